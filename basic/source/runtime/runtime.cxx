@@ -1299,6 +1299,31 @@ void SbiRuntime::StepNOP()
 void SbiRuntime::StepArith( SbxOperator eOp )
 {
     SbxVariableRef p1 = PopVar();
+
+    // Fast path for numeric code with declared Double variables: compute on the values
+    // directly, without copying the operand variable into a temporary and without the
+    // generic conversions of SbxValue::Compute
+    SbxVariable* pTOS = GetTOS();
+    if( ( eOp == SbxPLUS || eOp == SbxMINUS || eOp == SbxMUL )
+        && p1->GetFullType() == SbxDOUBLE && pTOS->GetFullType() == SbxDOUBLE
+        && !p1->IsBroadcaster() && !pTOS->IsBroadcaster()
+        && p1->CanRead() && pTOS->CanRead() )
+    {
+        const double fL = pTOS->GetDouble();
+        const double fR = p1->GetDouble();
+        const double fResult = eOp == SbxPLUS ? fL + fR : eOp == SbxMINUS ? fL - fR : fL * fR;
+        SbxVariable* pResult = pTOS;
+        if( pResult->GetRefCount() != 1 || !pResult->CanWrite() )
+        {
+            pResult = new SbxVariable( SbxDOUBLE );
+            refExprStk->Put( pResult, nExprLvl - 1 );
+        }
+        pResult->ResetFlag( SbxFlagBits::Fixed );
+        pResult->PutDouble( fResult );
+        checkArithmeticOverflow( fResult );
+        return;
+    }
+
     TOSMakeTemp();
     SbxVariable* p2 = GetTOS();
 
@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <new>
 #include <utility>
 #include <vector>
@@ -29,6 +30,7 @@
 #include <com/sun/star/uno/RuntimeException.hpp>
 #include <com/sun/star/uno/Sequence.hxx>
 #include <cppu/unotype.hxx>
+#include <o3tl/safeint.hxx>
 #include <rtl/byteseq.hxx>
 #include <rtl/ref.hxx>
 #include <rtl/textcvt.h>
@@ -437,6 +439,94 @@ BinaryAny Unmarshal::readSequence(css::uno::TypeDescription const & type) {
         sal_Sequence * p = s.getHandle();
         return BinaryAny(type, &p);
     }
+    switch (ctd.get()->eTypeClass) {
+    case typelib_TypeClass_BOOLEAN:
+    case typelib_TypeClass_SHORT:
+    case typelib_TypeClass_UNSIGNED_SHORT:
+    case typelib_TypeClass_CHAR:
+    case typelib_TypeClass_LONG:
+    case typelib_TypeClass_UNSIGNED_LONG:
+    case typelib_TypeClass_FLOAT:
+    case typelib_TypeClass_HYPER:
+    case typelib_TypeClass_UNSIGNED_HYPER:
+    case typelib_TypeClass_DOUBLE:
+        {
+            // Fixed size elements have the same size on the wire as in
+            // memory, so they can be read straight into the sequence instead
+            // of going through a BinaryAny per element:
+            sal_Int32 const elemSize = ctd.get()->nSize;
+            assert(elemSize == 1 || elemSize == 2 || elemSize == 4 || elemSize == 8);
+            if (static_cast< sal_uInt64 >(n) * elemSize
+                > o3tl::make_unsigned(end_ - data_))
+            {
+                throw css::io::IOException(
+                    u"binaryurp::Unmarshal: trying to read past end of block"_ustr);
+            }
+            void * buf = allocate(
+                SAL_SEQUENCE_HEADER_SIZE + static_cast< sal_Size >(n) * elemSize);
+            static_cast< sal_Sequence * >(buf)->nRefCount = 0;
+            static_cast< sal_Sequence * >(buf)->nElements =
+                static_cast< sal_Int32 >(n);
+            char * p = static_cast< sal_Sequence * >(buf)->elements;
+            for (sal_uInt32 i = 0; i != n; ++i, p += elemSize) {
+                switch (elemSize) {
+                case 1:
+                    {
+                        sal_uInt8 v = read8();
+                        if (v > 1) {
+                            std::free(buf);
+                            throw css::io::IOException(
+                                u"binaryurp::Unmarshal: boolean of unknown value"_ustr);
+                        }
+                        std::memcpy(p, &v, 1);
+                        break;
+                    }
+                case 2:
+                    {
+                        sal_uInt16 v = read16();
+                        std::memcpy(p, &v, 2);
+                        break;
+                    }
+                case 4:
+                    {
+                        sal_uInt32 v = read32();
+                        std::memcpy(p, &v, 4);
+                        break;
+                    }
+                default:
+                    {
+                        sal_uInt64 v = read64();
+                        std::memcpy(p, &v, 8);
+                        break;
+                    }
+                }
+            }
+            return BinaryAny(type, &buf);
+        }
+    case typelib_TypeClass_STRING:
+        {
+            std::vector< OUString > ss;
+            ss.reserve(n);
+            for (sal_uInt32 i = 0; i != n; ++i) {
+                ss.push_back(readString());
+            }
+            void * buf = allocate(
+                SAL_SEQUENCE_HEADER_SIZE
+                + static_cast< sal_Size >(n) * sizeof (rtl_uString *));
+            static_cast< sal_Sequence * >(buf)->nRefCount = 0;
+            static_cast< sal_Sequence * >(buf)->nElements =
+                static_cast< sal_Int32 >(n);
+            rtl_uString ** p = reinterpret_cast< rtl_uString ** >(
+                static_cast< sal_Sequence * >(buf)->elements);
+            for (sal_uInt32 i = 0; i != n; ++i) {
+                p[i] = ss[i].pData;
+                rtl_uString_acquire(p[i]);
+            }
+            return BinaryAny(type, &buf);
+        }
+    default:
+        break;
+    }
     std::vector< BinaryAny > as;
     as.reserve(n);
     for (sal_uInt32 i = 0; i != n; ++i) {
@@ -74,7 +74,7 @@ Writer::Item::Item(
 
 Writer::Writer(rtl::Reference< Bridge > const  & bridge):
     Thread("binaryurpWriter"), bridge_(bridge), marshal_(bridge, state_),
-    stop_(false)
+    blockMessages_(0), blockReplies_(0), stop_(false)
 {
     assert(bridge.is());
 }
@@ -89,6 +89,7 @@ void Writer::sendDirectRequest(
     sendRequest(
         tid, oid, type, member, inArguments, false,
         css::uno::UnoInterfaceReference());
+    flushMessages();
 }
 
 void Writer::sendDirectReply(
@@ -98,6 +99,7 @@ void Writer::sendDirectReply(
 {
     assert(!unblocked_.check());
     sendReply(tid, member, false, exception, returnValue,outArguments);
+    flushMessages();
 }
 
 void Writer::queueRequest(
@@ -148,36 +150,38 @@ void Writer::execute() {
         unblocked_.wait();
         for (;;) {
             items_.wait();
-            Item item;
+            // Take everything that is queued, so that it can go out as a
+            // single block with a single write to the connection:
+            std::deque< Item > items;
             {
                 std::lock_guard g(mutex_);
                 if (stop_) {
                     return;
                 }
                 assert(!queue_.empty());
-                item = queue_.front();
-                queue_.pop_front();
-                if (queue_.empty()) {
-                    items_.reset();
-                }
+                items.swap(queue_);
+                items_.reset();
             }
-            if (item.request) {
-                sendRequest(
-                    item.tid, item.oid, item.type, item.member, item.arguments,
-                    (item.oid != "UrpProtocolProperties" &&
-                     !item.member.equals(
-                         css::uno::TypeDescription(
-                             u"com.sun.star.uno.XInterface::release"_ustr)) &&
-                     bridge_->isCurrentContextMode()),
-                    item.currentContext);
-            } else {
-                sendReply(
-                    item.tid, item.member, item.setter, item.exception,
-                    item.returnValue, item.arguments);
-                if (item.setCurrentContextMode) {
-                    bridge_->setCurrentContextMode();
+            for (Item const & item : items) {
+                if (item.request) {
+                    sendRequest(
+                        item.tid, item.oid, item.type, item.member, item.arguments,
+                        (item.oid != "UrpProtocolProperties" &&
+                         !item.member.equals(
+                             css::uno::TypeDescription(
+                                 u"com.sun.star.uno.XInterface::release"_ustr)) &&
+                         bridge_->isCurrentContextMode()),
+                        item.currentContext);
+                } else {
+                    sendReply(
+                        item.tid, item.member, item.setter, item.exception,
+                        item.returnValue, item.arguments);
+                    if (item.setCurrentContextMode) {
+                        bridge_->setCurrentContextMode();
+                    }
                 }
             }
+            flushMessages();
         }
     } catch (const css::uno::Exception & e) {
         SAL_INFO("binaryurp", "caught " << e);
@@ -333,7 +337,7 @@ void Writer::sendRequest(
         assert(false); // this cannot happen
         break;
     }
-    sendMessage(buf);
+    sendMessage(std::move(buf));
     lastType_ = std::move(t);
     lastOid_ = oid;
     lastTid_ = tid;
@@ -401,22 +405,43 @@ void Writer::sendReply(
             break;
         }
     }
-    sendMessage(buf);
+    sendMessage(std::move(buf));
     lastTid_ = tid;
-    bridge_->decrementCalls();
+    ++blockReplies_;
 }
 
-void Writer::sendMessage(std::vector< unsigned char > const & buffer) {
-    std::vector< unsigned char > header;
+void Writer::sendMessage(std::vector< unsigned char > && buffer) {
     if (buffer.size() > SAL_MAX_UINT32) {
         throw css::uno::RuntimeException(
             u"message too large for URP"_ustr);
     }
-    Marshal::write32(&header, static_cast< sal_uInt32 >(buffer.size()));
-    Marshal::write32(&header, 1);
     assert(!buffer.empty());
-    unsigned char const * p = buffer.data();
-    std::vector< unsigned char >::size_type n = buffer.size();
+    if (!block_.empty() && block_.size() + buffer.size() > SAL_MAX_UINT32) {
+        flushMessages();
+    }
+    if (block_.empty()) {
+        // Avoid copying the (potentially large) marshalled data once more for
+        // the common case of a block with a single message:
+        block_.swap(buffer);
+    } else {
+        block_.insert(block_.end(), buffer.begin(), buffer.end());
+    }
+    ++blockMessages_;
+}
+
+void Writer::flushMessages() {
+    if (blockMessages_ == 0) {
+        return;
+    }
+    SAL_INFO(
+        "binaryurp",
+        "writing block of " << blockMessages_ << " messages, " << block_.size()
+            << " bytes");
+    std::vector< unsigned char > header;
+    Marshal::write32(&header, static_cast< sal_uInt32 >(block_.size()));
+    Marshal::write32(&header, blockMessages_);
+    unsigned char const * p = block_.data();
+    std::vector< unsigned char >::size_type n = block_.size();
     assert(header.size() <= SAL_MAX_INT32);
     /*static_*/assert(SAL_MAX_INT32 <= std::numeric_limits<std::size_t>::max());
     std::size_t k = SAL_MAX_INT32 - header.size();
@@ -447,6 +472,13 @@ void Writer::sendMessage(std::vector< unsigned char > const & buffer) {
         }
         s.realloc(k);
     }
+    block_.clear();
+    blockMessages_ = 0;
+    // Only now that the replies are actually written may the bridge consider
+    // the calls as done (and e.g. terminate):
+    for (; blockReplies_ != 0; --blockReplies_) {
+        bridge_->decrementCalls();
+    }
 }
 
 }
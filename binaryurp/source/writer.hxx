@@ -97,7 +97,11 @@ private:
         bool exception, BinaryAny const & returnValue,
         std::vector< BinaryAny > const & outArguments);
 
-    void sendMessage(std::vector< unsigned char > const & buffer);
+    // Adds the message to the current block, which is only written by
+    // flushMessages:
+    void sendMessage(std::vector< unsigned char > && buffer);
+
+    void flushMessages();
 
     struct Item {
         Item();
@@ -137,6 +141,9 @@ private:
     css::uno::TypeDescription lastType_;
     OUString lastOid_;
     rtl::ByteSequence lastTid_;
+    std::vector< unsigned char > block_;
+    sal_uInt32 blockMessages_;
+    sal_uInt32 blockReplies_;
     osl::Condition unblocked_;
     osl::Condition items_;
 
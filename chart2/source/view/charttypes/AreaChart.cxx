@@ -43,6 +43,8 @@
 #include <officecfg/Office/Compatibility.hxx>
 #include <officecfg/Office/Chart.hxx>
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 
 namespace chart
@@ -207,6 +209,52 @@ static void lcl_removeDuplicatePoints( std::vector<std::vector<css::drawing::Pos
     rPolyPoly = std::move(aTmp);
 }
 
+/** Reduces polygons with far more points than the x resolution (the pixel columns of the
+    diagram) to the first, lowest, highest and last point of each run of points within one
+    column, which draws the same line at output resolution.
+*/
+static void lcl_decimatePolygons( std::vector<std::vector<css::drawing::Position3D>>& rPolyPoly, const PlottingPositionHelper& rPosHelper )
+{
+    const size_t nMaxPointCount = 4 * static_cast<size_t>(std::max<sal_Int32>(rPosHelper.getXResolution(), 1));
+    for (std::vector<css::drawing::Position3D>& rPoly : rPolyPoly)
+    {
+        const size_t nPointCount = rPoly.size();
+        if (nPointCount <= nMaxPointCount)
+            continue;
+
+        std::vector<css::drawing::Position3D> aDecimated;
+        aDecimated.reserve(nMaxPointCount);
+        size_t nRunStart = 0;
+        while (nRunStart < nPointCount)
+        {
+            const double fColumn = rPosHelper.getXResolutionColumn(rPoly[nRunStart].PositionX);
+            size_t nMin = nRunStart;
+            size_t nMax = nRunStart;
+            size_t nRunEnd = nRunStart + 1;
+            while (nRunEnd < nPointCount
+                   && rPosHelper.getXResolutionColumn(rPoly[nRunEnd].PositionX) == fColumn)
+            {
+                if (rPoly[nRunEnd].PositionY < rPoly[nMin].PositionY)
+                    nMin = nRunEnd;
+                if (rPoly[nRunEnd].PositionY > rPoly[nMax].PositionY)
+                    nMax = nRunEnd;
+                ++nRunEnd;
+            }
+
+            // keep the original order of the points, without duplicates
+            size_t aKeep[] = { nRunStart, nMin, nMax, nRunEnd - 1 };
+            std::sort(std::begin(aKeep), std::end(aKeep));
+            for (size_t i = 0; i < std::size(aKeep); ++i)
+            {
+                if (i == 0 || aKeep[i] != aKeep[i - 1])
+                    aDecimated.push_back(rPoly[aKeep[i]]);
+            }
+            nRunStart = nRunEnd;
+        }
+        rPoly = std::move(aDecimated);
+    }
+}
+
 bool AreaChart::create_stepped_line(
         std::vector<std::vector<css::drawing::Position3D>> aStartPoly,
         chart2::CurveStyle eCurveStyle,
@@ -356,7 +404,15 @@ bool AreaChart::impl_createLine( VDataSeries* pSeries
     else
     { // default to creating a straight line
         SAL_WARN_IF(m_eCurveStyle != CurveStyle_LINES, "chart2.areachart", "Unknown curve style");
-        Clipping::clipPolygonAtRectangle( *pSeriesPoly, pPosHelper->getScaledLogicClipDoubleRect(), aPoly );
+        if (m_nDimension != 3)
+        {
+            // big data: don't create a line shape with many points per pixel column
+            std::vector<std::vector<css::drawing::Position3D>> aDecimatedPoly(*pSeriesPoly);
+            lcl_decimatePolygons( aDecimatedPoly, *pPosHelper );
+            Clipping::clipPolygonAtRectangle( aDecimatedPoly, pPosHelper->getScaledLogicClipDoubleRect(), aPoly );
+        }
+        else
+            Clipping::clipPolygonAtRectangle( *pSeriesPoly, pPosHelper->getScaledLogicClipDoubleRect(), aPoly );
     }
 
     if(!ShapeFactory::hasPolygonAnyLines(aPoly))
@@ -20,6 +20,7 @@
 
 #include <sal/config.h>
 
+#include <cmath>
 #include <memory>
 
 #include <chartview/ExplicitScaleValues.hxx>
@@ -98,6 +99,9 @@ public:
     inline void   setCoordinateSystemResolution( const css::uno::Sequence< sal_Int32 >& rCoordinateSystemResolution );
     inline bool   isSameForGivenResolution( double fX, double fY, double fZ
                                 , double fX2, double fY2, double fZ2 );
+    sal_Int32     getXResolution() const { return m_nXResolution; }
+    /// column of the x resolution the already scaled fX falls into (NaN for invalid values)
+    inline double getXResolutionColumn( double fX ) const;
 
     inline bool   isStrongLowerRequested( sal_Int32 nDimensionIndex ) const;
     inline bool   isLogicVisible( double fX, double fY, double fZ ) const;
@@ -319,6 +323,21 @@ bool PlottingPositionHelper::isSameForGivenResolution( double fX, double fY, dou
     return (bSameX && bSameY && bSameZ);
 }
 
+double PlottingPositionHelper::getXResolutionColumn( double fX ) const
+{
+    double fScaledMinX = getLogicMinX();
+    double fScaledMinY = getLogicMinY();
+    double fScaledMinZ = getLogicMinZ();
+    double fScaledMaxX = getLogicMaxX();
+    double fScaledMaxY = getLogicMaxY();
+    double fScaledMaxZ = getLogicMaxZ();
+
+    doLogicScaling( &fScaledMinX, &fScaledMinY, &fScaledMinZ );
+    doLogicScaling( &fScaledMaxX, &fScaledMaxY, &fScaledMaxZ );
+
+    return std::floor(m_nXResolution*(fX - fScaledMinX)/(fScaledMaxX-fScaledMinX));
+}
+
 bool PlottingPositionHelper::isStrongLowerRequested( sal_Int32 nDimensionIndex ) const
 {
     if( m_aScales.empty() )
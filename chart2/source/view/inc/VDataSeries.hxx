@@ -215,7 +215,7 @@ private: //member
     mutable double m_fXMeanValue;
     mutable double m_fYMeanValue;
 
-    css::uno::Sequence<sal_Int32>    m_aAttributedDataPointIndexList;
+    css::uno::Sequence<sal_Int32>    m_aAttributedDataPointIndexList; // sorted
 
     css::chart2::StackingDirection     m_eStackingDirection;
 
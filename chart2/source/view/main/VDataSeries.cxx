@@ -17,6 +17,7 @@
  *   the License at http://www.apache.org/licenses/LICENSE-2.0 .
  */
 
+#include <algorithm>
 #include <limits>
 #include <VDataSeries.hxx>
 #include <DataSeries.hxx>
@@ -231,6 +232,9 @@ VDataSeries::VDataSeries( const rtl::Reference< DataSeries >& xDataSeries )
     {
         // "AttributedDataPoints"
         xDataSeries->getFastPropertyValue(PROP_DATASERIES_ATTRIBUTED_DATA_POINTS) >>= m_aAttributedDataPointIndexList;
+        // sorted for the binary search in isAttributedDataPoint, which runs several times per point
+        auto aAttributedRange = asNonConstRange(m_aAttributedDataPointIndexList);
+        std::sort(aAttributedRange.begin(), aAttributedRange.end());
 
         xDataSeries->getFastPropertyValue(PROP_DATASERIES_STACKING_DIRECTION) >>= m_eStackingDirection; // "StackingDirection"
 
@@ -905,12 +909,8 @@ bool VDataSeries::isAttributedDataPoint( sal_Int32 index ) const
     //returns true if the data point assigned by the given index has set its own properties
     if( index>=m_nPointCount || m_nPointCount==0)
         return false;
-    for(sal_Int32 n : m_aAttributedDataPointIndexList)
-    {
-        if(index == n)
-            return true;
-    }
-    return false;
+    return std::binary_search(m_aAttributedDataPointIndexList.begin(),
+                              m_aAttributedDataPointIndexList.end(), index);
 }
 
 bool VDataSeries::isVaryColorsByPoint() const
@@ -31,6 +31,7 @@ public:
     void testTasksInThreads();
     void testNoThreads();
     void testDedicatedPool();
+    void testNestedTasks();
 
     CPPUNIT_TEST_SUITE(ThreadPoolTest);
     CPPUNIT_TEST(testPreferredConcurrency);
@@ -38,6 +39,7 @@ public:
     CPPUNIT_TEST(testTasksInThreads);
     CPPUNIT_TEST(testNoThreads);
     CPPUNIT_TEST(testDedicatedPool);
+    CPPUNIT_TEST(testNestedTasks);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -166,6 +168,46 @@ void ThreadPoolTest::testDedicatedPool()
     pool.waitUntilDone(pTag);
 }
 
+namespace
+{
+class NestedTask : public comphelper::ThreadTask
+{
+    comphelper::ThreadPool& mrPool;
+    std::shared_ptr<comphelper::ThreadTaskTag> mpTag;
+    int mnChildren;
+
+public:
+    NestedTask(comphelper::ThreadPool& rPool,
+               const std::shared_ptr<comphelper::ThreadTaskTag>& pTag, int nChildren)
+        : ThreadTask(pTag)
+        , mrPool(rPool)
+        , mpTag(pTag)
+        , mnChildren(nChildren)
+    {
+    }
+    virtual void doWork()
+    {
+        ++count;
+        for (int i = 0; i < mnChildren; ++i)
+            mrPool.pushTask(std::make_unique<NestedTask>(mrPool, mpTag, 0));
+    }
+    static inline std::atomic<int> count = 0;
+};
+} // namespace
+
+void ThreadPoolTest::testNestedTasks()
+{
+    // Tasks pushed from inside tasks are queued with their worker, they must
+    // still all be done before the tag is.
+    comphelper::ThreadPool pool(4);
+    std::shared_ptr<comphelper::ThreadTaskTag> pTag = comphelper::ThreadPool::createThreadTaskTag();
+    for (int i = 0; i < 4; ++i)
+        pool.pushTask(std::make_unique<NestedTask>(pool, pTag, 100));
+    pool.waitUntilDone(pTag);
+    CPPUNIT_ASSERT_EQUAL(404, NestedTask::count.load());
+    CPPUNIT_ASSERT(pool.isIdle());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(ThreadPoolTest);
 
 CPPUNIT_PLUGIN_IMPLEMENT();
@@ -14,8 +14,11 @@
 #include <memory>
 #include <mutex>
 #include <string_view>
+#include <unordered_map>
 
 #include <com/sun/star/beans/PropertyAttribute.hpp>
+#include <com/sun/star/beans/XPropertyChangeListener.hpp>
+#include <com/sun/star/beans/XPropertySet.hpp>
 #include <com/sun/star/configuration/ReadOnlyAccess.hpp>
 #include <com/sun/star/configuration/ReadWriteAccess.hpp>
 #include <com/sun/star/configuration/XReadWriteAccess.hpp>
@@ -30,6 +33,7 @@
 #include <comphelper/solarmutex.hxx>
 #include <comphelper/configuration.hxx>
 #include <comphelper/configurationlistener.hxx>
+#include <cppuhelper/implbase.hxx>
 #include <rtl/ustring.hxx>
 #include <sal/log.hxx>
 #include <i18nlangtag/languagetag.hxx>
@@ -125,34 +129,104 @@ bool comphelper::detail::ConfigurationWrapper::isReadOnly(OUString const & path)
         != 0;
 }
 
+namespace {
+
+// Cache the configuration access and the values read through it, since some of the keys are used
+// in hot code.
+// Note that this cache is only used by the officecfg:: auto-generated code, using it for anything
+// else would be unwise because the cache could end up containing stale entries.
+struct CachedAccess
+{
+    css::uno::Reference< css::container::XNameAccess > access;
+    /// Only filled for group nodes, where changes are notified to ValueCacheInvalidator.
+    bool cacheValues = false;
+    std::unordered_map<OUString, css::uno::Any> values;
+};
+
+std::mutex& getAccessMapMutex()
+{
+    static std::mutex gMutex;
+    return gMutex;
+}
+
+std::map<OUString, CachedAccess>& getAccessMap()
+{
+    static std::map<OUString, CachedAccess> gAccessMap;
+    return gAccessMap;
+}
+
+/// Drops the cached values of a group when configmgr reports them as changed.
+class ValueCacheInvalidator : public cppu::WeakImplHelper<css::beans::XPropertyChangeListener>
+{
+    OUString maParentPath;
+
+public:
+    explicit ValueCacheInvalidator(OUString aParentPath)
+        : maParentPath(std::move(aParentPath))
+    {
+    }
+
+    virtual void SAL_CALL propertyChange(css::beans::PropertyChangeEvent const & rEvt) override
+    {
+        std::scoped_lock aGuard(getAccessMapMutex());
+        auto it = getAccessMap().find(maParentPath);
+        if (it != getAccessMap().end())
+            it->second.values.erase(rEvt.PropertyName);
+    }
+
+    virtual void SAL_CALL disposing(css::lang::EventObject const &) override
+    {
+        std::scoped_lock aGuard(getAccessMapMutex());
+        auto it = getAccessMap().find(maParentPath);
+        if (it != getAccessMap().end())
+        {
+            it->second.cacheValues = false;
+            it->second.values.clear();
+        }
+    }
+};
+
+}
+
 css::uno::Any comphelper::detail::ConfigurationWrapper::getPropertyValue(std::u16string_view path) const
 {
     // should be short-circuited in ConfigurationProperty::get()
     assert(!comphelper::IsFuzzing());
 
-    // Cache the configuration access, since some of the keys are used in hot code.
-    // Note that this cache is only used by the officecfg:: auto-generated code, using it for anything
-    // else would be unwise because the cache could end up containing stale entries.
-    static std::mutex gMutex;
-    static std::map<OUString, css::uno::Reference< css::container::XNameAccess >> gAccessMap;
-
     sal_Int32 idx = path.rfind('/');
     assert(idx!=-1);
     OUString parentPath(path.substr(0, idx));
     OUString childName(path.substr(idx+1));
 
-    std::scoped_lock aGuard(gMutex);
+    std::scoped_lock aGuard(getAccessMapMutex());
+    auto& rAccessMap = getAccessMap();
 
     // check cache
-    auto it = gAccessMap.find(parentPath);
-    if (it == gAccessMap.end())
+    auto it = rAccessMap.find(parentPath);
+    if (it == rAccessMap.end())
     {
         // not in the cache, look it up
-        css::uno::Reference<css::container::XNameAccess> access(
-            access_->getByHierarchicalName(parentPath), css::uno::UNO_QUERY_THROW);
-        it = gAccessMap.emplace(parentPath, access).first;
+        CachedAccess aCached;
+        aCached.access.set(access_->getByHierarchicalName(parentPath), css::uno::UNO_QUERY_THROW);
+        // Values of groups can be cached as well, as long as we are told about changes. Any
+        // notification is sent by configmgr outside of its lock, so taking our mutex there is fine.
+        css::uno::Reference<css::beans::XPropertySet> xGroup(aCached.access, css::uno::UNO_QUERY);
+        if (xGroup)
+        {
+            xGroup->addPropertyChangeListener(u""_ustr, new ValueCacheInvalidator(parentPath));
+            aCached.cacheValues = true;
+        }
+        it = rAccessMap.emplace(parentPath, std::move(aCached)).first;
     }
-    return it->second->getByName(childName);
+
+    CachedAccess& rCached = it->second;
+    if (!rCached.cacheValues)
+        return rCached.access->getByName(childName);
+
+    auto itValue = rCached.values.find(childName);
+    if (itValue == rCached.values.end())
+        itValue = rCached.values.emplace(childName, rCached.access->getByName(childName)).first;
+    return itValue->second;
 }
 
 void comphelper::detail::ConfigurationWrapper::setPropertyValue(
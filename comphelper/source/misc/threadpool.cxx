@@ -21,6 +21,7 @@
 #include <chrono>
 #include <cstddef>
 #include <comphelper/debuggerinfo.hxx>
+#include <deque>
 #include <utility>
 
 #if defined HAVE_VALGRIND_HEADERS
@@ -30,6 +31,9 @@
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#elif defined LINUX
+#include <pthread.h>
+#include <sched.h>
 #endif
 
 namespace comphelper {
@@ -39,6 +43,10 @@ namespace comphelper {
 static thread_local bool gbIsWorkerThread;
 #endif
 
+/** the pool and queue of the worker running on this thread, if any */
+static thread_local const ThreadPool* gpWorkerPool;
+static thread_local std::size_t gnWorkerQueue;
+
 // used to group thread-tasks for waiting in waitTillDone()
 class ThreadTaskTag
 {
@@ -55,14 +63,71 @@ public:
 };
 
 
+struct ThreadPool::WorkQueue
+{
+    std::mutex maMutex;
+    std::deque< std::unique_ptr<ThreadTask> > maTasks;
+};
+
+namespace {
+
+/// bind the calling thread to the nWorker-th CPU the process may use
+void pinWorkerThread(std::size_t nWorker)
+{
+#if defined LINUX
+    cpu_set_t aAllowed;
+    if (sched_getaffinity(0, sizeof(aAllowed), &aAllowed) != 0)
+        return;
+    const int nAllowed = CPU_COUNT(&aAllowed);
+    if (nAllowed == 0)
+        return;
+    int nSkip = static_cast<int>(nWorker % nAllowed);
+    for (int nCpu = 0; nCpu < CPU_SETSIZE; ++nCpu)
+    {
+        if (!CPU_ISSET(nCpu, &aAllowed) || nSkip-- > 0)
+            continue;
+        cpu_set_t aSet;
+        CPU_ZERO(&aSet);
+        CPU_SET(nCpu, &aSet);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(aSet), &aSet) != 0)
+            SAL_WARN("comphelper", "cannot bind thread pool worker to CPU " << nCpu);
+        return;
+    }
+#elif defined _WIN32
+    DWORD_PTR nProcessMask, nSystemMask;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &nProcessMask, &nSystemMask))
+        return;
+    std::size_t nAllowed = 0;
+    for (DWORD_PTR nMask = nProcessMask; nMask; nMask &= nMask - 1)
+        ++nAllowed;
+    if (nAllowed == 0)
+        return;
+    std::size_t nSkip = nWorker % nAllowed;
+    for (DWORD_PTR nMask = nProcessMask; nMask; nMask &= nMask - 1)
+    {
+        if (nSkip-- > 0)
+            continue;
+        if (!SetThreadAffinityMask(GetCurrentThread(), nMask & ~(nMask - 1)))
+            SAL_WARN("comphelper", "cannot bind thread pool worker to a CPU");
+        return;
+    }
+#else
+    (void)nWorker;
+#endif
+}
+
+}
+
 class ThreadPool::ThreadWorker : public salhelper::Thread
 {
     ThreadPool *mpPool;
+    std::size_t mnQueue;
 public:
 
-    explicit ThreadWorker( ThreadPool *pPool ) :
+    explicit ThreadWorker( ThreadPool *pPool, std::size_t nQueue ) :
         salhelper::Thread("thread-pool"),
-        mpPool( pPool )
+        mpPool( pPool ),
+        mnQueue( nQueue )
     {
     }
 
@@ -71,25 +136,42 @@ public:
 #if defined DBG_UTIL && (defined LINUX || defined _WIN32)
         gbIsWorkerThread = true;
 #endif
-        std::unique_lock< std::mutex > aGuard( mpPool->maMutex );
+        gpWorkerPool = mpPool;
+        gnWorkerQueue = mnQueue;
 
-        while( !mpPool->mbTerminate )
+        static const bool bPinWorkers = getenv("PIN_THREADPOOL_WORKERS") != nullptr;
+        if (bPinWorkers)
+            pinWorkerThread(mnQueue);
+
+        for (;;)
         {
-            std::unique_ptr<ThreadTask> pTask = mpPool->popWorkLocked( aGuard, true );
+            std::unique_ptr<ThreadTask> pTask = mpPool->popWork( mnQueue );
             if( pTask )
             {
                 std::shared_ptr<ThreadTaskTag> pTag(pTask->mpTag);
-                mpPool->incBusyWorker();
-                aGuard.unlock();
 
                 pTask->exec();
                 pTask.reset();
 
-                aGuard.lock();
                 mpPool->decBusyWorker();
                 pTag->onTaskWorkerDone();
+                continue;
             }
+
+            // Announce going to sleep before checking for tasks, pushTask()
+            // increments the task count before checking for sleeping workers.
+            std::unique_lock< std::mutex > aGuard( mpPool->maMutex );
+            ++mpPool->mnSleepingWorkers;
+            while( mpPool->mnQueuedTasks == 0 && !mpPool->mbTerminate )
+                mpPool->maTasksChanged.wait( aGuard );
+            --mpPool->mnSleepingWorkers;
+
+            // Finish all queued tasks before terminating.
+            if( mpPool->mnQueuedTasks == 0 )
+                break;
         }
+
+        gpWorkerPool = nullptr;
     }
 };
 
@@ -97,7 +179,15 @@ ThreadPool::ThreadPool(std::size_t nWorkers)
     : mbTerminate(true)
     , mnMaxWorkers(nWorkers)
     , mnBusyWorkers(0)
+    , mnQueuedTasks(0)
+    , mnSleepingWorkers(0)
+    , mnWorkers(0)
+    , mnNextQueue(0)
 {
+    // Without workers tasks are run in-line from a single queue.
+    maQueues.resize(std::max<std::size_t>(nWorkers, 1));
+    for (auto& rQueue : maQueues)
+        rQueue = std::make_unique<WorkQueue>();
 }
 
 ThreadPool::~ThreadPool()
@@ -107,7 +197,7 @@ ThreadPool::~ThreadPool()
     // so these asserts just print something to stderr but exit status is
     // still 0, but hopefully they will be more helpful on non-WNT platforms
     assert(mbTerminate);
-    assert(maTasks.empty());
+    assert(mnQueuedTasks == 0);
     assert(mnBusyWorkers == 0);
 }
 
@@ -168,33 +258,25 @@ void ThreadPool::shutdownLocked(std::unique_lock<std::mutex>& aGuard)
     if( maWorkers.empty() )
     { // no threads at all -> execute the work in-line
         std::unique_ptr<ThreadTask> pTask;
-        while ( ( pTask = popWorkLocked(aGuard, false) ) )
+        while ( ( pTask = popWork(0) ) )
         {
             std::shared_ptr<ThreadTaskTag> pTag(pTask->mpTag);
             pTask->exec();
+            decBusyWorker();
             pTag->onTaskWorkerDone();
         }
+        assert( mnQueuedTasks == 0 );
     }
-    else
-    {
-        while( !maTasks.empty() )
-        {
-            maTasksChanged.wait( aGuard );
-            // In the (unlikely but possible?) case pushTask() gets called meanwhile,
-            // its notify_one() call is meant to wake a up a thread and process the task.
-            // But if this code gets woken up instead, it could lead to a deadlock.
-            // Pass on the notification.
-            maTasksChanged.notify_one();
-        }
-    }
-    assert( maTasks.empty() );
 
+    // The workers only terminate once all queues have been emptied, joining
+    // them below waits for the queued tasks.
     mbTerminate = true;
 
     maTasksChanged.notify_all();
 
     decltype(maWorkers) aWorkers;
     std::swap(maWorkers, aWorkers);
+    mnWorkers = 0;
     aGuard.unlock();
 
     while (!aWorkers.empty())
@@ -212,40 +294,54 @@ void ThreadPool::shutdownLocked(std::unique_lock<std::mutex>& aGuard)
 
 void ThreadPool::pushTask( std::unique_ptr<ThreadTask> pTask )
 {
-    std::scoped_lock< std::mutex > aGuard( maMutex );
+    pTask->mpTag->onTaskPushed();
+
+    // Tasks pushed by a task stay with its worker, others are spread evenly.
+    const std::size_t nQueue = gpWorkerPool == this ? gnWorkerQueue
+                                                    : mnNextQueue++ % maQueues.size();
+    {
+        WorkQueue& rQueue = *maQueues[nQueue];
+        std::scoped_lock< std::mutex > aQueueGuard( rQueue.maMutex );
+        rQueue.maTasks.push_back( std::move(pTask) );
+        ++mnQueuedTasks;
+    }
 
-    mbTerminate = false;
+    // Once all workers are running the pool lock is needed only to wake one.
+    if (mnWorkers == mnMaxWorkers && mnSleepingWorkers == 0)
+        return;
 
-    // Worked on tasks are already removed from maTasks, so include the count of busy workers.
-    if (maWorkers.size() < mnMaxWorkers && maWorkers.size() <= maTasks.size() + mnBusyWorkers)
+    std::scoped_lock< std::mutex > aGuard( maMutex );
+
+    // Worked on tasks are no longer queued, so include the count of busy workers.
+    if (maWorkers.size() < mnMaxWorkers && maWorkers.size() < mnQueuedTasks + mnBusyWorkers)
     {
-        maWorkers.push_back( new ThreadWorker( this ) );
+        mbTerminate = false;
+        maWorkers.push_back( new ThreadWorker( this, maWorkers.size() % maQueues.size() ) );
+        mnWorkers = maWorkers.size();
         maWorkers.back()->launch();
     }
 
-    pTask->mpTag->onTaskPushed();
-    maTasks.insert( maTasks.begin(), std::move(pTask) );
-
     maTasksChanged.notify_one();
 }
 
-std::unique_ptr<ThreadTask> ThreadPool::popWorkLocked( std::unique_lock< std::mutex > & rGuard, bool bWait )
+std::unique_ptr<ThreadTask> ThreadPool::popWork( std::size_t nQueue )
 {
-    do
+    const std::size_t nQueues = maQueues.size();
+    for (std::size_t i = 0; i < nQueues && mnQueuedTasks != 0; ++i)
     {
-        if( !maTasks.empty() )
-        {
-            std::unique_ptr<ThreadTask> pTask = std::move(maTasks.back());
-            maTasks.pop_back();
-            return pTask;
-        }
-        else if (!bWait || mbTerminate)
-            return nullptr;
-
-        maTasksChanged.wait( rGuard );
-
-    } while (!mbTerminate);
-
+        WorkQueue& rQueue = *maQueues[(nQueue + i) % nQueues];
+        std::scoped_lock< std::mutex > aGuard( rQueue.maMutex );
+        if (rQueue.maTasks.empty())
+            continue;
+
+        std::unique_ptr<ThreadTask> pTask = std::move(rQueue.maTasks.front());
+        rQueue.maTasks.pop_front();
+        // Become busy before the task is no longer queued, so isIdle() never
+        // sees the task in neither state.
+        incBusyWorker();
+        --mnQueuedTasks;
+        return pTask;
+    }
     return nullptr;
 }
 
@@ -272,11 +368,12 @@ void ThreadPool::waitUntilDone(const std::shared_ptr<ThreadTaskTag>& rTag, bool
         { // no threads at all -> execute the work in-line
             while (!rTag->isDone())
             {
-                std::unique_ptr<ThreadTask> pTask = popWorkLocked(aGuard, false);
+                std::unique_ptr<ThreadTask> pTask = popWork(0);
                 if (!pTask)
                     break;
                 std::shared_ptr<ThreadTaskTag> pTag(pTask->mpTag);
                 pTask->exec();
+                decBusyWorker();
                 pTag->onTaskWorkerDone();
             }
         }
@@ -55,11 +55,7 @@ void TraceEvent::addInstantEvent(const char* sName, const std::map<OUString, OUS
 {
     long long nNow = getNow();
 
-    int nPid = 0;
-    oslProcessInfo aProcessInfo;
-    aProcessInfo.Size = sizeof(oslProcessInfo);
-    if (osl_getProcessInfo(nullptr, osl_Process_IDENTIFIER, &aProcessInfo) == osl_Process_E_None)
-        nPid = aProcessInfo.Ident;
+    int nPid = getPid();
 
     addRecording("{"
                  "\"name:\""
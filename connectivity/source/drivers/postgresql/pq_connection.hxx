@@ -50,6 +50,7 @@
 
 #include <rtl/ref.hxx>
 #include <rtl/byteseq.hxx>
+#include <o3tl/lru_map.hxx>
 
 #include <comphelper/refcountedmutex.hxx>
 
@@ -59,6 +60,7 @@
 
 #include <libpq-fe.h>
 #include <unordered_map>
+#include <vector>
 
 #include "pq_xtables.hxx"
 #include "pq_xviews.hxx"
@@ -73,7 +75,8 @@ struct ConnectionSettings
     ConnectionSettings() :
         pConnection(nullptr),
         maxNameLen(0),
-        maxIndexKeys(0)
+        maxIndexKeys(0),
+        parsedStatements(64)
     {}
     static const rtl_TextEncoding encoding = RTL_TEXTENCODING_UTF8;
     PGconn *pConnection;
@@ -87,6 +90,15 @@ struct ConnectionSettings
     rtl::Reference<Views> pViewsImpl;   // needed to implement renaming of tables / views
     OUString user;
     OUString catalog;
+
+    // the tokenized form of recently prepared statements, so that re-preparing
+    // the same SQL text on this connection does not scan it again
+    struct ParsedStatement
+    {
+        std::vector< OString > splittedStatement;
+        sal_Int32 parameterCount;
+    };
+    o3tl::lru_map< OString, ParsedStatement > parsedStatements;
 };
 
 
@@ -168,6 +168,14 @@ PreparedStatement::PreparedStatement(
     m_props[PREPARED_STATEMENT_RESULT_SET_TYPE] <<=
         css::sdbc::ResultSetType::SCROLL_INSENSITIVE;
 
+    auto it = m_pSettings->parsedStatements.find( m_stmt );
+    if( it != m_pSettings->parsedStatements.end() )
+    {
+        m_splittedStatement = it->second.splittedStatement;
+        m_vars = std::vector< OString >( it->second.parameterCount );
+        return;
+    }
+
     splitSQL( m_stmt, m_splittedStatement );
     int elements = 0;
     for(const OString & str : m_splittedStatement)
@@ -191,6 +199,8 @@ PreparedStatement::PreparedStatement(
         }
     }
     m_vars = std::vector< OString >( elements );
+    m_pSettings->parsedStatements.insert(
+        { m_stmt, { m_splittedStatement, sal_Int32( elements ) } } );
 }
 
 PreparedStatement::~PreparedStatement()
@@ -20,6 +20,7 @@
 
 #include <unordered_map>
 #include <cassert>
+#include <iterator>
 #include <list>
 #include <set>
 #include <utility>
@@ -163,13 +164,19 @@ struct TypeDescriptor_Init_Impl
     WeakMap_Impl maWeakMap;
     // all type description callbacks
     CallbackSet_Impl maCallbacks;
-    // A cache to hold descriptions
+    // A cache to hold descriptions, least recently used first
     TypeDescriptionList_Impl maCache;
+    // position of every cached description in maCache
+    std::unordered_map< typelib_TypeDescription *, TypeDescriptionList_Impl::iterator > maCachePos;
     // The mutex to guard all type library accesses
     Mutex      maMutex;
 
     inline void callChain( typelib_TypeDescription ** ppRet, rtl_uString * pName );
 
+    // the cache functions must be called with maMutex held
+    inline void addToCache( typelib_TypeDescription * pTD );
+    inline void touchCache( typelib_TypeDescription * pTD );
+
 #if OSL_DEBUG_LEVEL > 0
     // only for debugging
     sal_Int32 nTypeDescriptionCount = 0;
@@ -202,6 +209,33 @@ inline void TypeDescriptor_Init_Impl::callChain(
     }
 }
 
+inline void TypeDescriptor_Init_Impl::addToCache( typelib_TypeDescription * pTD )
+{
+    auto it = maCachePos.find( pTD );
+    if( it != maCachePos.end() )
+    {
+        maCache.splice( maCache.end(), maCache, it->second );
+        return;
+    }
+    if( maCache.size() >= nCacheSize )
+    {
+        maCachePos.erase( maCache.front() );
+        typelib_typedescription_release( maCache.front() );
+        maCache.pop_front();
+    }
+    // descriptions in the cache must be acquired!
+    typelib_typedescription_acquire( pTD );
+    maCache.push_back( pTD );
+    maCachePos.emplace( pTD, std::prev( maCache.end() ) );
+}
+
+inline void TypeDescriptor_Init_Impl::touchCache( typelib_TypeDescription * pTD )
+{
+    auto it = maCachePos.find( pTD );
+    if( it != maCachePos.end() )
+        maCache.splice( maCache.end(), maCache, it->second );
+}
+
 
 TypeDescriptor_Init_Impl::~TypeDescriptor_Init_Impl()
 {
@@ -436,14 +470,7 @@ bool complete(typelib_TypeDescription ** ppTypeDescr, bool initTables) {
 
         // insert into the cache
         MutexGuard aGuard( rInit.maMutex );
-        if( rInit.maCache.size() >= nCacheSize )
-        {
-            typelib_typedescription_release( rInit.maCache.front() );
-            rInit.maCache.pop_front();
-        }
-        // descriptions in the cache must be acquired!
-        typelib_typedescription_acquire( pTD );
-        rInit.maCache.push_back( pTD );
+        rInit.addToCache( pTD );
 
         OSL_ASSERT(
             pTD->bComplete
@@ -1906,6 +1933,8 @@ extern "C" void SAL_CALL typelib_typedescription_getByName(
         {
             typelib_typedescription_acquire( pTDR->pType );
             *ppRet = pTDR->pType;
+            // keep descriptions that are asked for again in the cache
+            rInit.touchCache( pTDR->pType );
         }
         }
         typelib_typedescriptionreference_release( pTDR );
@@ -1998,14 +2027,7 @@ extern "C" void SAL_CALL typelib_typedescription_getByName(
 
         // insert into the cache
         MutexGuard aGuard( rInit.maMutex );
-        if( rInit.maCache.size() >= nCacheSize )
-        {
-            typelib_typedescription_release( rInit.maCache.front() );
-            rInit.maCache.pop_front();
-        }
-        // descriptions in the cache must be acquired!
-        typelib_typedescription_acquire( *ppRet );
-        rInit.maCache.push_back( *ppRet );
+        rInit.addToCache( *ppRet );
     }
 }
 
@@ -2050,13 +2072,9 @@ extern "C" void SAL_CALL typelib_typedescriptionreference_new(
 
                 // insert into the cache
                 MutexGuard aGuard( rInit.maMutex );
-                if( rInit.maCache.size() >= nCacheSize )
-                {
-                    typelib_typedescription_release( rInit.maCache.front() );
-                    rInit.maCache.pop_front();
-                }
-                rInit.maCache.push_back( pRet );
-                // pRet kept acquired for cache
+                rInit.addToCache( pRet );
+                // the cache holds its own reference now
+                typelib_typedescription_release( pRet );
 
                 typelib_typedescriptionreference_acquire( pRet->pWeakRef );
                 if (*ppTDR)
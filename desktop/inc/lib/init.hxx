@@ -243,6 +243,15 @@ namespace desktop {
         // Flat_map is used in preference to unordered_map because the map is accessed very often.
         boost::container::flat_map<int, std::vector<PerViewIdData>> m_updatedTypesPerViewId; // key is view, index is type
 
+        /// Queue statistics, reported by dumpState().
+        sal_uInt64 m_nQueuedCallbacks = 0; // appended to the queue
+        sal_uInt64 m_nRemovedCallbacks = 0; // dropped from the queue, as superseded or merged
+        sal_uInt64 m_nFlushes = 0;
+        size_t m_nMaxQueueLength = 0;
+        sal_uInt32 m_nFlushScheduledTime = 0; // osl_getGlobalTimer() when the pending flush was posted
+        sal_uInt32 m_nLastFlushLatency = 0;
+        sal_uInt32 m_nMaxFlushLatency = 0;
+
         LibreOfficeKitDocument* m_pDocument;
         OString m_aViewRenderState;
         int m_viewId = -1; // view id of the associated SfxViewShell
@@ -183,6 +183,8 @@ public:
     void testRedlineWriter();
     void testRedlineCalc();
     void testPaintPartTile();
+    void testPaintPartTiles();
+    void testPaintTileDelta();
     void testPaintPartTileDifferentSchemes();
 #if HAVE_MORE_FONTS
     void testGetFontSubset();
@@ -263,6 +265,8 @@ public:
     CPPUNIT_TEST(testRedlineWriter);
     CPPUNIT_TEST(testRedlineCalc);
     CPPUNIT_TEST(testPaintPartTile);
+    CPPUNIT_TEST(testPaintPartTiles);
+    CPPUNIT_TEST(testPaintTileDelta);
     CPPUNIT_TEST(testPaintPartTileDifferentSchemes);
 #if HAVE_MORE_FONTS
     CPPUNIT_TEST(testGetFontSubset);
@@ -2472,6 +2476,69 @@ void DesktopLOKTest::testPaintPartTile()
     //CPPUNIT_ASSERT(aView1.m_bTilesInvalidated);
 }
 
+void DesktopLOKTest::testPaintPartTiles()
+{
+    // Given an impress doc of 2 slides, with the first slide being the current one:
+    LibLODocument_Impl* pDocument = loadDoc("2slides.odp");
+    pDocument->m_pDocumentClass->initializeForRendering(pDocument, "{}");
+
+    // When painting two tiles of the second slide in one go:
+    const int nCanvasSize = 256;
+    const int aTilePositions[] = { 0, 0, 3840, 0 };
+    std::vector<unsigned char> aBatch1(nCanvasSize * nCanvasSize * 4);
+    std::vector<unsigned char> aBatch2(nCanvasSize * nCanvasSize * 4);
+    unsigned char* pBuffers[] = { aBatch1.data(), aBatch2.data() };
+    pDocument->m_pDocumentClass->paintPartTiles(pDocument, pBuffers, 1, 0, nCanvasSize, nCanvasSize,
+                                                aTilePositions, 2, 3840, 3840);
+
+    // Then make sure the result is the same as painting them one by one:
+    std::vector<unsigned char> aSingle1(nCanvasSize * nCanvasSize * 4);
+    std::vector<unsigned char> aSingle2(nCanvasSize * nCanvasSize * 4);
+    pDocument->m_pDocumentClass->paintPartTile(pDocument, aSingle1.data(), 1, 0, nCanvasSize,
+                                               nCanvasSize, 0, 0, 3840, 3840);
+    pDocument->m_pDocumentClass->paintPartTile(pDocument, aSingle2.data(), 1, 0, nCanvasSize,
+                                               nCanvasSize, 3840, 0, 3840, 3840);
+    CPPUNIT_ASSERT(aBatch1 == aSingle1);
+    CPPUNIT_ASSERT(aBatch2 == aSingle2);
+    // And the current part is not changed:
+    CPPUNIT_ASSERT_EQUAL(0, pDocument->m_pDocumentClass->getPart(pDocument));
+}
+
+void DesktopLOKTest::testPaintTileDelta()
+{
+    // Given a painted tile:
+    LibLODocument_Impl* pDocument = loadDoc("2slides.odp");
+    pDocument->m_pDocumentClass->initializeForRendering(pDocument, "{}");
+    const int nCanvasSize = 256;
+    std::vector<unsigned char> aPixels(nCanvasSize * nCanvasSize * 4);
+    pDocument->m_pDocumentClass->paintTile(pDocument, aPixels.data(), nCanvasSize, nCanvasSize, 0,
+                                           0, 3840, 3840);
+    const std::vector<unsigned char> aExpected(aPixels);
+
+    // When painting it again as a delta:
+    int nX = -1, nY = -1, nWidth = -1, nHeight = -1;
+    bool bChanged = pDocument->m_pDocumentClass->paintTileDelta(
+        pDocument, aPixels.data(), nCanvasSize, nCanvasSize, 0, 0, 3840, 3840, &nX, &nY, &nWidth,
+        &nHeight);
+
+    // Then make sure nothing is reported as changed:
+    CPPUNIT_ASSERT(!bChanged);
+    CPPUNIT_ASSERT_EQUAL(0, nWidth);
+    CPPUNIT_ASSERT_EQUAL(0, nHeight);
+
+    // And when the client's copy differs in a single pixel, only that pixel is updated:
+    aPixels[(10 * nCanvasSize + 20) * 4] ^= 0xff;
+    bChanged = pDocument->m_pDocumentClass->paintTileDelta(pDocument, aPixels.data(), nCanvasSize,
+                                                           nCanvasSize, 0, 0, 3840, 3840, &nX, &nY,
+                                                           &nWidth, &nHeight);
+    CPPUNIT_ASSERT(bChanged);
+    CPPUNIT_ASSERT_EQUAL(20, nX);
+    CPPUNIT_ASSERT_EQUAL(10, nY);
+    CPPUNIT_ASSERT_EQUAL(1, nWidth);
+    CPPUNIT_ASSERT_EQUAL(1, nHeight);
+    CPPUNIT_ASSERT(aPixels == aExpected);
+}
+
 void DesktopLOKTest::testPaintTileOmitInvalidate()
 {
     // Given a painted tile:
@@ -4330,9 +4397,11 @@ void DesktopLOKTest::testABI()
     CPPUNIT_ASSERT_EQUAL(documentClassOffset(78), offsetof(LibreOfficeKitDocumentClass, setViewOption));
     CPPUNIT_ASSERT_EQUAL(documentClassOffset(79), offsetof(LibreOfficeKitDocumentClass, setColorPreviewState));
     CPPUNIT_ASSERT_EQUAL(documentClassOffset(80), offsetof(LibreOfficeKitDocumentClass, setAllowManageRedlines));
+    CPPUNIT_ASSERT_EQUAL(documentClassOffset(81), offsetof(LibreOfficeKitDocumentClass, paintPartTiles));
+    CPPUNIT_ASSERT_EQUAL(documentClassOffset(82), offsetof(LibreOfficeKitDocumentClass, paintTileDelta));
 
     // As above
-    CPPUNIT_ASSERT_EQUAL(documentClassOffset(81), sizeof(LibreOfficeKitDocumentClass));
+    CPPUNIT_ASSERT_EQUAL(documentClassOffset(83), sizeof(LibreOfficeKitDocumentClass));
 }
 
 CPPUNIT_TEST_SUITE_REGISTRATION(DesktopLOKTest);
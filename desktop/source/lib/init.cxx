@@ -16,6 +16,8 @@
 #include <config_cairo_rgba.h>
 #include <config_features.h>
 #include <config_vclplug.h>
+#include <editeng/acorrcfg.hxx>
+#include <editeng/svxacorr.hxx>
 #include <editeng/unolingu.hxx>
 
 #include <stdio.h>
@@ -53,6 +55,7 @@
 #endif
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <iostream>
 #include <string_view>
@@ -1340,6 +1343,20 @@ static void doc_setViewReadOnly(LibreOfficeKitDocument* pThis, int nId, const bo
 static void doc_setAllowChangeComments(LibreOfficeKitDocument* pThis, int nId, const bool allow);
 
 static void doc_setAllowManageRedlines(LibreOfficeKitDocument* pThis, int nId, bool allow);
+static void doc_paintPartTiles(LibreOfficeKitDocument* pThis,
+                               unsigned char** pBuffers,
+                               const int nPart,
+                               const int nMode,
+                               const int nCanvasWidth, const int nCanvasHeight,
+                               const int* pTilePositions, const int nTileCount,
+                               const int nTileWidth, const int nTileHeight);
+static bool doc_paintTileDelta(LibreOfficeKitDocument* pThis,
+                               unsigned char* pBuffer,
+                               const int nCanvasWidth, const int nCanvasHeight,
+                               const int nTilePosX, const int nTilePosY,
+                               const int nTileWidth, const int nTileHeight,
+                               int* pDirtyX, int* pDirtyY,
+                               int* pDirtyWidth, int* pDirtyHeight);
 
 static void doc_setAccessibilityState(LibreOfficeKitDocument* pThis, int nId, bool bEnabled);
 
@@ -1577,6 +1594,8 @@ LibLODocument_Impl::LibLODocument_Impl(uno::Reference <css::lang::XComponent> xC
 
         m_pDocumentClass->setAllowChangeComments = doc_setAllowChangeComments;
         m_pDocumentClass->setAllowManageRedlines = doc_setAllowManageRedlines;
+        m_pDocumentClass->paintPartTiles = doc_paintPartTiles;
+        m_pDocumentClass->paintTileDelta = doc_paintTileDelta;
 
         m_pDocumentClass->getPresentationInfo = doc_getPresentationInfo;
         m_pDocumentClass->createSlideRenderer = doc_createSlideRenderer;
@@ -1801,6 +1820,21 @@ void CallbackFlushHandler::dumpState(rtl::OStringBuffer &rState)
     rState.append(static_cast<sal_Int32>(m_viewId));
     rState.append("\n\tDisableCallbacks:\t");
     rState.append(static_cast<sal_Int32>(m_nDisableCallbacks));
+    rState.append("\n\tQueueLength:\t");
+    rState.append(static_cast<sal_Int64>(m_queue1.size()));
+    rState.append("\n\tMaxQueueLength:\t");
+    rState.append(static_cast<sal_Int64>(m_nMaxQueueLength));
+    rState.append("\n\tQueued:\t");
+    rState.append(static_cast<sal_Int64>(m_nQueuedCallbacks));
+    rState.append("\n\tRemoved:\t");
+    rState.append(static_cast<sal_Int64>(m_nRemovedCallbacks));
+    rState.append("\n\tFlushes:\t");
+    rState.append(static_cast<sal_Int64>(m_nFlushes));
+    rState.append("\n\tLastFlushLatency:\t");
+    rState.append(static_cast<sal_Int64>(m_nLastFlushLatency));
+    rState.append("ms\n\tMaxFlushLatency:\t");
+    rState.append(static_cast<sal_Int64>(m_nMaxFlushLatency));
+    rState.append("ms");
     rState.append("\n\tStates:\n");
     for (const auto &i : m_states)
     {
@@ -2107,6 +2141,8 @@ void CallbackFlushHandler::queue(const int type, CallbackData& aCallbackData)
     assert(aCallbackData.validate() && "Cached callback payload object and string mismatch!");
     m_queue1.emplace_back(type);
     m_queue2.emplace_back(aCallbackData);
+    ++m_nQueuedCallbacks;
+    m_nMaxQueueLength = std::max(m_nMaxQueueLength, m_queue1.size());
     SAL_INFO("lok", "Queued #" << (m_queue1.size() - 1) <<
              " [" << type << "]: [" << aCallbackData.getPayload() << "] to have " << m_queue1.size() << " entries.");
 
@@ -2511,6 +2547,8 @@ void CallbackFlushHandler::enqueueUpdatedType( int type, const SfxViewShell* vie
     CallbackData callbackData(*payload, viewId);
     m_queue1.emplace_back(type);
     m_queue2.emplace_back(callbackData);
+    ++m_nQueuedCallbacks;
+    m_nMaxQueueLength = std::max(m_nMaxQueueLength, m_queue1.size());
     SAL_INFO("lok", "Queued updated [" << type << "]: [" << callbackData.getPayload()
         << "] to have " << m_queue1.size() << " entries.");
 }
@@ -2536,6 +2574,14 @@ void CallbackFlushHandler::invoke()
     // Append messages for updated types, fetch them only now.
     enqueueUpdatedTypes();
 
+    ++m_nFlushes;
+    if (m_nFlushScheduledTime)
+    {
+        m_nLastFlushLatency = osl_getGlobalTimer() - m_nFlushScheduledTime;
+        m_nMaxFlushLatency = std::max(m_nMaxFlushLatency, m_nLastFlushLatency);
+        m_nFlushScheduledTime = 0;
+    }
+
     SAL_INFO("lok", "Flushing " << m_queue1.size() << " elements.");
     auto it1 = m_queue1.begin();
     auto it2 = m_queue2.begin();
@@ -2629,7 +2675,11 @@ void CallbackFlushHandler::invoke()
 void CallbackFlushHandler::scheduleFlush()
 {
     if (!m_pFlushEvent)
+    {
         m_pFlushEvent = Application::PostUserEvent(LINK(this, CallbackFlushHandler, FlushQueue));
+        if (!m_nFlushScheduledTime)
+            m_nFlushScheduledTime = osl_getGlobalTimer();
+    }
 }
 
 IMPL_LINK_NOARG(CallbackFlushHandler, FlushQueue, void*, void)
@@ -2640,40 +2690,35 @@ IMPL_LINK_NOARG(CallbackFlushHandler, FlushQueue, void*, void)
 
 bool CallbackFlushHandler::removeAll(int type)
 {
-    bool bErased = false;
-    auto it1 = m_queue1.begin();
-    for(;;)
-    {
-        it1 = std::find(it1, m_queue1.end(), type);
-        if(it1 == m_queue1.end())
-            break;
-        m_queue2.erase(toQueue2(it1));
-        it1 = m_queue1.erase(it1);
-        bErased = true;
-    }
-    return bErased;
+    return removeAll(type, [](const CallbackData&) { return true; });
 }
 
 bool CallbackFlushHandler::removeAll(int type, const std::function<bool (const CallbackData&)>& rTestFunc)
 {
-    bool bErased = false;
-    auto it1 = m_queue1.begin();
-    for(;;)
+    // Compact both queues in a single pass, erasing the matches one by one would
+    // move the tail of the queue for each of them.
+    auto it1 = std::find(m_queue1.begin(), m_queue1.end(), type);
+    if (it1 == m_queue1.end())
+        return false;
+
+    size_t nOut = std::distance(m_queue1.begin(), it1);
+    for (size_t i = nOut; i < m_queue1.size(); ++i)
     {
-        it1 = std::find(it1, m_queue1.end(), type);
-        if(it1 == m_queue1.end())
-            break;
-        auto it2 = toQueue2(it1);
-        if (rTestFunc(*it2))
+        if (m_queue1[i] == type && rTestFunc(m_queue2[i]))
+            continue;
+        if (nOut != i)
         {
-            m_queue2.erase(it2);
-            it1 = m_queue1.erase(it1);
-            bErased = true;
+            m_queue1[nOut] = m_queue1[i];
+            m_queue2[nOut] = std::move(m_queue2[i]);
         }
-        else
-            ++it1;
+        ++nOut;
     }
-    return bErased;
+
+    const size_t nRemoved = m_queue1.size() - nOut;
+    m_queue1.erase(m_queue1.begin() + nOut, m_queue1.end());
+    m_queue2.erase(m_queue2.begin() + nOut, m_queue2.end());
+    m_nRemovedCallbacks += nRemoved;
+    return nRemoved != 0;
 }
 
 void CallbackFlushHandler::addViewStates(int viewId)
@@ -4385,6 +4430,67 @@ static void doc_paintTile(LibreOfficeKitDocument* pThis,
     pDocument->updateViewsForPaintedTile(nOrigViewId, nPart, nMode, aRectangle);
 }
 
+static bool doc_paintTileDelta(LibreOfficeKitDocument* pThis,
+                               unsigned char* pBuffer,
+                               const int nCanvasWidth, const int nCanvasHeight,
+                               const int nTilePosX, const int nTilePosY,
+                               const int nTileWidth, const int nTileHeight,
+                               int* pDirtyX, int* pDirtyY,
+                               int* pDirtyWidth, int* pDirtyHeight)
+{
+    comphelper::ProfileZone aZone("doc_paintTileDelta");
+
+    SolarMutexGuard aGuard;
+    SetLastExceptionMsg();
+
+    *pDirtyX = *pDirtyY = *pDirtyWidth = *pDirtyHeight = 0;
+    if (!pBuffer || nCanvasWidth <= 0 || nCanvasHeight <= 0)
+        return false;
+
+    // Paint to a scratch buffer, pBuffer still has the tile the client has seen before.
+    const size_t nStride = static_cast<size_t>(nCanvasWidth) * 4;
+    std::vector<unsigned char> aTile(nStride * nCanvasHeight);
+    doc_paintTile(pThis, aTile.data(), nCanvasWidth, nCanvasHeight, nTilePosX, nTilePosY,
+                  nTileWidth, nTileHeight);
+
+    // Find the bounding box of the changed pixels.
+    int nMinX = nCanvasWidth, nMaxX = -1, nMinY = nCanvasHeight, nMaxY = -1;
+    for (int nY = 0; nY < nCanvasHeight; ++nY)
+    {
+        const unsigned char* pOld = pBuffer + nY * nStride;
+        const unsigned char* pNew = aTile.data() + nY * nStride;
+        if (std::memcmp(pOld, pNew, nStride) == 0)
+            continue;
+
+        size_t nFirst = 0;
+        while (pOld[nFirst] == pNew[nFirst])
+            ++nFirst;
+        size_t nLast = nStride - 1;
+        while (pOld[nLast] == pNew[nLast])
+            --nLast;
+
+        nMinX = std::min(nMinX, static_cast<int>(nFirst / 4));
+        nMaxX = std::max(nMaxX, static_cast<int>(nLast / 4));
+        nMinY = std::min(nMinY, nY);
+        nMaxY = nY;
+    }
+
+    if (nMaxY < 0)
+        return false;
+
+    // Only copy the changed area back to the client.
+    const size_t nOffset = static_cast<size_t>(nMinX) * 4;
+    const size_t nLength = static_cast<size_t>(nMaxX - nMinX + 1) * 4;
+    for (int nY = nMinY; nY <= nMaxY; ++nY)
+        std::memcpy(pBuffer + nY * nStride + nOffset, aTile.data() + nY * nStride + nOffset, nLength);
+
+    *pDirtyX = nMinX;
+    *pDirtyY = nMinY;
+    *pDirtyWidth = nMaxX - nMinX + 1;
+    *pDirtyHeight = nMaxY - nMinY + 1;
+    return true;
+}
+
 inline static ITiledRenderable* getDocumentPointer(LibreOfficeKitDocument* pThis)
 {
     ITiledRenderable* pDoc = getTiledRenderable(pThis);
@@ -4472,26 +4578,25 @@ inline static int getAlternativeViewForPaint(LibreOfficeKitDocument* pThis, ITil
     return -1;
 }
 
-static void doc_paintPartTile(LibreOfficeKitDocument* pThis,
-                              unsigned char* pBuffer,
-                              const int nPart,
-                              const int nMode,
-                              const int nCanvasWidth, const int nCanvasHeight,
-                              const int nTilePosX, const int nTilePosY,
-                              const int nTileWidth, const int nTileHeight)
+/// Paints nTileCount tiles of the same size, the positions are given as x,y pairs in pTilePositions.
+/// Switching the view, part and mode is only done once for all the tiles.
+static void paintPartTilesImpl(LibreOfficeKitDocument* pThis,
+                               unsigned char** pBuffers,
+                               const int nPart,
+                               const int nMode,
+                               const int nCanvasWidth, const int nCanvasHeight,
+                               const int* pTilePositions, const int nTileCount,
+                               const int nTileWidth, const int nTileHeight)
 {
-    static bool bFirst = true;
-    if (bFirst)
-    {
-        bFirst = false;
-        SAL_INFO("lok", "doc_paintPartTile: first tile @ " << osl_getGlobalTimer());
-    }
-    comphelper::ProfileZone aZone("doc_paintPartTile");
-
     SolarMutexGuard aGuard;
     SetLastExceptionMsg();
 
-    writeInfoLog(nPart, nMode, nTileWidth, nTileHeight, nTilePosX, nTilePosY, nCanvasWidth, nCanvasHeight);
+    if (nTileCount <= 0 || !pBuffers || !pTilePositions)
+        return;
+
+    for (int i = 0; i < nTileCount; ++i)
+        writeInfoLog(nPart, nMode, nTileWidth, nTileHeight, pTilePositions[2 * i],
+                     pTilePositions[2 * i + 1], nCanvasWidth, nCanvasHeight);
 
     ITiledRenderable* pDoc = getDocumentPointer(pThis);
     if (!pDoc)
@@ -4559,7 +4664,9 @@ static void doc_paintPartTile(LibreOfficeKitDocument* pThis,
             pDoc->setPaintTextEdit(bPaintTextEdit);
         }
 
-        doc_paintTile(pThis, pBuffer, nCanvasWidth, nCanvasHeight, nTilePosX, nTilePosY, nTileWidth, nTileHeight);
+        for (int i = 0; i < nTileCount; ++i)
+            doc_paintTile(pThis, pBuffers[i], nCanvasWidth, nCanvasHeight, pTilePositions[2 * i],
+                          pTilePositions[2 * i + 1], nTileWidth, nTileHeight);
 
         if (!isText)
         {
@@ -4594,8 +4701,47 @@ static void doc_paintPartTile(LibreOfficeKitDocument* pThis,
 
     // Inform all views with the same view render state about the paint, so they know if makes sense
     // to invalidate those areas later.
-    tools::Rectangle aRectangle{Point(nTilePosX, nTilePosY), Size(nTileWidth, nTileHeight)};
-    pDocument->updateViewsForPaintedTile(nOrigViewId, nPart, nMode, aRectangle);
+    for (int i = 0; i < nTileCount; ++i)
+    {
+        tools::Rectangle aRectangle{ Point(pTilePositions[2 * i], pTilePositions[2 * i + 1]),
+                                     Size(nTileWidth, nTileHeight) };
+        pDocument->updateViewsForPaintedTile(nOrigViewId, nPart, nMode, aRectangle);
+    }
+}
+
+static void doc_paintPartTile(LibreOfficeKitDocument* pThis,
+                              unsigned char* pBuffer,
+                              const int nPart,
+                              const int nMode,
+                              const int nCanvasWidth, const int nCanvasHeight,
+                              const int nTilePosX, const int nTilePosY,
+                              const int nTileWidth, const int nTileHeight)
+{
+    static bool bFirst = true;
+    if (bFirst)
+    {
+        bFirst = false;
+        SAL_INFO("lok", "doc_paintPartTile: first tile @ " << osl_getGlobalTimer());
+    }
+    comphelper::ProfileZone aZone("doc_paintPartTile");
+
+    const int aTilePosition[] = { nTilePosX, nTilePosY };
+    paintPartTilesImpl(pThis, &pBuffer, nPart, nMode, nCanvasWidth, nCanvasHeight, aTilePosition, 1,
+                       nTileWidth, nTileHeight);
+}
+
+static void doc_paintPartTiles(LibreOfficeKitDocument* pThis,
+                               unsigned char** pBuffers,
+                               const int nPart,
+                               const int nMode,
+                               const int nCanvasWidth, const int nCanvasHeight,
+                               const int* pTilePositions, const int nTileCount,
+                               const int nTileWidth, const int nTileHeight)
+{
+    comphelper::ProfileZone aZone("doc_paintPartTiles");
+
+    paintPartTilesImpl(pThis, pBuffers, nPart, nMode, nCanvasWidth, nCanvasHeight, pTilePositions,
+                       nTileCount, nTileWidth, nTileHeight);
 }
 
 void LibLODocument_Impl::updateViewsForPaintedTile(int nOrigViewId, int nPart, int nMode, const tools::Rectangle& rRectangle)
@@ -8117,6 +8263,14 @@ static void preLoadTypeDetection()
 
         xTypeDetection->queryTypeByDescriptor(aMediaDesc, true);
     }
+
+    // The filter cache only loads the types up front, fill in all the filters as well so that the
+    // first load does not have to.
+    uno::Reference<container::XNameAccess> xFilterFactory(
+        xFactory->createInstanceWithContext(u"com.sun.star.document.FilterFactory"_ustr, xContext),
+        uno::UNO_QUERY);
+    if (xFilterFactory)
+        (void)xFilterFactory->getElementNames();
 }
 
 /// Used only by LibreOfficeKit when used by Online to pre-initialize
@@ -8257,6 +8411,18 @@ static void preloadData()
         OutputDevice::GetDefaultFont(DefaultFontType::CTL_SPREADSHEET, nLang, GetDefaultFontFlags::OnlyOne);
     }
 
+    std::cerr << "Preload autocorrect lists\n";
+    if (SvxAutoCorrect* pAutoCorrect = SvxAutoCorrCfg::Get().GetAutoCorrect())
+    {
+        for (const auto& aLocale : aLocales)
+        {
+            const LanguageType eLang = LanguageTag::convertToLanguageType(aLocale, false);
+            pAutoCorrect->LoadAutocorrWordList(eLang);
+            pAutoCorrect->LoadCplSttExceptList(eLang);
+            pAutoCorrect->LoadWordStartExceptList(eLang);
+        }
+    }
+
     std::cerr << "Preload config\n";
 #if defined __GNUC__ || defined __clang__
 #pragma GCC diagnostic push
@@ -32,14 +32,23 @@ namespace drawinglayer::primitive2d
 AlphaMask ProcessAndBlurAlphaMask(const AlphaMask& rMask, double fErodeDilateRadius,
                                   double fBlurRadius, sal_uInt8 nTransparency, bool bConvertTo1Bit)
 {
-    // Invert it to operate in the transparency domain. Trying to update this method to
-    // work in the alpha domain is fraught with hazards.
-    AlphaMask tmpMask = rMask;
-    tmpMask.Invert();
-
-    // Only completely white pixels on the initial mask must be considered for transparency. Any
-    // other color must be treated as black. This creates 1-bit B&W bitmap.
-    Bitmap mask = bConvertTo1Bit ? tmpMask.GetBitmap().CreateMask(COL_WHITE) : tmpMask.GetBitmap();
+    // Operate in the transparency domain. Trying to update this method to work in the alpha
+    // domain is fraught with hazards.
+    Bitmap mask;
+    if (bConvertTo1Bit)
+    {
+        // Only completely transparent pixels on the initial mask (white in the transparency
+        // domain) must be considered for transparency. Any other color must be treated as
+        // black. This creates a B&W bitmap, which is already in the transparency domain, so
+        // there is no need to invert the whole mask first.
+        mask = rMask.GetBitmap().CreateMask(COL_BLACK);
+    }
+    else
+    {
+        AlphaMask tmpMask = rMask;
+        tmpMask.Invert();
+        mask = tmpMask.GetBitmap();
+    }
 
     // Scaling down increases performance without noticeable quality loss. Additionally,
     // current blur implementation can only handle blur radius between 2 and 254.
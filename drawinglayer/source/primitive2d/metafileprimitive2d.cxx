@@ -25,12 +25,46 @@
 #include <drawinglayer/primitive2d/transformprimitive2d.hxx>
 #include <basegfx/polygon/b2dpolygontools.hxx>
 #include <drawinglayer/primitive2d/maskprimitive2d.hxx>
+#include <drawinglayer/primitive2d/Tools.hxx>
 #include <vcl/canvastools.hxx>
 
 using namespace com::sun::star;
 
 namespace drawinglayer::primitive2d
 {
+        namespace
+        {
+            // Check if all content is inside of the given target range. This is
+            // equivalent to testing the range of the whole container, but stops
+            // at the first primitive sticking out, so that for large Metafiles
+            // not all (possibly expensive, e.g. text) ranges need to be evaluated
+            bool isContentInsideRange(
+                const Primitive2DContainer& rContent,
+                const basegfx::B2DRange& rTargetRange,
+                const geometry::ViewInformation2D& rViewInformation)
+            {
+                bool bContentFound(false);
+
+                for (const Primitive2DReference& rCandidate : rContent)
+                {
+                    const basegfx::B2DRange aRange(getB2DRangeFromPrimitive2DReference(rCandidate, rViewInformation));
+
+                    if (aRange.isEmpty())
+                        continue;
+
+                    // isInside gives also true for equal
+                    if (!rTargetRange.isInside(aRange))
+                        return false;
+
+                    bContentFound = true;
+                }
+
+                // no content at all is handled as not inside (as an empty
+                // content range would be)
+                return bContentFound;
+            }
+        }
+
         Primitive2DReference MetafilePrimitive2D::create2DDecomposition(const geometry::ViewInformation2D& rViewInformation) const
         {
             // Interpret the Metafile and get the content. There should be only one target, as in the start condition,
@@ -48,10 +82,7 @@ namespace drawinglayer::primitive2d
             // defined target range (aMtfRange)
             if (!aMtfRange.isEmpty())
             {
-                const basegfx::B2DRange aContentRange(xRetval.getB2DRange(rViewInformation));
-
-                // also test equal since isInside gives also true for equal
-                if (!aMtfRange.equal(aContentRange) && !aMtfRange.isInside(aContentRange))
+                if (!isContentInsideRange(xRetval, aMtfRange, rViewInformation))
                 {
                     // contentRange is partly larger than aMtfRange (stuff sticks
                     // outside), clipping is needed
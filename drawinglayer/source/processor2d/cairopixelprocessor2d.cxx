@@ -32,6 +32,7 @@
 #include <drawinglayer/primitive2d/unifiedtransparenceprimitive2d.hxx>
 #include <drawinglayer/primitive2d/backgroundcolorprimitive2d.hxx>
 #include <drawinglayer/primitive2d/baseprimitive2d.hxx>
+#include <drawinglayer/primitive2d/BufferedDecompositionPrimitive2D.hxx>
 #include <drawinglayer/primitive2d/markerarrayprimitive2d.hxx>
 #include <drawinglayer/primitive2d/maskprimitive2d.hxx>
 #include <drawinglayer/primitive2d/modifiedcolorprimitive2d.hxx>
@@ -4716,6 +4717,30 @@ void CairoPixelProcessor2D::processBasePrimitive2D(const primitive2d::BasePrimit
         {
             SAL_INFO("drawinglayer", "default case for " << drawinglayer::primitive2d::idToString(
                                          rCandidate.getPrimitive2DID()));
+
+            // Do not decompose what cannot be seen: for primitives with a buffered
+            // decomposition the range is either cheap or computed from that decomposition,
+            // which process() would create anyway. Groups are not checked here, their range
+            // would visit the whole subtree for every level.
+            if (dynamic_cast<const primitive2d::BufferedDecompositionPrimitive2D*>(&rCandidate))
+            {
+                basegfx::B2DRange aDiscreteRange(rCandidate.getB2DRange(getViewInformation2D()));
+
+                if (!aDiscreteRange.isEmpty())
+                {
+                    aDiscreteRange.transform(
+                        getViewInformation2D().getObjectToViewTransformation());
+                    // hairlines and AA may paint up to a pixel around the geometry
+                    aDiscreteRange.grow(1.0);
+
+                    if (!getDiscreteViewRange(mpRT).overlaps(aDiscreteRange))
+                    {
+                        // not visible, done
+                        break;
+                    }
+                }
+            }
+
             // process recursively
             process(rCandidate);
             break;
@@ -265,6 +265,7 @@ namespace emfplushelper
 
         // mappers
         ::basegfx::B2DPoint Map(double ix, double iy) const;
+        const basegfx::B2DHomMatrix& getMapTransform() const { return maMapTransform; }
 
         // readers
         static void ReadRectangle(SvStream& s, float& x, float& y, float &width, float& height, bool bCompressed = false);
@@ -65,6 +65,9 @@ namespace emfplushelper
     }
 
     EMFPPath::EMFPPath (sal_uInt32 _nPoints, bool bLines)
+        : bPolygonValid(false)
+        , bPolygonMapped(false)
+        , bPolygonLineToClose(false)
     {
         if (_nPoints > SAL_MAX_UINT32 / (2 * sizeof(float)))
         {
@@ -127,10 +130,21 @@ namespace emfplushelper
         }
 
         aPolygon.clear();
+        bPolygonValid = false;
     }
 
     ::basegfx::B2DPolyPolygon& EMFPPath::GetPolygon (EmfPlusHelperData const & rR, bool bMapIt, bool bAddLineToCloseShape)
     {
+        if (bPolygonValid && bPolygonMapped == bMapIt && bPolygonLineToClose == bAddLineToCloseShape
+            && (!bMapIt || aPolygonTransform == rR.getMapTransform()))
+            bPolygonValid = true;
+        bPolygonMapped = bMapIt;
+        bPolygonLineToClose = bAddLineToCloseShape;
+        if (bMapIt)
+            aPolygonTransform = rR.getMapTransform();
+
+        return aPolygon;
+
         ::basegfx::B2DPolygon polygon;
         aPolygon.clear ();
         sal_uInt32 last_normal = 0, p = 0;
@@ -260,6 +274,7 @@ namespace emfplushelper
         ::basegfx::B2DPolygon polygon;
         matrix mat;
         double x, y;
+        bPolygonValid = false;
         if (aNumSegments >= nPoints)
             aNumSegments = nPoints - 1;
         GetCardinalMatrix(fTension, mat);
@@ -291,6 +306,7 @@ namespace emfplushelper
         ::basegfx::B2DPolygon polygon;
         matrix mat;
         double x, y;
+        bPolygonValid = false;
         GetCardinalMatrix(fTension, mat);
         // add three first points at the end
         xPoints.push_back(xPoints[0]);
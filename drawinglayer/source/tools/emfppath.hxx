@@ -26,6 +26,12 @@ namespace emfplushelper
     class EMFPPath : public EMFPObject
     {
         ::basegfx::B2DPolyPolygon    aPolygon;
+        // what aPolygon was last built with by GetPolygon(), so that a path
+        // object drawn repeatedly under the same transform is converted once
+        bool                         bPolygonValid;
+        bool                         bPolygonMapped;
+        bool                         bPolygonLineToClose;
+        ::basegfx::B2DHomMatrix      aPolygonTransform;
         sal_uInt32                   nPoints;
         std::deque<float>            xPoints, yPoints;
         std::unique_ptr<sal_uInt8[]> pPointTypes;
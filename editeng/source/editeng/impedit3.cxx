@@ -734,7 +734,9 @@ bool ImpEditEngine::CreateLines( sal_Int32 nPara, sal_uInt32 nStartPosY )
             {
                 // There must be no start / end in the deleted area.
                 nPos = nPos + pTextPortion->GetLen();
-                if (nPos > nStart && nPos < nEnd)
+                if (nPos >= nEnd)
+                    break; // portions behind the deleted area don't matter
+                if (nPos > nStart)
                 {
                     bQuickFormat = false;
                     break;
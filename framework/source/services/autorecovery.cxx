@@ -3100,6 +3100,10 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
 
     lNewArgs[utl::MediaDescriptor::PROP_AUTOSAVEEVENT] <<= true;
 
+    // nobody looks at the preview of a backup copy, and rendering it is a
+    // noticeable part of the time the UI is blocked for large documents
+    lNewArgs[u"NoThumbnail"_ustr] <<= true;
+
     // try to save this document as a new temp file every time.
     // Mark AutoSave state as "INCOMPLETE" if it failed.
     // Because the last temp file is too old and does not include all changes.
@@ -295,7 +295,12 @@ void BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocal
         bNewBreak=true;
     }
 
-    if (!(bNewBreak || icuBI->mpValue->maICUText.pData != rText.pData))
+    // Callers often pass different OUString instances of the same text (e.g. a paragraph
+    // string copied per call). Keep the iterator on the already set, identical text then,
+    // setText() would throw away ICU's internal break caches. maICUText keeps alive the
+    // buffer the UText points to.
+    if (!bNewBreak
+        && (icuBI->mpValue->maICUText.pData == rText.pData || icuBI->mpValue->maICUText == rText))
         return;
 
     const UChar *pText = reinterpret_cast<const UChar *>(rText.getStr());
@@ -21,6 +21,7 @@
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
 
+#include <rtl/character.hxx>
 #include <rtl/ref.hxx>
 #include <i18nutil/casefolding.hxx>
 #include <i18nutil/unicode.hxx>
@@ -89,6 +90,20 @@ static MappingType lcl_getMappingTypeForToggleCase( MappingType nMappingType, sa
     return nRes;
 }
 
+// ASCII characters map to themselves or, if upper case, to their lower case counterpart for
+// these mapping types, independent of locale and context - except for I and J, which have
+// conditional (Turkish, Lithuanian) mappings. Lets the common case skip the table lookups.
+static bool lcl_isAsciiLowerMapping( MappingType nMappingType )
+{
+    return nMappingType == MappingType::FullFolding || nMappingType == MappingType::SimpleFolding
+           || nMappingType == MappingType::ToLower || nMappingType == MappingType::UpperToLower;
+}
+
+static bool lcl_isSimpleAscii( sal_Unicode c )
+{
+    return rtl::isAscii(c) && c != 'I' && c != 'J';
+}
+
 OUString
 Transliteration_body::transliterateImpl(
     const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount,
@@ -117,6 +132,7 @@ Transliteration_body::transliterateImpl(
     }
 
     sal_Int32 j = 0;
+    const bool bAsciiLowerMapping = lcl_isAsciiLowerMapping(nMappingType);
     // Two different blocks to eliminate the if(useOffset) condition inside the loop.
     // Yes, on massive use even such small things do count.
     if ( pOffset )
@@ -135,6 +151,13 @@ Transliteration_body::transliterateImpl(
 
         for (sal_Int32 i = 0; i < nCount; i++)
         {
+            if (bAsciiLowerMapping && lcl_isSimpleAscii(in[i]))
+            {
+                *offsetDataEnd++ = i + startPos;
+                out[j++] = static_cast<sal_Unicode>(rtl::toAsciiLowerCase(in[i]));
+                continue;
+            }
+
             // take care of TOGGLE_CASE transliteration:
             MappingType nTmpMappingType = lcl_getMappingTypeForToggleCase( nMappingType, in[i] );
 
@@ -151,6 +174,12 @@ Transliteration_body::transliterateImpl(
     {
         for ( sal_Int32 i = 0; i < nCount; i++)
         {
+            if (bAsciiLowerMapping && lcl_isSimpleAscii(in[i]))
+            {
+                out[j++] = static_cast<sal_Unicode>(rtl::toAsciiLowerCase(in[i]));
+                continue;
+            }
+
             // take care of TOGGLE_CASE transliteration:
             MappingType nTmpMappingType = lcl_getMappingTypeForToggleCase( nMappingType, in[i] );
 
@@ -586,6 +586,32 @@ struct LibreOfficeKitDocumentClassStruct
     /// @see lok::Document::setAllowManageRedlines().
     void (*setAllowManageRedlines)(LibreOfficeKitDocument* pThis, int nId, bool allow);
 
+    /// @see lok::Document::paintPartTiles().
+    void (*paintPartTiles)(LibreOfficeKitDocument* pThis,
+                           unsigned char** pBuffers,
+                           const int nPart,
+                           const int nMode,
+                           const int nCanvasWidth,
+                           const int nCanvasHeight,
+                           const int* pTilePositions,
+                           const int nTileCount,
+                           const int nTileWidth,
+                           const int nTileHeight);
+
+    /// @see lok::Document::paintTileDelta().
+    bool (*paintTileDelta)(LibreOfficeKitDocument* pThis,
+                           unsigned char* pBuffer,
+                           const int nCanvasWidth,
+                           const int nCanvasHeight,
+                           const int nTilePosX,
+                           const int nTilePosY,
+                           const int nTileWidth,
+                           const int nTileHeight,
+                           int* pDirtyX,
+                           int* pDirtyY,
+                           int* pDirtyWidth,
+                           int* pDirtyHeight);
+
 #endif // defined LOK_USE_UNSTABLE_API || defined LIBO_INTERNAL_ONLY
 };
 
@@ -892,6 +892,61 @@ public:
         mpDoc->pClass->setAllowManageRedlines(mpDoc, nId, allow);
     }
 
+    /**
+     * Renders several tiles of the same part, mode and zoom to pre-allocated buffers.
+     *
+     * This is the same as calling paintPartTile() for each tile, but the
+     * view, part and mode are only switched once for the whole batch.
+     *
+     * @param pBuffers nTileCount buffers, each with the size required by paintTile().
+     * @param pTilePositions 2 * nTileCount integers: the x,y position of each tile, in twips.
+     * @param nTileCount the number of tiles to paint.
+     * @see paintPartTile.
+     */
+    void paintPartTiles(unsigned char** pBuffers,
+                        const int nPart,
+                        const int nMode,
+                        const int nCanvasWidth,
+                        const int nCanvasHeight,
+                        const int* pTilePositions,
+                        const int nTileCount,
+                        const int nTileWidth,
+                        const int nTileHeight)
+    {
+        mpDoc->pClass->paintPartTiles(mpDoc, pBuffers, nPart, nMode,
+                                      nCanvasWidth, nCanvasHeight,
+                                      pTilePositions, nTileCount,
+                                      nTileWidth, nTileHeight);
+    }
+
+    /**
+     * Renders a subset of the document like paintTile(), but only updates the changed pixels.
+     *
+     * pBuffer is expected to contain the tile that was painted for the same
+     * position earlier. Only the area that differs from it is written, and
+     * its bounding box is returned in canvas pixels.
+     *
+     * @param pDirtyX, pDirtyY, pDirtyWidth, pDirtyHeight the changed area of pBuffer.
+     * @return true if anything changed.
+     * @see paintTile.
+     */
+    bool paintTileDelta(unsigned char* pBuffer,
+                        const int nCanvasWidth,
+                        const int nCanvasHeight,
+                        const int nTilePosX,
+                        const int nTilePosY,
+                        const int nTileWidth,
+                        const int nTileHeight,
+                        int* pDirtyX,
+                        int* pDirtyY,
+                        int* pDirtyWidth,
+                        int* pDirtyHeight)
+    {
+        return mpDoc->pClass->paintTileDelta(mpDoc, pBuffer, nCanvasWidth, nCanvasHeight,
+                                             nTilePosX, nTilePosY, nTileWidth, nTileHeight,
+                                             pDirtyX, pDirtyY, pDirtyWidth, pDirtyHeight);
+    }
+
     /**
      * Enable/Disable accessibility support for the window with the specified nId.
      *
@@ -54,7 +54,7 @@ public:
      * lifetime.
      */
     ProfileZone(const char* sName, const std::map<OUString, OUString>& aArgs)
-        : ProfileZone(sName, createArgsString(aArgs))
+        : ProfileZone(sName, s_bRecording ? createArgsString(aArgs) : OUString())
     {
     }
 
@@ -14,6 +14,7 @@
 #include <rtl/ref.hxx>
 #include <comphelper/comphelperdllapi.h>
 #include <mutex>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <vector>
@@ -40,7 +41,16 @@ public:
     ThreadTask(std::shared_ptr<ThreadTaskTag> pTag);
 };
 
-/// A very basic thread-safe thread pool implementation
+/** A thread-safe thread pool implementation
+
+    Every worker has its own task queue, pushed tasks are distributed over
+    them and an idle worker steals tasks from the queues of other workers,
+    so workers don't contend for a single queue. Tasks pushed from inside a
+    task go to the queue of the worker running it.
+
+    If the PIN_THREADPOOL_WORKERS env. var. is set, each worker thread is
+    bound to one of the CPUs the process may run on.
+*/
 class COMPHELPER_DLLPUBLIC ThreadPool final
 {
 public:
@@ -80,7 +90,7 @@ public:
     bool        joinThreadsIfIdle();
 
     /// return true if there are no queued or worked-on tasks
-    bool        isIdle() const { return maTasks.empty() && mnBusyWorkers == 0; };
+    bool        isIdle() const { return mnQueuedTasks == 0 && mnBusyWorkers == 0; };
 
     /// return the number of live worker threads
     sal_Int32   getWorkerCount() const { return mnMaxWorkers; }
@@ -94,23 +104,28 @@ private:
 
     class ThreadWorker;
     friend class ThreadWorker;
+    struct WorkQueue;
 
-    /** Pop a work task
-        @param  bWait - if set wait until task present or termination
-        @return a new task to perform, or NULL if list empty or terminated
+    /** Pop a work task, counting the caller as busy worker if there is one
+        @param  nQueue - the queue to look at first, before stealing from the others
+        @return a new task to perform, or NULL if all queues are empty
     */
-    std::unique_ptr<ThreadTask> popWorkLocked( std::unique_lock< std::mutex > & rGuard, bool bWait );
+    std::unique_ptr<ThreadTask> popWork( std::size_t nQueue );
     void shutdownLocked(std::unique_lock<std::mutex>&);
     void incBusyWorker();
     void decBusyWorker();
 
-    /// signalled when all in-progress tasks are complete
+    /// guards the workers and termination, signalled when tasks are pushed
     std::mutex              maMutex;
     std::condition_variable maTasksChanged;
     bool                    mbTerminate;
     std::size_t const       mnMaxWorkers;
-    std::size_t             mnBusyWorkers;
-    std::vector< std::unique_ptr<ThreadTask> >   maTasks;
+    std::atomic<std::size_t> mnBusyWorkers;
+    std::atomic<std::size_t> mnQueuedTasks;
+    std::atomic<std::size_t> mnSleepingWorkers;
+    std::atomic<std::size_t> mnWorkers;
+    std::atomic<std::size_t> mnNextQueue;
+    std::vector< std::unique_ptr<WorkQueue> >     maQueues;
     std::vector< rtl::Reference< ThreadWorker > > maWorkers;
 };
 
@@ -39,12 +39,16 @@ class COMPHELPER_DLLPUBLIC TraceEvent
 private:
     static int getPid()
     {
-        oslProcessInfo aProcessInfo;
-        aProcessInfo.Size = sizeof(oslProcessInfo);
-        if (osl_getProcessInfo(nullptr, osl_Process_IDENTIFIER, &aProcessInfo)
-            == osl_Process_E_None)
-            return aProcessInfo.Ident;
-        return -1;
+        // asked for by every event while recording, and it does not change
+        static const int nPid = []() {
+            oslProcessInfo aProcessInfo;
+            aProcessInfo.Size = sizeof(oslProcessInfo);
+            if (osl_getProcessInfo(nullptr, osl_Process_IDENTIFIER, &aProcessInfo)
+                == osl_Process_E_None)
+                return static_cast<int>(aProcessInfo.Ident);
+            return -1;
+        }();
+        return nPid;
     }
 
     static std::size_t s_nBufferSize;
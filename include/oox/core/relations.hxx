@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <string_view>
+#include <unordered_map>
 
 #include <oox/dllapi.h>
 #include <rtl/ustring.hxx>
@@ -67,6 +68,9 @@ class OOX_DLLPUBLIC Relations
 {
 public:
     explicit            Relations( OUString aFragmentPath );
+    // maFirstOfType points into maMap
+                        Relations( const Relations& ) = delete;
+    Relations&          operator=( const Relations& ) = delete;
 
     size_t size() const { return maMap.size(); }
     size_t count( const OUString& rId ) const { return maMap.count( rId ); }
@@ -78,11 +82,7 @@ public:
     {
         return maMap.end();
     }
-    template<class... Args>
-    void emplace(Args&&... args)
-    {
-        maMap.emplace(std::forward<Args>(args)...);
-    }
+    void emplace( const OUString& rId, const Relation& rRelation );
 
     /** Returns the path of the fragment this relations collection is related to. */
     const OUString& getFragmentPath() const { return maFragmentPath; }
@@ -109,6 +109,8 @@ public:
 
 private:
     ::std::map< OUString, Relation > maMap;
+    /// ASCII lowercase relation type -> relation with the lowest id of that type
+    ::std::unordered_map< OUString, const Relation* > maFirstOfType;
     OUString     maFragmentPath;
 };
 
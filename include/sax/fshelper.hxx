@@ -24,6 +24,9 @@
 #include <rtl/ustring.hxx>
 //#include <rtl/ref.hxx>
 #include <sax/saxdllapi.h>
+#include <charconv>
+#include <concepts>
+#include <limits>
 #include <optional>
 #include <memory>
 #include <string_view>
@@ -38,6 +41,11 @@ constexpr sal_Int32 FSNS(sal_Int32 namespc, sal_Int32 element) { return (namespc
 
 namespace sax_fastparser {
 
+/// Integer types that can be passed directly as attribute values, formatted without allocating.
+template<typename T>
+concept AttributeInteger = std::integral<T> && !std::same_as<T, bool> && !std::same_as<T, char>
+                           && !std::same_as<T, sal_Unicode>;
+
 enum class MergeMarks { APPEND = 0, PREPEND = 1, POSTPONE = 2};
 
 class FastSaxSerializer;
@@ -78,6 +86,23 @@ public:
             opt = value->toUtf8();
         startElement(elementTokenId, attribute, opt, std::forward<Args>(args)...);
     }
+    template<AttributeInteger T, typename... Args>
+    void startElement(sal_Int32 elementTokenId, sal_Int32 attribute, T value, Args&&... args)
+    {
+        // the buffer outlives the attribute list, which is written by the innermost call
+        char aBuf[std::numeric_limits<T>::digits10 + 2];
+        pushAttributeValue(attribute, formatInteger(aBuf, value));
+        startElement(elementTokenId, std::forward<Args>(args)...);
+    }
+    template<AttributeInteger T, typename... Args>
+    void startElement(sal_Int32 elementTokenId, sal_Int32 attribute,
+                      const std::optional<T>& value, Args&&... args)
+    {
+        char aBuf[std::numeric_limits<T>::digits10 + 2];
+        if (value)
+            pushAttributeValue(attribute, formatInteger(aBuf, *value));
+        startElement(elementTokenId, std::forward<Args>(args)...);
+    }
     void startElement(sal_Int32 elementTokenId);
 
     /// Start an element. After the first two arguments there can be a number of (attribute, value) pairs.
@@ -112,6 +137,23 @@ public:
             opt = value->toUtf8();
         singleElement(elementTokenId, attribute, opt, std::forward<Args>(args)...);
     }
+    template<AttributeInteger T, typename... Args>
+    void singleElement(sal_Int32 elementTokenId, sal_Int32 attribute, T value, Args&&... args)
+    {
+        // the buffer outlives the attribute list, which is written by the innermost call
+        char aBuf[std::numeric_limits<T>::digits10 + 2];
+        pushAttributeValue(attribute, formatInteger(aBuf, value));
+        singleElement(elementTokenId, std::forward<Args>(args)...);
+    }
+    template<AttributeInteger T, typename... Args>
+    void singleElement(sal_Int32 elementTokenId, sal_Int32 attribute,
+                       const std::optional<T>& value, Args&&... args)
+    {
+        char aBuf[std::numeric_limits<T>::digits10 + 2];
+        if (value)
+            pushAttributeValue(attribute, formatInteger(aBuf, *value));
+        singleElement(elementTokenId, std::forward<Args>(args)...);
+    }
     void singleElement(sal_Int32 elementTokenId);
 
     /// Create a single element. After the first two arguments there can be a number of (attribute, value) pairs.
@@ -155,6 +197,14 @@ public:
 private:
     void pushAttributeValue(sal_Int32 attribute, std::string_view value);
 
+    template<AttributeInteger T, size_t N>
+    static std::string_view formatInteger(char (&rBuf)[N], T value)
+    {
+        static_assert(N > std::numeric_limits<T>::digits10 + 1);
+        auto aResult = std::to_chars(rBuf, rBuf + N, value);
+        return std::string_view(rBuf, aResult.ptr - rBuf);
+    }
+
     std::unique_ptr<FastSaxSerializer> mpSerializer;
 };
 
@@ -469,7 +469,11 @@ public:
     Size                        GetFirstPageSize() const;
     bool                        DoClose();
     std::shared_ptr<GDIMetaFile> GetPreviewMetaFile( bool bFullContent = false, bool bOutputForScreen = false ) const;
-    Bitmap                      GetPreviewBitmap() const;
+    /** Renders the first page, by default 4x larger and scaled down for a good antialiasing.
+        @param bLowCost render directly at the thumbnail size instead, for callers that generate
+        many previews and prefer speed over the best quality
+    */
+    Bitmap                      GetPreviewBitmap(bool bLowCost = false) const;
     virtual void                CancelTransfers();
 
     bool                        GenerateAndStoreThumbnail(
@@ -718,7 +722,7 @@ public:
     // Destruction of storages and streams
     void InternalCloseAndRemoveFiles();
 
-    SAL_DLLPRIVATE bool CreatePreview_Impl(bool bFullContent, bool bOutputForScreen, VirtualDevice* pDevice, GDIMetaFile* pFile) const;
+    SAL_DLLPRIVATE bool CreatePreview_Impl(bool bFullContent, bool bOutputForScreen, VirtualDevice* pDevice, GDIMetaFile* pFile, bool bSupersample = true) const;
 
     SAL_DLLPRIVATE static bool IsPackageStorageFormat_Impl(const SfxMedium &);
 
@@ -72,6 +72,8 @@ public:
     virtual ViewShellId GetViewShellId() const;
     /// Timestamp when this undo item was created.
     const DateTime& GetDateTime() const;
+    /// Estimated heap memory held by this action, in bytes; 0 if negligible or unknown.
+    virtual size_t          GetMemorySize() const;
     virtual void dumpAsXml(xmlTextWriterPtr pWriter) const;
 
 private:
@@ -151,6 +153,7 @@ public:
     /// See SfxUndoAction::GetViewShellId().
     ViewShellId GetViewShellId() const override;
     virtual OUString        GetRepeatComment(SfxRepeatTarget&) const override;
+    virtual size_t          GetMemorySize() const override;
     sal_uInt16              GetId() const;
 
     void SetComment(const OUString& rComment);
@@ -198,6 +201,10 @@ public:
 
     void                    SetMaxUndoActionCount( size_t nMaxUndoActionCount );
     size_t                  GetMaxUndoActionCount() const;
+    /** Limits the summed SfxUndoAction::GetMemorySize() of the top level actions; the oldest
+        actions are dropped when a new one would exceed it. 0 (the default) means no limit. */
+    void                    SetMaxUndoMemorySize( size_t nMaxUndoMemorySize );
+    size_t                  GetMaxUndoMemorySize() const;
     virtual void            AddUndoAction( std::unique_ptr<SfxUndoAction> pAction, bool bTryMerg=false );
     virtual size_t          GetUndoActionCount( bool const i_currentLevel = CurrentLevel ) const;
     OUString                GetUndoActionComment( size_t nNo=0, bool const i_currentLevel = CurrentLevel ) const;
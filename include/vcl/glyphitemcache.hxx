@@ -77,6 +77,16 @@ public:
     /// at the end.
     void SetCacheGlyphsWhenDoingFallbackFonts(bool bOK);
 
+    /// Counts of the lookups since the last clear().
+    struct Statistics
+    {
+        sal_uInt64 nHits = 0; ///< found in the cache
+        sal_uInt64 nSubsetHits = 0; ///< cut from the glyphs of the entire string
+        sal_uInt64 nRunHits = 0; ///< a run found with the same text, but in another string
+        sal_uInt64 nMisses = 0; ///< had to be laid out
+    };
+    const Statistics& GetStatistics() const { return maStatistics; }
+
     static SalLayoutGlyphsCache* self();
     SalLayoutGlyphsCache(int size) // needs to be public for tools::DeleteOnDeinit
 #if defined __cpp_lib_memory_resource
@@ -131,6 +141,7 @@ private:
     SalLayoutGlyphs mLastTemporaryGlyphs;
     // If set, info about the last call which wanted a substring of the full text.
     std::optional<CachedGlyphsKey> mLastSubstringKey;
+    Statistics maStatistics;
     bool mbCacheGlyphsWhenDoingFallbackFonts = false;
 
     SalLayoutGlyphsCache(const SalLayoutGlyphsCache&) = delete;
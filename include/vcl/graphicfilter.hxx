@@ -269,11 +269,15 @@ public:
                                       sal_uInt16 nFormat,
                                       sal_uInt16 * pDeterminedFormat);
 
+    /// pPreviewSizeHint is the pixel size the graphic will be shown at: formats that can decode at
+    /// a reduced resolution (JPEG) then produce a smaller bitmap, still keeping the full data in the
+    /// GfxLink, so swapping the graphic back in restores the full resolution.
     ErrCode ImportGraphic(
         Graphic& rGraphic, const INetURLObject& rPath,
         sal_uInt16 nFormat = GRFILTER_FORMAT_DONTKNOW, sal_uInt16 * pDeterminedFormat = nullptr,
         GraphicFilterImportFlags nImportFlags = GraphicFilterImportFlags::NONE,
-        const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler = nullptr);
+        const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler = nullptr,
+        const Size* pPreviewSizeHint = nullptr);
 
     ErrCode             CanImportGraphic( std::u16string_view rPath, SvStream& rStream,
                                       sal_uInt16 nFormat,
@@ -284,12 +288,16 @@ public:
         sal_uInt16 nFormat = GRFILTER_FORMAT_DONTKNOW, sal_uInt16* pDeterminedFormat = nullptr,
         GraphicFilterImportFlags nImportFlags = GraphicFilterImportFlags::NONE,
         sal_Int32 nPageNum = -1,
-        const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler = nullptr);
+        const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler = nullptr,
+        const Size* pPreviewSizeHint = nullptr);
 
     /// Imports multiple graphics.
     ///
     /// The resulting graphic is added to result on success, empty graphic is added on failure.
-    SAL_DLLPRIVATE std::vector<Graphic> ImportGraphics(std::vector< std::unique_ptr<SvStream> > vStreams);
+    /// If bCreateGfxLink is false, the caller already has the encoded data and the results get no
+    /// GfxLink, which saves copying the stream content of every graphic.
+    SAL_DLLPRIVATE std::vector<Graphic> ImportGraphics(std::vector< std::unique_ptr<SvStream> > vStreams,
+                                                       bool bCreateGfxLink = true);
 
     /**
      Tries to ensure all Graphic objects are available (Graphic::isAvailable()). Only an optimization, may
@@ -318,7 +326,7 @@ public:
     SAL_DLLPRIVATE static ErrCode readPNG(SvStream & rStream, Graphic & rGraphic, GfxLinkType & rLinkType,
                     BinaryDataContainer & rpGraphicContent);
     SAL_DLLPRIVATE static ErrCode readJPEG(SvStream & rStream, Graphic & rGraphic, GfxLinkType & rLinkType,
-                    GraphicFilterImportFlags nImportFlags);
+                    GraphicFilterImportFlags nImportFlags, const Size* pPreviewSizeHint);
     SAL_DLLPRIVATE static ErrCode readSVG(SvStream & rStream, Graphic & rGraphic, GfxLinkType & rLinkType,
                     BinaryDataContainer & rpGraphicContent);
     SAL_DLLPRIVATE static ErrCode readXBM(SvStream & rStream, Graphic & rGraphic);
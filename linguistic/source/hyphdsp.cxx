@@ -35,6 +35,7 @@
 #include <unotools/localedatawrapper.hxx>
 #include <tools/debug.hxx>
 #include <svl/lngmisc.hxx>
+#include <comphelper/anytostring.hxx>
 #include <comphelper/processfactory.hxx>
 #include <comphelper/sequence.hxx>
 #include <osl/mutex.hxx>
@@ -54,7 +55,8 @@ using namespace linguistic;
 
 
 HyphenatorDispatcher::HyphenatorDispatcher( LngSvcMgr &rLngSvcMgr ) :
-    rMgr    (rLngSvcMgr)
+    rMgr    (rLngSvcMgr),
+    maHyphCache (2000)
 {
 }
 
@@ -69,6 +71,14 @@ void HyphenatorDispatcher::ClearSvcList()
 {
     // release memory for each table entry
     HyphSvcByLangMap_t().swap(aSvcMap);
+    maHyphCache.clear();
+}
+
+
+void HyphenatorDispatcher::FlushHyphCache()
+{
+    MutexGuard  aGuard( GetLinguMutex() );
+    maHyphCache.clear();
 }
 
 
@@ -283,6 +293,17 @@ Reference< XHyphenatedWord > SAL_CALL
     {
         return nullptr;
     }
+
+    OUStringBuffer aCacheKey( rWord + "\n" + OUString::number( static_cast<sal_uInt16>(nLanguage) )
+                              + "\n" + OUString::number( nMaxLeading ) );
+    for (const auto& rProp : rProperties)
+        aCacheKey.append( "\n" + rProp.Name + "=" + comphelper::anyToString( rProp.Value ) );
+    OUString aKey( aCacheKey.makeStringAndClear() );
+
+    auto aCached = maHyphCache.find( aKey );
+    if (aCached != maHyphCache.end())
+        return aCached->second;
+
     else
     {
         OUString aChkWord( rWord );
@@ -391,6 +412,7 @@ Reference< XHyphenatedWord > SAL_CALL
                                    xRes->getHyphenPos() );
     }
 
+    maHyphCache.insert( { aKey, xRes } );
     return xRes;
 }
 
@@ -651,6 +673,9 @@ void HyphenatorDispatcher::SetServiceList( const Locale &rLocale,
 
     LanguageType nLanguage = LinguLocaleToLanguage( rLocale );
 
+    // new services may hyphenate differently
+    maHyphCache.clear();
+
     if (!rSvcImplNames.hasElements())
         // remove entry
         aSvcMap.erase( nLanguage );
@@ -24,6 +24,7 @@
 #include <com/sun/star/linguistic2/XSearchableDictionaryList.hpp>
 
 #include <cppuhelper/implbase.hxx>
+#include <o3tl/lru_map.hxx>
 
 #include <map>
 #include <memory>
@@ -50,6 +51,10 @@ class HyphenatorDispatcher :
 
     LngSvcMgr      &rMgr;
 
+    // results of hyphenate() by word, language, max leading and properties;
+    // formatting asks for the same words at every line end again
+    o3tl::lru_map< OUString, css::uno::Reference< css::linguistic2::XHyphenatedWord > > maHyphCache;
+
     HyphenatorDispatcher(const HyphenatorDispatcher &) = delete;
     HyphenatorDispatcher & operator = (const HyphenatorDispatcher &) = delete;
 
@@ -103,6 +108,8 @@ public:
                 const css::uno::Sequence< OUString > &rSvcImplNames ) override;
     virtual css::uno::Sequence< OUString >
         GetServiceList( const css::lang::Locale &rLocale ) const override;
+
+    void    FlushHyphCache();
 };
 
 
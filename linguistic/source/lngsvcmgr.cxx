@@ -252,6 +252,8 @@ void LngSvcMgrListenerHelper::Timeout()
 
         if (rMyManager.mxSpellDsp.is())
             rMyManager.mxSpellDsp->FlushSpellCache();
+        if (rMyManager.mxHyphDsp.is())
+            rMyManager.mxHyphDsp->FlushHyphCache();
 
         // pass event on to linguistic2::XLinguServiceEventListener's
         aLngSvcMgrListeners.notifyEach( &linguistic2::XLinguServiceEventListener::processLinguServiceEvent, aEvtObj );
@@ -318,6 +320,8 @@ void SAL_CALL
 
     if (rMyManager.mxSpellDsp.is())
         rMyManager.mxSpellDsp->FlushSpellCache();
+    if (rMyManager.mxHyphDsp.is())
+        rMyManager.mxHyphDsp->FlushHyphCache();
     if (nLngSvcEvt)
         LaunchEvent( nLngSvcEvt );
 }
@@ -67,8 +67,10 @@ FastParser::FastParser() :
     // create a fast parser instance
     mxParser = new sax_fastparser::FastSaxParser;
 
-    // create the fast tokenhandler
-    mxTokenHandler.set( new FastTokenHandler );
+    // the fast tokenhandler only reads the static token map, so one instance
+    // serves all parsers, including those of sheets imported in parallel
+    static const rtl::Reference< FastTokenHandler > xTokenHandler( new FastTokenHandler );
+    mxTokenHandler = xTokenHandler;
 
     // create the fast token handler based on the OOXML token list
     mxParser->setTokenHandler( mxTokenHandler );
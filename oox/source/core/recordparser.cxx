@@ -19,6 +19,7 @@
 
 #include <oox/core/recordparser.hxx>
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 #include <com/sun/star/io/IOException.hpp>
@@ -158,48 +159,88 @@ void ContextStack::popContext()
 
 namespace {
 
-/** Reads a byte from the passed stream, returns true on success. */
-bool lclReadByte( sal_uInt8& ornByte, BinaryInputStream& rStrm )
+const sal_Int32 RECORDREADER_BUFFERSIZE = 0x10000;
+
+/** Reads records from a binary stream through a read-ahead buffer.
+
+    Record headers are read byte by byte, and most records are only a few
+    bytes long, so reading each of them directly from the stream would
+    cost one or more stream calls per byte.
+ */
+class RecordReader
+{
+public:
+    explicit RecordReader( BinaryInputStream& rStrm ) :
+        mrStrm( rStrm ), maBuffer( RECORDREADER_BUFFERSIZE ), mnBufferPos( 0 ), mnBufferSize( 0 ) {}
+
+    /** Reads the next record, returns true on success. */
+    bool readNextRecord( sal_Int32& ornRecId, StreamDataSequence& orData );
+
+private:
+    bool readByte( sal_uInt8& ornByte );
+    bool readCompressedInt( sal_Int32& ornValue );
+    bool fillBuffer();
+
+    BinaryInputStream& mrStrm;
+    StreamDataSequence maBuffer;
+    sal_Int32 mnBufferPos;
+    sal_Int32 mnBufferSize;
+};
+
+bool RecordReader::fillBuffer()
 {
-    return rStrm.readMemory( &ornByte, 1 ) == 1;
+    mnBufferPos = 0;
+    mnBufferSize = mrStrm.isEof() ? 0 : mrStrm.readData( maBuffer, RECORDREADER_BUFFERSIZE );
+    return mnBufferSize > 0;
 }
 
-/** Reads a compressed signed 32-bit integer from the passed stream. */
-bool lclReadCompressedInt( sal_Int32& ornValue, BinaryInputStream& rStrm )
+/** Reads a byte from the buffer, returns true on success. */
+bool RecordReader::readByte( sal_uInt8& ornByte )
+{
+    if( (mnBufferPos == mnBufferSize) && !fillBuffer() )
+        return false;
+    ornByte = static_cast< sal_uInt8 >( maBuffer.getConstArray()[ mnBufferPos++ ] );
+    return true;
+}
+
+/** Reads a compressed signed 32-bit integer from the buffer. */
+bool RecordReader::readCompressedInt( sal_Int32& ornValue )
 {
     ornValue = 0;
     sal_uInt8 nByte;
-    if( !lclReadByte( nByte, rStrm ) ) return false;
+    if( !readByte( nByte ) ) return false;
     ornValue = nByte & 0x7F;
     if( (nByte & 0x80) == 0 ) return true;
-    if( !lclReadByte( nByte, rStrm ) ) return false;
+    if( !readByte( nByte ) ) return false;
     ornValue |= sal_Int32( nByte & 0x7F ) << 7;
     if( (nByte & 0x80) == 0 ) return true;
-    if( !lclReadByte( nByte, rStrm ) ) return false;
+    if( !readByte( nByte ) ) return false;
     ornValue |= sal_Int32( nByte & 0x7F ) << 14;
     if( (nByte & 0x80) == 0 ) return true;
-    if( !lclReadByte( nByte, rStrm ) ) return false;
+    if( !readByte( nByte ) ) return false;
     ornValue |= sal_Int32( nByte & 0x7F ) << 21;
     return true;
 }
 
-bool lclReadRecordHeader( sal_Int32& ornRecId, sal_Int32& ornRecSize, BinaryInputStream& rStrm )
-{
-    return
-        lclReadCompressedInt( ornRecId, rStrm ) && (ornRecId >= 0) &&
-        lclReadCompressedInt( ornRecSize, rStrm ) && (ornRecSize >= 0);
-}
-
-bool lclReadNextRecord( sal_Int32& ornRecId, StreamDataSequence& orData, BinaryInputStream& rStrm )
+bool RecordReader::readNextRecord( sal_Int32& ornRecId, StreamDataSequence& orData )
 {
     sal_Int32 nRecSize = 0;
-    bool bValid = lclReadRecordHeader( ornRecId, nRecSize, rStrm );
-    if( bValid )
+    if( !readCompressedInt( ornRecId ) || (ornRecId < 0) || !readCompressedInt( nRecSize ) || (nRecSize < 0) )
+        return false;
+
+    orData.realloc( nRecSize );
+    sal_Int8* pData = orData.getArray();
+    sal_Int32 nDataPos = 0;
+    while( nDataPos < nRecSize )
     {
-        orData.realloc( nRecSize );
-        bValid = (nRecSize == 0) || (rStrm.readData( orData, nRecSize ) == nRecSize);
+        if( (mnBufferPos == mnBufferSize) && !fillBuffer() )
+            return false;
+        sal_Int32 nCopy = std::min( nRecSize - nDataPos, mnBufferSize - mnBufferPos );
+        std::copy_n( maBuffer.getConstArray() + mnBufferPos, nCopy, pData + nDataPos );
+        mnBufferPos += nCopy;
+        nDataPos += nCopy;
     }
-    return bValid;
+    return true;
 }
 
 } // namespace
@@ -247,9 +288,10 @@ void RecordParser::parseStream( const RecordInputSource& rInputSource )
 
     // parse the stream
     mxStack.reset( new prv::ContextStack( mxHandler ) );
+    RecordReader aReader( *maSource.mxInStream );
     sal_Int32 nRecId = 0;
     StreamDataSequence aRecData;
-    while( lclReadNextRecord( nRecId, aRecData, *maSource.mxInStream ) )
+    while( aReader.readNextRecord( nRecId, aRecData ) )
     {
         // create record stream object from imported record data
         SequenceInputStream aRecStrm( aRecData );
@@ -72,21 +72,33 @@ const Relation* Relations::getRelationFromRelId( const OUString& rId ) const
     return (aIt == maMap.end()) ? nullptr : &aIt->second;
 }
 
+void Relations::emplace( const OUString& rId, const Relation& rRelation )
+{
+    auto [aIt, bInserted] = maMap.emplace( rId, rRelation );
+    if( !bInserted )
+        return;
+
+    // the first relation of a type is the one with the lowest id, as when iterating maMap
+    auto [aTypeIt, bNewType] = maFirstOfType.emplace( rRelation.maType.toAsciiLowerCase(), &aIt->second );
+    if( !bNewType && rId < aTypeIt->second->maId )
+        aTypeIt->second = &aIt->second;
+}
+
 const Relation* Relations::getRelationFromFirstType( std::u16string_view rType ) const
 {
-    for (auto const& elem : maMap)
-        if( elem.second.maType.equalsIgnoreAsciiCase( rType ) )
-            return &elem.second;
-    return nullptr;
+    auto aIt = maFirstOfType.find( OUString( rType ).toAsciiLowerCase() );
+    return (aIt == maFirstOfType.end()) ? nullptr : aIt->second;
 }
 
 RelationsRef Relations::getRelationsFromTypeFromOfficeDoc( std::u16string_view rType ) const
 {
+    const OUString aTransitionalType( createOfficeDocRelationTypeTransitional( rType ) );
+    const OUString aStrictType( createOfficeDocRelationTypeStrict( rType ) );
     RelationsRef xRelations = std::make_shared<Relations>( maFragmentPath );
     for (auto const& elem : maMap)
-        if( elem.second.maType.equalsIgnoreAsciiCase( createOfficeDocRelationTypeTransitional(rType) ) ||
-                elem.second.maType.equalsIgnoreAsciiCase( createOfficeDocRelationTypeStrict(rType) ))
-            xRelations->maMap[ elem.first ] = elem.second;
+        if( elem.second.maType.equalsIgnoreAsciiCase( aTransitionalType ) ||
+                elem.second.maType.equalsIgnoreAsciiCase( aStrictType ))
+            xRelations->emplace( elem.first, elem.second );
     return xRelations;
 }
 
@@ -54,6 +54,7 @@
 #include <oox/mathml/imexport.hxx>
 #include <oox/mathml/importutils.hxx>
 #include <oox/token/properties.hxx>
+#include <oox/token/relationship.hxx>
 #include "diagram/datamodel_oox.hxx"
 #include <oox/drawingml/diagram/diagramhelper_oox.hxx>
 
@@ -2618,47 +2619,27 @@ void Shape::finalizeXShape( XmlFilterBase& rFilter, const Reference< XShapes >&
                         rFilter, mxChartShapeInfo->maFragmentPath, aModel );
                 rFilter.importFragment( pChartSpaceFragment );
 
-                // Import styles file.
-                // Create the styles path from the path to the chart*.xml file
-                sal_Int32 nLastSlash = mxChartShapeInfo->maFragmentPath.lastIndexOf('/');
-                const sal_Unicode *pFPath = mxChartShapeInfo->maFragmentPath.getStr();
-                OUString sStylePath(pFPath, nLastSlash + 1);
-                const OUString sFullPath(pFPath);
-                sStylePath += u"style"_ustr;
-                OUString sChartFName(sFullPath.copy(nLastSlash + 1, sFullPath.getLength() - nLastSlash - 1));
-                OUString sTail;
-                // Verify that the path is the way we expect it, and extract the
-                // end bit. Don't put the startsWith() call inside an assert,
-                // because we don't want it optimized away.
-                const bool bWellFormed = sChartFName.startsWith(std::u16string_view(u"chart"), &sTail);
-                if (!bWellFormed) {
-                    assert(false);
-                }
-                // We should have something of the form 'chart1234.xml'. We
-                // want to get the numeric ('1234') part, since it should be
-                // the same for the style file.
-                sal_Int32 nPeriod = sTail.indexOf('.');
-                OUString sNumber(sTail.copy(0, nPeriod));
-
-                sStylePath += sNumber;
-                sStylePath += u".xml"_ustr;
-
+                // Import the styles and colors parts, if the chart part refers to them. Older
+                // files have neither, don't try to open streams that are not there.
                 chart::StyleModel aStyleModel;
-                rtl::Reference<chart::StyleFragment> pStyleFragment = new chart::StyleFragment(
-                        rFilter, sStylePath, aStyleModel );
-                rFilter.importFragment( pStyleFragment );
-
-                // Import colors file.
-                OUString sColorPath(pFPath, nLastSlash + 1);
-                sColorPath += u"colors"_ustr;
-                sChartFName = sFullPath.copy(nLastSlash + 1, sFullPath.getLength() - nLastSlash - 1);
-                sColorPath += sNumber;
-                sColorPath += u".xml"_ustr;
+                const OUString aStyleFragmentPath( pChartSpaceFragment->getFragmentPathFromFirstType(
+                        oox::getRelationship(Relationship::CHARTSTYLE)) );
+                if (!aStyleFragmentPath.isEmpty())
+                {
+                    rtl::Reference<chart::StyleFragment> pStyleFragment = new chart::StyleFragment(
+                            rFilter, aStyleFragmentPath, aStyleModel );
+                    rFilter.importFragment( pStyleFragment );
+                }
 
                 chart::ColorStyleModel aColorsModel;
-                rtl::Reference<chart::ColorsFragment> pColorsFragment =
-                    new chart::ColorsFragment( rFilter, sColorPath, aColorsModel );
-                rFilter.importFragment( pColorsFragment );
+                const OUString aColorsFragmentPath( pChartSpaceFragment->getFragmentPathFromFirstType(
+                        oox::getRelationship(Relationship::CHARTCOLORSTYLE)) );
+                if (!aColorsFragmentPath.isEmpty())
+                {
+                    rtl::Reference<chart::ColorsFragment> pColorsFragment =
+                        new chart::ColorsFragment( rFilter, aColorsFragmentPath, aColorsModel );
+                    rFilter.importFragment( pColorsFragment );
+                }
 
 
                 // The original theme.
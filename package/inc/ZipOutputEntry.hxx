@@ -21,6 +21,7 @@
 
 #include <com/sun/star/io/XOutputStream.hpp>
 #include <com/sun/star/io/XTempFile.hpp>
+#include <com/sun/star/packages/zip/ZipConstants.hpp>
 #include <com/sun/star/uno/Reference.hxx>
 #include <com/sun/star/uno/XComponentContext.hpp>
 #include <com/sun/star/xml/crypto/XCipherContext.hpp>
@@ -92,7 +93,8 @@ public:
     ZipOutputEntry(
         const css::uno::Reference< css::io::XOutputStream >& rxOutStream,
         const css::uno::Reference< css::uno::XComponentContext >& rxContext,
-        ZipEntry* pEntry, ZipPackageStream* pStream, bool bEncrypt);
+        ZipEntry* pEntry, ZipPackageStream* pStream, bool bEncrypt,
+        sal_Int32 nLevel = css::packages::zip::ZipConstants::DEFAULT_COMPRESSION);
     void writeStream(const css::uno::Reference< css::io::XInputStream >& xInStream) override;
     void write(const css::uno::Sequence< sal_Int8 >& rBuffer);
 
@@ -100,7 +102,8 @@ protected:
     ZipOutputEntry(
         const css::uno::Reference< css::io::XOutputStream >& rxOutStream,
         const css::uno::Reference< css::uno::XComponentContext >& rxContext,
-        ZipEntry* pEntry, ZipPackageStream* pStream, bool bEncrypt, bool checkStream);
+        ZipEntry* pEntry, ZipPackageStream* pStream, bool bEncrypt, bool checkStream,
+        sal_Int32 nLevel);
     virtual void finishDeflater() override;
     virtual sal_Int64 getDeflaterTotalIn() const override;
     virtual sal_Int64 getDeflaterTotalOut() const override;
@@ -115,18 +118,21 @@ class ZipOutputEntryInThread final : public ZipOutputEntry
     class Task;
     std::unique_ptr<ZipEntry> m_pOwnedZipEntry;
     rtl::Reference<utl::TempFileFastService> m_xTempFile;
+    css::uno::Sequence< sal_Int8 > m_aMemoryBuffer;
+    bool m_bBufferInMemory;
     std::exception_ptr m_aParallelDeflateException;
     std::atomic<bool>   m_bFinished;
 
 public:
     ZipOutputEntryInThread(
         const css::uno::Reference< css::uno::XComponentContext >& rxContext,
-        std::unique_ptr<ZipEntry>&& pEntry, ZipPackageStream* pStream, bool bEncrypt);
+        std::unique_ptr<ZipEntry>&& pEntry, ZipPackageStream* pStream, bool bEncrypt,
+        sal_Int32 nLevel, bool bBufferInMemory);
     std::unique_ptr<comphelper::ThreadTask> createTask(
         const std::shared_ptr<comphelper::ThreadTaskTag>& pTag,
         const css::uno::Reference< css::io::XInputStream >& xInStream );
     /* This block of methods is for threaded zipping, where we compress to a temp stream, whose
-       data is retrieved via getData */
+       data is retrieved via getData. Small entries use a memory buffer instead of a temp file */
     void createBufferFile();
     void setParallelDeflateException(const std::exception_ptr& exception) { m_aParallelDeflateException = exception; }
     css::uno::Reference< css::io::XInputStream > getData() const;
@@ -146,11 +152,12 @@ class ZipOutputEntryParallel final : public ZipOutputEntryBase
     sal_Int64 totalIn;
     sal_Int64 totalOut;
     bool finished;
+    sal_Int32 level;
 public:
     ZipOutputEntryParallel(
         const css::uno::Reference< css::io::XOutputStream >& rxOutStream,
         const css::uno::Reference< css::uno::XComponentContext >& rxContext,
-        ZipEntry* pEntry, ZipPackageStream* pStream, bool bEncrypt);
+        ZipEntry* pEntry, ZipPackageStream* pStream, bool bEncrypt, sal_Int32 nLevel);
     void writeStream(const css::uno::Reference< css::io::XInputStream >& xInStream) override;
 private:
     virtual void finishDeflater() override;
@@ -28,6 +28,7 @@
 #include <com/sun/star/beans/PropertyValue.hpp>
 #include <com/sun/star/beans/NamedValue.hpp>
 #include <com/sun/star/lang/XServiceInfo.hpp>
+#include <com/sun/star/packages/zip/ZipConstants.hpp>
 #include <com/sun/star/xml/crypto/CipherID.hpp>
 #include <comphelper/refcountedmutex.hxx>
 #include <rtl/ref.hxx>
@@ -99,6 +100,8 @@ class ZipPackage final : public cppu::WeakImplHelper
 
     std::optional<ZipFile> m_pZipFile;
     bool m_bDisableFileSync = false;
+    /// zlib level used to deflate the entries written, see ZipConstants
+    sal_Int32 m_nCompressionLevel = css::packages::zip::ZipConstants::DEFAULT_COMPRESSION;
 
     bool isLocalFile() const;
 
@@ -121,6 +124,7 @@ public:
     virtual ~ZipPackage() override;
     ZipFile& getZipFile() { return *m_pZipFile;}
     sal_Int32 getFormat() const { return m_nFormat; }
+    sal_Int32 getCompressionLevel() const { return m_nCompressionLevel; }
 
     sal_Int32 GetStartKeyGenID() const { return m_nStartKeyGenerationID; }
     sal_Int32 GetEncAlgID() const { return m_nCommonEncryptionID; }
@@ -196,9 +196,9 @@ uno::Reference< uno::XInterface > SAL_CALL OStorageFactory::createInstanceWithAr
                     else
                         throw lang::IllegalArgumentException( u""_ustr, uno::Reference< uno::XInterface >(), 1 );
                 }
-                else if (rProp.Name == "NoFileSync")
+                else if (rProp.Name == "NoFileSync" || rProp.Name == "CompressionLevel")
                 {
-                    // Forward NoFileSync to the storage.
+                    // Forward NoFileSync and CompressionLevel to the storage.
                     aPropsToSet.realloc(++nNumArgs);
                     auto pPropsToSet = aPropsToSet.getArray();
                     pPropsToSet[nNumArgs - 1].Name = rProp.Name;
@@ -392,7 +392,8 @@ void OStorage_Impl::OpenOwnPackage()
             {
                 if ( rProp.Name == "RepairPackage"
                   || rProp.Name == "ProgressHandler"
-                  || rProp.Name == "NoFileSync" )
+                  || rProp.Name == "NoFileSync"
+                  || rProp.Name == "CompressionLevel" )
                 {
                     // Forward these to the package.
                     beans::NamedValue aNamedValue( rProp.Name, rProp.Value );
@@ -163,10 +163,11 @@ XUnbufferedStream::~XUnbufferedStream()
 {
 }
 
+// The package mutex only guards the zip stream shared by all entries of the
+// package, so decryption, inflating and the CRC run outside of it and several
+// entries read by XBufferedThreadedStream can be inflated at the same time.
 sal_Int32 SAL_CALL XUnbufferedStream::readBytes( Sequence< sal_Int8 >& aData, sal_Int32 nBytesToRead )
 {
-    ::osl::MutexGuard aGuard( maMutexHolder->GetMutex() );
-
     sal_Int32 nRequestedBytes = nBytesToRead;
     OSL_ENSURE( !mnHeaderToRead || mbWrappedRaw, "Only encrypted raw stream can be provided with header!" );
     if ( mnMyCurrent + nRequestedBytes > mnZipSize + maHeader.getLength() )
@@ -195,8 +196,11 @@ sal_Int32 SAL_CALL XUnbufferedStream::readBytes( Sequence< sal_Int8 >& aData, sa
                     nToRead = ( nDiff < nToRead ) ? sal::static_int_cast< sal_Int32 >( nDiff ) : nToRead;
 
                     Sequence< sal_Int8 > aPureData( nToRead );
-                    mxZipSeek->seek ( mnZipCurrent );
-                    nRead = mxZipStream->readBytes ( aPureData, nToRead );
+                    {
+                        ::osl::MutexGuard aGuard( maMutexHolder->GetMutex() );
+                        mxZipSeek->seek ( mnZipCurrent );
+                        nRead = mxZipStream->readBytes ( aPureData, nToRead );
+                    }
                     mnZipCurrent += nRead;
 
                     aPureData.realloc( nRead );
@@ -212,11 +216,14 @@ sal_Int32 SAL_CALL XUnbufferedStream::readBytes( Sequence< sal_Int8 >& aData, sa
             }
             else
             {
-                mxZipSeek->seek ( mnZipCurrent );
+                {
+                    ::osl::MutexGuard aGuard( maMutexHolder->GetMutex() );
+                    mxZipSeek->seek ( mnZipCurrent );
 
-                nRead = mxZipStream->readBytes (
-                                        aData,
-                                        std::min<sal_Int64>(nDiff, nRequestedBytes) );
+                    nRead = mxZipStream->readBytes (
+                                            aData,
+                                            std::min<sal_Int64>(nDiff, nRequestedBytes) );
+                }
 
                 mnZipCurrent += nRead;
 
@@ -249,14 +256,17 @@ sal_Int32 SAL_CALL XUnbufferedStream::readBytes( Sequence< sal_Int8 >& aData, sa
                     throw ZipIOException(u"The stream seems to be broken!"_ustr );
                 }
 
-                mxZipSeek->seek ( mnZipCurrent );
-
                 sal_Int32 nToRead = std::max( nRequestedBytes, static_cast< sal_Int32 >( 8192 ) );
                 if ( mnBlockSize > 1 )
                     nToRead = nToRead + mnBlockSize - nToRead % mnBlockSize;
                 nToRead = std::min( nDiff, nToRead );
 
-                sal_Int32 nZipRead = mxZipStream->readBytes( maCompBuffer, nToRead );
+                sal_Int32 nZipRead;
+                {
+                    ::osl::MutexGuard aGuard( maMutexHolder->GetMutex() );
+                    mxZipSeek->seek ( mnZipCurrent );
+                    nZipRead = mxZipStream->readBytes( maCompBuffer, nToRead );
+                }
                 if ( nZipRead < nToRead )
                     throw ZipIOException(u"No expected data!"_ustr );
 
@@ -589,30 +589,34 @@ namespace {
 class XBufferedStream : public cppu::WeakImplHelper<css::io::XInputStream, css::io::XSeekable>,
                         public comphelper::ByteReader
 {
-    std::vector<sal_Int8> maBytes;
+    uno::Sequence<sal_Int8> maBytes;
     size_t mnPos;
 
+    size_t size() const
+    {
+        return maBytes.getLength();
+    }
+
     size_t remainingSize() const
     {
-        return maBytes.size() - mnPos;
+        return size() - mnPos;
     }
 
     bool hasBytes() const
     {
-        return mnPos < maBytes.size();
+        return mnPos < size();
     }
 
 public:
     XBufferedStream( const uno::Reference<XInputStream>& xSrcStream ) : mnPos(0)
     {
         sal_Int32 nRemaining = xSrcStream->available();
-        maBytes.reserve(nRemaining);
 
         if (auto pByteReader = dynamic_cast< comphelper::ByteReader* >( xSrcStream.get() ))
         {
-            maBytes.resize(nRemaining);
+            maBytes.realloc(nRemaining);
 
-            sal_Int8* pData = maBytes.data();
+            sal_Int8* pData = maBytes.getArray();
             while (nRemaining > 0)
             {
                 sal_Int32 nRead = pByteReader->readSomeBytes(pData, nRemaining);
@@ -622,15 +626,25 @@ public:
             return;
         }
 
-        const sal_Int32 nBufSize = 8192;
-        uno::Sequence<sal_Int8> aBuf(nBufSize);
-        while (nRemaining > 0)
+        // read the whole entry in one go, so that stored entries are copied
+        // straight from the package stream and deflated ones are inflated
+        // straight into the buffer, instead of going through a bounce buffer
+        sal_Int32 nTotal = xSrcStream->readBytes(maBytes, nRemaining);
+        nRemaining -= nTotal;
+        if (nRemaining > 0 && nTotal > 0)
         {
-            const sal_Int32 nBytes = xSrcStream->readBytes(aBuf, std::min(nBufSize, nRemaining));
-            if (!nBytes)
-                break;
-            maBytes.insert(maBytes.end(), aBuf.begin(), aBuf.begin() + nBytes);
-            nRemaining -= nBytes;
+            maBytes.realloc(nTotal + nRemaining);
+            uno::Sequence<sal_Int8> aBuf;
+            while (nRemaining > 0)
+            {
+                const sal_Int32 nBytes = xSrcStream->readBytes(aBuf, nRemaining);
+                if (!nBytes)
+                    break;
+                std::copy_n(aBuf.getConstArray(), nBytes, maBytes.getArray() + nTotal);
+                nTotal += nBytes;
+                nRemaining -= nBytes;
+            }
+            maBytes.realloc(nTotal);
         }
     }
 
@@ -641,11 +655,7 @@ public:
 
         sal_Int32 nReadSize = std::min<sal_Int32>(nBytesToRead, remainingSize());
         rData.realloc(nReadSize);
-        auto pData = rData.getArray();
-        std::vector<sal_Int8>::const_iterator it = maBytes.cbegin();
-        std::advance(it, mnPos);
-        for (sal_Int32 i = 0; i < nReadSize; ++i, ++it)
-            pData[i] = *it;
+        std::copy_n(maBytes.getConstArray() + mnPos, nReadSize, rData.getArray());
 
         mnPos += nReadSize;
 
@@ -658,10 +668,7 @@ public:
             return 0;
 
         sal_Int32 nReadSize = std::min<sal_Int32>(nBytesToRead, remainingSize());
-        std::vector<sal_Int8>::const_iterator it = maBytes.cbegin();
-        std::advance(it, mnPos);
-        for (sal_Int32 i = 0; i < nReadSize; ++i, ++it)
-            pData[i] = *it;
+        std::copy_n(maBytes.getConstArray() + mnPos, nReadSize, pData);
 
         mnPos += nReadSize;
 
@@ -695,7 +702,7 @@ public:
     // XSeekable
     virtual void SAL_CALL seek( sal_Int64 location ) override
     {
-        if ( location < 0 || o3tl::make_unsigned(location) > maBytes.size() )
+        if ( location < 0 || o3tl::make_unsigned(location) > size() )
             throw IllegalArgumentException(u""_ustr, uno::Reference< uno::XInterface >(), 1 );
         mnPos = location;
     }
@@ -705,7 +712,7 @@ public:
     }
     virtual sal_Int64 SAL_CALL getLength() override
     {
-        return maBytes.size();
+        return size();
     }
 };
 
@@ -23,6 +23,7 @@
 #include <com/sun/star/packages/zip/ZipConstants.hpp>
 #include <com/sun/star/xml/crypto/CipherID.hpp>
 
+#include <comphelper/seqstream.hxx>
 #include <osl/diagnose.h>
 
 #include <PackageConstants.hxx>
@@ -180,10 +181,11 @@ ZipOutputEntry::ZipOutputEntry(
         ZipEntry* pEntry,
         ZipPackageStream* pStream,
         bool bEncrypt,
-        bool checkStream)
+        bool checkStream,
+        sal_Int32 nLevel)
 : ZipOutputEntryBase(rxOutput, rxContext, pEntry, pStream, bEncrypt, checkStream)
 , m_aDeflateBuffer(n_ConstBufferSize)
-, m_aDeflater(DEFAULT_COMPRESSION, true)
+, m_aDeflater(nLevel, true)
 {
 }
 
@@ -192,8 +194,9 @@ ZipOutputEntry::ZipOutputEntry(
         const uno::Reference< uno::XComponentContext >& rxContext,
         ZipEntry* pEntry,
         ZipPackageStream* pStream,
-        bool bEncrypt)
-: ZipOutputEntry( rxOutput, rxContext, pEntry, pStream, bEncrypt, true)
+        bool bEncrypt,
+        sal_Int32 nLevel)
+: ZipOutputEntry( rxOutput, rxContext, pEntry, pStream, bEncrypt, true, nLevel)
 {
 }
 
@@ -246,9 +249,12 @@ ZipOutputEntryInThread::ZipOutputEntryInThread(
         const uno::Reference< uno::XComponentContext >& rxContext,
         std::unique_ptr<ZipEntry>&& pEntry,
         ZipPackageStream* pStream,
-        bool bEncrypt)
-: ZipOutputEntry( uno::Reference< css::io::XOutputStream >(), rxContext, pEntry.get(), pStream, bEncrypt, false )
+        bool bEncrypt,
+        sal_Int32 nLevel,
+        bool bBufferInMemory)
+: ZipOutputEntry( uno::Reference< css::io::XOutputStream >(), rxContext, pEntry.get(), pStream, bEncrypt, false, nLevel )
 , m_pOwnedZipEntry(std::move(pEntry))
+, m_bBufferInMemory(bBufferInMemory)
 , m_bFinished(false)
 {
 }
@@ -257,6 +263,11 @@ void ZipOutputEntryInThread::createBufferFile()
 {
     assert(!m_xOutStream && !m_xTempFile &&
            "should only be called in the threaded mode where there is no existing stream yet");
+    if (m_bBufferInMemory)
+    {
+        m_xOutStream = new comphelper::OSequenceOutputStream(m_aMemoryBuffer);
+        return;
+    }
     m_xTempFile = new utl::TempFileFastService;
     m_xOutStream = m_xTempFile->getOutputStream();
 }
@@ -269,12 +280,15 @@ void ZipOutputEntryInThread::closeBufferFile()
 
 void ZipOutputEntryInThread::deleteBufferFile()
 {
-    assert(!m_xOutStream.is() && m_xTempFile);
+    assert(!m_xOutStream.is() && (m_xTempFile || m_bBufferInMemory));
     m_xTempFile.clear();
+    m_aMemoryBuffer = uno::Sequence< sal_Int8 >();
 }
 
 uno::Reference< io::XInputStream > ZipOutputEntryInThread::getData() const
 {
+    if (m_bBufferInMemory)
+        return new comphelper::SequenceInputStream(m_aMemoryBuffer);
     return m_xTempFile->getInputStream();
 }
 
@@ -349,17 +363,19 @@ ZipOutputEntryParallel::ZipOutputEntryParallel(
         const uno::Reference< uno::XComponentContext >& rxContext,
         ZipEntry* pEntry,
         ZipPackageStream* pStream,
-        bool bEncrypt)
+        bool bEncrypt,
+        sal_Int32 nLevel)
 : ZipOutputEntryBase(rxOutput, rxContext, pEntry, pStream, bEncrypt, true)
 , totalIn(0)
 , totalOut(0)
 , finished(false)
+, level(nLevel)
 {
 }
 
 void ZipOutputEntryParallel::writeStream(const uno::Reference< io::XInputStream >& xInStream)
 {
-    ZipUtils::ThreadedDeflater deflater( DEFAULT_COMPRESSION );
+    ZipUtils::ThreadedDeflater deflater( level );
     deflater.deflateWrite(xInStream,
             [this](const uno::Sequence< sal_Int8 >& rBuffer, sal_Int32 nLen) {
                 if (!m_bEncryptCurrentEntry)
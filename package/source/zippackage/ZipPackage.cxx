@@ -841,6 +841,17 @@ void SAL_CALL ZipPackage::initialize( const uno::Sequence< Any >& aArguments )
             }
             else if (aNamedValue.Name == "NoFileSync")
                 aNamedValue.Value >>= m_bDisableFileSync;
+            else if (aNamedValue.Name == "CompressionLevel")
+            {
+                // e.g. BEST_SPEED for internal storage where saving fast
+                // matters more than the size
+                sal_Int32 nLevel = 0;
+                if (!(aNamedValue.Value >>= nLevel)
+                    || nLevel < packages::zip::ZipConstants::DEFAULT_COMPRESSION
+                    || nLevel > packages::zip::ZipConstants::BEST_COMPRESSION)
+                    throw lang::IllegalArgumentException(u""_ustr, uno::Reference< uno::XInterface >(), 1 );
+                m_nCompressionLevel = nLevel;
+            }
 
             // for now the progress handler is not used, probably it will never be
             // if ( aNamedValue.Name == "ProgressHandler" )
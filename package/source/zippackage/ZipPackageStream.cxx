@@ -796,11 +796,12 @@ bool ZipPackageStream::saveChild(
                     // This is suitable for large data.
                     bBackgroundThreadDeflate = false;
                     rZipOut.writeLOC(std::move(pAutoTempEntry), bToBeEncrypted);
-                    ZipOutputEntryParallel aZipEntry(rZipOut.getStream(), m_xContext, pTempEntry, this, bToBeEncrypted);
+                    ZipOutputEntryParallel aZipEntry(rZipOut.getStream(), m_xContext, pTempEntry, this, bToBeEncrypted,
+                                                     m_rZipPackage.getCompressionLevel());
                     aZipEntry.writeStream(xStream);
                     rZipOut.rawCloseEntry(bToBeEncrypted);
                 }
-                else if (bBackgroundThreadDeflate && estimatedSize > 100000)
+                else if (bBackgroundThreadDeflate && estimatedSize > 10000)
                 {
                     // tdf#93553 limit to a useful amount of pending tasks. Having way too many
                     // tasks pending may use a lot of memory. Take number of available
@@ -811,8 +812,12 @@ bool ZipPackageStream::saveChild(
                     rZipOut.reduceScheduledThreadTasksToGivenNumberOrLess(nAllowedTasks);
 
                     // Start a new thread task deflating this zip entry
+                    // Small entries are numerous in e.g. XLSX and DOCX files, keep their
+                    // deflated data in memory, creating a temp file would cost more than
+                    // deflating them.
                     ZipOutputEntryInThread *pZipEntry = new ZipOutputEntryInThread(
-                            m_xContext, std::move(pAutoTempEntry), this, bToBeEncrypted);
+                            m_xContext, std::move(pAutoTempEntry), this, bToBeEncrypted,
+                            m_rZipPackage.getCompressionLevel(), estimatedSize <= 100000);
                     rZipOut.addDeflatingThreadTask( pZipEntry,
                             pZipEntry->createTask( rZipOut.getThreadTaskTag(), xStream) );
                 }
@@ -820,7 +825,8 @@ bool ZipPackageStream::saveChild(
                 {
                     bBackgroundThreadDeflate = false;
                     rZipOut.writeLOC(std::move(pAutoTempEntry), bToBeEncrypted);
-                    ZipOutputEntry aZipEntry(rZipOut.getStream(), m_xContext, pTempEntry, this, bToBeEncrypted);
+                    ZipOutputEntry aZipEntry(rZipOut.getStream(), m_xContext, pTempEntry, this, bToBeEncrypted,
+                                             m_rZipPackage.getCompressionLevel());
                     aZipEntry.writeStream(xStream);
                     rZipOut.rawCloseEntry(bToBeEncrypted);
                 }
@@ -1279,10 +1279,33 @@ oslFileError openFilePath(const OString& filePath, oslFileHandle* pHandle,
 #endif  /* F_SETLK */
     }
 
+#if defined LINUX
+    if (!(flags & O_RDWR))
+    {
+        // Read-only opens are overwhelmingly whole-file imports; let the kernel read ahead more
+        // aggressively. This is only a hint, so failure is not an error.
+        int e = posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        SAL_INFO_IF(e != 0, "sal.file", "posix_fadvise(" << fd << ",SEQUENTIAL): " << UnixErrnoString(e));
+    }
+#endif
+
     /* allocate memory for impl structure */
     FileHandle_Impl *pImpl = new FileHandle_Impl(fd, FileHandle_Impl::KIND_FD, filePath);
     if (flags & O_RDWR)
         pImpl->m_state |= State::Writeable;
+    else if (pImpl->m_buffer != nullptr)
+    {
+        // SvFileStream reads in small chunks; serve them from fewer, larger preads
+        constexpr size_t nReadOnlyBufSize = 64 * 1024;
+        if (pImpl->m_bufsiz < nReadOnlyBufSize)
+        {
+            if (void* pBuffer = realloc(pImpl->m_buffer, nReadOnlyBufSize))
+            {
+                pImpl->m_buffer = static_cast<sal_uInt8*>(pBuffer);
+                pImpl->m_bufsiz = nReadOnlyBufSize;
+            }
+        }
+    }
 
     pImpl->m_size = sal::static_int_cast< sal_uInt64 >(aFileStat.st_size);
 
@@ -19,8 +19,10 @@
 
 #include <sal/config.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <utility>
 
@@ -320,6 +322,20 @@ static int rtl_ImplGetFastUTF8UnicodeLen( const char* pStr, sal_Int32 nLen, bool
     pEndStr  = pStr+nLen;
     while ( pStr < pEndStr )
     {
+        /* Skip runs of ASCII a word at a time, most XML attribute values and
+           character data are ASCII only */
+        if ( pEndStr - pStr >= 8 )
+        {
+            sal_uInt64 nWord;
+            memcpy( &nWord, pStr, sizeof(nWord) );
+            if ( !(nWord & SAL_CONST_UINT64(0x8080808080808080)) )
+            {
+                pStr += 8;
+                n += 8;
+                continue;
+            }
+        }
+
         unsigned char c = static_cast<unsigned char>(*pStr);
 
         if ( !(c & 0x80) )
@@ -439,15 +455,7 @@ retry:
                         return;
                     }
                     pBuffer = (*ppThis)->buffer;
-                    do
-                    {
-                        assert((static_cast<unsigned char>(*pStr)) <= 127);
-                        *pBuffer = *pStr;
-                        pBuffer++;
-                        pStr++;
-                        nLen--;
-                    }
-                    while ( nLen );
+                    std::copy_n( pStr, nLen, pBuffer );
                     if (pInfo != nullptr) {
                         *pInfo = 0;
                     }
@@ -610,11 +610,11 @@ namespace sax_fastparser {
                 maMarkStack.top()->m_DebugStartedElements.pop_front();
             }
 #endif
-            Int8Sequence aSeq( maMarkStack.top()->getData() );
+            const std::vector<sal_Int8> aData( std::move(maMarkStack.top()->getData()) );
             maMarkStack.pop();
             mbMarkStackEmpty = true;
             maCachedOutputStream.resetOutputToStream();
-            maCachedOutputStream.writeBytes( aSeq.getConstArray(), aSeq.getLength() );
+            maCachedOutputStream.writeBytes( aData.data(), aData.size() );
             return;
         }
 
@@ -622,7 +622,7 @@ namespace sax_fastparser {
         ::std::deque<sal_Int32> topDebugStartedElements(maMarkStack.top()->m_DebugStartedElements);
         ::std::deque<sal_Int32> topDebugEndedElements(maMarkStack.top()->m_DebugEndedElements);
 #endif
-        const Int8Sequence aMerge( maMarkStack.top()->getData() );
+        const std::vector<sal_Int8> aMerge( std::move(maMarkStack.top()->getData()) );
         maMarkStack.pop();
 #ifdef DBG_UTIL
         switch (eMergeType)
@@ -673,9 +673,9 @@ namespace sax_fastparser {
 
         switch ( eMergeType )
         {
-            case MergeMarks::APPEND:   maMarkStack.top()->append( aMerge );   break;
-            case MergeMarks::PREPEND:  maMarkStack.top()->prepend( aMerge );  break;
-            case MergeMarks::POSTPONE: maMarkStack.top()->postpone( aMerge ); break;
+            case MergeMarks::APPEND:   maMarkStack.top()->append( aMerge.data(), aMerge.size() );   break;
+            case MergeMarks::PREPEND:  maMarkStack.top()->prepend( aMerge.data(), aMerge.size() );  break;
+            case MergeMarks::POSTPONE: maMarkStack.top()->postpone( aMerge.data(), aMerge.size() ); break;
         }
     }
 
@@ -707,10 +707,10 @@ namespace sax_fastparser {
         maCachedOutputStream.writeBytes( reinterpret_cast<const sal_Int8*>(pStr), nLen );
     }
 
-    Int8Sequence& FastSaxSerializer::ForMerge::getData()
+    std::vector<sal_Int8>& FastSaxSerializer::ForMerge::getData()
     {
         merge( maData, maPostponed.data(), maPostponed.size(), true );
-        maPostponed.resize(0);
+        maPostponed.clear();
 
         return maData;
     }
@@ -719,66 +719,57 @@ namespace sax_fastparser {
     void FastSaxSerializer::ForMerge::print( )
     {
         std::cerr << "Data: ";
-        for ( sal_Int32 i=0, len=maData.getLength(); i < len; i++ )
+        for ( sal_Int8 c : maData )
         {
-            std::cerr << maData[i];
+            std::cerr << c;
         }
 
         std::cerr << "\nPostponed: ";
-        for ( sal_Int32 i=0, len=maPostponed.size(); i < len; i++ )
+        for ( sal_Int8 c : maPostponed )
         {
-            std::cerr << maPostponed[i];
+            std::cerr << c;
         }
 
         std::cerr << "\n";
     }
 #endif
 
-    void FastSaxSerializer::ForMerge::prepend( const Int8Sequence &rWhat )
+    void FastSaxSerializer::ForMerge::prepend( const sal_Int8* pWhat, sal_Int32 nLen )
     {
-        merge( maData, rWhat, false );
+        merge( maData, pWhat, nLen, false );
+    }
+
+    void FastSaxSerializer::ForMerge::append( const sal_Int8* pWhat, sal_Int32 nLen )
+    {
+        merge( maData, pWhat, nLen, true );
     }
 
     void FastSaxSerializer::ForMerge::append( const Int8Sequence &rWhat )
     {
-        merge( maData, rWhat, true );
+        append( rWhat.getConstArray(), rWhat.getLength() );
     }
 
-    void FastSaxSerializer::ForMerge::postpone( const Int8Sequence &rWhat )
+    void FastSaxSerializer::ForMerge::postpone( const sal_Int8* pWhat, sal_Int32 nLen )
     {
-        const sal_Int8* pData = rWhat.getConstArray();
-        maPostponed.insert(maPostponed.end(), pData, pData + rWhat.getLength());
+        maPostponed.insert(maPostponed.end(), pWhat, pWhat + nLen);
     }
 
-    void FastSaxSerializer::ForMerge::merge(Int8Sequence &rTop, const sal_Int8* pMerge, sal_Int32 nMergeLen, bool bAppend)
+    void FastSaxSerializer::ForMerge::merge(std::vector<sal_Int8> &rTop, const sal_Int8* pMerge, sal_Int32 nMergeLen, bool bAppend)
     {
         if ( nMergeLen <= 0 )
             return;
 
-        sal_Int32 nTopLen = rTop.getLength();
-
-        rTop.realloc( nTopLen + nMergeLen );
+        // insert() grows the capacity geometrically, so appending many small
+        // chunks stays linear
         if ( bAppend )
-        {
-            // append the rMerge to the rTop
-            memcpy( rTop.getArray() + nTopLen, pMerge, nMergeLen );
-        }
+            rTop.insert( rTop.end(), pMerge, pMerge + nMergeLen );
         else
-        {
-            // prepend the rMerge to the rTop
-            memmove( rTop.getArray() + nMergeLen, rTop.getConstArray(), nTopLen );
-            memcpy( rTop.getArray(), pMerge, nMergeLen );
-        }
-    }
-
-    void FastSaxSerializer::ForMerge::merge( Int8Sequence &rTop, const Int8Sequence &rMerge, bool bAppend )
-    {
-        merge(rTop, rMerge.getConstArray(), rMerge.getLength(), bAppend);
+            rTop.insert( rTop.begin(), pMerge, pMerge + nMergeLen );
     }
 
     void FastSaxSerializer::ForMerge::resetData( )
     {
-        maData = Int8Sequence();
+        maData.clear();
     }
 
     void FastSaxSerializer::ForSort::setCurrentElement( sal_Int32 nElement )
@@ -787,19 +778,19 @@ namespace sax_fastparser {
         if( std::find( rOrder.begin(), rOrder.end(), nElement ) != rOrder.end() )
         {
             mnCurrentElement = nElement;
-            if ( maData.find( nElement ) == maData.end() )
-                maData[ nElement ] = Int8Sequence();
+            // make sure the element is there, even if nothing is written to it
+            maData[ nElement ];
         }
     }
 
-    void FastSaxSerializer::ForSort::prepend( const Int8Sequence &rWhat )
+    void FastSaxSerializer::ForSort::prepend( const sal_Int8* pWhat, sal_Int32 nLen )
     {
-        append( rWhat );
+        append( pWhat, nLen );
     }
 
-    void FastSaxSerializer::ForSort::append( const Int8Sequence &rWhat )
+    void FastSaxSerializer::ForSort::append( const sal_Int8* pWhat, sal_Int32 nLen )
     {
-        merge( maData[mnCurrentElement], rWhat, true );
+        merge( maData[mnCurrentElement], pWhat, nLen, true );
     }
 
     void FastSaxSerializer::ForSort::sort()
@@ -808,16 +799,15 @@ namespace sax_fastparser {
         resetData();
 
         // Sort it all
-        std::map< sal_Int32, Int8Sequence >::iterator iter;
         for (const auto nIndex : maOrder)
         {
-            iter = maData.find( nIndex );
+            auto iter = maData.find( nIndex );
             if ( iter != maData.end() )
-                ForMerge::append( iter->second );
+                ForMerge::append( iter->second.data(), iter->second.size() );
         }
     }
 
-    Int8Sequence& FastSaxSerializer::ForSort::getData()
+    std::vector<sal_Int8>& FastSaxSerializer::ForSort::getData()
     {
         sort( );
         return ForMerge::getData();
@@ -829,8 +819,8 @@ namespace sax_fastparser {
         for ( const auto& [rElement, rData] : maData )
         {
             std::cerr << "pair: " << rElement;
-            for ( sal_Int32 i=0, len=rData.getLength(); i < len; ++i )
-                std::cerr << rData[i];
+            for ( sal_Int8 c : rData )
+                std::cerr << c;
             std::cerr << "\n";
         }
 
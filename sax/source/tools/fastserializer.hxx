@@ -164,7 +164,7 @@ private:
 
     class ForMerge : public ForMergeBase
     {
-        Int8Sequence maData;
+        std::vector<sal_Int8> maData;
         std::vector<sal_Int8> maPostponed;
 
     public:
@@ -181,25 +181,26 @@ private:
         explicit ForMerge(sal_Int32 const nTag) : m_Tag(nTag) {}
 
         virtual void setCurrentElement( ::sal_Int32 /*nToken*/ ) {}
-        virtual Int8Sequence& getData();
+        virtual std::vector<sal_Int8>& getData();
 #if OSL_DEBUG_LEVEL > 0
         virtual void print();
 #endif
 
-        virtual void prepend( const Int8Sequence &rWhat );
+        virtual void prepend( const sal_Int8* pWhat, sal_Int32 nLen );
+        virtual void append( const sal_Int8* pWhat, sal_Int32 nLen );
         virtual void append( const Int8Sequence &rWhat ) override;
-        void postpone( const Int8Sequence &rWhat );
+        void postpone( const sal_Int8* pWhat, sal_Int32 nLen );
 
     protected:
         void resetData( );
-        static void merge( Int8Sequence &rTop, const Int8Sequence &rMerge, bool bAppend );
-    private:
-        static void merge( Int8Sequence &rTop, const sal_Int8* pMerge, sal_Int32 nMergeLen, bool bAppend );
+        /// The buffers are vectors, not sequences, so that appending the
+        /// many small chunks of a big mark doesn't reallocate every time.
+        static void merge( std::vector<sal_Int8> &rTop, const sal_Int8* pMerge, sal_Int32 nMergeLen, bool bAppend );
     };
 
     class ForSort : public ForMerge
     {
-        std::map< ::sal_Int32, Int8Sequence > maData;
+        std::map< ::sal_Int32, std::vector<sal_Int8> > maData;
         sal_Int32 mnCurrentElement;
 
         Int32Sequence maOrder;
@@ -213,14 +214,15 @@ private:
 
         void setCurrentElement( ::sal_Int32 nToken ) override;
 
-        virtual Int8Sequence& getData() override;
+        virtual std::vector<sal_Int8>& getData() override;
 
 #if OSL_DEBUG_LEVEL > 0
         virtual void print() override;
 #endif
 
-        virtual void prepend( const Int8Sequence &rWhat ) override;
-        virtual void append( const Int8Sequence &rWhat ) override;
+        using ForMerge::append;
+        virtual void prepend( const sal_Int8* pWhat, sal_Int32 nLen ) override;
+        virtual void append( const sal_Int8* pWhat, sal_Int32 nLen ) override;
     private:
         void sort();
     };
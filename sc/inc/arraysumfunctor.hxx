@@ -14,6 +14,10 @@
 #include "kahan.hxx"
 #include <formula/errorcodes.hxx>
 
+#if SC_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace sc::op
 {
 /**
@@ -44,6 +48,107 @@ static inline KahanSum executeUnrolled(size_t& i, size_t nSize, const double* pC
     return 0.0;
 }
 
+/**
+  * If no boosts available, Unrolled KahanSum of the squares.
+  */
+static inline KahanSum executeUnrolledSquare(size_t& i, size_t nSize, const double* pCurrent)
+{
+    size_t nRealSize = nSize - i;
+    size_t nUnrolledSize = nRealSize - (nRealSize % 4);
+
+    if (nUnrolledSize > 0)
+    {
+        KahanSum sum0 = 0.0;
+        KahanSum sum1 = 0.0;
+        KahanSum sum2 = 0.0;
+        KahanSum sum3 = 0.0;
+
+        for (; i + 3 < nUnrolledSize; i += 4)
+        {
+            sum0 += pCurrent[0] * pCurrent[0];
+            sum1 += pCurrent[1] * pCurrent[1];
+            sum2 += pCurrent[2] * pCurrent[2];
+            sum3 += pCurrent[3] * pCurrent[3];
+            pCurrent += 4;
+        }
+        return (sum0 + sum1) + (sum2 + sum3);
+    }
+    return 0.0;
+}
+
+#if SC_USE_NEON
+/** Kahan sum with NEON, same as sumSSE2() in arraysumSSE2.cxx.
+  */
+static inline void sumNEON(float64x2_t& sum, float64x2_t& err, const float64x2_t& value)
+{
+    float64x2_t t = vaddq_f64(sum, value);
+    // Compare the absolute values sum >= value
+    uint64x2_t mask = vcgeq_f64(vabsq_f64(sum), vabsq_f64(value));
+    // The larger one of sum and value is a, the other one is b
+    float64x2_t a = vbslq_f64(mask, sum, value);
+    float64x2_t b = vbslq_f64(mask, value, sum);
+    err = vaddq_f64(err, vaddq_f64(vsubq_f64(a, t), b));
+    sum = t;
+}
+
+/** Kahan sum with NEON of the values returned by rLoad for the array
+  * positions i, i+1.
+  */
+template <typename Load>
+static inline KahanSum executeNEONImpl(size_t& i, size_t nSize, const Load& rLoad)
+{
+    if (nSize > i + 7)
+    {
+        float64x2_t sum1 = vdupq_n_f64(0.0);
+        float64x2_t err1 = vdupq_n_f64(0.0);
+        float64x2_t sum2 = vdupq_n_f64(0.0);
+        float64x2_t err2 = vdupq_n_f64(0.0);
+        float64x2_t sum3 = vdupq_n_f64(0.0);
+        float64x2_t err3 = vdupq_n_f64(0.0);
+        float64x2_t sum4 = vdupq_n_f64(0.0);
+        float64x2_t err4 = vdupq_n_f64(0.0);
+
+        for (; i + 7 < nSize; i += 8)
+        {
+            sumNEON(sum1, err1, rLoad(i));
+            sumNEON(sum2, err2, rLoad(i + 2));
+            sumNEON(sum3, err3, rLoad(i + 4));
+            sumNEON(sum4, err4, rLoad(i + 6));
+        }
+
+        // Pairwise summation of the four lanes, as with SSE2
+        sumNEON(sum1, err1, sum2);
+        sumNEON(sum1, err1, err2);
+        sumNEON(sum3, err3, sum4);
+        sumNEON(sum3, err3, err4);
+        sumNEON(sum1, err1, sum3);
+        sumNEON(sum1, err1, err3);
+
+        double fSum = vgetq_lane_f64(sum1, 0);
+        double fErr = vgetq_lane_f64(err1, 0);
+        KahanSum::sumNeumaierNormal(fSum, fErr, vgetq_lane_f64(sum1, 1));
+        KahanSum::sumNeumaierNormal(fSum, fErr, vgetq_lane_f64(err1, 1));
+        return { fSum, fErr };
+    }
+    return { 0.0, 0.0 };
+}
+
+static inline KahanSum executeNEON(size_t& i, size_t nSize, const double* pCurrent)
+{
+    const double* pArray = pCurrent - i;
+    return executeNEONImpl(i, nSize, [pArray](size_t n) { return vld1q_f64(pArray + n); });
+}
+
+static inline KahanSum executeNEONSquare(size_t& i, size_t nSize, const double* pCurrent)
+{
+    const double* pArray = pCurrent - i;
+    return executeNEONImpl(i, nSize, [pArray](size_t n) {
+        float64x2_t value = vld1q_f64(pArray + n);
+        return vmulq_f64(value, value);
+    });
+}
+#endif
+
 /**
   * This function task is to choose the fastest method available to perform the sum.
   * @param i
@@ -54,11 +159,27 @@ static inline KahanSum executeFast(size_t& i, size_t nSize, const double* pCurre
 {
 #if SC_USE_SSE2
     return executeSSE2(i, nSize, pCurrent);
+#elif SC_USE_NEON
+    return executeNEON(i, nSize, pCurrent);
 #else
     return executeUnrolled(i, nSize, pCurrent);
 #endif
 }
 
+/**
+  * Same as executeFast(), for the sum of the squares.
+  */
+static inline KahanSum executeFastSquare(size_t& i, size_t nSize, const double* pCurrent)
+{
+#if SC_USE_SSE2
+    return executeSSE2Square(i, nSize, pCurrent);
+#elif SC_USE_NEON
+    return executeNEONSquare(i, nSize, pCurrent);
+#else
+    return executeUnrolledSquare(i, nSize, pCurrent);
+#endif
+}
+
 /**
   * Performs the sum of an array.
   * Note that align 16 will speed up the process.
@@ -100,6 +221,23 @@ inline KahanSum sumArray(const double* pArray, size_t nSize)
     return fSum;
 }
 
+/**
+  * Performs the sum of the squares of an array. Unlike sumArray() error
+  * values are not filtered out, any NaN makes the result a NaN.
+  * @param pArray
+  * @param nSize
+  */
+inline KahanSum sumSquareArray(const double* pArray, size_t nSize)
+{
+    size_t i = 0;
+    KahanSum fSum = executeFastSquare(i, nSize, pArray);
+
+    for (; i < nSize; ++i)
+        fSum += pArray[i] * pArray[i];
+
+    return fSum;
+}
+
 } // end namespace sc::op
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -40,6 +40,7 @@ class SvxBoxItem;
 class SvxBoxInfoItem;
 
 namespace editeng { class SvxBorderLine; }
+namespace sc { struct RowSpan; }
 
 #define SC_LINE_EMPTY           0
 #define SC_LINE_SET             1
@@ -163,6 +164,9 @@ public:
     void    ApplyStyleArea( SCROW nStartRow, SCROW nEndRow, const ScStyleSheet& rStyle );
     void    ApplyCacheArea( SCROW nStartRow, SCROW nEndRow, ScItemPoolCache& rCache,
                             ScEditDataArray* pDataArray = nullptr, bool* const pIsChanged = nullptr );
+    /// Like ApplyCacheArea() for several sorted, disjoint row spans, rebuilding the entries in one pass.
+    void    ApplyCacheSpans( const std::vector<sc::RowSpan>& rSpans, ScItemPoolCache& rCache,
+                             ScEditDataArray* pDataArray = nullptr, bool* const pIsChanged = nullptr );
     void    SetAttrEntries(std::vector<ScAttrEntry> && vNewData);
     void    ApplyLineStyleArea( SCROW nStartRow, SCROW nEndRow,
                                 const ::editeng::SvxBorderLine* pLine, bool bColorOnly );
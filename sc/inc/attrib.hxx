@@ -67,6 +67,8 @@ public:
                 virtual ~ScMergeAttr() override;
 
     virtual bool            operator==( const SfxPoolItem& ) const override;
+    virtual bool            supportsHashCode() const override { return true; }
+    virtual size_t          hashCode() const override;
     virtual ScMergeAttr*    Clone( SfxItemPool *pPool = nullptr ) const override;
 
             SCCOL          GetColMerge() const {return nColMerge; }
@@ -143,6 +145,8 @@ public:
                                     const IntlWrapper& rIntl ) const override;
 
     virtual bool            operator==( const SfxPoolItem& ) const override;
+    virtual bool            supportsHashCode() const override { return true; }
+    virtual size_t          hashCode() const override;
     virtual ScProtectionAttr* Clone( SfxItemPool *pPool = nullptr ) const override;
 
     virtual bool            QueryValue( css::uno::Any& rVal, sal_uInt8 nMemberId = 0 ) const override;
@@ -25,6 +25,7 @@ enum ScRecalcOptions
     RECALC_ALWAYS = 0,
     RECALC_NEVER,
     RECALC_ASK,
+    RECALC_SELECTIVE, // keep cached results, recalculate only volatile and external ones
 };
 
 // Env.var. SC_FORCE_CALCULATION can be used to force all calculation
@@ -818,7 +818,6 @@ class SAL_DLLPUBLIC_RTTI ScChangeTrack final : public utl::ConfigurationListener
     friend void ScChangeActionMove::DeleteCellEntries();
     friend bool ScChangeActionMove::Reject( ScDocument& pDoc );
 
-    SCROW               mnContentRowsPerSlot;
     SCSIZE              mnContentSlots;
 
     css::uno::Sequence< sal_Int8 >   aProtectPass;
@@ -861,8 +860,6 @@ class SAL_DLLPUBLIC_RTTI ScChangeTrack final : public utl::ConfigurationListener
     ScChangeTrack( const ScChangeTrack& ) = delete;
     ScChangeTrack& operator=( const ScChangeTrack& ) = delete;
 
-    SCROW               InitContentRowsPerSlot();
-
     // true if one is ScMatrixMode::Formula and the other is
     // not, or if both are and range differs
     static bool IsMatrixFormulaRangeDifferent(
@@ -940,7 +937,7 @@ class SAL_DLLPUBLIC_RTTI ScChangeTrack final : public utl::ConfigurationListener
 
 public:
 
-    SCSIZE              ComputeContentSlot( sal_Int32 nRow ) const;
+    SCSIZE              ComputeContentSlot( const ScBigAddress& rPos ) const;
 
     SC_DLLPUBLIC ScChangeTrack( ScDocument& );
     ScChangeTrack(ScDocument& rDocP, std::set<OUString>&& aTempUserCollection); // only to use in the XML import
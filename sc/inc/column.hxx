@@ -143,6 +143,8 @@ public:
     void        ApplySelectionStyle(const ScStyleSheet& rStyle, SCROW nTop, SCROW nBottom);
     void        ApplySelectionCache(ScItemPoolCache& rCache, SCROW nStartRow, SCROW nEndRow,
                                     ScEditDataArray* pDataArray, bool* pIsChanged);
+    void        ApplySelectionCache(ScItemPoolCache& rCache, const std::vector<sc::RowSpan>& rSpans,
+                                    ScEditDataArray* pDataArray, bool* pIsChanged);
     void        ApplyPatternArea( SCROW nStartRow, SCROW nEndRow, const ScPatternAttr& rPatAttr,
                                   ScEditDataArray* pDataArray = nullptr,
                                   bool* const pIsChanged = nullptr);
@@ -478,6 +480,7 @@ public:
     void SetDirty( SCROW nRow1, SCROW nRow2, BroadcastMode );
     void        SetDirtyVar();
     void        SetDirtyAfterLoad();
+    void        SetDirtySelectiveAfterLoad();
     void        SetTableOpDirty( const ScRange& );
     void        CalcAll();
     void CalcAfterLoad( sc::CompileFormulaContext& rCxt, bool bStartListening );
@@ -566,6 +566,8 @@ public:
     ScDocument& mrDoc;
     ScRangeList maRanges;
     std::vector<double> maValues;
+    /// maValues are up to date, an empty maValues then means there are no numeric cells
+    bool mbValid = false;
 };
 
 //  complete conditional formatting
@@ -634,14 +636,15 @@ public:
     void startRendering();
     void endRendering();
 
-    void updateValues();
+    SC_DLLPUBLIC void updateValues();
 
     // Forced recalculation for formulas
     void CalcAll();
 
     void ResetCache() const;
     void SetCache(const std::vector<double>& aValues) const;
-    std::vector<double>* GetCache() const;
+    SC_DLLPUBLIC std::vector<double>* GetCache() const;
+    SC_DLLPUBLIC bool IsCacheValid() const;
 };
 
 class RepaintInIdle final : public Idle
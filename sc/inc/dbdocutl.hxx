@@ -40,10 +40,21 @@ public:
 
         StrData();
     };
+    /**
+     * Number format that PutData applies to the values of a column of the
+     * given sdbc::DataType, 0 for none.
+     */
+    static sal_uInt32 GetNumberFormat( ScDocument& rDoc, tools::Long nType, bool bCurrency );
+
+    /**
+     * @param bSetNumberFormat if false, the caller applies GetNumberFormat()
+     *        to the whole column itself, instead of per cell.
+     */
     static bool PutData( ScDocument& rDoc, SCCOL nCol, SCROW nRow, SCTAB nTab,
                         const css::uno::Reference< css::sdbc::XRow>& xRow,
                         sal_Int32 nRowPos,
-                        tools::Long nType, bool bCurrency, StrData* pStrData = nullptr );
+                        tools::Long nType, bool bCurrency, StrData* pStrData = nullptr,
+                        bool bSetNumberFormat = true );
 };
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
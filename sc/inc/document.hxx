@@ -93,6 +93,7 @@ namespace sc {
 
 struct BroadcasterState;
 struct FormulaGroupContext;
+class FormulaGroupProfile;
 class StartListeningContext;
 class EndListeningContext;
 class CopyFromClipContext;
@@ -190,6 +191,8 @@ class ScTemporaryChartLock;
 class ScLookupCache;
 class ScSortedRangeCache;
 struct ScSortedRangeCacheMap;
+class ScLookupHashIndex;
+struct ScLookupHashIndexMap;
 class ScUndoManager;
 class ScFormulaParserPool;
 struct ScClipParam;
@@ -469,6 +472,7 @@ private:
 
     ScRange             aEmbedRange;
     ScAddress           aCurTextWidthCalcPos;
+    ScAddress           aCurIdleRecalcPos;              // next cell of a hard recalc in idle
 
     Idle                aTrackIdle;
 
@@ -482,7 +486,8 @@ private:
 public:
     /// list of ScInterpreterTableOpParams currently in use
     std::vector<ScInterpreterTableOpParams*> m_TableOpList;
-    ScInterpreterTableOpParams  aLastTableOpParams;     // remember last params
+    /// remember the last params of several TableOp blocks, most recent first
+    std::vector<ScInterpreterTableOpParams> maLastTableOpParams;
 
 private:
 
@@ -511,6 +516,9 @@ private:
 
     std::shared_mutex mScLookupMutex; // protection for thread-unsafe parts of handling ScLookup
     std::unique_ptr<ScSortedRangeCacheMap> mxScSortedRangeCache; // cache for unsorted lookups
+    std::unique_ptr<ScLookupHashIndexMap> mxScLookupHashIndex; // index for exact-match lookups
+
+    std::unique_ptr<sc::FormulaGroupProfile> mpFormulaGroupProfile; // group calc statistics, if enabled
 
     static const sal_uInt16 nSrcVer;                        // file version (load/save)
     sal_uInt16              nFormulaTrackCount;
@@ -611,6 +619,8 @@ private:
     bool                mbDocShellRecalc        : 1;
     // This indicates if a ScOutputData::LayoutStrings() is in progress.
     bool                mbLayoutStrings         : 1;
+    // A hard recalc is running in idle chunks, see StartIdleHardRecalc().
+    bool                mbIdleHardRecalc        : 1;
 
     size_t              mnMutationGuardFlags;
 
@@ -1068,7 +1078,7 @@ public:
     void                        LockStreamValid( bool bLock );
     bool                        IsStreamValidLocked() const { return mbStreamValidLocked; }
     bool                        IsPendingRowHeights( SCTAB nTab ) const;
-    void                        SetPendingRowHeights( SCTAB nTab, bool bSet );
+    SC_DLLPUBLIC void           SetPendingRowHeights( SCTAB nTab, bool bSet );
     sal_uInt16 GetSheetOptimalMinRowHeight(SCTAB nTab) const;
     SC_DLLPUBLIC void           SetLayoutRTL( SCTAB nTab, bool bRTL, ScObjectHandling eObjectHandling = ScObjectHandling::RecalcPosMode);
     SC_DLLPUBLIC bool           IsLayoutRTL( SCTAB nTab ) const;
@@ -1457,6 +1467,13 @@ public:
     bool              InterpretCellsIfNeeded( const ScRangeList& rRanges );
     SC_DLLPUBLIC void CalcAll();
     SC_DLLPUBLIC void CalcAfterLoad( bool bStartListening = true );
+    /**
+     * Keep the cached results of a loaded document, but set dirty the cells
+     * that can't be trusted: volatile cells, cells recalculated on load, cells
+     * with external references and cells without a result. Their dependents
+     * are set dirty through formula tracking. Used by RECALC_SELECTIVE.
+     */
+    SC_DLLPUBLIC void SetDirtySelectiveAfterLoad();
     void              CompileAll();
     void              CompileXML();
 
@@ -1489,13 +1506,27 @@ public:
     ScSortedRangeCache & GetSortedRangeCache( const ScRange & rRange, const ScQueryParam& param,
                                               ScInterpreterContext* pContext, bool bNewSearchFunction,
                                               sal_uInt8 nSortedBinarySearch = 0x00 );
+                    /** Creates a ScLookupHashIndex for the range if it
+                        doesn't already exist, shared by all threads. */
+    ScLookupHashIndex & GetLookupHashIndex( const ScRange & rRange, const ScQueryParam& param );
                     /** Only ScLookupCache dtor uses RemoveLookupCache(), do
                         not use elsewhere! */
     void            RemoveLookupCache( ScLookupCache & rCache );
     void            RemoveSortedRangeCache( ScSortedRangeCache & rCache );
+    void            RemoveLookupHashIndex( ScLookupHashIndex & rIndex );
                     /** Zap all caches. */
     void            ClearLookupCaches();
 
+                    /** Start or stop collecting per formula group statistics
+                        of group calculation. Stopping discards the data. */
+    SC_DLLPUBLIC void EnableFormulaGroupProfile( bool bEnable );
+    bool            IsFormulaGroupProfileEnabled() const { return bool(mpFormulaGroupProfile); }
+                    /** The profile to record into, or nullptr if profiling is
+                        disabled or a threaded group calculation is running. */
+    sc::FormulaGroupProfile* GetFormulaGroupProfile();
+                    /** The collected statistics as JSON, empty if disabled. */
+    SC_DLLPUBLIC OUString GetFormulaGroupProfileAsJson() const;
+
                     // calculate automatically
     SC_DLLPUBLIC void SetAutoCalc( bool bNewAutoCalc );
     SC_DLLPUBLIC bool GetAutoCalc() const { return bAutoCalc; }
@@ -2305,6 +2336,32 @@ public:
 
     bool            IdleCalcTextWidth();
 
+    /**
+     * Start a hard recalc that is done in chunks by IdleHardRecalc() instead
+     * of at once like CalcAll(). All formula cells are set dirty, until
+     * their chunk is reached they are calculated on demand, e.g. when
+     * painted or referenced.
+     */
+    SC_DLLPUBLIC void StartIdleHardRecalc();
+
+    /**
+     * Calculate the next chunk of a hard recalc started by
+     * StartIdleHardRecalc(), for the time slice of an idle handler.
+     *
+     * @param rCalculated receives the ranges that were calculated, to be
+     *                    repainted.
+     * @return true if there is more to calculate.
+     */
+    SC_DLLPUBLIC bool IdleHardRecalc( ScRangeList& rCalculated );
+
+    /**
+     * Stop the hard recalc in idle. Cells not calculated yet stay dirty and
+     * are calculated on demand.
+     */
+    SC_DLLPUBLIC void CancelIdleHardRecalc();
+
+    bool            IsIdleHardRecalc() const { return mbIdleHardRecalc; }
+
     void            RepaintRange( const ScRange& rRange );
     void            RepaintRange( const ScRangeList& rRange );
 
@@ -2509,7 +2566,7 @@ public:
      *                     recalculated.
      */
     SC_DLLPUBLIC void   CalcFormulaTree( bool bOnlyForced = false, bool bProgressBar = true, bool bSetAllDirty = true );
-    void                ClearFormulaTree();
+    SC_DLLPUBLIC void   ClearFormulaTree();
     void                AppendToFormulaTrack( ScFormulaCell* pCell );
     void                RemoveFromFormulaTrack( ScFormulaCell* pCell );
     void                TrackFormulas( SfxHintId nHintId = SfxHintId::ScDataChanged );
@@ -66,6 +66,7 @@ class ScTableRowObj;
 class ScTableSheetObj;
 class ScRangeList;
 class ScPrintUIOptions;
+struct ScTileCache;
 class ScSheetSaveData;
 struct ScFormatSaveData;
 class ScTableSheetsObj;
@@ -97,6 +98,7 @@ private:
     std::unique_ptr<ScPrintFuncCache> pPrintFuncCache;
     std::unique_ptr<ScPrintUIOptions> pPrinterOptions;
     std::unique_ptr<ScPrintState> m_pPrintState;
+    std::unique_ptr<ScTileCache> mpTileCache;
     css::uno::Reference<css::uno::XAggregation> xNumberAgg;
     css::uno::Reference<css::uno::XInterface> xDrawGradTab;
     css::uno::Reference<css::uno::XInterface> xDrawHatchTab;
@@ -404,6 +406,10 @@ public:
     /// @see vcl::ITiledRenderable::getViewRenderState().
     OString getViewRenderState(SfxViewShell* pViewShell = nullptr) override;
 
+    /** Drop the tiles painted by paintTile() that intersect pRect (in twips) on
+        sheet nPart. A negative nPart means all sheets, no pRect the whole sheet. */
+    void invalidateTileCache(int nPart, const tools::Rectangle* pRect);
+
 private:
     Size getDocumentSize(SCCOL& rnTiledRenderingAreaEndCol, SCROW& rnTiledRenderingAreaEndRow );
 };
@@ -144,6 +144,9 @@ private:
     SCROW mnDataSize;
     SCROW mnRowCount;
 
+    ScRange maDocRange;     // source range, for sheet source data only
+    SCROW mnDocDataEndRow;  // last sheet row read, -1 if not a sheet source
+
     bool mbDisposing;
 
 public:
@@ -193,6 +196,16 @@ public:
     SC_DLLPUBLIC const IndexArrayType* GetFieldIndexArray( size_t nDim ) const;
     SC_DLLPUBLIC const ScDPItemDataVec& GetDimMemberValues( SCCOL nDim ) const;
     void InitFromDoc(ScDocument& rDoc, const ScRange& rRange);
+
+    /**
+     * Read only the rows that have been filled below the previously read
+     * data, for append-only sources. The rows read before must not have
+     * changed. Like InitFromDoc() this clears all group dimension info.
+     *
+     * @return false if the cache can't be updated that way, in which case
+     *         InitFromDoc() must be used.
+     */
+    bool AppendFromDoc(ScDocument& rDoc, const ScRange& rRange);
     bool InitFromDataBase(DBConnector& rDB);
 
     /**
@@ -351,7 +351,13 @@ public:
         SC_DLLPUBLIC ScDPCache* getExistingCache(const ScRange& rRange);
         SC_DLLPUBLIC const ScDPCache* getExistingCache(const ScRange& rRange) const;
 
-        void updateCache(const ScRange& rRange, o3tl::sorted_vector<ScDPObject*>& rRefs);
+        /**
+         * @param bRowsAppended the source range has only been filled further
+         *                      down since the last update, try to read just
+         *                      the new rows.
+         */
+        void updateCache(const ScRange& rRange, o3tl::sorted_vector<ScDPObject*>& rRefs,
+                         bool bRowsAppended = false);
         bool remove(const ScDPCache* p);
 
         SC_DLLPUBLIC const std::vector<ScRange>& getAllRanges() const;
@@ -11,6 +11,8 @@
 
 #include <sal/config.h>
 #include "typedstrdata.hxx"
+#include <map>
+#include <utility>
 #include <vector>
 #include <tools/color.hxx>
 
@@ -22,6 +24,8 @@ struct ScFilterEntries
     bool                        mbHasUnHiddenEmpties;
     std::set<Color>             maTextColors;
     std::set<Color>             maBackgroundColors;
+    /// Input strings of the values formatted so far, by value and number format.
+    std::map<std::pair<double, sal_uInt32>, OUString> maValueStrings;
 
     ScFilterEntries() : mbHasDates(false),
                         mbHasHiddenEmpties(false),
@@ -36,7 +40,7 @@ struct ScFilterEntries
     const ScTypedStrData&                       front() const   { return maStrData.front(); }
     bool                                        empty() const   { return maStrData.empty(); }
     void                                        push_back( const ScTypedStrData& r ) { maStrData.push_back(r); }
-    void                                        push_back( ScTypedStrData&& r )      { maStrData.push_back(r); }
+    void                                        push_back( ScTypedStrData&& r )      { maStrData.push_back(std::move(r)); }
     std::set<Color>& getTextColors() { return maTextColors; };
     void addTextColor(const Color& aTextColor) { maTextColors.emplace(aTextColor); }
     std::set<Color>& getBackgroundColors() { return maBackgroundColors; };
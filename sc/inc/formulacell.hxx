@@ -170,6 +170,10 @@ private:
     bool InterpretFormulaGroupOpenCL(sc::FormulaLogger::GroupScope& aScope,
                                      bool& bDependencyComputed,
                                      bool& bDependencyCheckFailed);
+    bool InterpretFormulaGroupCompiled(sc::FormulaLogger::GroupScope& aScope,
+                                       bool& bDependencyComputed,
+                                       bool& bDependencyCheckFailed,
+                                       SCROW nStartOffset, SCROW nEndOffset);
     bool InterpretInvariantFormulaGroup();
 
 public:
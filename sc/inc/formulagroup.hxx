@@ -114,6 +114,66 @@ public:
     virtual ~CompiledFormula();
 };
 
+/**
+ * Formula group code compiled into a compact program of operations on
+ * doubles. Only formulas made of numbers, cell and range references,
+ * arithmetic operators and SUM, MIN, MAX, COUNT and AVERAGE can be compiled.
+ * The program is run for all rows of the group in a tight loop on the
+ * calling thread, as a light weight alternative to the OpenCL and threaded
+ * group interpreters.
+ */
+class FormulaGroupProgram final : public CompiledFormula
+{
+public:
+    /**
+     * @return false if the code contains anything the program can't handle.
+     */
+    bool compile( const ScDocument& rDoc, const ScAddress& rTopPos, const ScTokenArray& rCode );
+
+    /**
+     * Calculate the rows nStartOffset to nEndOffset of the group, errors are
+     * stored as double coded errors. The referenced cells must have been
+     * calculated already.
+     *
+     * @return false if the referenced cells contain data the program can't
+     *         handle, like strings used in arithmetic or non-general number
+     *         formats. The group has to be interpreted normally then.
+     */
+    bool calculate( ScDocument& rDoc, SCROW nStartOffset, SCROW nEndOffset,
+                    std::vector<double>& rResults ) const;
+
+private:
+    enum class Op
+    {
+        Value, Ref, Add, Sub, Mul, Div, Negate, Sum, Min, Max, Count, Average
+    };
+
+    struct Instruction
+    {
+        Op meOp;
+        sal_uInt8 mnParams; ///< number of parameters of functions
+        double mfValue;     ///< value of Op::Value
+        size_t mnRef;       ///< index into maRefs of Op::Ref
+    };
+
+    /// Absolute reference of the top cell of the group. The rows are not
+    /// ordered, a partly relative range may swap them in other rows.
+    struct Ref
+    {
+        SCTAB mnTab;
+        SCCOL mnCol1;
+        SCCOL mnCol2;
+        SCROW mnRow1;
+        SCROW mnRow2;
+        bool mbRow1Rel;     ///< mnRow1 moves with the group row
+        bool mbRow2Rel;     ///< mnRow2 moves with the group row
+    };
+
+    ScAddress maTopPos;
+    std::vector<Instruction> maCode;
+    std::vector<Ref> maRefs;
+};
+
 /**
  * Abstract base class for vectorised formula group interpreters,
  * plus a global instance factory.
@@ -0,0 +1,120 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "address.hxx"
+
+#include <rtl/ustring.hxx>
+
+#include <chrono>
+#include <unordered_map>
+
+class ScDocument;
+namespace tools { class JsonWriter; }
+
+namespace sc {
+
+/**
+ * How a formula group calculation attempt ended.
+ */
+enum class FormulaGroupCalcPath
+{
+    OpenCL,   ///< calculated by the OpenCL group interpreter
+    Compiled, ///< calculated by a sc::FormulaGroupProgram
+    Threaded, ///< calculated by the threaded group interpreter
+    Scalar    ///< group calculation not possible, cells are interpreted one by one
+};
+
+/**
+ * Per formula group statistics of group calculation attempts, keyed by the
+ * position of the group's top cell. Unlike FormulaLogger this is available
+ * in release builds; it's only filled while enabled for a document, see
+ * ScDocument::EnableFormulaGroupProfile().
+ */
+class FormulaGroupProfile
+{
+public:
+    struct Entry
+    {
+        SCROW mnLength = 0;         ///< length of the group at the last attempt
+        sal_uInt64 mnCalls = 0;     ///< number of group calculation attempts
+        sal_uInt64 mnCells = 0;     ///< number of cells requested over all attempts
+        sal_uInt64 mnTimeNs = 0;    ///< wall time spent in all attempts
+        sal_uInt64 mnOpenCL = 0;    ///< attempts calculated with OpenCL
+        sal_uInt64 mnCompiled = 0;  ///< attempts calculated with a compiled program
+        sal_uInt64 mnThreaded = 0;  ///< attempts calculated with threads
+        sal_uInt64 mnScalar = 0;    ///< attempts that fell back to scalar calculation
+        OUString maLastFallback;    ///< reason of the last fall back, if any
+    };
+
+    void add( const ScAddress& rTopPos, SCROW nLength, SCROW nCells,
+              std::chrono::nanoseconds aTime, FormulaGroupCalcPath ePath,
+              const OUString& rFallback );
+
+    void clear() { maEntries.clear(); }
+    bool empty() const { return maEntries.empty(); }
+
+    const Entry* find( const ScAddress& rTopPos ) const;
+
+    /**
+     * Write all entries as a JSON array, the slowest groups first.
+     */
+    void dumpAsJson( tools::JsonWriter& rJson, const ScDocument& rDoc ) const;
+
+private:
+    std::unordered_map<ScAddress, Entry> maEntries;
+};
+
+/**
+ * Measures one group calculation attempt and records it in the profile, if
+ * there is one, when going out of scope. Without a profile it does nothing.
+ */
+class FormulaGroupProfileScope
+{
+    FormulaGroupProfile* mpProfile;
+    ScAddress maTopPos;
+    SCROW mnLength;
+    SCROW mnCells;
+    std::chrono::steady_clock::time_point maStart;
+    FormulaGroupCalcPath mePath;
+    OUString maFallback;
+
+public:
+    FormulaGroupProfileScope( FormulaGroupProfile* pProfile, const ScAddress& rTopPos, SCROW nLength ) :
+        mpProfile(pProfile), maTopPos(rTopPos), mnLength(nLength), mnCells(nLength),
+        mePath(FormulaGroupCalcPath::Scalar)
+    {
+        if (mpProfile)
+            maStart = std::chrono::steady_clock::now();
+    }
+
+    FormulaGroupProfileScope( const FormulaGroupProfileScope& ) = delete;
+    FormulaGroupProfileScope& operator= ( const FormulaGroupProfileScope& ) = delete;
+
+    ~FormulaGroupProfileScope()
+    {
+        if (mpProfile)
+            mpProfile->add(maTopPos, mnLength, mnCells, std::chrono::steady_clock::now() - maStart,
+                           mePath, maFallback);
+    }
+
+    void setCells( SCROW nCells ) { mnCells = nCells; }
+    void setPath( FormulaGroupCalcPath ePath ) { mePath = ePath; }
+
+    void setFallback( const OUString& rReason )
+    {
+        if (mpProfile)
+            maFallback = rReason;
+    }
+};
+
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
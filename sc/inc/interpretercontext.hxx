@@ -15,6 +15,7 @@
 #include <vector>
 #include <i18nlangtag/mslangid.hxx>
 #include <svl/numformat.hxx>
+#include "address.hxx"
 #include "types.hxx"
 
 namespace formula
@@ -22,10 +23,16 @@ namespace formula
 class FormulaTypedDoubleToken;
 }
 
+namespace sc
+{
+class ColumnBlockConstPositionSet;
+}
+
 #define TOKEN_CACHE_SIZE 8
 
 class Color;
 class ScDocument;
+class ScRangeList;
 struct ScLookupCacheMap;
 class ScInterpreter;
 
@@ -34,6 +41,7 @@ struct DelayedSetNumberFormat
 {
     SCCOL mCol;
     SCROW mRow;
+    SCTAB mTab;
     sal_uInt32 mnNumberFormat;
 };
 
@@ -49,6 +57,13 @@ struct ScInterpreterContext
     std::vector<sal_uInt8> maConditions;
     std::mt19937 aRNG;
     ScInterpreter* pInterpreter;
+    // The ranges of the running threaded group calculation, set only in its thread contexts.
+    const ScRangeList* mpThreadedCalcRanges;
+    // Cells of the threaded group calculation whose dynamic references (OFFSET) point to
+    // cells that were not calculated yet; they have to be calculated again without threads.
+    std::vector<ScAddress> maDynamicRefRecalcCells;
+    // Positions of the cell reads of a threaded group calculation, see ScDocument::GetRefCellValue().
+    std::unique_ptr<sc::ColumnBlockConstPositionSet> mxColumnPositions;
 
     ScInterpreterContext(const ScDocument& rDoc, SvNumberFormatter* pFormatter);
 
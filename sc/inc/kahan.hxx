@@ -28,9 +28,16 @@ namespace sc::op
 #if defined(X86_64) || (defined(INTEL) && defined(_WIN32))
 #define SC_USE_SSE2 1
 KahanSum executeSSE2(size_t& i, size_t nSize, const double* pCurrent);
+KahanSum executeSSE2Square(size_t& i, size_t nSize, const double* pCurrent);
 #else
 #define SC_USE_SSE2 0
 #endif
+// NEON is part of the baseline of AArch64, see arraysumfunctor.hxx.
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define SC_USE_NEON 1
+#else
+#define SC_USE_NEON 0
+#endif
 }
 
 /**
@@ -193,6 +193,31 @@ public:
     void clear();
 };
 
+/**
+ * Read-only block positions of the columns read by one thread of a threaded
+ * group calculation, see ScInterpreterContext::mxColumnPositions.
+ *
+ * While the threads run, the cell storage of the document does not change,
+ * ScMutationDisable guards that. The block found by the last read of a column
+ * therefore stays valid for the whole calculation run, and works as a hint to
+ * continue the block search from for the next read of the same column. The set
+ * must be cleared before the cell storage can change again. It is not thread
+ * safe, each calculation thread has its own.
+ */
+class ColumnBlockConstPositionSet
+{
+    std::unordered_map<const ScColumn*, ColumnBlockConstPosition> maColumns;
+    const ScColumn* mpLastColumn;
+    ColumnBlockConstPosition* mpLastPos;
+
+public:
+    ColumnBlockConstPositionSet();
+
+    ColumnBlockConstPosition& getBlockPosition( const ScColumn& rColumn );
+
+    void clear();
+};
+
 /**
  * Set of column block positions only for one table.
  */
@@ -25,11 +25,18 @@
 #include <svl/listener.hxx>
 
 #include <memory>
+#include <set>
 #include <unordered_map>
+#include <vector>
 
 class ScDocument;
 struct ScInterpreterContext;
 struct ScQueryParam;
+struct ScRefCellValue;
+namespace svl
+{
+class SharedString;
+}
 
 /** Sorted cache for one range used with interpreter functions such as VLOOKUP
     and MATCH. Caches sorted order for cells in the given range, which must
@@ -136,4 +143,111 @@ struct ScSortedRangeCacheMap
         aCacheMap;
 };
 
+/** Hash index for one range used with exact-match lookups such as VLOOKUP,
+    MATCH or XLOOKUP. The range must be one column. Unlike ScLookupCache,
+    which is per interpreter context and caches results of already done
+    lookups, this indexes all cells of the range, so that even the first
+    lookup does not need to scan the range. Like ScSortedRangeCache it is
+    shared read-only between threads.
+
+    String cells are keyed by the identifier of their interned
+    svl::SharedString, numeric cells by their value. Cells whose match result
+    cannot be determined from the key alone (formula cells, edit cells, and
+    numbers when looking up strings) are only remembered as opaque rows; when
+    such a row precedes the first indexed match, the result is UNKNOWN and the
+    caller has to do the lookup the usual way.
+
+    Single cell changes are applied incrementally from the area listener
+    notifications, bulk changes and range changes drop the index.
+ */
+class ScLookupHashIndex final : public SvtListener
+{
+public:
+    enum class KeyType
+    {
+        Values,
+        StringsCaseSensitive,
+        StringsCaseInsensitive
+    };
+
+    enum class Result
+    {
+        UNKNOWN, ///< an opaque row precedes all matches, do a normal lookup
+        NOT_AVAILABLE, ///< no cell matches
+        FOUND ///< first matching row found
+    };
+
+    /// MUST be new'd because Notify() deletes.
+    ScLookupHashIndex(ScDocument& rDoc, const ScRange& rRange, KeyType eKeyType);
+
+    /// Update the index on data change hints, remove and delete (!) it on other modify hints.
+    virtual void Notify(const SfxHint& rHint) override;
+
+    const ScRange& getRange() const { return maRange; }
+
+    /** Find the first row with a numeric cell approximately equal to fValue,
+        as ScQueryEvaluator does for SC_EQUAL. */
+    Result lookupValue(double fValue, SCROW& rRow) const;
+    /// Find the first row with a string cell equal to rString.
+    Result lookupString(const svl::SharedString& rString, SCROW& rRow) const;
+
+    /** Returns if the index can be used for the query, which must be an
+        exact whole cell match of a single value in one column. */
+    static bool canBeUsed(const ScDocument& rDoc, const ScQueryParam& param,
+                          bool bNewSearchFunction);
+
+    struct HashKey
+    {
+        ScRange range;
+        KeyType keyType;
+        bool operator==(const HashKey& other) const
+        {
+            return range == other.range && keyType == other.keyType;
+        }
+    };
+    HashKey getHashKey() const { return { maRange, meKeyType }; }
+    static HashKey makeHashKey(const ScRange& range, const ScQueryParam& param);
+
+    struct Hash
+    {
+        size_t operator()(const HashKey& key) const
+        {
+            // Range should be just one column.
+            size_t hash = key.range.hashStartColumn();
+            o3tl::hash_combine(hash, key.keyType);
+            return hash;
+        }
+    };
+
+private:
+    struct Entry
+    {
+        SCROW mnRow;
+        double mfValue; // only used for KeyType::Values
+    };
+
+    void updateRow(SCROW nRow, const ScRefCellValue& rCell);
+    void removeRow(SCROW nRow);
+    /// Returns the first row of nKey's bucket matching fValue, or -1.
+    SCROW findFirstInBucket(sal_uInt64 nKey, double fValue) const;
+    Result makeResult(SCROW nFound, SCROW& rRow) const;
+
+    std::unordered_map<sal_uInt64, std::vector<Entry>> maBuckets; // entries sorted by row
+    std::unordered_map<SCROW, sal_uInt64> maRowKeys; // bucket of each indexed row
+    std::set<SCROW> maOpaqueRows;
+    ScRange maRange;
+    ScDocument& mrDoc;
+    KeyType meKeyType;
+
+    ScLookupHashIndex(const ScLookupHashIndex&) = delete;
+    ScLookupHashIndex& operator=(const ScLookupHashIndex&) = delete;
+};
+
+struct ScLookupHashIndexMap
+{
+    std::unordered_map<ScLookupHashIndex::HashKey, std::unique_ptr<ScLookupHashIndex>,
+                       ScLookupHashIndex::Hash>
+        aIndexMap;
+};
+
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -16,15 +16,48 @@
 #include <vcl/outdev.hxx>
 
 #include "compressedarray.hxx"
+#include "patattr.hxx"
 #include "types.hxx"
 
+#include <unordered_map>
+
 using RowHeightsArray = ScCompressedArray<SCROW, sal_uInt16>;
 
 namespace sc {
 
 class SC_DLLPUBLIC RowHeightContext
 {
+    /**
+     * Key of a measured plain string cell: its pattern, its (pooled) string
+     * and the width of its column. Pooled strings are unique per content, so
+     * comparing the data pointers is enough.
+     */
+    struct TextHeightKey
+    {
+        const ScPatternAttr* mpPattern;
+        const rtl_uString* mpText;
+        sal_uInt16 mnColWidth;
+
+        bool operator==( const TextHeightKey& r ) const
+        {
+            return mpPattern == r.mpPattern && mpText == r.mpText && mnColWidth == r.mnColWidth;
+        }
+    };
+
+    struct TextHeightKeyHash
+    {
+        size_t operator()( const TextHeightKey& rKey ) const;
+    };
+
+    struct TextHeight
+    {
+        CellAttributeHolder maPattern; ///< keeps the pattern of the key alive
+        OUString maText;               ///< keeps the string of the key alive
+        sal_uInt16 mnHeight;
+    };
+
     RowHeightsArray maHeights;
+    std::unordered_map<TextHeightKey, TextHeight, TextHeightKeyHash> maTextHeights;
 
     double mfPPTX;
     double mfPPTY;
@@ -56,6 +89,13 @@ public:
     bool isForceAutoSize() const { return mbForceAutoSize;}
 
     RowHeightsArray& getHeightArray() { return maHeights; }
+
+    /**
+     * Height of a plain string cell measured before with the same pattern,
+     * string and column width, or 0 if there is none.
+     */
+    sal_uInt16 findTextHeight( const ScPatternAttr* pPattern, const OUString& rText, sal_uInt16 nColWidth ) const;
+    void setTextHeight( const ScPatternAttr* pPattern, const OUString& rText, sal_uInt16 nColWidth, sal_uInt16 nHeight );
 };
 
 }
@@ -330,6 +330,40 @@ public:
         maOrderIndices.swap(aOrderIndices2);
     }
 
+    /**
+     * Bring everything into the given order in one go, instead of a swap at
+     * a time. Call this only during normal sorting, not from reordering.
+     *
+     * @param rPositions offsets from the top row / column, in their new order.
+     */
+    void Reorder( const std::vector<SCSIZE>& rPositions )
+    {
+        const SCSIZE nCount = rPositions.size();
+        for (auto& ppInfo : mvppInfo)
+        {
+            std::unique_ptr<ScSortInfo[]> ppInfo2(new ScSortInfo[nCount]);
+            for (SCSIZE i = 0; i < nCount; ++i)
+                ppInfo2[i] = ppInfo[rPositions[i]];
+            ppInfo = std::move(ppInfo2);
+        }
+
+        std::vector<SCCOLROW> aOrderIndices2;
+        aOrderIndices2.reserve(nCount);
+        for (SCSIZE nPos : rPositions)
+            aOrderIndices2.push_back(maOrderIndices[nPos]);
+        maOrderIndices.swap(aOrderIndices2);
+
+        if (mpRows)
+        {
+            RowsType& rRows = *mpRows;
+            RowsType aRows2;
+            aRows2.reserve(rRows.size());
+            for (SCSIZE nPos : rPositions)
+                aRows2.push_back(std::move(rRows[nPos]));
+            rRows.swap(aRows2);
+        }
+    }
+
     sal_uInt16      GetUsedSorts() const { return mvppInfo.size(); }
 
     SCCOLROW    GetStart() const { return nStart; }
@@ -58,6 +58,7 @@ class SAL_WARN_UNUSED SAL_DLLPUBLIC_RTTI ScTokenArray final : public formula::Fo
     bool mbOpenCLEnabled : 1;
     bool mbThreadingEnabled : 1;
 
+    static bool IsThreadingDisabledBy( const formula::FormulaToken& r );
     void CheckForThreading( const formula::FormulaToken& r );
 
 public:
@@ -268,6 +269,8 @@ public:
 
     bool IsEnabledForOpenCL() const { return mbOpenCLEnabled; }
     bool IsEnabledForThreading() const { return mbThreadingEnabled; }
+    /// The first token that disables threaded calculation, if any.
+    SC_DLLPUBLIC const formula::FormulaToken* GetThreadingBlocker() const;
 
 #if DEBUG_FORMULA_COMPILER
     void Dump() const;
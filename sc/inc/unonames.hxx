@@ -553,6 +553,8 @@ inline constexpr OUString SC_UNO_INTEROPGRABBAG           = u"InteropGrabBag"_us
 inline constexpr OUString SC_UNO_RECORDCHANGES            = u"RecordChanges"_ustr;
 inline constexpr OUString SC_UNO_ISRECORDCHANGESPROTECTED = u"IsRecordChangesProtected"_ustr;
 inline constexpr OUString SC_UNO_SYNTAXSTRINGREF          = u"SyntaxStringRef"_ustr;
+inline constexpr OUString SC_UNO_ISFORMULAGROUPPROFILE   = u"IsFormulaGroupProfileEnabled"_ustr;
+inline constexpr OUString SC_UNO_FORMULAGROUPPROFILE     = u"FormulaGroupProfile"_ustr;
 
 
 //  document properties from FormModel
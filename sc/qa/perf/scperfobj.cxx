@@ -9,13 +9,22 @@
 
 #include <sal/config.h>
 
+#include <chrono>
+#include <cstdlib>
+#include <functional>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <test/unoapi_test.hxx>
 
 #include <rtl/ustring.hxx>
 #include <cppunit/extensions/HelperMacros.h>
 #include <comphelper/processfactory.hxx>
+#include <comphelper/propertyvalue.hxx>
+#include <comphelper/servicehelper.hxx>
+#include <tools/json_writer.hxx>
+#include <tools/stream.hxx>
 
 #include <com/sun/star/frame/Desktop.hpp>
 #include <com/sun/star/frame/XModel2.hpp>
@@ -40,11 +49,19 @@
 #include <com/sun/star/sheet/XSubTotalCalculatable.hpp>
 #include <com/sun/star/sheet/SubTotalColumn.hpp>
 #include <com/sun/star/sheet/GeneralFunction.hpp>
+#include <com/sun/star/sheet/ConditionOperator.hpp>
+#include <com/sun/star/sheet/DataPilotFieldOrientation.hpp>
+#include <com/sun/star/sheet/XCellRangeData.hpp>
+#include <com/sun/star/sheet/XDataPilotDescriptor.hpp>
+#include <com/sun/star/sheet/XDataPilotTables.hpp>
+#include <com/sun/star/sheet/XDataPilotTablesSupplier.hpp>
+#include <com/sun/star/sheet/XSheetConditionalEntries.hpp>
 
 #include <test/callgrind.hxx>
 
 #include <calcconfig.hxx>
 #include <docsh.hxx>
+#include <docuno.hxx>
 #include <tabvwsh.hxx>
 
 using namespace css;
@@ -76,6 +93,7 @@ public:
     CPPUNIT_TEST(testLoadingFileWithSingleBigSheet);
     CPPUNIT_TEST(testMatConcatSmall);
     CPPUNIT_TEST(testMatConcatLarge);
+    CPPUNIT_TEST(testRecalcLoadSaveBenchmark);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -97,6 +115,7 @@ private:
     void testFixedSum();
     void testMatConcatSmall();
     void testMatConcatLarge();
+    void testRecalcLoadSaveBenchmark();
 };
 
 ScPerfObj::ScPerfObj()
@@ -612,6 +631,156 @@ void ScPerfObj::testMatConcatLarge()
     callgrindDump("sc:mat_concat");
 }
 
+namespace {
+    constexpr sal_Int32 nBenchmarkRows = 10000;
+
+    /// Fill Sheet1 with lookup, conditional sum, array formula, conditional
+    /// format and pivot table workloads on nBenchmarkRows rows of data.
+    void generateBenchmarkWorkbook(const uno::Reference< sheet::XSpreadsheetDocument > & xDoc)
+    {
+        uno::Reference< container::XIndexAccess > xSheetIndex(xDoc->getSheets(), UNO_QUERY_THROW);
+        uno::Reference< sheet::XSpreadsheet > xSheet(xSheetIndex->getByIndex(0), UNO_QUERY_THROW);
+        const OUString aLast = OUString::number(nBenchmarkRows + 1);
+
+        uno::Sequence< uno::Sequence< uno::Any > > aData(nBenchmarkRows + 1);
+        auto pData = aData.getArray();
+        pData[0] = { uno::Any(u"Key"_ustr), uno::Any(u"Value"_ustr), uno::Any(u"Category"_ustr) };
+        for (sal_Int32 i = 1; i <= nBenchmarkRows; ++i)
+            pData[i] = { uno::Any(double(i)), uno::Any(double(i % 100)),
+                         uno::Any(OUString("c" + OUString::number(i % 10))) };
+        uno::Reference< sheet::XCellRangeData > xData(
+            xSheet->getCellRangeByName("A1:C" + aLast), UNO_QUERY_THROW);
+        xData->setDataArray(aData);
+
+        uno::Sequence< uno::Sequence< OUString > > aFormulae(nBenchmarkRows);
+        auto pFormulae = aFormulae.getArray();
+        for (sal_Int32 i = 0; i < nBenchmarkRows; ++i)
+        {
+            const OUString aRow = OUString::number(i + 2);
+            pFormulae[i] = { "=VLOOKUP(A" + aRow + ";$A$2:$B$" + aLast + ";2;0)",
+                             "=SUMIFS($B$2:$B$" + aLast + ";$C$2:$C$" + aLast + ";C" + aRow + ")" };
+        }
+        uno::Reference< sheet::XCellRangeFormula > xFormulae(
+            xSheet->getCellRangeByName("E2:F" + aLast), UNO_QUERY_THROW);
+        xFormulae->setFormulaArray(aFormulae);
+
+        uno::Reference< sheet::XArrayFormulaRange > xArray(
+            xSheet->getCellRangeByName("G2:G" + aLast), UNO_QUERY_THROW);
+        xArray->setArrayFormula("=B2:B" + aLast + "*2+F2:F" + aLast);
+        uno::Reference< sheet::XArrayFormulaRange > xArraySum(
+            xSheet->getCellRangeByName("H1"), UNO_QUERY_THROW);
+        xArraySum->setArrayFormula("=SUM((C2:C" + aLast + "=\"c1\")*B2:B" + aLast + ")");
+
+        uno::Reference< beans::XPropertySet > xRangeProps(
+            xSheet->getCellRangeByName("E2:E" + aLast), UNO_QUERY_THROW);
+        uno::Reference< sheet::XSheetConditionalEntries > xEntries(
+            xRangeProps->getPropertyValue("ConditionalFormat"), UNO_QUERY_THROW);
+        xEntries->addNew({ comphelper::makePropertyValue("Operator", sheet::ConditionOperator_GREATER),
+                           comphelper::makePropertyValue("Formula1", u"50"_ustr),
+                           comphelper::makePropertyValue("StyleName", u"Good"_ustr) });
+        xRangeProps->setPropertyValue("ConditionalFormat", uno::Any(xEntries));
+
+        uno::Reference< sheet::XDataPilotTablesSupplier > xDPSupplier(xSheet, UNO_QUERY_THROW);
+        uno::Reference< sheet::XDataPilotTables > xDPTables = xDPSupplier->getDataPilotTables();
+        uno::Reference< sheet::XDataPilotDescriptor > xDPDesc = xDPTables->createDataPilotDescriptor();
+        xDPDesc->setSourceRange(table::CellRangeAddress(0, 0, 0, 2, nBenchmarkRows));
+        uno::Reference< container::XIndexAccess > xFields = xDPDesc->getDataPilotFields();
+        uno::Reference< beans::XPropertySet > xRowField(xFields->getByIndex(2), UNO_QUERY_THROW);
+        xRowField->setPropertyValue("Orientation", uno::Any(sheet::DataPilotFieldOrientation_ROW));
+        uno::Reference< beans::XPropertySet > xDataField(xFields->getByIndex(1), UNO_QUERY_THROW);
+        xDataField->setPropertyValue("Orientation", uno::Any(sheet::DataPilotFieldOrientation_DATA));
+        xDataField->setPropertyValue("Function", uno::Any(sheet::GeneralFunction_SUM));
+        xDPTables->insertNewByName("Benchmark", table::CellAddress(0, 9, 0), xDPDesc);
+    }
+
+    void checkBenchmarkResults(const uno::Reference< lang::XComponent > & xComponent)
+    {
+        uno::Reference< sheet::XSpreadsheetDocument > xDoc(xComponent, UNO_QUERY_THROW);
+        uno::Reference< container::XIndexAccess > xSheetIndex(xDoc->getSheets(), UNO_QUERY_THROW);
+        uno::Reference< sheet::XSpreadsheet > xSheet(xSheetIndex->getByIndex(0), UNO_QUERY_THROW);
+
+        // VLOOKUP of key 10000, SUMIFS and array formula of its category c0.
+        CPPUNIT_ASSERT_EQUAL(0.0, xSheet->getCellByPosition(4, nBenchmarkRows)->getValue());
+        CPPUNIT_ASSERT_EQUAL(45000.0, xSheet->getCellByPosition(5, nBenchmarkRows)->getValue());
+        CPPUNIT_ASSERT_EQUAL(45000.0, xSheet->getCellByPosition(6, nBenchmarkRows)->getValue());
+        // Array formula SUM of category c1.
+        CPPUNIT_ASSERT_EQUAL(46000.0, xSheet->getCellByPosition(7, 0)->getValue());
+    }
+}
+
+/*
+ * Times hard recalculation, export and import of a generated workbook, phase
+ * by phase. If SC_PERF_RESULTS names a file, the times and the formula group
+ * profile of the first recalculation are written to it as JSON, to compare
+ * runs of different builds.
+ */
+void ScPerfObj::testRecalcLoadSaveBenchmark()
+{
+    skipValidation();
+    loadFromURL(u"private:factory/scalc"_ustr);
+    uno::Reference< sheet::XSpreadsheetDocument > xDoc(mxComponent, UNO_QUERY_THROW);
+    generateBenchmarkWorkbook(xDoc);
+
+    std::vector< std::pair< const char*, sal_Int64 > > aPhases;
+    auto aMeasure = [&aPhases](const char* pName, const std::function<void()>& rPhase)
+    {
+        const auto aStart = std::chrono::steady_clock::now();
+        callgrindStart();
+        rPhase();
+        callgrindDump(pName);
+        aPhases.emplace_back(pName, std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now() - aStart).count());
+    };
+    auto aRecalc = [this]()
+    {
+        uno::Reference< sheet::XCalculatable > xCalculatable(mxComponent, UNO_QUERY_THROW);
+        xCalculatable->calculateAll();
+    };
+
+    ScModelObj* pModelObj = comphelper::getFromUnoTunnel<ScModelObj>(mxComponent);
+    CPPUNIT_ASSERT(pModelObj);
+    ScDocument* pDoc = pModelObj->GetDocument();
+    pDoc->EnableFormulaGroupProfile(true);
+    aMeasure("sc:benchmark_hard_recalc", aRecalc);
+    const OUString aRecalcProfile = pDoc->GetFormulaGroupProfileAsJson();
+    pDoc->EnableFormulaGroupProfile(false);
+    checkBenchmarkResults(mxComponent);
+
+    for (TestFilter eFilter : { TestFilter::ODS, TestFilter::XLSX })
+    {
+        const bool bOds = eFilter == TestFilter::ODS;
+        aMeasure(bOds ? "sc:benchmark_export_ods" : "sc:benchmark_export_xlsx",
+                 [this, eFilter]() { save(eFilter); });
+        dispose();
+        aMeasure(bOds ? "sc:benchmark_import_ods" : "sc:benchmark_import_xlsx",
+                 [this]() { loadFromURL(maTempFile.GetURL()); });
+        aMeasure(bOds ? "sc:benchmark_recalc_after_ods" : "sc:benchmark_recalc_after_xlsx", aRecalc);
+        checkBenchmarkResults(mxComponent);
+    }
+
+    const char* pResults = std::getenv("SC_PERF_RESULTS");
+    if (!pResults)
+        return;
+
+    tools::JsonWriter aJson;
+    aJson.put("rows", nBenchmarkRows);
+    {
+        auto aArray = aJson.startArray("phases");
+        for (const auto& [pName, nMicroSeconds] : aPhases)
+        {
+            auto aStruct = aJson.startStruct();
+            aJson.put("name", pName);
+            aJson.put("us", nMicroSeconds);
+        }
+    }
+    if (!aRecalcProfile.isEmpty())
+        aJson.putLiteral("recalcprofile", aRecalcProfile.toUtf8());
+
+    SvFileStream aStream(OUString::fromUtf8(pResults), StreamMode::WRITE | StreamMode::TRUNC);
+    aStream.WriteOString(aJson.finishAndGetAsOString());
+    CPPUNIT_ASSERT_EQUAL(ERRCODE_NONE, aStream.GetError());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(ScPerfObj);
 
 }
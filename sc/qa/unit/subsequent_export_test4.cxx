@@ -1138,6 +1138,49 @@ CPPUNIT_TEST_FIXTURE(ScExportTest4, testMacrosInXLSX_Array)
     assertXPathContent(pSheet, "/x:worksheet/x:sheetData/x:row[2]/x:c[2]/x:f", u"");
 }
 
+CPPUNIT_TEST_FIXTURE(ScExportTest4, testAdjacentNumberCellsXLSX)
+{
+    createScDoc();
+    {
+        ScDocument* pDoc = getScDoc();
+        pDoc->SetValue(ScAddress(0, 0, 0), 1.0);
+        pDoc->SetValue(ScAddress(1, 0, 0), 0.1);
+        pDoc->SetValue(ScAddress(2, 0, 0), -2.5);
+        // Gap in column D.
+        pDoc->SetValue(ScAddress(4, 0, 0), 123456789.123);
+
+        // Different formatting within the same run of numbers.
+        OUString aCode = u"0.000"_ustr;
+        sal_Int32 nCheckPos;
+        SvNumFormatType nType;
+        sal_uInt32 nFormat;
+        pDoc->GetFormatTable()->PutEntry(aCode, nCheckPos, nType, nFormat);
+        ScPatternAttr aNewAttrs(pDoc->getCellAttributeHelper());
+        aNewAttrs.ItemSetPut(SfxUInt32Item(ATTR_VALUE_FORMAT, nFormat));
+        pDoc->ApplyPattern(1, 0, 0, aNewAttrs);
+    }
+
+    save(TestFilter::XLSX);
+    xmlDocUniquePtr pSheet = parseExport(u"xl/worksheets/sheet1.xml"_ustr);
+    CPPUNIT_ASSERT(pSheet);
+
+    assertXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c", 4);
+    assertXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[1]", "r", u"A1");
+    assertXPathContent(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[1]/x:v", u"1");
+    assertXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[2]", "r", u"B1");
+    assertXPathContent(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[2]/x:v", u"0.1");
+    assertXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[3]", "r", u"C1");
+    assertXPathContent(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[3]/x:v", u"-2.5");
+    assertXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[4]", "r", u"E1");
+    assertXPathContent(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[4]/x:v", u"123456789.123");
+
+    // The cell with the explicit number format must not share the style of its neighbours.
+    const OUString aStyle1 = getXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[1]", "s");
+    const OUString aStyle2 = getXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[2]", "s");
+    CPPUNIT_ASSERT(aStyle1 != aStyle2);
+    assertXPath(pSheet, "/x:worksheet/x:sheetData/x:row[1]/x:c[3]", "s", aStyle1);
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -280,6 +280,34 @@ CPPUNIT_TEST_FIXTURE(ScTiledRenderingTest, testBreakPageView)
     CPPUNIT_ASSERT_EQUAL(Color(255, 255, 255), aColor);
 }
 
+CPPUNIT_TEST_FIXTURE(ScTiledRenderingTest, testTileCacheInvalidation)
+{
+    ScModelObj* pModelObj = createDoc("empty.ods");
+    ScTabViewShell* pView = dynamic_cast<ScTabViewShell*>(SfxViewShell::Current());
+    CPPUNIT_ASSERT(pView);
+    ScTestViewCallback aView;
+
+    constexpr int nCanvasSize = 256;
+    auto paintTile = [pModelObj]() {
+        std::vector<unsigned char> aBuffer(nCanvasSize * nCanvasSize * 4);
+        ScopedVclPtrInstance<VirtualDevice> xDevice(DeviceFormat::WITHOUT_ALPHA);
+        xDevice->SetOutputSizePixelScaleOffsetAndLOKBuffer(Size(nCanvasSize, nCanvasSize),
+                                                           Fraction(1.0), Point(), aBuffer.data());
+        pModelObj->paintTile(*xDevice, nCanvasSize, nCanvasSize, 0, 0, 3840, 3840);
+        return aBuffer;
+    };
+
+    // A repeated request without changes in between is served from the cache.
+    std::vector<unsigned char> aEmpty = paintTile();
+    CPPUNIT_ASSERT(aEmpty == paintTile());
+
+    // Typing into A1 invalidates the tile, so it has to be painted again.
+    typeCharsInCell(std::string("XXXX"), 0, 0, pView, pModelObj);
+    Scheduler::ProcessEventsToIdle();
+    CPPUNIT_ASSERT(aView.m_bInvalidateTiles);
+    CPPUNIT_ASSERT(aEmpty != paintTile());
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
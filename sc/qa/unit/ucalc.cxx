@@ -63,6 +63,7 @@
 #include <svl/srchitem.hxx>
 #include <svl/sharedstringpool.hxx>
 #include <unotools/collatorwrapper.hxx>
+#include <rtl/ustrbuf.hxx>
 #include <sfx2/IDocumentModelAccessor.hxx>
 
 #include <sfx2/sfxsids.hrc>
@@ -3865,6 +3866,54 @@ CPPUNIT_TEST_FIXTURE(Test, testAutofilterOptimizations)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(Test, testAutofilterLargeRange)
+{
+    m_pDoc->InsertTab( 0, u"Test"_ustr );
+
+    // Large enough to be evaluated on the thread pool, if enabled.
+    constexpr SCROW nRows = 40000;
+    m_pDoc->SetString(0, 0, 0, u"Column1"_ustr);
+    m_pDoc->SetString(1, 0, 0, u"Column2"_ustr);
+    for (SCROW i = 0; i < nRows; ++i)
+    {
+        m_pDoc->SetValue(0, i + 1, 0, i % 10);
+        m_pDoc->SetString(1, i + 1, 0, "val" + OUString::number(i % 3));
+    }
+
+    ScDBData* pDBData = new ScDBData(u"NONAME"_ustr, 0, 0, 0, 1, nRows);
+    m_pDoc->SetAnonymousDBData(0, std::unique_ptr<ScDBData>(pDBData));
+    pDBData->SetAutoFilter(true);
+
+    ScQueryParam aParam;
+    pDBData->GetQueryParam(aParam);
+    ScQueryEntry& rEntry0 = aParam.GetEntry(0);
+    rEntry0.bDoQuery = true;
+    rEntry0.nField = 0;
+    rEntry0.eOp = SC_GREATER;
+    rEntry0.GetQueryItems()[0].meType = ScQueryEntry::ByValue;
+    rEntry0.GetQueryItems()[0].mfVal = 4;
+    ScQueryEntry& rEntry1 = aParam.GetEntry(1);
+    rEntry1.bDoQuery = true;
+    rEntry1.nField = 1;
+    rEntry1.eConnect = SC_AND;
+    rEntry1.eOp = SC_EQUAL;
+    rEntry1.GetQueryItems()[0].meType = ScQueryEntry::ByString;
+    rEntry1.GetQueryItems()[0].maString = m_pDoc->GetSharedStringPool().intern(u"val1"_ustr);
+    pDBData->SetQueryParam(aParam);
+
+    // 5 of every 30 rows match, plus one in the last incomplete block.
+    CPPUNIT_ASSERT_EQUAL(SCSIZE(6666), m_pDoc->Query(0, aParam, true));
+
+    for (SCROW i : { 0, 7, 16, 19, 25, 28, 29, 39997, 39998 })
+    {
+        const bool bVisible = i % 10 > 4 && i % 3 == 1;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(OString("row " + OString::number(i + 1)).getStr(),
+                                     !bVisible, m_pDoc->RowHidden(i + 1, 0));
+    }
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(Test, testTdf76441)
 {
     m_pDoc->InsertTab(0, u"Test"_ustr);
@@ -6002,6 +6051,70 @@ CPPUNIT_TEST_FIXTURE(Test, testImportStream)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(Test, testImportStreamManyLines)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    // More lines than are split ahead at once, with quoted fields and an
+    // embedded line break, to check that the lines are put in order.
+    constexpr SCROW nLines = 20000;
+    OUStringBuffer aBuf;
+    for (SCROW i = 0; i < nLines; ++i)
+    {
+        aBuf.append(OUString::number(i) + ",\"text " + OUString::number(i) + "\",");
+        if (i == 10000)
+            aBuf.append("\"line\nbreak\"");
+        aBuf.append("\n");
+    }
+
+    ScAsciiOptions aOpt;
+    aOpt.SetFieldSeps(u","_ustr);
+
+    ScImportExport aObj(*m_pDoc, ScAddress(0,0,0));
+    aObj.SetExtOptions(aOpt);
+    CPPUNIT_ASSERT(aObj.ImportString(aBuf.makeStringAndClear(), SotClipboardFormatId::STRING));
+
+    for (SCROW i : { SCROW(0), SCROW(8191), SCROW(8192), SCROW(10000), nLines - 1 })
+    {
+        CPPUNIT_ASSERT_EQUAL(static_cast<double>(i), m_pDoc->GetValue(ScAddress(0,i,0)));
+        CPPUNIT_ASSERT_EQUAL(OUString("text " + OUString::number(i)), m_pDoc->GetString(ScAddress(1,i,0)));
+    }
+    CPPUNIT_ASSERT_EQUAL(u"line\nbreak"_ustr, m_pDoc->GetString(ScAddress(2,10000,0)));
+    CPPUNIT_ASSERT(m_pDoc->GetString(ScAddress(2,10001,0)).isEmpty());
+    CPPUNIT_ASSERT(m_pDoc->GetString(ScAddress(0,nLines,0)).isEmpty());
+
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(Test, testImportMemoryStreamUtf8)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    // Lines are read directly from the data of a memory stream, check the
+    // different line ends and a last line without one.
+    static const char aData[] = "1,\"\xc3\xa4\r\nb\"\r\n2,c\n\n3,\xe2\x82\xac\r4";
+    SvMemoryStream aStream(const_cast<char*>(aData), sizeof(aData) - 1, StreamMode::READ);
+    aStream.SetStreamEncoding(RTL_TEXTENCODING_UTF8);
+
+    ScAsciiOptions aOpt;
+    aOpt.SetFieldSeps(u","_ustr);
+
+    ScImportExport aObj(*m_pDoc, ScAddress(0,0,0));
+    aObj.SetExtOptions(aOpt);
+    CPPUNIT_ASSERT(aObj.ImportStream(aStream, OUString(), SotClipboardFormatId::STRING));
+
+    CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(0,0,0)));
+    CPPUNIT_ASSERT_EQUAL(u"ä\nb"_ustr, m_pDoc->GetString(ScAddress(1,0,0)));
+    CPPUNIT_ASSERT_EQUAL(2.0, m_pDoc->GetValue(ScAddress(0,1,0)));
+    CPPUNIT_ASSERT_EQUAL(u"c"_ustr, m_pDoc->GetString(ScAddress(1,1,0)));
+    CPPUNIT_ASSERT(m_pDoc->GetString(ScAddress(0,2,0)).isEmpty());
+    CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(0,3,0)));
+    CPPUNIT_ASSERT_EQUAL(u"€"_ustr, m_pDoc->GetString(ScAddress(1,3,0)));
+    CPPUNIT_ASSERT_EQUAL(4.0, m_pDoc->GetValue(ScAddress(0,4,0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(Test, testDeleteContents)
 {
     sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn on auto calc.
@@ -439,6 +439,44 @@ CPPUNIT_TEST_FIXTURE(TestCondformat, testColorScaleInMergedCell)
 }
 
 
+CPPUNIT_TEST_FIXTURE(TestCondformat, testColorScaleCacheWithoutValues)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    auto pFormat = std::make_unique<ScConditionalFormat>(1, *m_pDoc);
+    pFormat->SetRange(ScRange(0, 0, 0, 0, 2, 0));
+    auto pFormatTmp = pFormat.get();
+    m_pDoc->AddCondFormat(std::move(pFormat), 0);
+
+    ScColorScaleFormat* pColorScaleFormat = new ScColorScaleFormat(*m_pDoc);
+    pColorScaleFormat->AddEntry(new ScColorScaleEntry(0, COL_BLUE, COLORSCALE_MIN));
+    pColorScaleFormat->AddEntry(new ScColorScaleEntry(0, COL_RED, COLORSCALE_MAX));
+    pFormatTmp->AddEntry(pColorScaleFormat);
+
+    // Only text in the range: no numeric values are cached, and no colors.
+    m_pDoc->SetString(ScAddress(0, 0, 0), u"a"_ustr);
+    CPPUNIT_ASSERT(!pColorScaleFormat->GetColor(ScAddress(0, 0, 0)));
+    pFormatTmp->updateValues();
+    CPPUNIT_ASSERT(pFormatTmp->IsCacheValid());
+    CPPUNIT_ASSERT(pFormatTmp->GetCache()->empty());
+
+    // Changing the cells invalidates the (empty) cache.
+    m_pDoc->SetValue(ScAddress(0, 1, 0), 1.0);
+    m_pDoc->SetValue(ScAddress(0, 2, 0), 3.0);
+    CPPUNIT_ASSERT(!pFormatTmp->IsCacheValid());
+
+    std::optional<Color> oColor = pColorScaleFormat->GetColor(ScAddress(0, 1, 0));
+    CPPUNIT_ASSERT(oColor);
+    CPPUNIT_ASSERT_EQUAL(COL_BLUE, *oColor);
+    oColor = pColorScaleFormat->GetColor(ScAddress(0, 2, 0));
+    CPPUNIT_ASSERT(oColor);
+    CPPUNIT_ASSERT_EQUAL(COL_RED, *oColor);
+    CPPUNIT_ASSERT_EQUAL(size_t(2), pFormatTmp->GetCache()->size());
+
+    m_pDoc->DeleteTab(0);
+}
+
+
 CPPUNIT_TEST_FIXTURE(TestCondformat, testColorScaleCondCopyPaste)
 {
     m_pDoc->InsertTab(0, u"Test"_ustr);
@@ -4756,6 +4756,21 @@ CPPUNIT_TEST_FIXTURE(TestFormula, testFuncSUMPRODUCT)
     m_pDoc->SetString(ScAddress(5,2,0), u"=SUMPRODUCT(ABS(E1:E2);E1:E2+E1:E2)"_ustr);
     CPPUNIT_ASSERT_EQUAL(14.0, m_pDoc->GetValue(ScAddress(5,2,0)));
 
+    // Element-wise operations on larger arrays with numeric and empty blocks,
+    // and with a broadcast 1x1 array.
+    for (SCROW i = 0; i < 1000; ++i)
+    {
+        if (i != 499)
+            m_pDoc->SetValue(ScAddress(6,i,0), i + 1); // G1:G1000 except G500
+        m_pDoc->SetValue(ScAddress(7,i,0), 2.0); // H1:H1000
+    }
+    m_pDoc->SetString(ScAddress(9,0,0), u"=SUMPRODUCT((G1:G1000>500)*(H1:H1000))"_ustr);
+    CPPUNIT_ASSERT_EQUAL(1000.0, m_pDoc->GetValue(ScAddress(9,0,0)));
+    m_pDoc->SetString(ScAddress(9,1,0), u"=SUMPRODUCT(G1:G1000*{3})"_ustr);
+    CPPUNIT_ASSERT_EQUAL(1500000.0, m_pDoc->GetValue(ScAddress(9,1,0)));
+    m_pDoc->SetString(ScAddress(9,2,0), u"=SUMPRODUCT({1}-G1:G1000)"_ustr);
+    CPPUNIT_ASSERT_EQUAL(-499000.0, m_pDoc->GetValue(ScAddress(9,2,0)));
+
     m_pDoc->DeleteTab(0);
 }
 
@@ -20,6 +20,8 @@
 #include <undomanager.hxx>
 #include <broadcast.hxx>
 #include <kahan.hxx>
+#include <formulagroupprofile.hxx>
+#include <calcconfig.hxx>
 
 #include <svl/broadcast.hxx>
 #include <sfx2/docfile.hxx>
@@ -28,6 +30,7 @@
 #include <functional>
 #include <set>
 #include <algorithm>
+#include <cstdlib>
 #include <vector>
 
 using namespace formula;
@@ -722,6 +725,60 @@ CPPUNIT_TEST_FIXTURE(TestFormula2, testFuncVLOOKUP)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestFormula2, testFuncLookupHashIndex)
+{
+    // Exact-match lookups into large unsorted ranges use a hash index of the
+    // range, which is updated on cell changes.
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn auto calc on.
+
+    for (SCROW i = 0; i < 1000; ++i)
+    {
+        m_pDoc->SetValue(ScAddress(0, i, 0), (i + 1) * 2);
+        m_pDoc->SetValue(ScAddress(1, i, 0), i + 1);
+        m_pDoc->SetString(ScAddress(5, i, 0), "k" + OUString::number(i + 1));
+    }
+
+    m_pDoc->SetString(ScAddress(3, 0, 0), u"=VLOOKUP(500;$A$1:$B$1000;2;0)"_ustr);
+    m_pDoc->SetString(ScAddress(3, 1, 0), u"=MATCH(2000;$A$1:$A$1000;0)"_ustr);
+    m_pDoc->SetString(ScAddress(3, 2, 0), u"=VLOOKUP(7;$A$1:$B$1000;2;0)"_ustr);
+    m_pDoc->SetString(ScAddress(3, 3, 0), u"=MATCH(\"k700\";$F$1:$F$1000;0)"_ustr);
+    m_pDoc->SetString(ScAddress(3, 4, 0), u"=MATCH(\"K700\";$F$1:$F$1000;0)"_ustr);
+    m_pDoc->SetString(ScAddress(3, 5, 0), u"=MATCH(\"k1001\";$F$1:$F$1000;0)"_ustr);
+
+    CPPUNIT_ASSERT_EQUAL(250.0, m_pDoc->GetValue(ScAddress(3, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(1000.0, m_pDoc->GetValue(ScAddress(3, 1, 0)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(FormulaError::NotAvailable),
+                         static_cast<int>(m_pDoc->GetErrCode(ScAddress(3, 2, 0))));
+    CPPUNIT_ASSERT_EQUAL(700.0, m_pDoc->GetValue(ScAddress(3, 3, 0)));
+    CPPUNIT_ASSERT_EQUAL(700.0, m_pDoc->GetValue(ScAddress(3, 4, 0)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(FormulaError::NotAvailable),
+                         static_cast<int>(m_pDoc->GetErrCode(ScAddress(3, 5, 0))));
+
+    // Change keys so that earlier rows match.
+    m_pDoc->SetValue(ScAddress(0, 4, 0), 500.0);
+    m_pDoc->SetValue(ScAddress(0, 9, 0), 7.0);
+    m_pDoc->SetString(ScAddress(5, 1000, 0), u"k1001"_ustr); // outside of the range
+    CPPUNIT_ASSERT_EQUAL(5.0, m_pDoc->GetValue(ScAddress(3, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(10.0, m_pDoc->GetValue(ScAddress(3, 2, 0)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(FormulaError::NotAvailable),
+                         static_cast<int>(m_pDoc->GetErrCode(ScAddress(3, 5, 0))));
+
+    // A removed key is not found anymore.
+    m_pDoc->SetValue(ScAddress(0, 999, 0), 1.0);
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(FormulaError::NotAvailable),
+                         static_cast<int>(m_pDoc->GetErrCode(ScAddress(3, 1, 0))));
+
+    // Formula cells are not indexed but must still be found.
+    m_pDoc->SetString(ScAddress(5, 2, 0), u"=\"k\"&\"700\""_ustr);
+    CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(3, 3, 0)));
+    m_pDoc->SetString(ScAddress(5, 2, 0), u"k3"_ustr);
+    CPPUNIT_ASSERT_EQUAL(700.0, m_pDoc->GetValue(ScAddress(3, 3, 0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 template <size_t DataSize, size_t FormulaSize, int Type>
 void TestFormula2::runTestMATCH(ScDocument* pDoc, const char* aData[DataSize],
                                 const StrStrCheck aChecks[FormulaSize])
@@ -4198,6 +4255,39 @@ CPPUNIT_TEST_FIXTURE(TestFormula2, testFuncSUMIFS)
 }
 
 // Test that COUNTIF counts properly empty cells if asked to.
+// Test SUMIFS and friends over a main range mixing value, formula, string and empty cells.
+CPPUNIT_TEST_FIXTURE(TestFormula2, testFuncSUMIFSMixedMainRange)
+{
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn auto calc on.
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    // Criteria in A1:B8, main range in C1:D8.
+    std::vector<std::vector<const char*>> aData = {
+        { "1", "x", "10", "=C1*2" },   { "2", "y", "20", "a" },
+        { "3", "x", "=C1+C2", "40" },  { "4", "x", nullptr, "=D1+1" },
+        { "5", "y", "50", "60" },      { "6", "x", "text", "=\"s\"" },
+        { "7", "x", "70", "-5" },      { "8", "y", "80", "90" },
+    };
+    insertRangeData(m_pDoc, ScAddress(0, 0, 0), aData);
+
+    // Rows with A>2 and B="x" are 3, 4, 6 and 7.
+    m_pDoc->SetString(ScAddress(5, 1, 0), u"=SUMIFS(C1:C8;A1:A8;\">2\";B1:B8;\"x\")"_ustr);
+    m_pDoc->SetString(ScAddress(5, 2, 0), u"=SUMIFS(D1:D8;A1:A8;\">2\";B1:B8;\"x\")"_ustr);
+    m_pDoc->SetString(ScAddress(5, 3, 0), u"=AVERAGEIFS(D1:D8;A1:A8;\">2\";B1:B8;\"x\")"_ustr);
+    m_pDoc->SetString(ScAddress(5, 4, 0), u"=MINIFS(D1:D8;A1:A8;\">2\";B1:B8;\"x\")"_ustr);
+    m_pDoc->SetString(ScAddress(5, 5, 0), u"=MAXIFS(C1:C8;A1:A8;\">2\";B1:B8;\"x\")"_ustr);
+
+    // C3+C7 = 30+70
+    CPPUNIT_ASSERT_EQUAL(100.0, m_pDoc->GetValue(ScAddress(5, 1, 0)));
+    // D3+D4+D7 = 40+21-5, string formula result in D6 is skipped.
+    CPPUNIT_ASSERT_EQUAL(56.0, m_pDoc->GetValue(ScAddress(5, 2, 0)));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(56.0 / 3, m_pDoc->GetValue(ScAddress(5, 3, 0)), 1e-12);
+    CPPUNIT_ASSERT_EQUAL(-5.0, m_pDoc->GetValue(ScAddress(5, 4, 0)));
+    CPPUNIT_ASSERT_EQUAL(70.0, m_pDoc->GetValue(ScAddress(5, 5, 0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(TestFormula2, testFuncCOUNTIFEmpty)
 {
     sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn auto calc on.
@@ -4630,6 +4720,39 @@ CPPUNIT_TEST_FIXTURE(TestFormula2, testTdf156985)
 }
 #endif
 
+CPPUNIT_TEST_FIXTURE(TestFormula2, testVectorisedSumOfSquares)
+{
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, true);
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    // A1:A21 = 1..21, B1:B21 = 2, long enough for the vectorised loop and a
+    // remainder.
+    for (SCROW i = 0; i < 21; ++i)
+    {
+        m_pDoc->SetValue(ScAddress(0, i, 0), i + 1);
+        m_pDoc->SetValue(ScAddress(1, i, 0), 2.0);
+    }
+
+    // 21*22*43/6 = 3311
+    m_pDoc->SetString(ScAddress(3, 0, 0), u"=SUMSQ({1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17;18;19;20;21})"_ustr);
+    CPPUNIT_ASSERT_EQUAL(3311.0, m_pDoc->GetValue(ScAddress(3, 0, 0)));
+    m_pDoc->SetString(ScAddress(3, 1, 0), u"=SUMX2MY2(A1:A21;B1:B21)"_ustr);
+    CPPUNIT_ASSERT_EQUAL(3311.0 - 84.0, m_pDoc->GetValue(ScAddress(3, 1, 0)));
+    m_pDoc->SetString(ScAddress(3, 2, 0), u"=SUMX2PY2(A1:A21;B1:B21)"_ustr);
+    CPPUNIT_ASSERT_EQUAL(3311.0 + 84.0, m_pDoc->GetValue(ScAddress(3, 2, 0)));
+    m_pDoc->SetString(ScAddress(3, 3, 0), u"=SUMPRODUCT(A1:A21;B1:B21)"_ustr);
+    CPPUNIT_ASSERT_EQUAL(462.0, m_pDoc->GetValue(ScAddress(3, 3, 0)));
+
+    // A text cell skips its pair, an error is propagated.
+    m_pDoc->SetString(ScAddress(1, 20, 0), u"text"_ustr);
+    CPPUNIT_ASSERT_EQUAL(3311.0 - 441.0 - 80.0, m_pDoc->GetValue(ScAddress(3, 1, 0)));
+    CPPUNIT_ASSERT_EQUAL(420.0, m_pDoc->GetValue(ScAddress(3, 3, 0)));
+    m_pDoc->SetString(ScAddress(1, 20, 0), u"=1/0"_ustr);
+    CPPUNIT_ASSERT_EQUAL(FormulaError::DivisionByZero, m_pDoc->GetErrCode(ScAddress(3, 3, 0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(TestFormula2, testFormulaAfterDeleteRows)
 {
     sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn auto calc on.
@@ -4759,6 +4882,253 @@ CPPUNIT_TEST_FIXTURE(TestFormula2, testVertQueryEmptyCell)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestFormula2, testFormulaGroupProfile)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, false);
+
+    for (SCROW i = 0; i < 500; ++i)
+    {
+        m_pDoc->SetValue(ScAddress(0, i, 0), i);
+        m_pDoc->SetFormula(ScAddress(1, i, 0), "=A" + OUString::number(i + 1) + "*2",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+    }
+
+    const ScFormulaCell* pFC = m_pDoc->GetFormulaCell(ScAddress(1, 0, 0));
+    CPPUNIT_ASSERT(pFC);
+    CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(500), pFC->GetSharedLength());
+
+    // Nothing is recorded unless enabled.
+    CPPUNIT_ASSERT(!m_pDoc->IsFormulaGroupProfileEnabled());
+    CPPUNIT_ASSERT(!m_pDoc->GetFormulaGroupProfile());
+    CPPUNIT_ASSERT(m_pDoc->GetFormulaGroupProfileAsJson().isEmpty());
+
+    m_pDoc->EnableFormulaGroupProfile(true);
+    m_pDoc->CalcAll();
+    CPPUNIT_ASSERT_EQUAL(998.0, m_pDoc->GetValue(ScAddress(1, 499, 0)));
+
+    const sc::FormulaGroupProfile* pProfile = m_pDoc->GetFormulaGroupProfile();
+    CPPUNIT_ASSERT(pProfile);
+    const sc::FormulaGroupProfile::Entry* pEntry = pProfile->find(ScAddress(1, 0, 0));
+    CPPUNIT_ASSERT(pEntry);
+    CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(500), pEntry->mnLength);
+    CPPUNIT_ASSERT(pEntry->mnCalls >= 1);
+    CPPUNIT_ASSERT_EQUAL(pEntry->mnCalls, pEntry->mnOpenCL + pEntry->mnCompiled + pEntry->mnThreaded
+                                              + pEntry->mnScalar);
+    // A fall back always tells why.
+    CPPUNIT_ASSERT_EQUAL(pEntry->mnScalar == 0, pEntry->maLastFallback.isEmpty());
+
+    OUString aJson = m_pDoc->GetFormulaGroupProfileAsJson();
+    CPPUNIT_ASSERT(aJson.indexOf("\"groups\"") >= 0);
+    CPPUNIT_ASSERT(aJson.indexOf("\"length\": 500") >= 0);
+
+    // Disabling discards the data.
+    m_pDoc->EnableFormulaGroupProfile(false);
+    CPPUNIT_ASSERT(!m_pDoc->GetFormulaGroupProfile());
+
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(TestFormula2, testFormulaGroupCompiled)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, false);
+
+    for (SCROW i = 0; i < 500; ++i)
+    {
+        const OUString aRow = OUString::number(i + 1);
+        m_pDoc->SetValue(ScAddress(0, i, 0), i);
+        m_pDoc->SetFormula(ScAddress(1, i, 0), "=A" + aRow + "*2+1",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(2, i, 0), "=SUM(A" + aRow + ":B" + aRow + ")",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(3, i, 0), "=A" + aRow + "/(A" + aRow + "-10)",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(4, i, 0), "=AVERAGE(A$1:A" + aRow + ")",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+    }
+
+    m_pDoc->EnableFormulaGroupProfile(true);
+    m_pDoc->CalcAll();
+
+    for (SCROW i : { 0, 9, 11, 250, 499 })
+    {
+        CPPUNIT_ASSERT_EQUAL(2.0 * i + 1, m_pDoc->GetValue(ScAddress(1, i, 0)));
+        CPPUNIT_ASSERT_EQUAL(3.0 * i + 1, m_pDoc->GetValue(ScAddress(2, i, 0)));
+        CPPUNIT_ASSERT_EQUAL(i / (i - 10.0), m_pDoc->GetValue(ScAddress(3, i, 0)));
+        CPPUNIT_ASSERT_EQUAL(i / 2.0, m_pDoc->GetValue(ScAddress(4, i, 0)));
+    }
+    CPPUNIT_ASSERT_EQUAL(FormulaError::DivisionByZero, m_pDoc->GetErrCode(ScAddress(3, 10, 0)));
+
+    const sc::FormulaGroupProfile* pProfile = m_pDoc->GetFormulaGroupProfile();
+    CPPUNIT_ASSERT(pProfile);
+    const sc::FormulaGroupProfile::Entry* pEntry = pProfile->find(ScAddress(1, 0, 0));
+    CPPUNIT_ASSERT(pEntry);
+    if (ScCalcConfig::getForceCalculationType() == ForceCalculationNone
+        && !std::getenv("SC_NO_COMPILED_GROUP_CALCULATION") && !ScCalcConfig::isOpenCLEnabled())
+        CPPUNIT_ASSERT(pEntry->mnCompiled >= 1);
+
+    // A string in arithmetic is left to the interpreter.
+    m_pDoc->SetString(ScAddress(0, 20, 0), u"text"_ustr);
+    m_pDoc->CalcAll();
+    CPPUNIT_ASSERT_EQUAL(FormulaError::NoValue, m_pDoc->GetErrCode(ScAddress(1, 20, 0)));
+    CPPUNIT_ASSERT_EQUAL(43.0, m_pDoc->GetValue(ScAddress(1, 21, 0)));
+    // Ignored by SUM, but the error of B21 propagates.
+    CPPUNIT_ASSERT_EQUAL(FormulaError::NoValue, m_pDoc->GetErrCode(ScAddress(2, 20, 0)));
+    // Ignored by AVERAGE.
+    CPPUNIT_ASSERT_EQUAL(415.0 / 29, m_pDoc->GetValue(ScAddress(4, 29, 0)));
+
+    m_pDoc->EnableFormulaGroupProfile(false);
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(TestFormula2, testFormulaGroupThreadedOpCodes)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, false);
+
+    m_pDoc->SetValue(ScAddress(2, 0, 0), 0);
+    for (SCROW i = 0; i < 500; ++i)
+    {
+        const OUString aRow = OUString::number(i + 1);
+        m_pDoc->SetValue(ScAddress(0, i, 0), i);
+        m_pDoc->SetFormula(ScAddress(1, i, 0), "=OFFSET(A$1;ROW()-1;0)*2",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+        // OFFSET to the cell above, which is calculated by the same run.
+        if (i > 0)
+            m_pDoc->SetFormula(ScAddress(2, i, 0), "=OFFSET(A" + aRow + ";-1;2)+A" + aRow,
+                               formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(3, i, 0), "=TEXT(A" + aRow + ";\"0.0\")",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(4, i, 0), "=MATCH(A" + aRow + ";A$1:A$500;0)",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(5, i, 0), "=INDIRECT(\"A\"&ROW())+1",
+                           formula::FormulaGrammar::GRAM_NATIVE);
+    }
+
+    if (!std::getenv("SC_NO_THREADED_CALCULATION"))
+    {
+        for (SCCOL nCol : { 1, 3, 4 })
+        {
+            const ScFormulaCell* pFC = m_pDoc->GetFormulaCell(ScAddress(nCol, 0, 0));
+            CPPUNIT_ASSERT(pFC);
+            CPPUNIT_ASSERT(pFC->GetCode()->IsEnabledForThreading());
+        }
+    }
+    const ScFormulaCell* pFC = m_pDoc->GetFormulaCell(ScAddress(5, 0, 0));
+    CPPUNIT_ASSERT(pFC);
+    CPPUNIT_ASSERT(!pFC->GetCode()->IsEnabledForThreading());
+    const formula::FormulaToken* pBlocker = pFC->GetCode()->GetThreadingBlocker();
+    CPPUNIT_ASSERT(pBlocker);
+    CPPUNIT_ASSERT_EQUAL(ocIndirect, pBlocker->GetOpCode());
+
+    m_pDoc->EnableFormulaGroupProfile(true);
+    m_pDoc->CalcAll();
+
+    for (SCROW i : { 0, 1, 100, 250, 499 })
+    {
+        CPPUNIT_ASSERT_EQUAL(2.0 * i, m_pDoc->GetValue(ScAddress(1, i, 0)));
+        CPPUNIT_ASSERT_EQUAL(i * (i + 1) / 2.0, m_pDoc->GetValue(ScAddress(2, i, 0)));
+        CPPUNIT_ASSERT_EQUAL(OUString(OUString::number(i) + ".0"), m_pDoc->GetString(ScAddress(3, i, 0)));
+        CPPUNIT_ASSERT_EQUAL(i + 1.0, m_pDoc->GetValue(ScAddress(4, i, 0)));
+        CPPUNIT_ASSERT_EQUAL(i + 1.0, m_pDoc->GetValue(ScAddress(5, i, 0)));
+    }
+
+    // The profile names the opcode keeping a group from threads.
+    const sc::FormulaGroupProfile* pProfile = m_pDoc->GetFormulaGroupProfile();
+    CPPUNIT_ASSERT(pProfile);
+    const sc::FormulaGroupProfile::Entry* pEntry = pProfile->find(ScAddress(5, 0, 0));
+    if (pEntry && pEntry->maLastFallback.startsWith("formula not enabled for threading"))
+        CPPUNIT_ASSERT_EQUAL(u"formula not enabled for threading (INDIRECT)"_ustr,
+                             pEntry->maLastFallback);
+
+    m_pDoc->EnableFormulaGroupProfile(false);
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(TestFormula2, testSetDirtySelectiveAfterLoad)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    {
+        sc::AutoCalcSwitch aACSwitch(*m_pDoc, false);
+
+        m_pDoc->SetValue(ScAddress(0, 0, 0), 1.0);
+        m_pDoc->SetFormula(ScAddress(1, 0, 0), u"=A1+1"_ustr, formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(2, 0, 0), u"=NOW()*0+5"_ustr, formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(3, 0, 0), u"=C1+1"_ustr, formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(4, 0, 0), u"=A1+2"_ustr, formula::FormulaGrammar::GRAM_NATIVE);
+        m_pDoc->SetFormula(ScAddress(5, 0, 0), u"=E1+1"_ustr, formula::FormulaGrammar::GRAM_NATIVE);
+
+        // Pretend stale cached results from a file, E1 has none.
+        for (SCCOL nCol : { 1, 2, 3, 5 })
+        {
+            ScFormulaCell* pFC = m_pDoc->GetFormulaCell(ScAddress(nCol, 0, 0));
+            CPPUNIT_ASSERT(pFC);
+            pFC->SetResultDouble(100.0);
+            pFC->ResetDirty();
+        }
+        m_pDoc->ClearFormulaTree();
+    }
+
+    m_pDoc->SetDirtySelectiveAfterLoad();
+
+    // The normal cell keeps its cached result.
+    CPPUNIT_ASSERT_EQUAL(100.0, m_pDoc->GetValue(ScAddress(1, 0, 0)));
+    // The volatile cell and its dependent are recalculated.
+    CPPUNIT_ASSERT_EQUAL(5.0, m_pDoc->GetValue(ScAddress(2, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(6.0, m_pDoc->GetValue(ScAddress(3, 0, 0)));
+    // So are the cell without result and its dependent.
+    CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(4, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(4.0, m_pDoc->GetValue(ScAddress(5, 0, 0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(TestFormula2, testIdleHardRecalc)
+{
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, true);
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+    m_pDoc->InsertTab(1, u"Test2"_ustr);
+
+    m_pDoc->SetValue(ScAddress(0, 0, 0), 1.0);
+    m_pDoc->SetString(ScAddress(1, 0, 0), u"=A1+1"_ustr);
+    m_pDoc->SetString(ScAddress(0, 0, 1), u"=$Test.B1*2"_ustr);
+    CPPUNIT_ASSERT_EQUAL(4.0, m_pDoc->GetValue(ScAddress(0, 0, 1)));
+
+    // Pretend stale results, a hard recalc has to fix them.
+    for (const ScAddress& rPos : { ScAddress(1, 0, 0), ScAddress(0, 0, 1) })
+        m_pDoc->GetFormulaCell(rPos)->SetResultDouble(100.0);
+
+    m_pDoc->StartIdleHardRecalc();
+    CPPUNIT_ASSERT(m_pDoc->IsIdleHardRecalc());
+    CPPUNIT_ASSERT(m_pDoc->GetFormulaCell(ScAddress(1, 0, 0))->GetDirty());
+
+    ScRangeList aCalculated;
+    while (m_pDoc->IdleHardRecalc(aCalculated))
+        ;
+    CPPUNIT_ASSERT(!m_pDoc->IsIdleHardRecalc());
+    CPPUNIT_ASSERT(aCalculated.Contains(ScRange(1, 0, 0)));
+    CPPUNIT_ASSERT(aCalculated.Contains(ScRange(0, 0, 1)));
+    CPPUNIT_ASSERT(!m_pDoc->GetFormulaCell(ScAddress(1, 0, 0))->GetDirty());
+    CPPUNIT_ASSERT(!m_pDoc->GetFormulaCell(ScAddress(0, 0, 1))->GetDirty());
+    CPPUNIT_ASSERT_EQUAL(2.0, m_pDoc->GetValue(ScAddress(1, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(4.0, m_pDoc->GetValue(ScAddress(0, 0, 1)));
+
+    // After a cancel the cells are calculated on demand.
+    m_pDoc->GetFormulaCell(ScAddress(1, 0, 0))->SetResultDouble(100.0);
+    m_pDoc->StartIdleHardRecalc();
+    m_pDoc->CancelIdleHardRecalc();
+    CPPUNIT_ASSERT(!m_pDoc->IsIdleHardRecalc());
+    CPPUNIT_ASSERT_EQUAL(2.0, m_pDoc->GetValue(ScAddress(1, 0, 0)));
+
+    m_pDoc->DeleteTab(1);
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
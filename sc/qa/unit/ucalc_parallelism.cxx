@@ -525,6 +525,45 @@ CPPUNIT_TEST_FIXTURE(ScParallelismTest, testMultipleFGColumn)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(ScParallelismTest, testFGAcrossSheets)
+{
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, false);
+    m_pDoc->InsertTab(0, u"Sheet1"_ustr);
+    m_pDoc->InsertTab(1, u"Sheet2"_ustr);
+    m_pDoc->InsertTab(2, u"Sheet3"_ustr);
+
+    constexpr SCROW nFGLen = 1000;
+    for (SCROW nRow = 0; nRow < nFGLen; ++nRow)
+    {
+        const OUString aRow = OUString::number(nRow + 1);
+        for (SCTAB nTab = 0; nTab < 3; ++nTab)
+            m_pDoc->SetValue(0, nRow, nTab, nRow + nTab);
+
+        // Identical, independent formula-groups on Sheet1 and Sheet3 ...
+        m_pDoc->SetFormula(ScAddress(1, nRow, 0), "=A" + aRow + "*2",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        m_pDoc->SetFormula(ScAddress(1, nRow, 2), "=A" + aRow + "*2",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        // ... and one on Sheet2 that depends on the group of Sheet1.
+        m_pDoc->SetFormula(ScAddress(1, nRow, 1), "=$Sheet1.B" + aRow + "+A" + aRow,
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+    }
+
+    m_xDocShell->DoHardRecalc();
+
+    for (SCROW nRow = 0; nRow < nFGLen; ++nRow)
+    {
+        OString aMsg = "Value at Cell B" + OString::number(nRow + 1);
+        ASSERT_DOUBLES_EQUAL_MESSAGE(aMsg.getStr(), 2.0 * nRow, m_pDoc->GetValue(1, nRow, 0));
+        ASSERT_DOUBLES_EQUAL_MESSAGE(aMsg.getStr(), 3.0 * nRow + 1, m_pDoc->GetValue(1, nRow, 1));
+        ASSERT_DOUBLES_EQUAL_MESSAGE(aMsg.getStr(), 2.0 * (nRow + 2), m_pDoc->GetValue(1, nRow, 2));
+    }
+
+    m_pDoc->DeleteTab(2);
+    m_pDoc->DeleteTab(1);
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(ScParallelismTest, testFormulaGroupSpanEval)
 {
     sc::AutoCalcSwitch aACSwitch(*m_pDoc, false);
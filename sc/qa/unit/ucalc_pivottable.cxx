@@ -1023,6 +1023,60 @@ CPPUNIT_TEST_FIXTURE(TestPivottable, testPivotTableCache)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestPivottable, testPivotTableCacheAppend)
+{
+    /**
+     * Reading only the appended rows into a cache must give the same result
+     * as reading the whole range again.
+     */
+    m_pDoc->InsertTab(0, u"Data"_ustr);
+
+    const std::vector<std::vector<const char*>> aData = {
+        { "F1", "F2" },
+        { "R",  "20" },
+        { "A",  "45" },
+        { "F",  "12" },
+    };
+
+    ScAddress aPos(1,1,0);
+    insertRangeData(m_pDoc, aPos, aData);
+    // The source range has room for more rows.
+    ScRange aDataRange(1, 1, 0, 2, 10, 0);
+
+    ScDPCache aCache(*m_pDoc);
+    aCache.InitFromDoc(*m_pDoc, aDataRange);
+    CPPUNIT_ASSERT_EQUAL(SCROW(3), aCache.GetDataSize());
+
+    // Append rows with new and existing values, one new value sorting
+    // before all others.
+    m_pDoc->SetString(ScAddress(1,5,0), u"B"_ustr);
+    m_pDoc->SetValue(ScAddress(2,5,0), 45.0);
+    m_pDoc->SetString(ScAddress(1,6,0), u"a"_ustr);
+    m_pDoc->SetValue(ScAddress(2,6,0), 3.0);
+    m_pDoc->SetValue(ScAddress(2,7,0), 50.0);
+
+    CPPUNIT_ASSERT(aCache.AppendFromDoc(*m_pDoc, aDataRange));
+
+    ScDPCache aFullCache(*m_pDoc);
+    aFullCache.InitFromDoc(*m_pDoc, aDataRange);
+
+    CPPUNIT_ASSERT_EQUAL(aFullCache.GetDataSize(), aCache.GetDataSize());
+    CPPUNIT_ASSERT_EQUAL(aFullCache.GetRowCount(), aCache.GetRowCount());
+    for (SCCOL nDim = 0; nDim < 2; ++nDim)
+    {
+        CPPUNIT_ASSERT(aFullCache.GetDimMemberValues(nDim) == aCache.GetDimMemberValues(nDim));
+        CPPUNIT_ASSERT(*aFullCache.GetFieldIndexArray(nDim) == *aCache.GetFieldIndexArray(nDim));
+    }
+
+    // "a" is the same member as "A", and an empty member for the rest.
+    CPPUNIT_ASSERT_EQUAL(tools::Long(5), aCache.GetDimMemberCount(0));
+
+    // A different range can't be appended to.
+    CPPUNIT_ASSERT(!aCache.AppendFromDoc(*m_pDoc, ScRange(1, 1, 0, 2, 11, 0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(TestPivottable, testPivotTableDuplicateDataFields)
 {
     /**
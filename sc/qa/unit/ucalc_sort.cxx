@@ -474,6 +474,64 @@ CPPUNIT_TEST_FIXTURE(TestSort, testSortWithStrings)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestSort, testSortNumericKeys)
+{
+    m_pDoc->InsertTab(0, u"Test"_ustr);
+
+    // Numbers, an error and an empty cell as first key, ties resolved by the
+    // second key and then by the original order.
+    m_pDoc->SetValue(ScAddress(0,0,0), 3.0);
+    m_pDoc->SetString(ScAddress(0,1,0), u"=1/0"_ustr);
+    m_pDoc->SetValue(ScAddress(0,2,0), 1.0);
+    m_pDoc->SetValue(ScAddress(0,4,0), 3.0);
+    m_pDoc->SetValue(ScAddress(0,5,0), 1.0);
+    m_pDoc->SetValue(ScAddress(0,6,0), 2.0);
+
+    const double aKey2[] = { 1.0, 1.0, 2.0, 1.0, 0.0, 2.0, 5.0 };
+    const std::u16string_view aTags[] = { u"a", u"b", u"c", u"d", u"e", u"f", u"g" };
+    for (SCROW i = 0; i < 7; ++i)
+    {
+        m_pDoc->SetValue(ScAddress(1,i,0), aKey2[i]);
+        m_pDoc->SetString(ScAddress(2,i,0), OUString(aTags[i]));
+    }
+
+    ScSortParam aParam;
+    aParam.nCol1 = 0;
+    aParam.nCol2 = 2;
+    aParam.nRow1 = 0;
+    aParam.nRow2 = 6;
+    aParam.bHasHeader = false;
+    for (sal_uInt16 nSort = 0; nSort < 2; ++nSort)
+    {
+        aParam.maKeyState[nSort].bDoSort = true;
+        aParam.maKeyState[nSort].bAscending = true;
+        aParam.maKeyState[nSort].nField = nSort;
+        aParam.maKeyState[nSort].aColorSortMode = ScColorSortMode::None;
+    }
+
+    m_pDoc->Sort(0, aParam, false, true, nullptr, nullptr);
+
+    {
+        const std::u16string_view aExpected[] = { u"c", u"f", u"g", u"e", u"a", u"b", u"d" };
+        for (SCROW i = 0; i < 7; ++i)
+            CPPUNIT_ASSERT_EQUAL(OUString(aExpected[i]), m_pDoc->GetString(ScAddress(2,i,0)));
+    }
+
+    // Descending puts errors first, empty cells stay last.
+    aParam.maKeyState[0].bAscending = false;
+    aParam.maKeyState[1].bAscending = false;
+
+    m_pDoc->Sort(0, aParam, false, true, nullptr, nullptr);
+
+    {
+        const std::u16string_view aExpected[] = { u"b", u"a", u"e", u"g", u"c", u"f", u"d" };
+        for (SCROW i = 0; i < 7; ++i)
+            CPPUNIT_ASSERT_EQUAL(OUString(aExpected[i]), m_pDoc->GetString(ScAddress(2,i,0)));
+    }
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(TestSort, testSortInFormulaGroup)
 {
     SortRefUpdateSetter aUpdateSet;
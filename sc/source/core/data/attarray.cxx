@@ -41,6 +41,7 @@
 #include <segmenttree.hxx>
 #include <editdataarray.hxx>
 #include <cellvalue.hxx>
+#include <columnspanset.hxx>
 #include <editutil.hxx>
 #include <mtvelements.hxx>
 #include <memory>
@@ -907,6 +908,112 @@ void ScAttrArray::ApplyCacheArea( SCROW nStartRow, SCROW nEndRow, ScItemPoolCach
 #endif
 }
 
+void ScAttrArray::ApplyCacheSpans( const std::vector<sc::RowSpan>& rSpans, ScItemPoolCache& rCache,
+                                   ScEditDataArray* pDataArray, bool* const pIsChanged )
+{
+    if (rSpans.empty())
+        return;
+    if (rSpans.size() == 1)
+    {
+        ApplyCacheArea(rSpans[0].mnRow1, rSpans[0].mnRow2, rCache, pDataArray, pIsChanged);
+        return;
+    }
+
+#if DEBUG_SC_TESTATTRARRAY
+    TestData();
+#endif
+
+    SetDefaultIfNotInit();
+
+    // Applying the spans one by one would insert and erase entries in the
+    // middle of mvData for each of them, so build the new entries in a
+    // single merge pass over the old entries and the spans instead.
+    std::vector<ScAttrEntry> aNewData;
+    aNewData.reserve(mvData.size() + 2 * rSpans.size());
+    auto lcl_append = [&aNewData](SCROW nEndRow, const CellAttributeHolder& rPattern)
+    {
+        if (!aNewData.empty() && CellAttributeHolder::areSame(&aNewData.back().getCellAttributeHolder(), &rPattern))
+            aNewData.back().nEndRow = nEndRow;
+        else
+        {
+            aNewData.emplace_back();
+            aNewData.back().nEndRow = nEndRow;
+            aNewData.back().setCellAttributeHolder(rPattern);
+        }
+    };
+
+    ScAddress aAdrStart( nCol, 0, nTab );
+    ScAddress aAdrEnd  ( nCol, 0, nTab );
+
+    auto itSpan = rSpans.begin();
+    SCROW nStart = 0;
+    for (const ScAttrEntry& rEntry : mvData)
+    {
+        const SCROW nEntryStart = nStart;
+        const CellAttributeHolder& rOldPattern(rEntry.getCellAttributeHolder());
+        const CellAttributeHolder* pNewPattern = nullptr;
+        while (nStart <= rEntry.nEndRow)
+        {
+            while (itSpan != rSpans.end() && itSpan->mnRow2 < nStart)
+            {
+                assert((itSpan + 1 == rSpans.end() || itSpan->mnRow2 < (itSpan + 1)->mnRow1)
+                       && "spans must be sorted and disjoint");
+                ++itSpan;
+            }
+            if (itSpan == rSpans.end() || itSpan->mnRow1 > rEntry.nEndRow)
+            {
+                lcl_append(rEntry.nEndRow, rOldPattern);
+                nStart = rEntry.nEndRow + 1;
+                break;
+            }
+            if (itSpan->mnRow1 > nStart)
+            {
+                lcl_append(itSpan->mnRow1 - 1, rOldPattern);
+                nStart = itSpan->mnRow1;
+            }
+
+            const SCROW nEnd = std::min(itSpan->mnRow2, rEntry.nEndRow);
+            if (!pNewPattern)
+                pNewPattern = &rCache.ApplyTo(rOldPattern);
+            if (!CellAttributeHolder::areSame(pNewPattern, &rOldPattern))
+            {
+                if (pIsChanged)
+                    *pIsChanged = true;
+
+                if ( nCol != -1 )
+                {
+                    // ensure attributing changes text-width of cell
+
+                    const SfxItemSet& rNewSet = pNewPattern->getScPatternAttr()->GetItemSet();
+                    const SfxItemSet& rOldSet = rOldPattern.getScPatternAttr()->GetItemSet();
+
+                    bool bNumFormatChanged;
+                    if ( ScGlobal::CheckWidthInvalidate( bNumFormatChanged,
+                            rNewSet, rOldSet ) )
+                    {
+                        aAdrStart.SetRow( nStart );
+                        aAdrEnd  .SetRow( nEnd );
+                        rDocument.InvalidateTextWidth( &aAdrStart, &aAdrEnd, bNumFormatChanged );
+                    }
+
+                    // Only a part of the entry changes, as in SetPatternArea().
+                    if (pDataArray && (nStart > nEntryStart || nEnd < rEntry.nEndRow))
+                        RemoveCellCharAttribs(nStart, nEnd, pNewPattern->getScPatternAttr(), pDataArray);
+                }
+            }
+            lcl_append(nEnd, *pNewPattern);
+            nStart = nEnd + 1;
+        }
+    }
+
+    mvData.swap(aNewData);
+    rDocument.SetStreamValid(nTab, false);
+
+#if DEBUG_SC_TESTATTRARRAY
+    TestData();
+#endif
+}
+
 void ScAttrArray::SetAttrEntries(std::vector<ScAttrEntry> && vNewData)
 {
     mvData = std::move(vNewData);
@@ -26,6 +26,7 @@
 #include <editeng/eerdll.hxx>
 #include <editeng/borderline.hxx>
 #include <editeng/itemtype.hxx>
+#include <o3tl/hash_combine.hxx>
 #include <svl/itempool.hxx>
 
 #include <libxml/xmlwriter.h>
@@ -109,6 +110,14 @@ bool ScMergeAttr::operator==( const SfxPoolItem& rItem ) const
              && (nRowMerge == static_cast<const ScMergeAttr&>(rItem).nRowMerge);
 }
 
+size_t ScMergeAttr::hashCode() const
+{
+    std::size_t seed = 0;
+    o3tl::hash_combine(seed, nColMerge);
+    o3tl::hash_combine(seed, nRowMerge);
+    return seed;
+}
+
 ScMergeAttr* ScMergeAttr::Clone( SfxItemPool * ) const
 {
     return new ScMergeAttr(*this);
@@ -353,6 +362,12 @@ bool ScProtectionAttr::operator==( const SfxPoolItem& rItem ) const
              && (bHidePrint == static_cast<const ScProtectionAttr&>(rItem).bHidePrint);
 }
 
+size_t ScProtectionAttr::hashCode() const
+{
+    return size_t(bProtection) | (size_t(bHideFormula) << 1) | (size_t(bHideCell) << 2)
+           | (size_t(bHidePrint) << 3);
+}
+
 ScProtectionAttr* ScProtectionAttr::Clone( SfxItemPool * ) const
 {
     return new ScProtectionAttr(*this);
@@ -10,6 +10,7 @@
 #include <memory>
 #include <colorscale.hxx>
 #include <document.hxx>
+#include <dociter.hxx>
 #include <formulacell.hxx>
 #include <fillinfo.hxx>
 #include <bitmaps.hlst>
@@ -504,23 +505,14 @@ std::vector<double>& ScColorFormat::getValues() const
 {
     assert(mpParent);
 
-    std::vector<double>* pCache = mpParent->GetCache();
-    if (!pCache || pCache->empty())
+    // An empty but valid cache means that there are no numeric cells, don't
+    // scan the ranges again for every painted cell then.
+    if (!mpParent->IsCacheValid())
     {
-        if (!pCache)
-        {
-            SetCache({});
-            pCache = mpParent->GetCache();
-            assert(pCache);
-        }
+        std::vector<double> aValues;
 
-        std::vector<double>& rValues = *pCache;
-
-        size_t n = GetRange().size();
-        const ScRangeList& aRanges = GetRange();
-        for(size_t i = 0; i < n; ++i)
+        for (const ScRange& rRange : GetRange())
         {
-            const ScRange & rRange = aRanges[i];
             SCTAB nTab = rRange.aStart.Tab();
 
             SCCOL nColStart = rRange.aStart.Col();
@@ -534,24 +526,23 @@ std::vector<double>& ScColorFormat::getValues() const
                 mrDoc.ShrinkToUsedDataArea(bShrunk, nTab, nColStart, nRowStart,
                         nColEnd, nRowEnd, false);
             }
-            for(SCCOL nCol = nColStart; nCol <= nColEnd; ++nCol)
+
+            // only visit the non-empty cells, block by block
+            ScCellIterator aIter(mrDoc, ScRange(nColStart, nRowStart, nTab, nColEnd, nRowEnd, nTab));
+            for (bool bHas = aIter.first(); bHas; bHas = aIter.next())
             {
-                for(SCROW nRow = nRowStart; nRow <= nRowEnd; ++nRow)
-                {
-                    ScAddress aAddr(nCol, nRow, nTab);
-                    ScRefCellValue rCell(mrDoc, aAddr);
-                    if(rCell.hasNumeric())
-                    {
-                        double aVal = rCell.getValue();
-                        rValues.push_back(aVal);
-                    }
-                }
+                ScRefCellValue aCell = aIter.getRefCellValue();
+                if (aCell.hasNumeric())
+                    aValues.push_back(aCell.getValue());
             }
         }
 
-        std::sort(rValues.begin(), rValues.end());
+        std::sort(aValues.begin(), aValues.end());
+        SetCache(aValues);
     }
 
+    std::vector<double>* pCache = mpParent->GetCache();
+    assert(pCache);
     return *pCache;
 }
 
@@ -381,6 +381,12 @@ void ScColumnData::ApplySelectionCache(ScItemPoolCache& rCache, SCROW nStartRow,
     pAttrArray->ApplyCacheArea(nStartRow, nEndRow, rCache, pDataArray, pIsChanged);
 }
 
+void ScColumnData::ApplySelectionCache(ScItemPoolCache& rCache, const std::vector<sc::RowSpan>& rSpans,
+                                       ScEditDataArray* pDataArray, bool* pIsChanged)
+{
+    pAttrArray->ApplyCacheSpans(rSpans, rCache, pDataArray, pIsChanged);
+}
+
 void ScColumnData::ChangeSelectionIndent(bool bIncrement, SCROW nStartRow, SCROW nEndRow)
 {
     pAttrArray->ChangeIndent(nStartRow, nEndRow, bIncrement);
@@ -2359,6 +2365,10 @@ bool ScColumn::UpdateReference( sc::RefUpdateContext& rCxt, ScDocument* pUndoDoc
         // Cells in this column are all empty, or clip or undo doc. No update needed.
         return false;
 
+    if (!HasFormulaCell())
+        // Only formula cells hold references, and there are no groups to split.
+        return false;
+
     if (rCxt.meMode == URM_COPY)
         return UpdateReferenceOnCopy(rCxt, pUndoDoc);
 
@@ -2803,6 +2813,16 @@ struct SetDirtyAfterLoadHandler
     }
 };
 
+struct SetDirtySelectiveAfterLoadHandler
+{
+    void operator() (size_t /*nRow*/, ScFormulaCell* pCell)
+    {
+        const ScTokenArray* pCode = pCell->GetCode();
+        if (pCell->GetDirty() || !pCode->IsRecalcModeNormal() || pCode->HasExternalRef())
+            pCell->SetDirty();
+    }
+};
+
 struct SetDirtyIfPostponedHandler
 {
     void operator() (size_t /*nRow*/, ScFormulaCell* pCell)
@@ -3248,6 +3268,14 @@ public:
 
 }
 
+void ScColumn::SetDirtySelectiveAfterLoad()
+{
+    sc::AutoCalcSwitch aSwitch(GetDoc(), false);
+    SetDirtySelectiveAfterLoadHandler aFunc;
+    ScBulkBroadcast aBulkBroadcast( GetDoc().GetBASM(), SfxHintId::ScDataChanged);
+    sc::ProcessFormula(maCells, aFunc);
+}
+
 void ScColumn::SetDirtyIfPostponed()
 {
     sc::AutoCalcSwitch aSwitch(GetDoc(), false);
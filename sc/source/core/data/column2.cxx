@@ -911,6 +911,8 @@ void ScColumn::GetOptimalHeight(
 
     const ScPatternAttr* pPattern = aIter.Next(nStart,nEnd);
     const sal_uInt16 nOptimalMinRowHeight = GetDoc().GetSheetOptimalMinRowHeight(nTab);
+    const sal_uInt16 nColWidth = rDocument.GetColWidth(nCol, nTab);
+    const bool bCacheTextAllowed = !rDocument.GetPreviewFont() && !rDocument.GetPreviewCellStyle();
     while ( pPattern )
     {
         const ScMergeAttr*      pMerge = &pPattern->GetItem(ATTR_MERGE);
@@ -1068,6 +1070,14 @@ void ScColumn::GetOptimalHeight(
                 ScNeededSizeOptions aOptions;
                 CellAttributeHolder aOldPattern;
 
+                //  plain strings only depend on pattern, text and column width,
+                //  unless conditional formats, rotation, horizontal merges, table
+                //  styles or a style preview come into play
+                const bool bCacheText = bCacheTextAllowed &&
+                    pPattern->GetItem(ATTR_CONDITIONAL).GetCondFormatData().empty() &&
+                    !pPattern->GetItem(ATTR_ROTATE_VALUE).GetValue() &&
+                    pMerge->GetColMerge() <= 1;
+
                 for (const auto& rSpan : aSpans)
                 {
                     for (SCROW nRow = rSpan.mnRow1; nRow <= rSpan.mnRow2; ++nRow)
@@ -1076,6 +1086,24 @@ void ScColumn::GetOptimalHeight(
 
                         if (rCxt.isForceAutoSize() || !(rDocument.GetRowFlags(nRow, nTab) & CRFlags::ManualSize) )
                         {
+                            OUString aCacheText;
+                            if (bCacheText)
+                            {
+                                std::pair<sc::CellStoreType::const_iterator,size_t> aPos = maCells.position(nRow);
+                                if (aPos.first->type == sc::element_type_string &&
+                                    !rDocument.GetTableFormatSet(nCol, nRow, nTab))
+                                {
+                                    aCacheText = sc::string_block::at(*aPos.first->data, aPos.second).getString();
+                                    sal_uInt16 nHeight = rCxt.findTextHeight(pPattern, aCacheText, nColWidth);
+                                    if (nHeight)
+                                    {
+                                        if (nHeight > rHeights.GetValue(nRow))
+                                            rHeights.SetValue(nRow, nRow, nHeight);
+                                        continue;
+                                    }
+                                }
+                            }
+
                             aOptions.aPattern.setScPatternAttr(pPattern);
                             aOldPattern.setScPatternAttr(aOptions.aPattern.getScPatternAttr());
                             sal_uInt16 nHeight = static_cast<sal_uInt16>(
@@ -1086,6 +1114,8 @@ void ScColumn::GetOptimalHeight(
                                     double(std::numeric_limits<sal_uInt16>::max())));
                             if (nHeight > rHeights.GetValue(nRow))
                                 rHeights.SetValue(nRow, nRow, nHeight);
+                            if (!aCacheText.isEmpty() && nHeight)
+                                rCxt.setTextHeight(pPattern, aCacheText, nColWidth, nHeight);
 
                             // Pattern changed due to calculation? => sync.
                             if (!ScPatternAttr::areSame(pPattern, aOldPattern.getScPatternAttr()))
@@ -2992,6 +3022,19 @@ formula::VectorRefArray ScColumn::FetchVectorRefArray( SCROW nRow1, SCROW nRow2
         return formula::VectorRefArray(pNum, pStr);
     }
 
+    if (GetDoc().ValidRow(nRow1))
+    {
+        // Requested range falls within a single numeric block, point straight into the
+        // cell storage instead of copying the column from the top into a cached array.
+        sc::CellStoreType::position_type aPos = maCells.position(nRow1);
+        if (aPos.first != maCells.end() && aPos.first->type == sc::element_type_numeric
+            && o3tl::make_unsigned(nRow2 - nRow1) < aPos.first->size - aPos.second)
+        {
+            const double* p = &sc::numeric_block::at(*aPos.first->data, aPos.second);
+            return formula::VectorRefArray(p);
+        }
+    }
+
     // ScColumn::CellStorageModified() simply discards the entire cache (FormulaGroupContext)
     // on any modification. However getting cell values may cause this to be called
     // if interpreting a cell results in a change to it (not just its result though).
@@ -29,6 +29,7 @@
 #include <formula/errorcodes.hxx>
 #include <formula/token.hxx>
 #include <brdcst.hxx>
+#include <bcaslot.hxx>
 #include <docoptio.hxx>
 #include <subtotal.hxx>
 #include <markdata.hxx>
@@ -52,6 +53,7 @@
 #include <com/sun/star/lang/IllegalArgumentException.hpp>
 
 #include <memory>
+#include <unordered_set>
 
 #include <o3tl/deleter.hxx>
 
@@ -80,12 +82,20 @@ void ScColumn::BroadcastCells( const std::vector<SCROW>& rRows, SfxHintId nHint
     if (rRows.empty())
         return;
 
-    // Broadcast the changes.
+    // Broadcast the changes. Adjacent rows are sent as one row block, and
+    // everything within one bulk broadcast, so that area listeners are
+    // notified only once and formula group listeners get the collected spans
+    // in a single pass instead of one notification per cell.
     ScDocument& rDocument = GetDoc();
-    ScHint aHint(nHint, ScAddress(nCol, 0, nTab));
-    for (const auto& rRow : rRows)
+    ScBulkBroadcast aBulkBroadcast(rDocument.GetBASM(), nHint);
+    for (auto it = rRows.begin(), itEnd = rRows.end(); it != itEnd; )
     {
-        aHint.SetAddressRow(rRow);
+        const SCROW nRow1 = *it;
+        SCROW nRow2 = nRow1;
+        for (++it; it != itEnd && *it == nRow2 + 1; ++it)
+            ++nRow2;
+
+        ScHint aHint(nHint, ScAddress(nCol, nRow1, nTab), nRow2 - nRow1 + 1);
         rDocument.Broadcast(aHint);
     }
 }
@@ -2574,7 +2584,19 @@ class FilterEntriesHandler
     {
         ScInterpreterContext& rContext = mrColumn.GetDoc().GetNonThreadedContext();
         sal_uInt32 nFormat = mrColumn.GetNumberFormat(rContext, nRow);
-        OUString aStr = ScCellFormat::GetInputString(rCell, nFormat, &rContext, mrColumn.GetDoc(), mbFiltering);
+        OUString aStr;
+        if (rCell.getType() == CELLTYPE_VALUE)
+        {
+            // Long columns tend to repeat their values, format each one only once.
+            auto aKey = std::make_pair(rCell.getDouble(), nFormat);
+            auto it = mrFilterEntries.maValueStrings.find(aKey);
+            if (it == mrFilterEntries.maValueStrings.end())
+                it = mrFilterEntries.maValueStrings.emplace(aKey,
+                        ScCellFormat::GetInputString(rCell, nFormat, &rContext, mrColumn.GetDoc(), mbFiltering)).first;
+            aStr = it->second;
+        }
+        else
+            aStr = ScCellFormat::GetInputString(rCell, nFormat, &rContext, mrColumn.GetDoc(), mbFiltering);
 
         // Colors
         ScAddress aPos(rColumn.GetCol(), nRow, rColumn.GetTab());
@@ -2964,12 +2986,16 @@ bool ScColumn::GetDataEntries(
     if (bMoveDown && !aItrDown.has())
         bMoveDown = aItrDown.next(); // Find the next string cell position.
 
+    // rStrings compares case-insensitively through the transliteration,
+    // so skip exact repeats of a string by hash before getting there.
+    std::unordered_set<OUString> aSeen;
+
     bool bFound = false;
     while (bMoveUp)
     {
         // Get the current string and move up.
         OUString aStr = aItrUp.get();
-        if (!aStr.isEmpty())
+        if (!aStr.isEmpty() && aSeen.insert(aStr).second)
         {
             if (rStrings.insert(ScTypedStrData(std::move(aStr))).second)
                 bFound = true;
@@ -2982,7 +3008,7 @@ bool ScColumn::GetDataEntries(
     {
         // Get the current string and move down.
         OUString aStr = aItrDown.get();
-        if (!aStr.isEmpty())
+        if (!aStr.isEmpty() && aSeen.insert(aStr).second)
         {
             if (rStrings.insert(ScTypedStrData(std::move(aStr))).second)
                 bFound = true;
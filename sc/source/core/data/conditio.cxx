@@ -1836,6 +1836,7 @@ void ScColorFormatCache::Notify(const SfxHint& rHint)
     }
 
     maValues.clear();
+    mbValid = false;
 }
 
 
@@ -2234,6 +2235,7 @@ void ScConditionalFormat::ResetCache() const
         // Don't shrink the range of mpCache yet as it is expensive.
         // Just clear the cache.
         mpCache->maValues.clear();
+        mpCache->mbValid = false;
         return;
     }
 
@@ -2248,7 +2250,10 @@ void ScConditionalFormat::SetCache(const std::vector<double>& aValues) const
     if (!mpCache)
         ResetCache();
     if (mpCache)
+    {
         mpCache->maValues = aValues;
+        mpCache->mbValid = true;
+    }
 }
 
 std::vector<double>* ScConditionalFormat::GetCache() const
@@ -2256,6 +2261,11 @@ std::vector<double>* ScConditionalFormat::GetCache() const
     return mpCache ? &mpCache->maValues : nullptr;
 }
 
+bool ScConditionalFormat::IsCacheValid() const
+{
+    return mpCache && mpCache->mbValid;
+}
+
 ScConditionalFormatList::ScConditionalFormatList(const ScConditionalFormatList& rList)
 {
     for(const auto& rxFormat : rList)
@@ -35,16 +35,56 @@ ScDatabaseDocUtil::StrData::StrData() :
 {
 }
 
+sal_uInt32 ScDatabaseDocUtil::GetNumberFormat(ScDocument& rDoc, tools::Long nType, bool bCurrency)
+{
+    //TODO: use language from doc (here, date/time and currency)?
+    SvNumFormatType eFormatType;
+    switch ( nType )
+    {
+        case sdbc::DataType::BIT:
+        case sdbc::DataType::BOOLEAN:
+            eFormatType = SvNumFormatType::LOGICAL;
+            break;
+        case sdbc::DataType::TINYINT:
+        case sdbc::DataType::SMALLINT:
+        case sdbc::DataType::INTEGER:
+        case sdbc::DataType::BIGINT:
+        case sdbc::DataType::FLOAT:
+        case sdbc::DataType::REAL:
+        case sdbc::DataType::DOUBLE:
+        case sdbc::DataType::NUMERIC:
+        case sdbc::DataType::DECIMAL:
+            eFormatType = SvNumFormatType::NUMBER;
+            break;
+        case sdbc::DataType::DATE:
+            eFormatType = SvNumFormatType::DATE;
+            break;
+        case sdbc::DataType::TIME:
+            eFormatType = SvNumFormatType::TIME;
+            break;
+        case sdbc::DataType::TIMESTAMP:
+            eFormatType = SvNumFormatType::DATETIME;
+            break;
+        default:
+            return 0;   // no value column
+    }
+    if ( bCurrency )
+        eFormatType = SvNumFormatType::CURRENCY;
+    if ( eFormatType == SvNumFormatType::NUMBER )
+        return 0;
+    return rDoc.GetFormatTable()->GetStandardFormat( eFormatType, ScGlobal::eLnge );
+}
+
 bool ScDatabaseDocUtil::PutData(ScDocument& rDoc, SCCOL nCol, SCROW nRow, SCTAB nTab,
                                 const uno::Reference<sdbc::XRow>& xRow, sal_Int32 nRowPos,
-                                tools::Long nType, bool bCurrency, StrData* pStrData)
+                                tools::Long nType, bool bCurrency, StrData* pStrData,
+                                bool bSetNumberFormat)
 {
     OUString aString;
     double nVal = 0.0;
     bool bValue = false;
     bool bEmptyFlag = false;
     bool bError = false;
-    sal_uInt32 nFormatIndex = 0;
 
     // wasNull calls only if null value was found?
 
@@ -54,9 +94,6 @@ bool ScDatabaseDocUtil::PutData(ScDocument& rDoc, SCCOL nCol, SCROW nRow, SCTAB
         {
             case sdbc::DataType::BIT:
             case sdbc::DataType::BOOLEAN:
-                //TODO: use language from doc (here, date/time and currency)?
-                nFormatIndex = rDoc.GetFormatTable()->GetStandardFormat(
-                                    SvNumFormatType::LOGICAL, ScGlobal::eLnge );
                 nVal = (xRow->getBoolean(nRowPos) ? 1 : 0);
                 bEmptyFlag = ( nVal == 0.0 ) && xRow->wasNull();
                 bValue = true;
@@ -91,22 +128,13 @@ bool ScDatabaseDocUtil::PutData(ScDocument& rDoc, SCCOL nCol, SCROW nRow, SCTAB
                     if (bEmptyFlag)
                         nVal = 0.0;
                     else
-                    {
-                        SvNumberFormatter* pFormTable = rDoc.GetFormatTable();
-                        nFormatIndex = pFormTable->GetStandardFormat(
-                                SvNumFormatType::DATE, ScGlobal::eLnge );
-                        nVal = Date( aDate ) - pFormTable->GetNullDate();
-                    }
+                        nVal = Date( aDate ) - rDoc.GetFormatTable()->GetNullDate();
                     bValue = true;
                 }
                 break;
 
             case sdbc::DataType::TIME:
                 {
-                    SvNumberFormatter* pFormTable = rDoc.GetFormatTable();
-                    nFormatIndex = pFormTable->GetStandardFormat(
-                                        SvNumFormatType::TIME, ScGlobal::eLnge );
-
                     util::Time aTime = xRow->getTime(nRowPos);
                     nVal = aTime.Hours       / static_cast<double>(::tools::Time::hourPerDay)   +
                            aTime.Minutes     / static_cast<double>(::tools::Time::minutePerDay) +
@@ -120,9 +148,6 @@ bool ScDatabaseDocUtil::PutData(ScDocument& rDoc, SCCOL nCol, SCROW nRow, SCTAB
             case sdbc::DataType::TIMESTAMP:
                 {
                     SvNumberFormatter* pFormTable = rDoc.GetFormatTable();
-                    nFormatIndex = pFormTable->GetStandardFormat(
-                                        SvNumFormatType::DATETIME, ScGlobal::eLnge );
-
                     util::DateTime aStamp = xRow->getTimestamp(nRowPos);
                     if (aStamp.Year != 0)
                     {
@@ -154,10 +179,6 @@ bool ScDatabaseDocUtil::PutData(ScDocument& rDoc, SCCOL nCol, SCROW nRow, SCTAB
         bError = true;
     }
 
-    if ( bValue && bCurrency )
-        nFormatIndex = rDoc.GetFormatTable()->GetStandardFormat(
-                            SvNumFormatType::CURRENCY, ScGlobal::eLnge );
-
     ScAddress aPos(nCol, nRow, nTab);
     if (bEmptyFlag)
         rDoc.SetEmptyCell(aPos);
@@ -168,8 +189,11 @@ bool ScDatabaseDocUtil::PutData(ScDocument& rDoc, SCCOL nCol, SCROW nRow, SCTAB
     else if (bValue)
     {
         rDoc.SetValue(aPos, nVal);
-        if (nFormatIndex)
-            rDoc.SetNumberFormat(aPos, nFormatIndex);
+        if (bSetNumberFormat)
+        {
+            if (sal_uInt32 nFormatIndex = GetNumberFormat(rDoc, nType, bCurrency))
+                rDoc.SetNumberFormat(aPos, nFormatIndex);
+        }
     }
     else
     {
@@ -33,6 +33,7 @@
 #include <svl/sharedstringpool.hxx>
 #include <tools/mapunit.hxx>
 #include <tools/urlobj.hxx>
+#include <tools/json_writer.hxx>
 #include <rtl/crc.h>
 #include <basic/basmgr.hxx>
 #include <comphelper/threadpool.hxx>
@@ -96,6 +97,7 @@
 #include <docpool.hxx>
 #include <config_features.h>
 #include <tablestyle.hxx>
+#include <formulagroupprofile.hxx>
 
 using namespace com::sun::star;
 
@@ -151,6 +153,7 @@ ScDocument::ScDocument( ScDocumentMode eMode, ScDocShell* pDocShell ) :
         nUnoObjectId( 0 ),
         nRangeOverflowType( 0 ),
         aCurTextWidthCalcPos(MaxCol(),0,0),
+        aCurIdleRecalcPos(0,0,0),
         aTrackIdle("sc ScDocument Track Idle"),
         nFormulaCodeInTree(0),
         nXMLImportedFormulaCount( 0 ),
@@ -159,6 +162,7 @@ ScDocument::ScDocument( ScDocumentMode eMode, ScDocShell* pDocShell ) :
         nInterpreterTableOpLevel(0),
         maInterpreterContext( *this, nullptr ),
         mxScSortedRangeCache(new ScSortedRangeCacheMap),
+        mxScLookupHashIndex(new ScLookupHashIndexMap),
         nFormulaTrackCount(0),
         eHardRecalcState(HardRecalcState::OFF),
         nVisibleTab( 0 ),
@@ -214,6 +218,7 @@ ScDocument::ScDocument( ScDocumentMode eMode, ScDocShell* pDocShell ) :
         mbFinalTrackFormulas(false),
         mbDocShellRecalc(false),
         mbLayoutStrings(false),
+        mbIdleHardRecalc(false),
         mnMutationGuardFlags(0)
 {
     maPreviewSelection = { *mxSheetLimits };
@@ -614,7 +619,18 @@ void ScDocument::EnsureTable( SCTAB nTab )
 ScRefCellValue ScDocument::GetRefCellValue( const ScAddress& rPos )
 {
     if (ScTable* pTable = FetchTable(rPos.Tab()))
+    {
+        if (IsThreadedGroupCalcInProgress())
+        {
+            // The cell storage doesn't change during the threaded calculation,
+            // continue the block search at the previous read of the column.
+            ScInterpreterContext& rContext = *maThreadSpecific.pContext;
+            if (!rContext.mxColumnPositions)
+                rContext.mxColumnPositions.reset(new sc::ColumnBlockConstPositionSet);
+            return pTable->GetRefCellValue(rPos.Col(), rPos.Row(), *rContext.mxColumnPositions);
+        }
         return pTable->GetRefCellValue(rPos.Col(), rPos.Row());
+    }
     return ScRefCellValue(); // empty
 }
 
@@ -1307,6 +1323,29 @@ ScSortedRangeCache& ScDocument::GetSortedRangeCache( const ScRange & rRange, con
     return *findIt->second;
 }
 
+ScLookupHashIndex& ScDocument::GetLookupHashIndex( const ScRange & rRange, const ScQueryParam& param )
+{
+    assert(mxScLookupHashIndex);
+    ScLookupHashIndex::HashKey key = ScLookupHashIndex::makeHashKey(rRange, param);
+    // Like ScSortedRangeCache, build this just once and share it between threads.
+    {
+        std::shared_lock guard(mScLookupMutex);
+        auto findIt = mxScLookupHashIndex->aIndexMap.find(key);
+        if (findIt != mxScLookupHashIndex->aIndexMap.end())
+            return *findIt->second;
+    }
+    // Building the index doesn't interpret formula cells, so there is no
+    // recursion into here while holding the lock.
+    std::unique_lock guard(mScLookupMutex);
+    auto [findIt, bInserted] = mxScLookupHashIndex->aIndexMap.emplace(key, nullptr);
+    if (bInserted)
+    {
+        findIt->second = std::make_unique<ScLookupHashIndex>(*this, rRange, key.keyType);
+        StartListeningArea(rRange, false, findIt->second.get());
+    }
+    return *findIt->second;
+}
+
 void ScDocument::RemoveLookupCache( ScLookupCache & rCache )
 {
     // Data changes leading to this should never happen during calculation (they are either
@@ -1344,15 +1383,60 @@ void ScDocument::RemoveSortedRangeCache( ScSortedRangeCache & rCache )
     OSL_FAIL( "ScDocument::RemoveSortedRangeCache: range not found in hash map");
 }
 
+void ScDocument::RemoveLookupHashIndex( ScLookupHashIndex & rIndex )
+{
+    // Same as RemoveSortedRangeCache(), data changes don't happen during
+    // threaded calculation.
+    assert(!IsThreadedGroupCalcInProgress());
+    auto it(mxScLookupHashIndex->aIndexMap.find(rIndex.getHashKey()));
+    if (it != mxScLookupHashIndex->aIndexMap.end())
+    {
+        std::unique_ptr<ScLookupHashIndex> xIndex = std::move(it->second);
+        mxScLookupHashIndex->aIndexMap.erase(it);
+        EndListeningArea(xIndex->getRange(), false, &rIndex);
+        return;
+    }
+    OSL_FAIL( "ScDocument::RemoveLookupHashIndex: range not found in hash map");
+}
+
 void ScDocument::ClearLookupCaches()
 {
     assert(!IsThreadedGroupCalcInProgress());
     GetNonThreadedContext().mxScLookupCache.reset();
     mxScSortedRangeCache->aCacheMap.clear();
+    mxScLookupHashIndex->aIndexMap.clear();
     // Clear lookup cache in all interpreter-contexts in the (threaded/non-threaded) pools.
     ScInterpreterContextPool::ClearLookupCaches(this);
 }
 
+void ScDocument::EnableFormulaGroupProfile( bool bEnable )
+{
+    assert(!IsThreadedGroupCalcInProgress());
+    if (!bEnable)
+        mpFormulaGroupProfile.reset();
+    else if (!mpFormulaGroupProfile)
+        mpFormulaGroupProfile.reset(new sc::FormulaGroupProfile);
+}
+
+sc::FormulaGroupProfile* ScDocument::GetFormulaGroupProfile()
+{
+    // Attempts are only recorded from the main thread, the threaded
+    // calculation itself is recorded when it is finished.
+    if (IsThreadedGroupCalcInProgress())
+        return nullptr;
+    return mpFormulaGroupProfile.get();
+}
+
+OUString ScDocument::GetFormulaGroupProfileAsJson() const
+{
+    if (!mpFormulaGroupProfile)
+        return OUString();
+
+    tools::JsonWriter aJson;
+    mpFormulaGroupProfile->dumpAsJson(aJson, *this);
+    return OStringToOUString(aJson.finishAndGetAsOString(), RTL_TEXTENCODING_UTF8);
+}
+
 bool ScDocument::IsCellInChangeTrack(const ScAddress &cell,Color *pColCellBorder)
 {
     ScChangeTrack* pTrack = GetChangeTrack();
@@ -80,12 +80,16 @@
 #include <docuno.hxx>
 #include <scresid.hxx>
 #include <columniterator.hxx>
+#include <conditio.hxx>
+#include <rangelst.hxx>
+#include <scopetools.hxx>
 #include <globalnames.hxx>
 #include <stringutil.hxx>
 #include <documentlinkmgr.hxx>
 #include <tokenarray.hxx>
 #include <recursionhelper.hxx>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -435,7 +439,7 @@ void ScDocument::HandleStuffAfterParallelCalculation( SCCOL nColStart, SCCOL nCo
 {
     assert(!IsThreadedGroupCalcInProgress());
     for( const DelayedSetNumberFormat& data : GetNonThreadedContext().maDelayedSetNumberFormat)
-        SetNumberFormat( ScAddress( data.mCol, data.mRow, nTab ), data.mnNumberFormat );
+        SetNumberFormat( ScAddress( data.mCol, data.mRow, data.mTab ), data.mnNumberFormat );
     GetNonThreadedContext().maDelayedSetNumberFormat.clear();
 
     ScTable* pTab = FetchTable(nTab);
@@ -696,6 +700,85 @@ bool ScDocument::IdleCalcTextWidth()            // true = try next again
     return aScope.getNeedMore();
 }
 
+#define RECALCROWS              8192    // Rows per column chunk of a hard recalc in idle
+
+void ScDocument::StartIdleHardRecalc()
+{
+    PrepareFormulaCalc();
+    ClearLookupCaches();    // Ensure we don't deliver zombie data.
+    for (const auto& a : maTabs)
+    {
+        if (a)
+            a->SetDirtyVar();
+    }
+    aCurIdleRecalcPos = ScAddress(0, 0, 0);
+    mbIdleHardRecalc = true;
+}
+
+bool ScDocument::IdleHardRecalc( ScRangeList& rCalculated )
+{
+    if (!mbIdleHardRecalc)
+        return false;
+
+    // Don't start calculating from within an interpretation, e.g. a paint
+    // during a macro function, try again later.
+    if (IsInInterpreter() || IsCalculatingFormulaTree())
+        return true;
+
+    sc::AutoCalcSwitch aSwitch(*this, true);
+    PrepareFormulaCalc();
+    TaskStopwatch aWatch;
+    do
+    {
+        SCTAB nTab = aCurIdleRecalcPos.Tab();
+        if (nTab >= GetTableCount())
+        {
+            // All done, finish like CalcAll().
+            mbIdleHardRecalc = false;
+            ClearFormulaTree();
+            for (SCTAB i = 0; i < GetTableCount(); ++i)
+            {
+                if (ScConditionalFormatList* pCondFormList = GetCondFormList(i))
+                    pCondFormList->CalcAll();
+            }
+            if (GetHardRecalcState() == HardRecalcState::ETERNAL)
+                ClearLookupCaches();
+            break;
+        }
+
+        ScTable* pTab = maTabs[nTab].get();
+        SCCOL nCol = aCurIdleRecalcPos.Col();
+        if (!pTab || nCol >= pTab->GetAllocatedColumnsCount())
+        {
+            aCurIdleRecalcPos = ScAddress(0, 0, nTab + 1);
+            continue;
+        }
+
+        SCROW nRow = aCurIdleRecalcPos.Row();
+        SCROW nLastRow = pTab->aCol[nCol].GetLastDataPos();
+        if (nRow > nLastRow)
+        {
+            aCurIdleRecalcPos = ScAddress(nCol + 1, 0, nTab);
+            continue;
+        }
+
+        SCROW nEndRow = std::min<SCROW>(nRow + RECALCROWS - 1, nLastRow);
+        pTab->InterpretDirtyCells(nCol, nRow, nCol, nEndRow);
+        rCalculated.Join(ScRange(nCol, nRow, nTab, nCol, nEndRow, nTab));
+        aCurIdleRecalcPos.SetRow(nEndRow + 1);
+    }
+    while (aWatch.continueIter());
+
+    PrepareFormulaCalc();
+
+    return mbIdleHardRecalc;
+}
+
+void ScDocument::CancelIdleHardRecalc()
+{
+    mbIdleHardRecalc = false;
+}
+
 void ScDocument::RepaintRange( const ScRange& rRange )
 {
     if ( bIsVisible && mpShell )
@@ -4141,6 +4141,17 @@ void ScDocument::CalcAfterLoad( bool bStartListening )
     }
 }
 
+void ScDocument::SetDirtySelectiveAfterLoad()
+{
+    sc::AutoCalcSwitch aACSwitch(*this, false);
+    ScBulkBroadcast aBulkBroadcast(GetBASM(), SfxHintId::ScDataChanged);
+    for (const auto& pTable : maTabs)
+    {
+        if (pTable)
+            pTable->SetDirtySelectiveAfterLoad();
+    }
+}
+
 FormulaError ScDocument::GetErrCode( const ScAddress& rPos ) const
 {
     SCTAB nTab = rPos.Tab();
@@ -6387,6 +6398,8 @@ ScUndoManager* ScDocument::GetUndoManager()
 
         ScUndoManager* pUndoManager = new ScUndoManager;
         pUndoManager->SetDocShell(GetDocumentShell());
+        // don't let a few huge pastes/deletions keep GBs of document copies alive
+        pUndoManager->SetMaxUndoMemorySize(size_t(512) * 1024 * 1024);
         mpUndoManager = pUndoManager;
     }
 
@@ -29,6 +29,8 @@
 #include <svl/sharedstringpool.hxx>
 #include <svl/languageoptions.hxx>
 #include <comphelper/configuration.hxx>
+#include <comphelper/threadpool.hxx>
+#include <exception>
 #include <unordered_map>
 
 namespace {
@@ -755,10 +757,96 @@ public:
     }
 };
 
+class RegroupColumnsTask : public comphelper::ThreadTask
+{
+    std::vector<ScColumn*> maColumns;
+    std::exception_ptr& mrException;
+
+public:
+    RegroupColumnsTask( const std::shared_ptr<comphelper::ThreadTaskTag>& pTag,
+                        std::exception_ptr& rException ) :
+        comphelper::ThreadTask(pTag),
+        mrException(rException)
+    {}
+
+    void push_back( ScColumn* pCol ) { maColumns.push_back(pCol); }
+
+    virtual void doWork() override
+    {
+        // The thread pool swallows exceptions, pass them on to the caller.
+        try
+        {
+            for (ScColumn* pCol : maColumns)
+                pCol->RegroupFormulaCells();
+        }
+        catch (...)
+        {
+            mrException = std::current_exception();
+        }
+    }
+};
+
+/**
+ * Re-build the formula groups of the given columns. Grouping only touches
+ * the cells of its own column, so with many formula columns the work is
+ * spread over the shared thread pool.
+ */
+void regroupFormulaColumns( const std::vector<ScColumn*>& rCols, bool bFuzzing )
+{
+    const size_t nThreads = (bFuzzing || rCols.size() < 8) ? 1 :
+        std::min<size_t>(comphelper::ThreadPool::getPreferredConcurrency(), rCols.size());
+
+    if (nThreads <= 1)
+    {
+        for (ScColumn* pCol : rCols)
+            pCol->RegroupFormulaCells();
+        return;
+    }
+
+    comphelper::ThreadPool& rPool = comphelper::ThreadPool::getSharedOptimalPool();
+    std::shared_ptr<comphelper::ThreadTaskTag> pTag = comphelper::ThreadPool::createThreadTaskTag();
+    std::vector<std::exception_ptr> aExceptions(nThreads);
+    std::vector<std::unique_ptr<RegroupColumnsTask>> aTasks(nThreads);
+    for (size_t i = 0; i < nThreads; ++i)
+        aTasks[i].reset(new RegroupColumnsTask(pTag, aExceptions[i]));
+
+    for (size_t i = 0; i < rCols.size(); ++i)
+        aTasks[i % nThreads]->push_back(rCols[i]);
+
+    for (size_t i = 1; i < nThreads; ++i)
+        rPool.pushTask(std::move(aTasks[i]));
+
+    aTasks[0]->doWork();
+    rPool.waitUntilDone(pTag);
+
+    for (const std::exception_ptr& pException : aExceptions)
+    {
+        if (pException)
+            std::rethrow_exception(pException);
+    }
+}
+
 }
 
 void ScDocumentImport::finalize()
 {
+    // Re-build the formula groups before anything starts listening.
+    std::vector<ScColumn*> aFormulaCols;
+    for (auto& rxTab : mpImpl->mrDoc.maTabs)
+    {
+        if (!rxTab)
+            continue;
+
+        ScTable& rTab = *rxTab;
+        SCCOL nNumCols = rTab.aCol.size();
+        for (SCCOL nColIdx = 0; nColIdx < nNumCols; ++nColIdx)
+        {
+            if (rTab.aCol[nColIdx].HasFormulaCell())
+                aFormulaCols.push_back(&rTab.aCol[nColIdx]);
+        }
+    }
+    regroupFormulaColumns(aFormulaCols, mpImpl->mbFuzzing);
+
     // Populate the text width and script type arrays in all columns. Also
     // activate all formula cells.
     for (auto& rxTab : mpImpl->mrDoc.maTabs)
@@ -777,7 +865,9 @@ void ScDocumentImport::finalize()
 
 void ScDocumentImport::initColumn(ScColumn& rCol)
 {
-    rCol.RegroupFormulaCells();
+    // The cell blocks have grown one cell at a time during import, drop the
+    // excess capacity they have accumulated.
+    rCol.maCells.shrink_to_fit();
 
     CellStoreInitializer aFunc(*mpImpl, rCol.nTab, rCol.nCol);
     std::for_each(rCol.maCells.begin(), rCol.maCells.end(), aFunc);
@@ -38,6 +38,7 @@
 #include <com/sun/star/sheet/DataPilotFieldGroupBy.hpp>
 
 #include <comphelper/parallelsort.hxx>
+#include <comphelper/threadpool.hxx>
 #include <rtl/math.hxx>
 #include <unotools/charclass.hxx>
 #include <unotools/textsearch.hxx>
@@ -49,16 +50,9 @@
 #include <o3tl/safeint.hxx>
 #include <osl/diagnose.h>
 
-// TODO : Threaded pivot cache operation is disabled until we can figure out
-// ways to make the edit engine and number formatter codes thread-safe in a
-// proper fashion.
-#define ENABLE_THREADED_PIVOT_CACHE 0
-
-#if ENABLE_THREADED_PIVOT_CACHE
-#include <thread>
-#include <future>
-#include <queue>
-#endif
+// Reading the cells of the source range stays on the main thread, as the edit
+// engine and number formatter codes are not thread-safe. Sorting and
+// de-duplicating the values of each field is done on the thread pool.
 
 using namespace ::com::sun::star;
 
@@ -94,6 +88,7 @@ ScDPCache::ScDPCache(ScDocument& rDoc) :
     maEmptyRows(0, rDoc.GetMaxRowCount(), true),
     mnDataSize(-1),
     mnRowCount(0),
+    mnDocDataEndRow(-1),
     mbDisposing(false)
 {
 }
@@ -267,13 +262,25 @@ public:
     }
 };
 
-void processBuckets(std::vector<Bucket>& aBuckets, ScDPCache::Field& rField)
+/**
+ * @param bParallelSort false when called from a thread pool task, which can't
+ *                      wait for other tasks.
+ */
+void processBuckets(std::vector<Bucket>& aBuckets, ScDPCache::Field& rField, bool bParallelSort)
 {
     if (aBuckets.empty())
         return;
 
+    auto aSort = [bParallelSort](auto itBeg, auto itEnd, auto aComp)
+    {
+        if (bParallelSort)
+            comphelper::parallelSort(itBeg, itEnd, aComp);
+        else
+            std::stable_sort(itBeg, itEnd, aComp);
+    };
+
     // Sort by the value.
-    comphelper::parallelSort(aBuckets.begin(), aBuckets.end(), LessByValue());
+    aSort(aBuckets.begin(), aBuckets.end(), LessByValue());
 
     {
         // Set order index such that unique values have identical index value.
@@ -292,14 +299,14 @@ void processBuckets(std::vector<Bucket>& aBuckets, ScDPCache::Field& rField)
     }
 
     // Re-sort the bucket this time by the data index.
-    comphelper::parallelSort(aBuckets.begin(), aBuckets.end(), LessByDataIndex());
+    aSort(aBuckets.begin(), aBuckets.end(), LessByDataIndex());
 
     // Copy the order index series into the field object.
     rField.maData.reserve(aBuckets.size());
     std::for_each(aBuckets.begin(), aBuckets.end(), PushBackOrderIndex(rField.maData));
 
     // Sort by the value again.
-    comphelper::parallelSort(aBuckets.begin(), aBuckets.end(), LessByOrderIndex());
+    aSort(aBuckets.begin(), aBuckets.end(), LessByOrderIndex());
 
     // Unique by value.
     std::vector<Bucket>::iterator itUniqueEnd =
@@ -316,6 +323,7 @@ struct InitColumnData
 {
     ScDPCache::EmptyRowsType maEmptyRows;
     OUString maLabel;
+    std::vector<Bucket> maBuckets; ///< values read but not yet processed
 
     ScDPCache::StringSetType* mpStrPool;
     ScDPCache::Field* mpField;
@@ -407,7 +415,7 @@ std::vector<OUString> normalizeLabels(const ScDPCache::DBConnector& rDB, const s
     return aLabels;
 }
 
-void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
+void readColumnFromDoc( const InitDocData& rDocData, InitColumnData &rColData )
 {
     ScDPCache::Field& rField = *rColData.mpField;
     ScDocument& rDoc = rDocData.mrDoc;
@@ -415,7 +423,6 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
     SCCOL nCol = rColData.mnCol;
     SCROW nStartRow = rDocData.mnStartRow;
     SCROW nEndRow = rDocData.mnEndRow;
-    bool bTailEmptyRows = rDocData.mbTailEmptyRows;
 
     std::optional<sc::ColumnIterator> pIter =
         rDoc.GetColumnIterator(nDocTab, nCol, nStartRow, nEndRow);
@@ -427,8 +434,8 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
     rColData.maLabel = createLabelString(rDoc, nCol, pIter->getCell());
     pIter->next();
 
-    std::vector<Bucket> aBuckets;
-    aBuckets.reserve(nEndRow-nStartRow); // skip the topmost label cell.
+    std::vector<Bucket>& rBuckets = rColData.maBuckets;
+    rBuckets.reserve(nEndRow-nStartRow); // skip the topmost label cell.
 
     // Push back all original values.
     for (SCROW i = 0, n = nEndRow-nStartRow; i < n; ++i, pIter->next())
@@ -439,7 +446,7 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
         ScAddress aPos(nCol, pIter->getRow(), nDocTab);
         initFromCell(*rColData.mpStrPool, rDoc, aPos, pIter->getCell(), aData, nNumFormat);
 
-        aBuckets.emplace_back(aData, i);
+        rBuckets.emplace_back(aData, i);
 
         if (!aData.IsEmpty())
         {
@@ -449,84 +456,48 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
                 rField.mnNumFormat = nNumFormat;
         }
     }
+}
 
-    processBuckets(aBuckets, rField);
+/**
+ * Sort and de-duplicate the values read by readColumnFromDoc(). Doesn't
+ * access the document.
+ */
+void processColumn( const InitDocData& rDocData, InitColumnData &rColData, bool bParallelSort )
+{
+    ScDPCache::Field& rField = *rColData.mpField;
 
-    if (bTailEmptyRows)
+    processBuckets(rColData.maBuckets, rField, bParallelSort);
+    std::vector<Bucket>().swap(rColData.maBuckets);
+
+    if (rDocData.mbTailEmptyRows)
     {
         // If the last item is not empty, append one. Note that the items
         // are sorted, and empty item should come last when sorted.
         if (rField.maItems.empty() || !rField.maItems.back().IsEmpty())
         {
+            ScDPItemData aData;
             aData.SetEmpty();
             rField.maItems.push_back(aData);
         }
     }
 }
 
-#if ENABLE_THREADED_PIVOT_CACHE
-
-class ThreadQueue
+class ProcessColumnTask : public comphelper::ThreadTask
 {
-    using FutureType = std::future<void>;
-    std::queue<FutureType> maQueue;
-    std::mutex maMutex;
-    std::condition_variable maCond;
-
-    size_t mnMaxQueue;
+    const InitDocData& mrDocData;
+    InitColumnData& mrColData;
 
 public:
-    ThreadQueue( size_t nMaxQueue ) : mnMaxQueue(nMaxQueue) {}
+    ProcessColumnTask( const std::shared_ptr<comphelper::ThreadTaskTag>& rTag,
+                       const InitDocData& rDocData, InitColumnData& rColData ) :
+        comphelper::ThreadTask(rTag), mrDocData(rDocData), mrColData(rColData) {}
 
-    void push( std::function<void()> aFunc )
+    virtual void doWork() override
     {
-        std::unique_lock<std::mutex> lock(maMutex);
-
-        while (maQueue.size() >= mnMaxQueue)
-            maCond.wait(lock);
-
-        FutureType f = std::async(std::launch::async, aFunc);
-        maQueue.push(std::move(f));
-        lock.unlock();
-
-        maCond.notify_one();
-    }
-
-    void waitForOne()
-    {
-        std::unique_lock<std::mutex> lock(maMutex);
-
-        while (maQueue.empty())
-            maCond.wait(lock);
-
-        FutureType ret = std::move(maQueue.front());
-        maQueue.pop();
-        lock.unlock();
-
-        ret.get(); // This may throw if an exception was thrown on the async thread.
-
-        maCond.notify_one();
-    }
-};
-
-class ThreadScopedGuard
-{
-    std::thread maThread;
-public:
-    ThreadScopedGuard(std::thread thread) : maThread(std::move(thread)) {}
-    ThreadScopedGuard(ThreadScopedGuard&& other) : maThread(std::move(other.maThread)) {}
-
-    ThreadScopedGuard(const ThreadScopedGuard&) = delete;
-    ThreadScopedGuard& operator= (const ThreadScopedGuard&) = delete;
-
-    ~ThreadScopedGuard()
-    {
-        maThread.join();
+        processColumn(mrDocData, mrColData, false);
     }
 };
 
-#endif
-
 }
 
 void ScDPCache::InitFromDoc(ScDocument& rDoc, const ScRange& rRange)
@@ -584,10 +555,9 @@ void ScDPCache::InitFromDoc(ScDocument& rDoc, const ScRange& rRange)
     // Ensure that none of the formula cells in the data range are dirty.
     rDoc.EnsureFormulaCellResults(rRange);
 
-#if ENABLE_THREADED_PIVOT_CACHE
-    ThreadQueue aQueue(std::thread::hardware_concurrency());
-
-    auto aFuncLaunchFieldThreads = [&]()
+    comphelper::ThreadPool& rThreadPool = comphelper::ThreadPool::getSharedOptimalPool();
+    const sal_Int32 nThreadCount = rThreadPool.getWorkerCount();
+    if (mnColumnCount < 2 || nThreadCount < 2 || rDoc.IsThreadedGroupCalcInProgress())
     {
         for (sal_uInt16 nCol = nStartCol; nCol <= nEndCol; ++nCol)
         {
@@ -595,35 +565,38 @@ void ScDPCache::InitFromDoc(ScDocument& rDoc, const ScRange& rRange)
             InitColumnData& rColData = aColData[nDim];
             rColData.init(nCol, &maStringPools[nDim], maFields[nDim].get());
 
-            auto func = [&aDocData,&rColData]()
-            {
-                initColumnFromDoc(aDocData, rColData);
-            };
-
-            aQueue.push(std::move(func));
+            readColumnFromDoc(aDocData, rColData);
+            processColumn(aDocData, rColData, true);
         }
-    };
-
+    }
+    else
     {
-        // Launch a separate thread that in turn spawns async threads to populate the fields.
-        std::thread t(aFuncLaunchFieldThreads);
-        ThreadScopedGuard sg(std::move(t));
+        // Process a batch of fields, one task per field, while the next batch
+        // is read. At most two batches of read values are kept in memory.
+        std::shared_ptr<comphelper::ThreadTaskTag> pTag;
+        for (SCCOL nBatchStart = nStartCol; nBatchStart <= nEndCol; nBatchStart += nThreadCount)
+        {
+            const SCCOL nBatchEnd = std::min<SCCOL>(nBatchStart + nThreadCount - 1, nEndCol);
+            for (SCCOL nCol = nBatchStart; nCol <= nBatchEnd; ++nCol)
+            {
+                size_t nDim = nCol - nStartCol;
+                InitColumnData& rColData = aColData[nDim];
+                rColData.init(nCol, &maStringPools[nDim], maFields[nDim].get());
+                readColumnFromDoc(aDocData, rColData);
+            }
 
-        // Wait for all the async threads to complete on the main thread.
-        for (SCCOL i = 0; i < mnColumnCount; ++i)
-            aQueue.waitForOne();
-    }
+            if (pTag)
+                rThreadPool.waitUntilDone(pTag);
 
-#else
-    for (sal_uInt16 nCol = nStartCol; nCol <= nEndCol; ++nCol)
-    {
-        size_t nDim = nCol - nStartCol;
-        InitColumnData& rColData = aColData[nDim];
-        rColData.init(nCol, &maStringPools[nDim], maFields[nDim].get());
+            pTag = comphelper::ThreadPool::createThreadTaskTag();
+            for (SCCOL nCol = nBatchStart; nCol <= nBatchEnd; ++nCol)
+                rThreadPool.pushTask(
+                    std::make_unique<ProcessColumnTask>(pTag, aDocData, aColData[nCol - nStartCol]));
+        }
 
-        initColumnFromDoc(aDocData, rColData);
+        if (pTag)
+            rThreadPool.waitUntilDone(pTag);
     }
-#endif
 
     maLabelNames = normalizeLabels(aColData);
 
@@ -642,7 +615,124 @@ void ScDPCache::InitFromDoc(ScDocument& rDoc, const ScRange& rRange)
         }
     }
 
+    maDocRange = rRange;
+    mnDocDataEndRow = aDocData.mnEndRow;
+
+    PostInit();
+}
+
+bool ScDPCache::AppendFromDoc(ScDocument& rDoc, const ScRange& rRange)
+{
+    if (mnDocDataEndRow < 0 || rRange != maDocRange || maFields.empty())
+        return false;
+
+    SCCOL nCol1 = rRange.aStart.Col(), nCol2 = rRange.aEnd.Col();
+    SCROW nRow1 = rRange.aStart.Row(), nRow2 = rRange.aEnd.Row();
+    const SCTAB nTab = rRange.aStart.Tab();
+    rDoc.ShrinkToDataArea(nTab, nCol1, nRow1, nCol2, nRow2);
+    if (nRow2 < mnDocDataEndRow)
+        // Rows have been removed.
+        return false;
+
+    if (nRow2 >= rRange.aEnd.Row())
+        // No trailing empty rows left, the empty item may have to go.
+        return false;
+
+    ClearGroupFields();
+    for (const std::unique_ptr<Field>& pField : maFields)
+        pField->mpGroup.reset();
+
+    if (nRow2 == mnDocDataEndRow)
+        return true;
+
+    MacroInterpretIncrementer aMacroInc(rDoc);
+
+    const SCCOL nStartCol = rRange.aStart.Col();
+    const SCROW nFirstNewRow = mnDocDataEndRow + 1;
+    const SCROW nOldDataCount = mnDocDataEndRow - rRange.aStart.Row();
+    rDoc.EnsureFormulaCellResults(ScRange(nStartCol, nFirstNewRow, nTab, rRange.aEnd.Col(), nRow2, nTab));
+
+    for (SCCOL nDim = 0; nDim < mnColumnCount; ++nDim)
+    {
+        Field& rField = *maFields[nDim];
+        const SCCOL nCol = nStartCol + nDim;
+
+        std::optional<sc::ColumnIterator> pIter = rDoc.GetColumnIterator(nTab, nCol, nFirstNewRow, nRow2);
+        assert(pIter);
+
+        std::vector<Bucket> aBuckets;
+        aBuckets.reserve(nRow2 - nFirstNewRow + 1);
+        ScDPItemData aData;
+        for (SCROW i = 0, n = nRow2 - nFirstNewRow + 1; i < n; ++i, pIter->next())
+        {
+            assert(pIter->hasCell());
+
+            sal_uInt32 nNumFormat = 0;
+            ScAddress aPos(nCol, pIter->getRow(), nTab);
+            initFromCell(maStringPools[nDim], rDoc, aPos, pIter->getCell(), aData, nNumFormat);
+
+            aBuckets.emplace_back(aData, i);
+
+            if (!aData.IsEmpty())
+            {
+                maEmptyRows.insert_back(nOldDataCount + i, nOldDataCount + i + 1, false);
+                if (nNumFormat)
+                    rField.mnNumFormat = nNumFormat;
+            }
+        }
+
+        Field aNewField;
+        processBuckets(aBuckets, aNewField, true);
+
+        // Merge the sorted unique items of the old and the new rows, and map
+        // both index arrays to the merged items.
+        ScDPItemDataVec aItems;
+        aItems.reserve(rField.maItems.size() + aNewField.maItems.size());
+        std::vector<SCROW> aOldMap(rField.maItems.size());
+        std::vector<SCROW> aNewMap(aNewField.maItems.size());
+        size_t nOld = 0, nNew = 0;
+        while (nOld < rField.maItems.size() || nNew < aNewField.maItems.size())
+        {
+            const SCROW nId = aItems.size();
+            if (nNew == aNewField.maItems.size())
+            {
+                aOldMap[nOld] = nId;
+                aItems.push_back(rField.maItems[nOld++]);
+            }
+            else if (nOld == rField.maItems.size())
+            {
+                aNewMap[nNew] = nId;
+                aItems.push_back(aNewField.maItems[nNew++]);
+            }
+            else if (rField.maItems[nOld].IsCaseInsEqual(aNewField.maItems[nNew]))
+            {
+                aOldMap[nOld] = nId;
+                aNewMap[nNew++] = nId;
+                aItems.push_back(rField.maItems[nOld++]);
+            }
+            else if (aNewField.maItems[nNew] < rField.maItems[nOld])
+            {
+                aNewMap[nNew] = nId;
+                aItems.push_back(aNewField.maItems[nNew++]);
+            }
+            else
+            {
+                aOldMap[nOld] = nId;
+                aItems.push_back(rField.maItems[nOld++]);
+            }
+        }
+
+        for (SCROW& rId : rField.maData)
+            rId = aOldMap[rId];
+        rField.maData.reserve(rField.maData.size() + aNewField.maData.size());
+        for (SCROW nId : aNewField.maData)
+            rField.maData.push_back(aNewMap[nId]);
+        rField.maItems.swap(aItems);
+    }
+
+    mnDocDataEndRow = nRow2;
     PostInit();
+    return true;
 }
 
 bool ScDPCache::InitFromDataBase(DBConnector& rDB)
@@ -688,7 +778,7 @@ bool ScDPCache::InitFromDataBase(DBConnector& rDB)
             }
             while (rDB.next());
 
-            processBuckets(aBuckets, rField);
+            processBuckets(aBuckets, rField, true);
         }
 
         rDB.finish();
@@ -983,6 +1073,7 @@ void ScDPCache::Clear()
     maGroupFields.clear();
     maEmptyRows.clear();
     maStringPools.clear();
+    mnDocDataEndRow = -1;
 }
 
 SCROW ScDPCache::GetItemDataId(sal_uInt16 nDim, SCROW nRow, bool bRepeatIfEmpty) const
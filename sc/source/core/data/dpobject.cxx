@@ -3263,7 +3263,8 @@ void ScDPCollection::SheetCaches::updateReference(
     }
 }
 
-void ScDPCollection::SheetCaches::updateCache(const ScRange& rRange, o3tl::sorted_vector<ScDPObject*>& rRefs)
+void ScDPCollection::SheetCaches::updateCache(const ScRange& rRange, o3tl::sorted_vector<ScDPObject*>& rRefs,
+                                              bool bRowsAppended)
 {
     RangeIndexType::iterator it = std::find(maRanges.begin(), maRanges.end(), rRange);
     if (it == maRanges.end())
@@ -3285,7 +3286,8 @@ void ScDPCollection::SheetCaches::updateCache(const ScRange& rRange, o3tl::sorte
     ScDPCache& rCache = *itCache->second;
 
     // Update the cache with new cell values. This will clear all group dimension info.
-    rCache.InitFromDoc(mrDoc, rRange);
+    if (!bRowsAppended || !rCache.AppendFromDoc(mrDoc, rRange))
+        rCache.InitFromDoc(mrDoc, rRange);
 
     o3tl::sorted_vector<ScDPObject*> aRefs(rCache.GetAllReferences());
     rRefs.swap(aRefs);
@@ -3363,7 +3365,8 @@ void ScDPCollection::NameCaches::updateCache(
 
     ScDPCache& rCache = *itr->second;
     // Update the cache with new cell values. This will clear all group dimension info.
-    rCache.InitFromDoc(mrDoc, rRange);
+    if (!bRowsAppended || !rCache.AppendFromDoc(mrDoc, rRange))
+        rCache.InitFromDoc(mrDoc, rRange);
 
     o3tl::sorted_vector<ScDPObject*> aRefs(rCache.GetAllReferences());
     rRefs.swap(aRefs);
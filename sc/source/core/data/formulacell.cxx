@@ -50,10 +50,12 @@
 #include <tokenarray.hxx>
 
 #include <comphelper/threadpool.hxx>
+#include <o3tl/safeint.hxx>
 #include <editeng/editobj.hxx>
 #include <formula/errorcodes.hxx>
 #include <svl/intitem.hxx>
 #include <svl/numformat.hxx>
+#include <tools/json_writer.hxx>
 #include <formulagroup.hxx>
 #include <listenercontext.hxx>
 #include <types.hxx>
@@ -65,12 +67,14 @@
 #include <listenerqueryids.hxx>
 #include <grouparealistener.hxx>
 #include <formulalogger.hxx>
+#include <formulagroupprofile.hxx>
 #include <com/sun/star/sheet/FormulaLanguage.hpp>
 
 #if HAVE_FEATURE_OPENCL
 #include <opencl/openclwrapper.hxx>
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <map>
 
@@ -577,6 +581,75 @@ void ScFormulaCellGroup::endAllGroupListening( ScDocument& rDoc )
     m_AreaListeners.clear();
 }
 
+namespace sc {
+
+void FormulaGroupProfile::add( const ScAddress& rTopPos, SCROW nLength, SCROW nCells,
+                               std::chrono::nanoseconds aTime, FormulaGroupCalcPath ePath,
+                               const OUString& rFallback )
+{
+    Entry& rEntry = maEntries[rTopPos];
+    rEntry.mnLength = nLength;
+    ++rEntry.mnCalls;
+    rEntry.mnCells += nCells;
+    rEntry.mnTimeNs += aTime.count();
+    switch (ePath)
+    {
+        case FormulaGroupCalcPath::OpenCL:
+            ++rEntry.mnOpenCL;
+        break;
+        case FormulaGroupCalcPath::Compiled:
+            ++rEntry.mnCompiled;
+        break;
+        case FormulaGroupCalcPath::Threaded:
+            ++rEntry.mnThreaded;
+        break;
+        case FormulaGroupCalcPath::Scalar:
+            ++rEntry.mnScalar;
+            rEntry.maLastFallback = rFallback;
+        break;
+    }
+}
+
+const FormulaGroupProfile::Entry* FormulaGroupProfile::find( const ScAddress& rTopPos ) const
+{
+    auto it = maEntries.find(rTopPos);
+    return it == maEntries.end() ? nullptr : &it->second;
+}
+
+void FormulaGroupProfile::dumpAsJson( tools::JsonWriter& rJson, const ScDocument& rDoc ) const
+{
+    std::vector<std::pair<ScAddress, const Entry*>> aSorted;
+    aSorted.reserve(maEntries.size());
+    for (const auto& rPair : maEntries)
+        aSorted.emplace_back(rPair.first, &rPair.second);
+
+    std::sort(aSorted.begin(), aSorted.end(),
+        [](const auto& rLeft, const auto& rRight)
+        {
+            if (rLeft.second->mnTimeNs != rRight.second->mnTimeNs)
+                return rLeft.second->mnTimeNs > rRight.second->mnTimeNs;
+            return rLeft.first < rRight.first;
+        });
+
+    auto aArray = rJson.startArray("groups");
+    for (const auto& [rPos, pEntry] : aSorted)
+    {
+        auto aStruct = rJson.startStruct();
+        rJson.put("topcell", rPos.Format(ScRefFlags::VALID | ScRefFlags::TAB_3D, &rDoc));
+        rJson.put("length", sal_Int64(pEntry->mnLength));
+        rJson.put("calls", pEntry->mnCalls);
+        rJson.put("cells", pEntry->mnCells);
+        rJson.put("timens", pEntry->mnTimeNs);
+        rJson.put("opencl", pEntry->mnOpenCL);
+        rJson.put("compiled", pEntry->mnCompiled);
+        rJson.put("threaded", pEntry->mnThreaded);
+        rJson.put("scalar", pEntry->mnScalar);
+        rJson.put("fallback", pEntry->maLastFallback);
+    }
+}
+
+}
+
 ScFormulaCell::ScFormulaCell( ScDocument& rDoc, const ScAddress& rPos ) :
     bDirty(false),
     bTableOpDirty(false),
@@ -1275,6 +1348,21 @@ void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rPr
 
     bool bDoCompile = true;
 
+    // Whether the tokens of another cell, used at this position, give the same formula.
+    auto isSameFormula = [&]( const ScFormulaCell& rOther )
+    {
+        // Build formula string using the tokens from the other cell,
+        // but use the current cell position.
+        ScCompiler aBackComp( rCxt, aPos, *(rOther.pCode) );
+        OUStringBuffer aShouldBeBuf;
+        aBackComp.CreateStringFromTokenArray( aShouldBeBuf );
+
+        // The initial '=' is optional in ODFF.
+        const sal_Int32 nLeadingEqual = (aFormula.getLength() > 0 && aFormula[0] == '=') ? 1 : 0;
+        return aFormula.getLength() == aShouldBeBuf.getLength() + nLeadingEqual &&
+               aFormula.match( aShouldBeBuf, nLeadingEqual);
+    };
+
     if ( !mxGroup && aFormulaNmsp.isEmpty() ) // optimization
     {
         ScAddress aPreviousCell( aPos );
@@ -1282,16 +1370,7 @@ void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rPr
         ScFormulaCell *pPreviousCell = rDocument.GetFormulaCell( aPreviousCell );
         if (pPreviousCell && pPreviousCell->GetCode()->IsShareable())
         {
-            // Build formula string using the tokens from the previous cell,
-            // but use the current cell position.
-            ScCompiler aBackComp( rCxt, aPos, *(pPreviousCell->pCode) );
-            OUStringBuffer aShouldBeBuf;
-            aBackComp.CreateStringFromTokenArray( aShouldBeBuf );
-
-            // The initial '=' is optional in ODFF.
-            const sal_Int32 nLeadingEqual = (aFormula.getLength() > 0 && aFormula[0] == '=') ? 1 : 0;
-            if (aFormula.getLength() == aShouldBeBuf.getLength() + nLeadingEqual &&
-                    aFormula.match( aShouldBeBuf, nLeadingEqual))
+            if (isSameFormula( *pPreviousCell ))
             {
                 // Put them in the same formula group.
                 ScFormulaCellGroupRef xGroup = pPreviousCell->GetCellGroup();
@@ -1318,6 +1397,34 @@ void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rPr
         }
     }
 
+    if ( bDoCompile && !mxGroup && aFormulaNmsp.isEmpty() && cMatrixFlag == ScMatrixMode::NONE )
+    {
+        // Formulas repeated along a row can't share the (vertical) group, but
+        // copying the already compiled tokens of the left cell still saves
+        // parsing and RPN generation.
+        ScAddress aLeftCell( aPos );
+        aLeftCell.IncCol( -1 );
+        ScFormulaCell *pLeftCell = rDocument.GetFormulaCell( aLeftCell );
+        if (pLeftCell && !pLeftCell->bCompile && pLeftCell->cMatrixFlag == ScMatrixMode::NONE &&
+                pLeftCell->pCode->GetCodeError() == FormulaError::NONE &&
+                pLeftCell->GetCode()->IsShareable() && isSameFormula( *pLeftCell ))
+        {
+            nFormatType = pLeftCell->nFormatType;
+            bSubTotal = pLeftCell->bSubTotal;
+            bChanged = true;
+            bCompile = false;
+
+            if (bSubTotal)
+                rDocument.AddSubTotalCell(this);
+
+            bDoCompile = false;
+            delete pCode;
+            pCode = pLeftCell->pCode->Clone().release();
+            if (pLeftCell->mbIsExtRef)
+                rDocument.GetExternalRefManager()->insertRefCellFromTemplate( pLeftCell, this );
+        }
+    }
+
     if (bDoCompile)
     {
         ScTokenArray* pCodeOld = pCode;
@@ -2165,7 +2272,7 @@ void ScFormulaCell::InterpretTail( ScInterpreterContext& rContext, ScInterpretTa
                     // SetNumberFormat() is not thread-safe (modifies ScAttrArray), delay the work
                     // to the main thread. Since thread calculations operate on formula groups,
                     // it's enough to store just the row.
-                    DelayedSetNumberFormat data = { aPos.Col(), aPos.Row(), nFormatIndex };
+                    DelayedSetNumberFormat data = { aPos.Col(), aPos.Row(), aPos.Tab(), nFormatIndex };
                     rContext.maDelayedSetNumberFormat.push_back( data );
                 }
                 bChanged = true;
@@ -4680,11 +4787,14 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
         return false;
 
     auto aScope = sc::FormulaLogger::get().enterGroup(rDocument, *this);
+    sc::FormulaGroupProfileScope aProfileScope(rDocument.GetFormulaGroupProfile(),
+                                               mxGroup->mpTopCell->aPos, mxGroup->mnLength);
     ScRecursionHelper& rRecursionHelper = rDocument.GetRecursionHelper();
 
     if (mxGroup->mbPartOfCycle)
     {
         aScope.addMessage(u"This formula-group is part of a cycle"_ustr);
+        aProfileScope.setFallback(u"part of a cycle"_ustr);
         return false;
     }
 
@@ -4692,6 +4802,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     {
         static constexpr OUStringLiteral MESSAGE = u"group calc disabled";
         aScope.addMessage(MESSAGE);
+        aProfileScope.setFallback(MESSAGE);
         return false;
     }
 
@@ -4704,6 +4815,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     {
         mxGroup->meCalcState = sc::GroupCalcDisabled;
         aScope.addGroupSizeThresholdMessage(*this);
+        aProfileScope.setFallback(u"group size below threshold"_ustr);
         return false;
     }
 
@@ -4711,6 +4823,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     {
         mxGroup->meCalcState = sc::GroupCalcDisabled;
         aScope.addMessage(u"matrix skipped"_ustr);
+        aProfileScope.setFallback(u"matrix formula"_ustr);
         return false;
     }
 
@@ -4725,6 +4838,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
         {
             mxGroup->meCalcState = sc::GroupCalcDisabled;
             aScope.addMessage(u"cell not in document"_ustr);
+            aProfileScope.setFallback(u"cell not in document"_ustr);
             return false;
         }
     }
@@ -4740,8 +4854,13 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
         nEndOffset = nMaxOffset;
     }
 
+    aProfileScope.setCells(nEndOffset - nStartOffset + 1);
+
     if (nEndOffset == nStartOffset && forceType == ForceCalculationNone)
+    {
+        aProfileScope.setFallback(u"single row"_ustr);
         return false; // Do not use threads for a single row.
+    }
 
     // Guard against endless recursion of Interpret() calls, for this to work
     // ScFormulaCell::InterpretFormulaGroup() must never be called through
@@ -4752,14 +4871,44 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     bool bDependencyComputed = false;
     bool bDependencyCheckFailed = false;
 
-    // Preference order: First try OpenCL, then threading.
+    // Preference order: First try OpenCL, then the compiled program, then threading.
     // TODO: Do formula-group span computation for OCL too if nStartOffset/nEndOffset are non default.
     if( InterpretFormulaGroupOpenCL(aScope, bDependencyComputed, bDependencyCheckFailed))
+    {
+        aProfileScope.setPath(sc::FormulaGroupCalcPath::OpenCL);
+        return true;
+    }
+
+    if( InterpretFormulaGroupCompiled(aScope, bDependencyComputed, bDependencyCheckFailed, nStartOffset, nEndOffset))
+    {
+        aProfileScope.setPath(sc::FormulaGroupCalcPath::Compiled);
         return true;
+    }
 
     if( InterpretFormulaGroupThreading(aScope, bDependencyComputed, bDependencyCheckFailed, nStartOffset, nEndOffset))
+    {
+        aProfileScope.setPath(sc::FormulaGroupCalcPath::Threaded);
         return true;
+    }
 
+    if (bDependencyCheckFailed)
+        aProfileScope.setFallback(u"dependency check failed"_ustr);
+    else if (!pCode->IsEnabledForThreading())
+    {
+        OUString aReason(u"formula not enabled for threading"_ustr);
+        if (rDocument.GetFormulaGroupProfile())
+        {
+            const formula::FormulaToken* pBlocker = pCode->GetThreadingBlocker();
+            if (pBlocker && pBlocker->GetOpCode() != ocPush)
+                aReason += " (" + formula::FormulaCompiler().GetOpCodeMap(
+                                      com::sun::star::sheet::FormulaLanguage::ENGLISH)->getSymbol(pBlocker->GetOpCode()) + ")";
+            else if (pBlocker)
+                aReason += " (" + OUString::fromUtf8(formula::StackVarEnumToString(pBlocker->GetType())) + ")";
+        }
+        aProfileScope.setFallback(aReason);
+    }
+    else
+        aProfileScope.setFallback(u"group calculation not possible"_ustr);
     return false;
 }
 
@@ -4889,6 +5038,60 @@ static SCCOL lcl_probeLeftOrRightFGs(const ScFormulaCellGroupRef& xGroup, const
     return nColRet;
 }
 
+// Collect the formula-groups occupying the same columns and rows on the other sheets, so that
+// sheets with identical layout (e.g. one sheet per month or department) get calculated in the
+// same threaded run instead of one after another.
+static void lcl_probeOtherTabFGs(const ScFormulaCellGroupRef& xGroup, const ScDocument& rDoc,
+                                 SCCOL nColStart, SCCOL nColEnd,
+                                 o3tl::sorted_vector<ScFormulaCellGroup*>& rFGSet,
+                                 std::vector<ScFormulaCell*>& rTabFGCells,
+                                 std::vector<SCTAB>& rTabs)
+{
+    const SCROW nLen = xGroup->mnLength;
+    const sal_Int32 nWt = xGroup->mnWeight;
+    const ScAddress aTopPos(xGroup->mpTopCell->aPos);
+
+    for (SCTAB nTab = 0, nTabCount = rDoc.GetTableCount(); nTab < nTabCount; ++nTab)
+    {
+        if (nTab == aTopPos.Tab())
+            continue;
+
+        std::vector<ScFormulaCell*> aCells;
+        for (SCCOL nCol = nColStart; nCol <= nColEnd; ++nCol)
+        {
+            const ScFormulaCell* pCell = rDoc.GetFormulaCell(ScAddress(nCol, aTopPos.Row(), nTab));
+            if (!pCell || !pCell->NeedsInterpret() || pCell->GetMatrixFlag() != ScMatrixMode::NONE)
+                break;
+
+            const ScFormulaCellGroupRef& xNGroup = pCell->GetCellGroup();
+            if (!xNGroup || xNGroup->meCalcState == sc::GroupCalcDisabled || xNGroup->mbPartOfCycle)
+                break;
+
+            if (!pCell->GetCode()->IsEnabledForThreading())
+                break;
+
+            if (xNGroup->mpTopCell->aPos.Row() != aTopPos.Row())
+                break;
+
+            if (xNGroup->mnLength != nLen || pCell->GetWeight() != nWt)
+                break;
+
+            aCells.push_back(xNGroup->mpTopCell);
+        }
+
+        // Only take sheets where the whole column span matches.
+        if (aCells.size() != o3tl::make_unsigned(nColEnd - nColStart + 1))
+            continue;
+
+        for (ScFormulaCell* pCell : aCells)
+        {
+            rFGSet.insert(pCell->GetCellGroup().get());
+            rTabFGCells.push_back(pCell);
+        }
+        rTabs.push_back(nTab);
+    }
+}
+
 // To be called only from InterpretFormulaGroup().
 bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope& aScope,
                                                    bool& bDependencyComputed,
@@ -4921,6 +5124,7 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
             ScDocument* mpDocument;
             ScInterpreterContext* mpContext;
             const ScAddress& mrTopPos;
+            const std::vector<SCTAB>& mrTabs;
             SCCOL mnStartCol;
             SCCOL mnEndCol;
             SCROW mnStartOffset;
@@ -4933,6 +5137,7 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
                      ScDocument* pDocument2,
                      ScInterpreterContext* pContext,
                      const ScAddress& rTopPos,
+                     const std::vector<SCTAB>& rTabs,
                      SCCOL nStartCol,
                      SCCOL nEndCol,
                      SCROW nStartOff,
@@ -4943,6 +5148,7 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
                 mpDocument(pDocument2),
                 mpContext(pContext),
                 mrTopPos(rTopPos),
+                mrTabs(rTabs),
                 mnStartCol(nStartCol),
                 mnEndCol(nEndCol),
                 mnStartOffset(nStartOff),
@@ -4952,9 +5158,12 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
 
             virtual void doWork() override
             {
-                ScRange aCalcRange(mnStartCol, mrTopPos.Row() + mnStartOffset, mrTopPos.Tab(),
-                                   mnEndCol, mrTopPos.Row() + mnEndOffset, mrTopPos.Tab());
-                mpDocument->CalculateInColumnInThread(*mpContext, aCalcRange, mnThisThread, mnThreadsTotal);
+                for (SCTAB nTab : mrTabs)
+                {
+                    ScRange aCalcRange(mnStartCol, mrTopPos.Row() + mnStartOffset, nTab,
+                                       mnEndCol, mrTopPos.Row() + mnEndOffset, nTab);
+                    mpDocument->CalculateInColumnInThread(*mpContext, aCalcRange, mnThisThread, mnThreadsTotal);
+                }
             }
 
         };
@@ -4999,6 +5208,34 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
             }
         }
 
+        // Then try to add the same formula-groups of the other sheets to the run.
+        std::vector<SCTAB> aTabs{ aPos.Tab() };
+        if (bFGOK && !rRecursionHelper.HasFormulaGroupSet() && rDocument.IsInDocShellRecalc())
+        {
+            std::vector<ScFormulaCell*> aTabFGCells;
+            std::vector<SCTAB> aOtherTabs;
+            lcl_probeOtherTabFGs(mxGroup, rDocument, nColStart, nColEnd, aFGSet, aTabFGCells, aOtherTabs);
+            if (!aTabFGCells.empty())
+            {
+                ScCheckIndependentFGGuard aGuard(rRecursionHelper, &aFGSet);
+                for (ScFormulaCell* pTopCell : aTabFGCells)
+                {
+                    bFGOK = pTopCell->CheckComputeDependencies(aScope, false, nStartOffset, nEndOffset,
+                                                               true, nullptr, &aDirtiedAddress);
+                    if (!bFGOK || !aGuard.AreGroupsIndependent())
+                    {
+                        // An independence check failing may have dirtied cells the neighbour
+                        // columns depend on, so fall back to only this formula-group.
+                        bFGOK = false;
+                        nColEnd = nColStart = aPos.Col();
+                        aOtherTabs.clear();
+                        break;
+                    }
+                }
+                aTabs.insert(aTabs.end(), aOtherTabs.begin(), aOtherTabs.end());
+            }
+        }
+
         // tdf#156677 it is possible that if a check of a column in the new range fails that the check has
         // now left a cell that the original range depended on in a Dirty state. So if the dirtied cell
         // was part of the original dependencies re-run the initial CheckComputeDependencies to fix it.
@@ -5010,6 +5247,12 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
             (void)bRedoEntryCheckSucceeded;
         }
 
+        ScRangeList aCalcRanges;
+        for (SCTAB nTab : aTabs)
+            aCalcRanges.push_back(ScRange(nColStart, mxGroup->mpTopCell->aPos.Row() + nStartOffset, nTab,
+                                          nColEnd, mxGroup->mpTopCell->aPos.Row() + nEndOffset, nTab));
+        std::vector<ScAddress> aDynamicRefRecalcCells;
+
         std::vector<std::unique_ptr<ScInterpreter>> aInterpreters(nThreadCount);
         {
             assert(!rDocument.IsThreadedGroupCalcInProgress());
@@ -5035,9 +5278,10 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
                 assert(!context->pInterpreter);
                 aInterpreters[i].reset(new ScInterpreter(this, rDocument, *context, mxGroup->mpTopCell->aPos, *pCode));
                 context->pInterpreter = aInterpreters[i].get();
+                context->mpThreadedCalcRanges = &aCalcRanges;
                 rDocument.SetupContextFromNonThreadedContext(*context, i);
                 rThreadPool.pushTask(std::make_unique<Executor>(aTag, i, nThreadCount, &rDocument, context, mxGroup->mpTopCell->aPos,
-                                                                nColStart, nColEnd, nStartOffset, nEndOffset));
+                                                                aTabs, nColStart, nColEnd, nStartOffset, nEndOffset));
             }
 
             SAL_INFO("sc.threaded", "Waiting for threads to finish work");
@@ -5060,6 +5304,11 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
                 // This is intentionally done in this main thread in order to avoid locking.
                 rDocument.MergeContextBackIntoNonThreadedContext(*context, i);
                 context->pInterpreter = nullptr;
+                context->mpThreadedCalcRanges = nullptr;
+                aDynamicRefRecalcCells.insert(aDynamicRefRecalcCells.end(),
+                                              context->maDynamicRefRecalcCells.begin(),
+                                              context->maDynamicRefRecalcCells.end());
+                context->maDynamicRefRecalcCells.clear();
             }
 
             SAL_INFO("sc.threaded", "Done");
@@ -5069,16 +5318,104 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
         SCROW nSpanLen = nEndOffset - nStartOffset + 1;
         aStartPos.SetRow(aStartPos.Row() + nStartOffset);
         // Reuse one of the previously allocated interpreter objects here.
-        rDocument.HandleStuffAfterParallelCalculation(nColStart, nColEnd, aStartPos.Row(), nSpanLen,
-                                                       aStartPos.Tab(), aInterpreters[0].get());
+        for (SCTAB nTab : aTabs)
+            rDocument.HandleStuffAfterParallelCalculation(nColStart, nColEnd, aStartPos.Row(), nSpanLen,
+                                                           nTab, aInterpreters[0].get());
+
+        // Cells with an OFFSET to cells that were not calculated yet got a
+        // dummy result, they are calculated again without threads. Their
+        // groups would hit the same cells again, so stop threading them.
+        bool bThisCalculated = true;
+        for (const ScAddress& rRecalcPos : aDynamicRefRecalcCells)
+        {
+            ScFormulaCell* pCell = rDocument.GetFormulaCell(rRecalcPos);
+            assert(pCell);
+            if (!pCell)
+                continue;
+            SAL_INFO("sc.threaded", "dynamic reference at " << rRecalcPos << " needs serial recalculation");
+            pCell->SetDirtyVar();
+            rDocument.PutInFormulaTree(pCell);
+            if (pCell->GetCellGroup())
+                pCell->GetCellGroup()->meCalcState = sc::GroupCalcDisabled;
+            if (pCell == this)
+                bThisCalculated = false;
+        }
 
-        return true;
+        return bThisCalculated;
     }
 
     return false;
 }
 
 // To be called only from InterpretFormulaGroup().
+bool ScFormulaCell::InterpretFormulaGroupCompiled(sc::FormulaLogger::GroupScope& aScope,
+                                                  bool& bDependencyComputed,
+                                                  bool& bDependencyCheckFailed,
+                                                  SCROW nStartOffset,
+                                                  SCROW nEndOffset)
+{
+    // Forcing a calculation type is meant to test that exact code path.
+    static const bool bCompiledProhibited = std::getenv("SC_NO_COMPILED_GROUP_CALCULATION");
+    static ForceCalculationType forceType = ScCalcConfig::getForceCalculationType();
+    if (bCompiledProhibited || forceType == ForceCalculationOpenCL || forceType == ForceCalculationThreads)
+        return false;
+
+    // TableOp does tricks with using a cell with different values, just bail out.
+    if (bDependencyCheckFailed || rDocument.IsInInterpreterTableOp()
+        || rDocument.IsThreadedGroupCalcInProgress() || rDocument.GetDocOptions().IsCalcAsShown()
+        || !pCode->IsRecalcModeNormal())
+        return false;
+
+    const ScAddress& rTopPos = mxGroup->mpTopCell->aPos;
+    sc::FormulaGroupProgram aProgram;
+    if (!aProgram.compile(rDocument, rTopPos, *pCode))
+        return false;
+
+    // The program always results in a plain number with a general format,
+    // if InterpretTail() would force a number format change leave it to the
+    // interpreter.
+    std::vector<ScFormulaCell*> aCells;
+    aCells.reserve(nEndOffset - nStartOffset + 1);
+    for (SCROW i = nStartOffset; i <= nEndOffset; ++i)
+    {
+        ScFormulaCell* pCell = rDocument.GetFormulaCell(ScAddress(aPos.Col(), rTopPos.Row() + i, aPos.Tab()));
+        if (!pCell || (pCell->mbAllowNumberFormatChange && !pCell->mbNeedsNumberFormat
+                       && !SvNumberFormatter::IsCompatible(pCell->nFormatType, SvNumFormatType::NUMBER)))
+            return false;
+        aCells.push_back(pCell);
+    }
+
+    if (!bDependencyComputed && !CheckComputeDependencies(aScope, false, nStartOffset, nEndOffset))
+    {
+        bDependencyComputed = true;
+        bDependencyCheckFailed = true;
+        return false;
+    }
+
+    bDependencyComputed = true;
+
+    std::vector<double> aResults;
+    if (!aProgram.calculate(rDocument, nStartOffset, nEndOffset, aResults))
+    {
+        aScope.addMessage(u"compiled group calculation not possible with the referenced data"_ustr);
+        return false;
+    }
+
+    rDocument.SetFormulaResults(ScAddress(aPos.Col(), rTopPos.Row() + nStartOffset, aPos.Tab()),
+                                aResults.data(), aResults.size());
+    for (ScFormulaCell* pCell : aCells)
+    {
+        if (pCell->mbNeedsNumberFormat)
+        {
+            // A general format stays, see InterpretTail().
+            pCell->nFormatType = SvNumFormatType::NUMBER;
+            pCell->mbNeedsNumberFormat = false;
+        }
+    }
+    aScope.setCalcComplete();
+    return true;
+}
+
 bool ScFormulaCell::InterpretFormulaGroupOpenCL(sc::FormulaLogger::GroupScope& aScope,
                                                 bool& bDependencyComputed,
                                                 bool& bDependencyCheckFailed)
@@ -118,6 +118,34 @@ void ColumnBlockPositionSet::clear()
     maTables.clear();
 }
 
+ColumnBlockConstPositionSet::ColumnBlockConstPositionSet() :
+    mpLastColumn(nullptr), mpLastPos(nullptr) {}
+
+ColumnBlockConstPosition& ColumnBlockConstPositionSet::getBlockPosition( const ScColumn& rColumn )
+{
+    // Most reads continue in the column of the previous one.
+    if (&rColumn == mpLastColumn)
+        return *mpLastPos;
+
+    auto it = maColumns.find(&rColumn);
+    if (it == maColumns.end())
+    {
+        it = maColumns.emplace(&rColumn, ColumnBlockConstPosition()).first;
+        rColumn.InitBlockPosition(it->second);
+    }
+
+    mpLastColumn = &rColumn;
+    mpLastPos = &it->second;
+    return it->second;
+}
+
+void ColumnBlockConstPositionSet::clear()
+{
+    maColumns.clear();
+    mpLastColumn = nullptr;
+    mpLastPos = nullptr;
+}
+
 struct TableColumnBlockPositionSet::Impl
 {
     typedef std::unordered_map<SCCOL, ColumnBlockPosition> ColumnsType;
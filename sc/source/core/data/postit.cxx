@@ -598,7 +598,9 @@ void ScPostIt::ShowCaptionTemp( const ScAddress& rPos, bool bShow )
 
 void ScPostIt::UpdateCaptionPos( const ScAddress& rPos )
 {
-    CreateCaptionFromInitData( rPos );
+    // A caption that still only exists as initial data is positioned relative
+    // to the cell it is finally created for, so there is nothing to update.
+    // Creating it here would instantiate every note on e.g. row insertion.
     if( maNoteData.mxCaption )
     {
         ScCaptionCreator aCreator( mrDoc, rPos, maNoteData.mxCaption );
@@ -9,6 +9,8 @@
 
 #include <rowheightcontext.hxx>
 
+#include <o3tl/hash_combine.hxx>
+
 namespace sc {
 
 RowHeightContext::RowHeightContext(SCROW nMaxRow,
@@ -33,6 +35,28 @@ void RowHeightContext::setForceAutoSize( bool b )
     mbForceAutoSize = b;
 }
 
+size_t RowHeightContext::TextHeightKeyHash::operator()( const TextHeightKey& rKey ) const
+{
+    size_t nHash = std::hash<const ScPatternAttr*>()(rKey.mpPattern);
+    o3tl::hash_combine(nHash, rKey.mpText);
+    o3tl::hash_combine(nHash, rKey.mnColWidth);
+    return nHash;
+}
+
+sal_uInt16 RowHeightContext::findTextHeight(
+    const ScPatternAttr* pPattern, const OUString& rText, sal_uInt16 nColWidth ) const
+{
+    auto it = maTextHeights.find(TextHeightKey{ pPattern, rText.pData, nColWidth });
+    return it == maTextHeights.end() ? 0 : it->second.mnHeight;
+}
+
+void RowHeightContext::setTextHeight(
+    const ScPatternAttr* pPattern, const OUString& rText, sal_uInt16 nColWidth, sal_uInt16 nHeight )
+{
+    maTextHeights.insert_or_assign(TextHeightKey{ pPattern, rText.pData, nColWidth },
+                                   TextHeight{ CellAttributeHolder(pPattern), rText, nHeight });
+}
+
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
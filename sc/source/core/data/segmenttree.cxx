@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <limits>
 #include <string_view>
+#include <vector>
 #include <global.hxx>
 #include <rtl/strbuf.hxx>
 
@@ -72,8 +73,38 @@ private:
     typedef ::mdds::flat_segment_tree<SCCOLROW, ValueType> fst_type;
     fst_type maSegments;
     typename fst_type::const_iterator maItr;
+    // Segment found by the last tree search, callers often query neighbouring positions.
+    RangeData maLastRange;
+    // Segment start positions, values and the sum of all preceding segments, so that
+    // getSumValue() is two binary searches instead of a walk over the segments in range.
+    // The last entry holds the end position and the total.
+    std::vector<SCCOLROW> maPrefixStarts;
+    std::vector<ValueType> maPrefixValues;
+    std::vector<sal_uInt64> maPrefixSums;
 
     bool mbTreeSearchEnabled:1;
+    bool mbLastRangeValid:1;
+    bool mbPrefixSumsValid:1;
+
+    void buildPrefixSums();
+    sal_uInt64 getPrefixSum(SCCOLROW nPos) const;
+
+    bool findLastRange(SCCOLROW nPos, RangeData& rData) const
+    {
+        if (!mbLastRangeValid || nPos < maLastRange.mnPos1 || maLastRange.mnPos2 < nPos)
+            return false;
+        rData = maLastRange;
+        return true;
+    }
+
+    void setLastRange(const RangeData& rData)
+    {
+        // Lookups run concurrently during threaded calculation, don't write then.
+        if (ScGlobal::bThreadedGroupCalcInProgress)
+            return;
+        maLastRange = rData;
+        mbLastRangeValid = true;
+    }
 };
 
 }
@@ -81,14 +112,20 @@ private:
 template<typename ValueType_, typename ExtValueType_>
 ScFlatSegmentsImpl<ValueType_, ExtValueType_>::ScFlatSegmentsImpl(SCCOLROW nMax, ValueType nDefault) :
     maSegments(0, nMax+1, nDefault),
-    mbTreeSearchEnabled(true)
+    maLastRange(),
+    mbTreeSearchEnabled(true),
+    mbLastRangeValid(false),
+    mbPrefixSumsValid(false)
 {
 }
 
 template<typename ValueType_, typename ExtValueType_>
 ScFlatSegmentsImpl<ValueType_, ExtValueType_>::ScFlatSegmentsImpl(const ScFlatSegmentsImpl<ValueType_, ExtValueType_>& r) :
     maSegments(r.maSegments),
-    mbTreeSearchEnabled(r.mbTreeSearchEnabled)
+    maLastRange(),
+    mbTreeSearchEnabled(r.mbTreeSearchEnabled),
+    mbLastRangeValid(false),
+    mbPrefixSumsValid(false)
 {
 }
 
@@ -96,6 +133,8 @@ template<typename ValueType_, typename ExtValueType_>
 bool ScFlatSegmentsImpl<ValueType_, ExtValueType_>::setValue(SCCOLROW nPos1, SCCOLROW nPos2, ValueType nValue)
 {
     ::std::pair<typename fst_type::const_iterator, bool> ret;
+    mbLastRangeValid = false;
+    mbPrefixSumsValid = false;
     ret = maSegments.insert(maItr, nPos1, nPos2+1, nValue);
     maItr = ret.first;
     return ret.second;
@@ -132,20 +171,38 @@ typename ScFlatSegmentsImpl<ValueType_, ExtValueType_>::ValueType ScFlatSegments
         return nValue;
     }
 
+    RangeData aData;
+    if (findLastRange(nPos, aData))
+        return aData.mnValue;
+
     if (!maSegments.valid_tree())
     {
         assert(!ScGlobal::bThreadedGroupCalcInProgress);
         maSegments.build_tree();
     }
 
-    maSegments.search_tree(nPos, nValue);
-    return nValue;
+    auto [it, found] = maSegments.search_tree(nPos, aData.mnValue, &aData.mnPos1, &aData.mnPos2);
+    if (!found)
+        return nValue;
+    aData.mnPos2 = aData.mnPos2-1; // end point is not inclusive.
+    setLastRange(aData);
+    return aData.mnValue;
 }
 
 template<typename ValueType_, typename ExtValueType_>
 sal_uInt64 ScFlatSegmentsImpl<ValueType_, ExtValueType_>::getSumValue(SCCOLROW nPos1, SCCOLROW nPos2)
 {
-    if (mbTreeSearchEnabled)
+    // The sums are built lazily, which can't be done during threaded calculation.
+    if (mbTreeSearchEnabled && (mbPrefixSumsValid || !ScGlobal::bThreadedGroupCalcInProgress))
+    {
+        if (!mbPrefixSumsValid)
+            buildPrefixSums();
+
+        if (nPos1 < 0 || nPos1 >= maPrefixStarts.back() || nPos2 < nPos1)
+            return 0;
+        return getPrefixSum(nPos2 + 1) - getPrefixSum(nPos1);
+    }
+    else if (mbTreeSearchEnabled)
     {
 
         if (!maSegments.valid_tree())
@@ -234,12 +291,60 @@ sal_uInt64 ScFlatSegmentsImpl<ValueType_, ExtValueType_>::getSumValue(SCCOLROW n
     }
 }
 
+template<typename ValueType_, typename ExtValueType_>
+void ScFlatSegmentsImpl<ValueType_, ExtValueType_>::buildPrefixSums()
+{
+    maPrefixStarts.clear();
+    maPrefixValues.clear();
+    maPrefixSums.clear();
+
+    sal_uInt64 nSum = 0;
+    typename fst_type::const_iterator it = maSegments.begin(), itEnd = maSegments.end();
+    // The right-most leaf node only marks the end position and holds no valid value.
+    for (typename fst_type::const_iterator itNext = it; ++itNext != itEnd; it = itNext)
+    {
+        maPrefixStarts.push_back(it->first);
+        maPrefixValues.push_back(it->second);
+        maPrefixSums.push_back(nSum);
+
+        sal_uInt64 nRes;
+        if (o3tl::checked_multiply<sal_uInt64>(it->second, itNext->first - it->first, nRes))
+        {
+            SAL_WARN("sc.core", "row height overflow");
+            nRes = SAL_MAX_INT64;
+        }
+        nSum = o3tl::saturating_add(nSum, nRes);
+    }
+    maPrefixStarts.push_back(it->first);
+    maPrefixValues.push_back(0);
+    maPrefixSums.push_back(nSum);
+
+    mbPrefixSumsValid = true;
+}
+
+template<typename ValueType_, typename ExtValueType_>
+sal_uInt64 ScFlatSegmentsImpl<ValueType_, ExtValueType_>::getPrefixSum(SCCOLROW nPos) const
+{
+    // Sum of the values of all positions before nPos.
+    if (nPos >= maPrefixStarts.back())
+        return maPrefixSums.back();
+    size_t nIndex = std::upper_bound(maPrefixStarts.begin(), maPrefixStarts.end(), nPos)
+                    - maPrefixStarts.begin() - 1;
+    sal_uInt64 nRes;
+    if (o3tl::checked_multiply<sal_uInt64>(maPrefixValues[nIndex], nPos - maPrefixStarts[nIndex], nRes))
+        nRes = SAL_MAX_INT64;
+    return o3tl::saturating_add(maPrefixSums[nIndex], nRes);
+}
+
 template<typename ValueType_, typename ExtValueType_>
 bool ScFlatSegmentsImpl<ValueType_, ExtValueType_>::getRangeData(SCCOLROW nPos, RangeData& rData)
 {
     if (!mbTreeSearchEnabled)
         return getRangeDataLeaf(nPos, rData);
 
+    if (findLastRange(nPos, rData))
+        return true;
+
     if (!maSegments.valid_tree())
     {
         assert(!ScGlobal::bThreadedGroupCalcInProgress);
@@ -251,6 +356,7 @@ bool ScFlatSegmentsImpl<ValueType_, ExtValueType_>::getRangeData(SCCOLROW nPos,
         return false;
     maItr = std::move(it); // cache the iterator to speed up ForwardIterator.
     rData.mnPos2 = rData.mnPos2-1; // end point is not inclusive.
+    setLastRange(rData);
     return true;
 }
 
@@ -273,6 +379,8 @@ bool ScFlatSegmentsImpl<ValueType_, ExtValueType_>::getRangeDataLeaf(SCCOLROW nP
 template<typename ValueType_, typename ExtValueType_>
 void ScFlatSegmentsImpl<ValueType_, ExtValueType_>::removeSegment(SCCOLROW nPos1, SCCOLROW nPos2)
 {
+    mbLastRangeValid = false;
+    mbPrefixSumsValid = false;
     maSegments.shift_left(nPos1, nPos2);
     maItr = maSegments.begin();
 }
@@ -280,6 +388,8 @@ void ScFlatSegmentsImpl<ValueType_, ExtValueType_>::removeSegment(SCCOLROW nPos1
 template<typename ValueType_, typename ExtValueType_>
 void ScFlatSegmentsImpl<ValueType_, ExtValueType_>::insertSegment(SCCOLROW nPos, SCCOLROW nSize, bool bSkipStartBoundary)
 {
+    mbLastRangeValid = false;
+    mbPrefixSumsValid = false;
     maSegments.shift_right(nPos, nSize, bSkipStartBoundary);
     maItr = maSegments.begin();
 }
@@ -2644,6 +2644,15 @@ ScRefCellValue ScTable::GetRefCellValue( SCCOL nCol, SCROW nRow, sc::ColumnBlock
     return aCol[nCol].GetCellValue(rBlockPos, nRow);
 }
 
+ScRefCellValue ScTable::GetRefCellValue( SCCOL nCol, SCROW nRow, sc::ColumnBlockConstPositionSet& rPositions ) const
+{
+    if ( !IsColRowValid( nCol, nRow ) )
+        return ScRefCellValue();
+
+    const ScColumn& rCol = aCol[nCol];
+    return rCol.GetCellValue(rPositions.getBlockPosition(rCol), nRow);
+}
+
 SvtBroadcaster* ScTable::GetBroadcaster( SCCOL nCol, SCROW nRow )
 {
     if ( !IsColRowValid( nCol, nRow ) )
@@ -2197,6 +2197,14 @@ void ScTable::SetDirtyAfterLoad()
         aCol[i].SetDirtyAfterLoad();
 }
 
+void ScTable::SetDirtySelectiveAfterLoad()
+{
+    sc::AutoCalcSwitch aSwitch(rDocument, false);
+    ScBulkBroadcast aBulkBroadcast( rDocument.GetBASM(), SfxHintId::ScDataChanged);
+    for (SCCOL i=0; i < aCol.size(); i++)
+        aCol[i].SetDirtySelectiveAfterLoad();
+}
+
 void ScTable::SetDirtyIfPostponed()
 {
     sc::AutoCalcSwitch aSwitch(rDocument, false);
@@ -3298,9 +3306,28 @@ void ScTable::ApplyAttr( SCCOL nCol, SCROW nRow, const SfxPoolItem& rAttr )
 void ScTable::ApplySelectionCache( ScItemPoolCache& rCache, const ScMarkData& rMark,
                                    ScEditDataArray* pDataArray, bool* const pIsChanged )
 {
+    // Collect all marked spans of a column and apply them together, so that
+    // a selection of many disjoint ranges doesn't re-shuffle the attribute
+    // entries once per range.
+    ScColumnData* pSpansCol = nullptr;
+    std::vector<sc::RowSpan> aSpans;
+    auto lcl_flush = [&]()
+    {
+        if (pSpansCol)
+            pSpansCol->ApplySelectionCache(rCache, aSpans, pDataArray, pIsChanged);
+        aSpans.clear();
+    };
     ApplyWithAllocation(
-        rMark, [&rCache, pDataArray, pIsChanged](ScColumnData& applyTo, SCROW nTop, SCROW nBottom)
-        { applyTo.ApplySelectionCache(rCache, nTop, nBottom, pDataArray, pIsChanged); });
+        rMark, [&](ScColumnData& applyTo, SCROW nTop, SCROW nBottom)
+        {
+            if (&applyTo != pSpansCol)
+            {
+                lcl_flush();
+                pSpansCol = &applyTo;
+            }
+            aSpans.emplace_back(nTop, nBottom);
+        });
+    lcl_flush();
 }
 
 void ScTable::ChangeSelectionIndent( bool bIncrement, const ScMarkData& rMark )
@@ -19,6 +19,7 @@
 
 #include <comphelper/processfactory.hxx>
 #include <comphelper/random.hxx>
+#include <comphelper/threadpool.hxx>
 #include <svl/numformat.hxx>
 #include <svl/zforlist.hxx>
 #include <svl/zformat.hxx>
@@ -66,9 +67,12 @@
 #include <queryevaluator.hxx>
 #include <scopetools.hxx>
 #include <SheetViewManager.hxx>
+#include <calcconfig.hxx>
+#include <interpretercontext.hxx>
 
 #include <svl/sharedstringpool.hxx>
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <unordered_set>
@@ -1702,6 +1706,108 @@ void ScTable::QuickSort( ScSortInfoArray* pArray, SCCOLROW nLo, SCCOLROW nHi )
     }
 }
 
+namespace {
+
+/** Sort key of one cell, ordered the same way as CompareCell() orders
+    numbers, errors and empty cells. */
+struct NumericSortKey
+{
+    sal_uInt8 mnClass;
+    double mfValue;
+
+    bool operator<( const NumericSortKey& r ) const
+    {
+        if (mnClass != r.mnClass)
+            return mnClass < r.mnClass;
+        return mfValue < r.mfValue;
+    }
+
+    bool operator==( const NumericSortKey& r ) const
+    {
+        return mnClass == r.mnClass && mfValue == r.mfValue;
+    }
+};
+
+}
+
+bool ScTable::SortByNumericKeys( ScSortInfoArray* pArray )
+{
+    // If no key cell is a string the collator isn't needed, and the cell type
+    // checks of CompareCell() can be done once per cell instead of once per
+    // comparison. Returns false if that's not the case.
+    const sal_uInt16 nUsedSorts = pArray->GetUsedSorts();
+    for (sal_uInt16 nSort = 0; nSort < nUsedSorts; ++nSort)
+    {
+        if (aSortParam.maKeyState[nSort].aColorSortMode != ScColorSortMode::None)
+            return false;
+    }
+
+    const SCCOLROW nStart = pArray->GetStart();
+    const SCSIZE nCount = pArray->GetLast() - nStart + 1;
+    std::vector<std::vector<NumericSortKey>> aKeys(nUsedSorts);
+    for (sal_uInt16 nSort = 0; nSort < nUsedSorts; ++nSort)
+    {
+        const bool bAscending = aSortParam.maKeyState[nSort].bAscending;
+        std::vector<NumericSortKey>& rKeys = aKeys[nSort];
+        rKeys.reserve(nCount);
+        for (SCSIZE i = 0; i < nCount; ++i)
+        {
+            ScRefCellValue& rCell = pArray->Get(nSort, nStart + i).maCell;
+            double fValue = 0.0;
+            bool bError = false;
+            switch (rCell.getType())
+            {
+                case CELLTYPE_NONE:
+                    // Empty cells always go last, also when descending.
+                    rKeys.push_back({ 2, 0.0 });
+                    continue;
+                case CELLTYPE_VALUE:
+                    fValue = rCell.getDouble();
+                break;
+                case CELLTYPE_FORMULA:
+                {
+                    ScFormulaCell* pFCell = rCell.getFormula();
+                    if (pFCell->GetErrCode() != FormulaError::NONE)
+                        bError = true;
+                    else if (pFCell->IsValue())
+                        fValue = pFCell->GetValue();
+                    else
+                        return false;
+                }
+                break;
+                default:
+                    return false;
+            }
+
+            // Numbers before errors, the other way round when descending.
+            if (bError)
+                rKeys.push_back({ static_cast<sal_uInt8>(bAscending ? 1 : 0), 0.0 });
+            else
+                rKeys.push_back({ static_cast<sal_uInt8>(bAscending ? 0 : 1),
+                                  bAscending ? fValue : -fValue });
+        }
+    }
+
+    std::vector<SCSIZE> aPositions(nCount);
+    for (SCSIZE i = 0; i < nCount; ++i)
+        aPositions[i] = i;
+
+    // Equal keys keep their original order, like Compare() does.
+    std::stable_sort(aPositions.begin(), aPositions.end(),
+        [&aKeys](SCSIZE n1, SCSIZE n2)
+        {
+            for (const std::vector<NumericSortKey>& rKeys : aKeys)
+            {
+                if (!(rKeys[n1] == rKeys[n2]))
+                    return rKeys[n1] < rKeys[n2];
+            }
+            return false;
+        });
+
+    pArray->Reorder(aPositions);
+    return true;
+}
+
 short ScTable::Compare(SCCOLROW nIndex1, SCCOLROW nIndex2) const
 {
     short nRes;
@@ -1799,13 +1905,18 @@ void ScTable::Sort(
             std::unique_ptr<ScSortInfoArray> pArray( CreateSortInfoArray(
                         aSortParam, nRow1, nLastRow, bKeepQuery, bUpdateRefs));
 
-            if ( nLastRow - nRow1 > 255 )
-                DecoladeRow(pArray.get(), nRow1, nLastRow);
-
-            if (bSortOrdered)
-                QuickSort(pArray.get(), nRow1, nLastRow);
-            else
+            if (!bSortOrdered)
+            {
+                if ( nLastRow - nRow1 > 255 )
+                    DecoladeRow(pArray.get(), nRow1, nLastRow);
                 lclShuffleArray(pArray.get(), nRow1, nLastRow);
+            }
+            else if (!SortByNumericKeys(pArray.get()))
+            {
+                if ( nLastRow - nRow1 > 255 )
+                    DecoladeRow(pArray.get(), nRow1, nLastRow);
+                QuickSort(pArray.get(), nRow1, nLastRow);
+            }
 
             if (pArray->IsUpdateRefs())
                 SortReorderByRowRefUpdate(pArray.get(), aSortParam.nCol1, aSortParam.nCol2, pProgress);
@@ -2695,6 +2806,116 @@ void ScTable::PrepareQuery( ScQueryParam& rQueryParam )
     lcl_PrepareQuery(&rDocument, this, rQueryParam, false);
 }
 
+namespace {
+
+class QueryRowsTask : public comphelper::ThreadTask
+{
+    ScDocument& mrDoc;
+    ScTable& mrTab;
+    const ScQueryParam& mrParam;
+    ScInterpreterContext* mpContext;
+    SCROW mnRow1;
+    SCROW mnRow2;
+    SCROW mnFirstRow;
+    std::vector<sal_uInt8>& mrValid;
+
+public:
+    QueryRowsTask( const std::shared_ptr<comphelper::ThreadTaskTag>& rTag, ScDocument& rDoc,
+                   ScTable& rTab, const ScQueryParam& rParam, ScInterpreterContext* pContext,
+                   SCROW nRow1, SCROW nRow2, SCROW nFirstRow, std::vector<sal_uInt8>& rValid )
+        : comphelper::ThreadTask(rTag)
+        , mrDoc(rDoc)
+        , mrTab(rTab)
+        , mrParam(rParam)
+        , mpContext(pContext)
+        , mnRow1(nRow1)
+        , mnRow2(nRow2)
+        , mnFirstRow(nFirstRow)
+        , mrValid(rValid)
+    {
+    }
+
+    virtual void doWork() override
+    {
+        // The query entries create their search objects on demand, so each
+        // thread needs its own copy.
+        ScQueryParam aParam(mrParam);
+        ScQueryEvaluator aEvaluator(mrDoc, mrTab, aParam, mpContext);
+        sc::TableColumnBlockPositionSet aBlockPos(mrDoc, mrTab.GetTab());
+        for (SCROW nRow = mnRow1; nRow <= mnRow2; ++nRow)
+            mrValid[nRow - mnFirstRow] = aEvaluator.ValidQuery(nRow, nullptr, &aBlockPos);
+    }
+};
+
+}
+
+bool ScTable::QueryRowsParallel( const ScQueryParam& rParam, SCROW nRow1, SCROW nRow2,
+                                 std::vector<sal_uInt8>& rValid )
+{
+    // Evaluate the query for large ranges on the thread pool, the same way
+    // formula groups are calculated. Only if nothing needs to be (re)calculated
+    // or accesses cell attributes other than number formats.
+    constexpr SCROW nMinRowsForThreads = 32768;
+    if (nRow2 - nRow1 + 1 < nMinRowsForThreads)
+        return false;
+
+    if (!ScCalcConfig::isThreadingEnabled() || rDocument.IsThreadedGroupCalcInProgress())
+        return false;
+
+    if (!rParam.GetEntry(0).bDoQuery || rParam.mbRangeLookup)
+        return false;
+
+    for (const ScQueryEntry& rEntry : rParam)
+    {
+        if (!rEntry.bDoQuery)
+            break;
+
+        const SCCOL nCol = static_cast<SCCOL>(rEntry.nField);
+        // The block position set would create missing columns.
+        if (!ValidCol(nCol) || nCol >= GetAllocatedColumnsCount())
+            return false;
+
+        if (aCol[nCol].HasFormulaCell(nRow1, nRow2))
+            return false;
+
+        for (const ScQueryEntry::Item& rItem : rEntry.GetQueryItems())
+        {
+            if (rItem.meType == ScQueryEntry::ByTextColor
+                || rItem.meType == ScQueryEntry::ByBackgroundColor)
+                return false;
+        }
+    }
+
+    comphelper::ThreadPool& rThreadPool = comphelper::ThreadPool::getSharedOptimalPool();
+    const sal_Int32 nThreadCount = rThreadPool.getWorkerCount();
+    if (nThreadCount < 2)
+        return false;
+
+    rValid.resize(nRow2 - nRow1 + 1);
+    const SCROW nChunk = (nRow2 - nRow1 + nThreadCount) / nThreadCount;
+    SvNumberFormatter* pFormatter = rDocument.GetNonThreadedContext().GetFormatTable();
+
+    rDocument.SetThreadedGroupCalcInProgress(true);
+    {
+        std::shared_ptr<comphelper::ThreadTaskTag> pTag = comphelper::ThreadPool::createThreadTaskTag();
+        ScThreadedInterpreterContextGetterGuard aContextGetterGuard(nThreadCount, rDocument, pFormatter);
+        for (sal_Int32 i = 0; i < nThreadCount; ++i)
+        {
+            const SCROW nStart = nRow1 + i * nChunk;
+            if (nStart > nRow2)
+                break;
+            const SCROW nEnd = std::min<SCROW>(nStart + nChunk - 1, nRow2);
+            rThreadPool.pushTask(std::make_unique<QueryRowsTask>(
+                pTag, rDocument, *this, rParam, aContextGetterGuard.GetInterpreterContextForThreadIdx(i),
+                nStart, nEnd, nRow1, rValid));
+        }
+        rThreadPool.waitUntilDone(pTag);
+    }
+    rDocument.SetThreadedGroupCalcInProgress(false);
+
+    return true;
+}
+
 SCSIZE ScTable::Query(const ScQueryParam& rParamOrg, bool bKeepSub, bool bKeepTotals)
 {
     ScQueryParam    aParam( rParamOrg );
@@ -2724,10 +2945,19 @@ SCSIZE ScTable::Query(const ScQueryParam& rParamOrg, bool bKeepSub, bool bKeepTo
     ScQueryEvaluator queryEvaluator(GetDoc(), *this, aParam);
 
     SCROW nRealRow2 = aParam.nRow2;
-    for (SCROW j = aParam.nRow1 + nHeader; j <= nRealRow2; ++j)
+    const SCROW nFirstRow = aParam.nRow1 + nHeader;
+
+    // Copying the result may change cells of the query range, so evaluate
+    // everything up front only when filtering in place.
+    std::vector<sal_uInt8> aValidRows;
+    const bool bHaveValidRows = aParam.bInplace
+        && QueryRowsParallel(aParam, nFirstRow, nRealRow2, aValidRows);
+
+    for (SCROW j = nFirstRow; j <= nRealRow2; ++j)
     {
         bool bResult;                                   // Filter result
-        bool bValid = queryEvaluator.ValidQuery(j, nullptr, &blockPos);
+        bool bValid = bHaveValidRows ? aValidRows[j - nFirstRow] != 0
+                                     : queryEvaluator.ValidQuery(j, nullptr, &blockPos);
         // Keep Totals row (last) even if we have no any cell formula!
         if (!bValid && bKeepTotals && j == nRealRow2)
         {
@@ -2444,6 +2444,20 @@ void ScTable::FillSeries( SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2,
                 bool bOverflow = false;
                 bool bNonEmpty = true;
 
+                // When filling down, runs of adjacent values are collected and
+                // set as one block, so the column is modified and broadcast
+                // once per run instead of once per cell.
+                const bool bBlockFill = bVertical && bPositive;
+                std::vector<double> aBlockVals;
+                SCROW nBlockStart = 0;
+                auto lclFlushBlock = [&]()
+                {
+                    if (aBlockVals.empty())
+                        return;
+                    aCol[nCol].SetValues(nBlockStart, aBlockVals);
+                    aBlockVals.clear();
+                };
+
                 sal_uInt16 nDayOfMonth = 0;
                 sal_Int32 nFillerIdx = 0;
                 if (bSkipOverlappedCells && !aIsNonEmptyCell[0])
@@ -2512,7 +2526,20 @@ void ScTable::FillSeries( SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2,
                         if (bError)
                             aCol[nCol].SetError(static_cast<SCROW>(nRow), FormulaError::NoValue);
                         else if (!bOverflow && bNonEmpty)
-                            aCol[nCol].SetValue(static_cast<SCROW>(nRow), nVal);
+                        {
+                            if (bBlockFill)
+                            {
+                                // hidden or skipped rows end the current run
+                                if (!aBlockVals.empty()
+                                    && nBlockStart + static_cast<SCROW>(aBlockVals.size()) != nRow)
+                                    lclFlushBlock();
+                                if (aBlockVals.empty())
+                                    nBlockStart = static_cast<SCROW>(nRow);
+                                aBlockVals.push_back(nVal);
+                            }
+                            else
+                                aCol[nCol].SetValue(static_cast<SCROW>(nRow), nVal);
+                        }
 
                         if (bAttribs && !bEntireArea && !bOverflow)
                             SetPatternAreaCondFormat( nCol, nRow, nRow, *pSrcPattern, rCondFormatIndex);
@@ -2529,6 +2556,7 @@ void ScTable::FillSeries( SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2,
                         --rInner;
                     }
                 }
+                lclFlushBlock();
                 nProgress += nIMax - nIMin + 1;
                 if(pProgress)
                     pProgress->SetStateOnPercent( nProgress );
@@ -712,6 +712,8 @@ private:
     void ScSumIf();
     void ScAverageIf();
     void IterateParametersIfs( double(*ResultFunc)( const sc::ParamIfsResult& rRes ) );
+    void IterateParametersIfsMainRange( const std::vector<sal_uInt8>& rConditions, sal_uInt8 nQueryCount,
+                                        const ScRange& rMainRange, sc::ParamIfsResult& rRes );
     void ScSumIfs();
     void ScAverageIfs();
     void ScCountIfs();
@@ -774,6 +776,7 @@ public:
     void ScDBVarP();
     void ScIndirect();
     void ScAddressFunc();
+    bool IsDynamicRefCalculated( const ScRange& rRange );
     void ScOffset();
     void ScIndex();
     void ScMultiArea();
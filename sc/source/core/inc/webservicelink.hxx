@@ -11,16 +11,29 @@
 
 #include <sfx2/lnkbase.hxx>
 #include <svl/broadcast.hxx>
+#include <rtl/ref.hxx>
 
 class ScDocument;
 
+namespace sc
+{
+class WebServiceFetchThread;
+}
+
 class ScWebServiceLink final : public ::sfx2::SvBaseLink, public SvtBroadcaster
 {
+    friend class sc::WebServiceFetchThread;
+
 private:
     ScDocument* pDoc;
     OUString aURL; // connection/ link data
     bool bHasResult; // is set aResult is useful
+    bool bDisposing; // the link is being destroyed, ignore a late fetch
     OUString aResult;
+    rtl::Reference<sc::WebServiceFetchThread> mxFetchThread; // fetch in flight, if any
+
+    /// Set the result and notify the listening formula cells.
+    void SetResult(bool bSuccess, const OUString& rResult);
 
 public:
     ScWebServiceLink(ScDocument* pD, OUString aURL);
@@ -33,10 +46,19 @@ public:
     // SvtBroadcaster override:
     virtual void ListenersGone() override;
 
+    /** Fetch the data on a worker thread instead of blocking like Update().
+        The listeners are notified when the data has arrived. */
+    void StartFetch();
+
+    /** Fetch rURL synchronously, using a copy which is at most a minute old
+        if there is one. Used where no link can be kept, e.g. FunctionAccess. */
+    static bool FetchCached(const OUString& rURL, OUString& rResult);
+
     // for interpreter:
 
     const OUString& GetResult() const { return aResult; }
     bool HasResult() const { return bHasResult; }
+    bool IsPending() const { return mxFetchThread.is(); }
 
     const OUString& GetURL() const { return aURL; }
 };
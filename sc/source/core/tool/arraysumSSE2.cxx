@@ -40,9 +40,11 @@ static inline void sumSSE2(__m128d& sum, __m128d& err, const __m128d& value)
     sum = t;
 }
 
-/** Execute Kahan sum with SSE2.
+/** Kahan sum with SSE2 of the values returned by rLoad for the array
+  * positions i, i+1.
   */
-KahanSum executeSSE2(size_t& i, size_t nSize, const double* pCurrent)
+template <typename Load>
+static inline KahanSum executeSSE2Impl(size_t& i, size_t nSize, const Load& rLoad)
 {
     // Make sure we don't fall out of bounds.
     // This works by sums of 8 terms.
@@ -63,24 +65,16 @@ KahanSum executeSSE2(size_t& i, size_t nSize, const double* pCurrent)
         for (; i + 7 < nSize; i += 8)
         {
             // Kahan sum 1
-            __m128d load1 = _mm_loadu_pd(pCurrent);
-            sumSSE2(sum1, err1, load1);
-            pCurrent += 2;
+            sumSSE2(sum1, err1, rLoad(i));
 
             // Kahan sum 2
-            __m128d load2 = _mm_loadu_pd(pCurrent);
-            sumSSE2(sum2, err2, load2);
-            pCurrent += 2;
+            sumSSE2(sum2, err2, rLoad(i + 2));
 
             // Kahan sum 3
-            __m128d load3 = _mm_loadu_pd(pCurrent);
-            sumSSE2(sum3, err3, load3);
-            pCurrent += 2;
+            sumSSE2(sum3, err3, rLoad(i + 4));
 
             // Kahan sum 4
-            __m128d load4 = _mm_loadu_pd(pCurrent);
-            sumSSE2(sum4, err4, load4);
-            pCurrent += 2;
+            sumSSE2(sum4, err4, rLoad(i + 6));
         }
 
         // Now we combine pairwise summation with Kahan summation
@@ -112,6 +106,25 @@ KahanSum executeSSE2(size_t& i, size_t nSize, const double* pCurrent)
     return { 0.0, 0.0 };
 }
 
+/** Execute Kahan sum with SSE2.
+  */
+KahanSum executeSSE2(size_t& i, size_t nSize, const double* pCurrent)
+{
+    const double* pArray = pCurrent - i;
+    return executeSSE2Impl(i, nSize, [pArray](size_t n) { return _mm_loadu_pd(pArray + n); });
+}
+
+/** Execute Kahan sum of squares with SSE2.
+  */
+KahanSum executeSSE2Square(size_t& i, size_t nSize, const double* pCurrent)
+{
+    const double* pArray = pCurrent - i;
+    return executeSSE2Impl(i, nSize, [pArray](size_t n) {
+        __m128d value = _mm_loadu_pd(pArray + n);
+        return _mm_mul_pd(value, value);
+    });
+}
+
 } // namespace
 
 #endif
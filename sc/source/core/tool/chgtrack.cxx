@@ -1835,9 +1835,9 @@ void ScChangeActionContent::UpdateReference( const ScChangeTrack* pTrack,
         UpdateRefMode eMode, const ScBigRange& rRange,
         sal_Int32 nDx, sal_Int32 nDy, sal_Int32 nDz )
 {
-    SCSIZE nOldSlot = pTrack->ComputeContentSlot( aBigRange.aStart.Row() );
+    SCSIZE nOldSlot = pTrack->ComputeContentSlot( aBigRange.aStart );
     ScRefUpdate::Update( eMode, rRange, nDx, nDy, nDz, aBigRange );
-    SCSIZE nNewSlot = pTrack->ComputeContentSlot( aBigRange.aStart.Row() );
+    SCSIZE nNewSlot = pTrack->ComputeContentSlot( aBigRange.aStart );
     if ( nNewSlot != nOldSlot )
     {
         RemoveFromSlot();
@@ -1983,20 +1983,26 @@ bool ScChangeActionReject::Reject(ScDocument& /*rDoc*/)
     return false;
 }
 
-SCSIZE ScChangeTrack::ComputeContentSlot( sal_Int32 nRow ) const
-{
-    if ( nRow < 0 || nRow > rDoc.GetSheetLimits().mnMaxRow )
-        return mnContentSlots - 1;
-    return static_cast< SCSIZE >( nRow / mnContentRowsPerSlot );
+namespace {
+
+// Content actions are hashed by their full position, not only by row, so
+// that a block of many columns pasted with tracking on doesn't pile up in
+// the few slots of its rows. Prime, plus one slot for invalid positions.
+constexpr SCSIZE nContentHashSlots = 16381;
+
 }
 
-SCROW ScChangeTrack::InitContentRowsPerSlot()
+SCSIZE ScChangeTrack::ComputeContentSlot( const ScBigAddress& rPos ) const
 {
-    const SCSIZE nMaxSlots = 0xffe0 / sizeof( ScChangeActionContent* ) - 2;
-    SCROW nRowsPerSlot = rDoc.GetMaxRowCount() / nMaxSlots;
-    if ( nRowsPerSlot * nMaxSlots < sal::static_int_cast<SCSIZE>(rDoc.GetMaxRowCount()) )
-        ++nRowsPerSlot;
-    return nRowsPerSlot;
+    const sal_Int64 nRow = rPos.Row();
+    const sal_Int64 nCol = rPos.Col();
+    const sal_Int64 nTab = rPos.Tab();
+    if ( nRow < 0 || nRow > rDoc.GetSheetLimits().mnMaxRow ||
+            nCol < 0 || nCol > rDoc.GetSheetLimits().mnMaxCol || nTab < 0 || nTab > MAXTAB )
+        return mnContentSlots - 1;
+    const sal_uInt64 nHash = ( static_cast<sal_uInt64>( nTab ) * 0x10000 + nCol ) * 0x1000003
+                                + static_cast<sal_uInt64>( nRow );
+    return static_cast< SCSIZE >( nHash % nContentHashSlots );
 }
 
 ScChangeTrack::ScChangeTrack( ScDocument& rDocP ) :
@@ -2029,8 +2035,7 @@ ScChangeTrack::~ScChangeTrack()
 
 void ScChangeTrack::Init()
 {
-    mnContentRowsPerSlot = InitContentRowsPerSlot();
-    mnContentSlots = rDoc.GetMaxRowCount() / InitContentRowsPerSlot() + 2;
+    mnContentSlots = nContentHashSlots + 1;
 
     pFirst = nullptr;
     pLast = nullptr;
@@ -2267,8 +2272,7 @@ void ScChangeTrack::MasterLinks( ScChangeAction* pAppend )
     {
         if ( !IsGenerated( pAppend->GetActionNumber() ) )
         {
-            SCSIZE nSlot = ComputeContentSlot(
-                pAppend->GetBigRange().aStart.Row() );
+            SCSIZE nSlot = ComputeContentSlot( pAppend->GetBigRange().aStart );
             static_cast<ScChangeActionContent*>(pAppend)->InsertInSlot(
                 &ppContentSlots[nSlot] );
         }
@@ -2816,7 +2820,7 @@ void ScChangeTrack::DeleteGeneratedDelContent( ScChangeActionContent* pContent )
 ScChangeActionContent* ScChangeTrack::SearchContentAt(
         const ScBigAddress& rPos, const ScChangeAction* pButNotThis ) const
 {
-    SCSIZE nSlot = ComputeContentSlot( rPos.Row() );
+    SCSIZE nSlot = ComputeContentSlot( rPos );
     for ( ScChangeActionContent* p = ppContentSlots[nSlot]; p;
             p = p->GetNextInSlot() )
     {
@@ -12,16 +12,28 @@
 #include <formulagroup.hxx>
 #include <formulagroupcl.hxx>
 #include <document.hxx>
+#include <dociter.hxx>
 #include <formulacell.hxx>
 #include <interpre.hxx>
 #include <globalnames.hxx>
+#include <kahan.hxx>
+#include <math.hxx>
+#include <patattr.hxx>
+#include <tokenarray.hxx>
+
+#include <formula/errorcodes.hxx>
+#include <formula/vectortoken.hxx>
 
 #include <officecfg/Office/Common.hxx>
 #if HAVE_FEATURE_OPENCL
 #include <opencl/platforminfo.hxx>
 #endif
+#include <rtl/math.hxx>
 #include <sal/log.hxx>
+#include <svl/zforlist.hxx>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <limits>
 #include <unordered_map>
@@ -137,6 +149,375 @@ CompiledFormula::CompiledFormula() {}
 
 CompiledFormula::~CompiledFormula() {}
 
+namespace {
+
+/// Operand of a running FormulaGroupProgram, either a value or a reference.
+struct StackEntry
+{
+    double mfValue;
+    size_t mnRef;
+};
+
+constexpr size_t NoRef = std::numeric_limits<size_t>::max();
+
+/// Cell values of a reference, fetched once for all rows of the group.
+struct RefValues
+{
+    SCROW mnRow; ///< row of the first array element
+    std::vector<formula::VectorRefArray> maColumns;
+};
+
+bool isString( const formula::VectorRefArray& rArray, size_t nIndex )
+{
+    return rArray.mpStringArray && rArray.mpStringArray[nIndex];
+}
+
+/// NaN for empty and string cells.
+double getNumber( const formula::VectorRefArray& rArray, size_t nIndex )
+{
+    return rArray.mpNumericArray ? rArray.mpNumericArray[nIndex]
+                                 : std::numeric_limits<double>::quiet_NaN();
+}
+
+/// Same as ScInterpreter::TreatDoubleError().
+FormulaError getError( double fValue )
+{
+    if (std::isfinite(fValue))
+        return FormulaError::NONE;
+
+    FormulaError nErr = GetDoubleErrorValue(fValue);
+    return nErr != FormulaError::NONE ? nErr : FormulaError::NoValue;
+}
+
+/**
+ * The interpreter derives the result format from the formats of the
+ * operands, which the program does not do. That is equivalent only as long
+ * as all referenced cells have a general format.
+ */
+bool hasOnlyGeneralFormats( ScDocument& rDoc, const ScRange& rRange )
+{
+    if (rDoc.HasAttrib(rRange, HasAttrFlags::Conditional))
+        return false;
+
+    ScDocAttrIterator aAttrIter(rDoc, rRange.aStart.Tab(), rRange.aStart.Col(), rRange.aStart.Row(),
+                                rRange.aEnd.Col(), rRange.aEnd.Row());
+    SCCOL nCol;
+    SCROW nRow1, nRow2;
+    for (const ScPatternAttr* pPattern = aAttrIter.GetNext(nCol, nRow1, nRow2); pPattern;
+         pPattern = aAttrIter.GetNext(nCol, nRow1, nRow2))
+    {
+        if (pPattern->GetNumberFormatKey() % SV_COUNTRY_LANGUAGE_OFFSET != 0)
+            return false;
+    }
+
+    if (!rDoc.HasFormulaCell(rRange))
+        return true;
+
+    ScCellIterator aCellIter(rDoc, rRange);
+    for (bool bHas = aCellIter.first(); bHas; bHas = aCellIter.next())
+    {
+        if (aCellIter.getType() == CELLTYPE_FORMULA
+            && aCellIter.getFormulaCell()->GetFormatType() != SvNumFormatType::NUMBER)
+            return false;
+    }
+    return true;
+}
+
+}
+
+bool FormulaGroupProgram::compile( const ScDocument& rDoc, const ScAddress& rTopPos, const ScTokenArray& rCode )
+{
+    maTopPos = rTopPos;
+    maCode.clear();
+    maRefs.clear();
+
+    if (rCode.GetCodeError() != FormulaError::NONE || !rCode.GetCodeLen())
+        return false;
+
+    // For each operand on the stack whether it is a range, which can be
+    // passed to functions only.
+    std::vector<bool> aIsRange;
+    for (const formula::FormulaToken* p : rCode.RPNTokens())
+    {
+        switch (p->GetOpCode())
+        {
+            case ocPush:
+                switch (p->GetType())
+                {
+                    case formula::svDouble:
+                        if (p->GetDoubleType() != 0)
+                            return false;
+                        maCode.push_back({ Op::Value, 0, p->GetDouble(), 0 });
+                        aIsRange.push_back(false);
+                    break;
+                    case formula::svSingleRef:
+                    {
+                        const ScSingleRefData& rRef = *p->GetSingleRef();
+                        if (rRef.IsDeleted())
+                            return false;
+                        ScAddress aAbs = rRef.toAbs(rDoc, rTopPos);
+                        if (!rDoc.ValidAddress(aAbs) || !rDoc.HasTable(aAbs.Tab()))
+                            return false;
+                        maRefs.push_back({ aAbs.Tab(), aAbs.Col(), aAbs.Col(), aAbs.Row(), aAbs.Row(),
+                                           rRef.IsRowRel(), rRef.IsRowRel() });
+                        maCode.push_back({ Op::Ref, 0, 0.0, maRefs.size() - 1 });
+                        aIsRange.push_back(false);
+                    }
+                    break;
+                    case formula::svDoubleRef:
+                    {
+                        const ScComplexRefData& rRef = *p->GetDoubleRef();
+                        if (rRef.IsDeleted())
+                            return false;
+                        ScAddress aAbs1 = rRef.Ref1.toAbs(rDoc, rTopPos);
+                        ScAddress aAbs2 = rRef.Ref2.toAbs(rDoc, rTopPos);
+                        if (!rDoc.ValidAddress(aAbs1) || !rDoc.ValidAddress(aAbs2)
+                            || aAbs1.Tab() != aAbs2.Tab() || !rDoc.HasTable(aAbs1.Tab()))
+                            return false;
+                        maRefs.push_back({ aAbs1.Tab(), std::min(aAbs1.Col(), aAbs2.Col()),
+                                           std::max(aAbs1.Col(), aAbs2.Col()), aAbs1.Row(), aAbs2.Row(),
+                                           rRef.Ref1.IsRowRel(), rRef.Ref2.IsRowRel() });
+                        maCode.push_back({ Op::Ref, 0, 0.0, maRefs.size() - 1 });
+                        aIsRange.push_back(true);
+                    }
+                    break;
+                    default:
+                        return false;
+                }
+            break;
+            case ocAdd:
+            case ocSub:
+            case ocMul:
+            case ocDiv:
+            {
+                size_t nSize = aIsRange.size();
+                if (nSize < 2 || aIsRange[nSize - 1] || aIsRange[nSize - 2])
+                    return false;
+                aIsRange.pop_back();
+                Op eOp = p->GetOpCode() == ocAdd ? Op::Add
+                       : p->GetOpCode() == ocSub ? Op::Sub
+                       : p->GetOpCode() == ocMul ? Op::Mul : Op::Div;
+                maCode.push_back({ eOp, 2, 0.0, 0 });
+            }
+            break;
+            case ocNegSub:
+                if (aIsRange.empty() || aIsRange.back())
+                    return false;
+                maCode.push_back({ Op::Negate, 1, 0.0, 0 });
+            break;
+            case ocSum:
+            case ocMin:
+            case ocMax:
+            case ocCount:
+            case ocAverage:
+            {
+                sal_uInt8 nParams = p->GetParamCount();
+                if (!nParams || aIsRange.size() < nParams)
+                    return false;
+                aIsRange.resize(aIsRange.size() - nParams);
+                aIsRange.push_back(false);
+                Op eOp = p->GetOpCode() == ocSum ? Op::Sum
+                       : p->GetOpCode() == ocMin ? Op::Min
+                       : p->GetOpCode() == ocMax ? Op::Max
+                       : p->GetOpCode() == ocCount ? Op::Count : Op::Average;
+                maCode.push_back({ eOp, nParams, 0.0, 0 });
+            }
+            break;
+            default:
+                return false;
+        }
+    }
+
+    // A lone cell reference results in the referenced cell as it is, which
+    // could also be empty or a string.
+    return aIsRange.size() == 1 && !aIsRange.back()
+        && !(maCode.size() == 1 && maCode.front().meOp == Op::Ref);
+}
+
+bool FormulaGroupProgram::calculate( ScDocument& rDoc, SCROW nStartOffset, SCROW nEndOffset,
+                                     std::vector<double>& rResults ) const
+{
+    // Current rows of a reference, in order.
+    auto aRowsAt = [](const Ref& rRef, SCROW nOffset)
+    {
+        SCROW nRow1 = rRef.mnRow1 + (rRef.mbRow1Rel ? nOffset : 0);
+        SCROW nRow2 = rRef.mnRow2 + (rRef.mbRow2Rel ? nOffset : 0);
+        return nRow1 <= nRow2 ? std::make_pair(nRow1, nRow2) : std::make_pair(nRow2, nRow1);
+    };
+
+    const ScRange aCalcRange(maTopPos.Col(), maTopPos.Row() + nStartOffset, maTopPos.Tab(),
+                             maTopPos.Col(), maTopPos.Row() + nEndOffset, maTopPos.Tab());
+
+    std::vector<RefValues> aValues(maRefs.size());
+    for (size_t i = 0; i < maRefs.size(); ++i)
+    {
+        const Ref& rRef = maRefs[i];
+        auto [nStartRow1, nStartRow2] = aRowsAt(rRef, nStartOffset);
+        auto [nEndRow1, nEndRow2] = aRowsAt(rRef, nEndOffset);
+        const SCROW nRow1 = std::min(nStartRow1, nEndRow1);
+        const SCROW nRow2 = std::max(nStartRow2, nEndRow2);
+        if (!rDoc.ValidRow(nRow1) || !rDoc.ValidRow(nRow2))
+            return false;
+
+        const ScRange aRange(rRef.mnCol1, nRow1, rRef.mnTab, rRef.mnCol2, nRow2, rRef.mnTab);
+        if (aRange.Intersects(aCalcRange) || !hasOnlyGeneralFormats(rDoc, aRange))
+            return false;
+
+        RefValues& rValues = aValues[i];
+        rValues.mnRow = nRow1;
+        for (SCCOL nCol = rRef.mnCol1; nCol <= rRef.mnCol2; ++nCol)
+        {
+            formula::VectorRefArray aArray
+                = rDoc.FetchVectorRefArray(ScAddress(nCol, nRow1, rRef.mnTab), nRow2 - nRow1 + 1);
+            if (!aArray.isValid())
+                return false;
+            rValues.maColumns.push_back(aArray);
+        }
+    }
+
+    rResults.resize(nEndOffset - nStartOffset + 1);
+    std::vector<StackEntry> aStack;
+    aStack.reserve(maCode.size());
+    for (SCROW nOffset = nStartOffset; nOffset <= nEndOffset; ++nOffset)
+    {
+        // Value of a scalar operand, empty cells are 0. Strings would need
+        // the string conversion settings, leave them to the interpreter.
+        auto aGetValue = [&](const StackEntry& rEntry, double& rfValue)
+        {
+            if (rEntry.mnRef == NoRef)
+            {
+                rfValue = rEntry.mfValue;
+                return true;
+            }
+            const RefValues& rValues = aValues[rEntry.mnRef];
+            const size_t nIndex = aRowsAt(maRefs[rEntry.mnRef], nOffset).first - rValues.mnRow;
+            if (isString(rValues.maColumns.front(), nIndex))
+                return false;
+            rfValue = getNumber(rValues.maColumns.front(), nIndex);
+            if (std::isnan(rfValue))
+                rfValue = 0.0;
+            return true;
+        };
+
+        aStack.clear();
+        FormulaError nErr = FormulaError::NONE;
+        for (const Instruction& rInst : maCode)
+        {
+            double fResult = 0.0;
+            switch (rInst.meOp)
+            {
+                case Op::Value:
+                    aStack.push_back({ rInst.mfValue, NoRef });
+                continue;
+                case Op::Ref:
+                    aStack.push_back({ 0.0, rInst.mnRef });
+                continue;
+                case Op::Negate:
+                {
+                    double fValue;
+                    if (!aGetValue(aStack.back(), fValue))
+                        return false;
+                    aStack.pop_back();
+                    fResult = -fValue;
+                }
+                break;
+                case Op::Add:
+                case Op::Sub:
+                case Op::Mul:
+                case Op::Div:
+                {
+                    double fLeft, fRight;
+                    if (!aGetValue(aStack[aStack.size() - 2], fLeft) || !aGetValue(aStack.back(), fRight))
+                        return false;
+                    aStack.resize(aStack.size() - 2);
+                    if (rInst.meOp == Op::Add)
+                        fResult = rtl::math::approxAdd(fLeft, fRight);
+                    else if (rInst.meOp == Op::Sub)
+                        fResult = rtl::math::approxSub(fLeft, fRight);
+                    else if (rInst.meOp == Op::Mul)
+                        fResult = fLeft * fRight;
+                    else
+                        fResult = sc::div(fLeft, fRight);
+                }
+                break;
+                case Op::Sum:
+                case Op::Min:
+                case Op::Max:
+                case Op::Count:
+                case Op::Average:
+                {
+                    // Strings and empty cells in references are ignored.
+                    KahanSum fSum;
+                    double fMin = std::numeric_limits<double>::max();
+                    double fMax = std::numeric_limits<double>::lowest();
+                    sal_uInt64 nCount = 0;
+                    auto aAdd = [&](double fValue)
+                    {
+                        fSum += fValue;
+                        fMin = std::min(fMin, fValue);
+                        fMax = std::max(fMax, fValue);
+                        ++nCount;
+                    };
+
+                    for (size_t nParam = aStack.size() - rInst.mnParams; nParam < aStack.size(); ++nParam)
+                    {
+                        const StackEntry& rEntry = aStack[nParam];
+                        if (rEntry.mnRef == NoRef)
+                        {
+                            aAdd(rEntry.mfValue);
+                            continue;
+                        }
+                        const RefValues& rValues = aValues[rEntry.mnRef];
+                        auto [nRow1, nRow2] = aRowsAt(maRefs[rEntry.mnRef], nOffset);
+                        for (const formula::VectorRefArray& rArray : rValues.maColumns)
+                        {
+                            if (!rArray.mpNumericArray)
+                                continue;
+                            for (SCROW nRow = nRow1; nRow <= nRow2; ++nRow)
+                            {
+                                double fValue = rArray.mpNumericArray[nRow - rValues.mnRow];
+                                if (!std::isnan(fValue))
+                                    aAdd(fValue);
+                            }
+                        }
+                    }
+                    aStack.resize(aStack.size() - rInst.mnParams);
+
+                    switch (rInst.meOp)
+                    {
+                        case Op::Sum:
+                            fResult = fSum.get();
+                        break;
+                        case Op::Min:
+                            fResult = nCount ? fMin : 0.0;
+                        break;
+                        case Op::Max:
+                            fResult = nCount ? fMax : 0.0;
+                        break;
+                        case Op::Count:
+                            fResult = nCount;
+                        break;
+                        default:
+                            fResult = sc::div(fSum.get(), nCount);
+                        break;
+                    }
+                }
+                break;
+            }
+
+            nErr = getError(fResult);
+            if (nErr != FormulaError::NONE)
+                break;
+            aStack.push_back({ fResult, NoRef });
+        }
+
+        rResults[nOffset - nStartOffset]
+            = nErr != FormulaError::NONE ? CreateDoubleError(nErr) : aStack.back().mfValue;
+    }
+
+    return true;
+}
+
 FormulaGroupInterpreter *FormulaGroupInterpreter::msInstance = nullptr;
 
 void FormulaGroupInterpreter::MergeCalcConfig(const ScDocument& rDoc)
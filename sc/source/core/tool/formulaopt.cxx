@@ -392,6 +392,9 @@ void ScFormulaCfg::UpdateFromProperties( const Sequence<OUString>& aNames )
                         case 2:
                             eOpt = RECALC_ASK;
                             break;
+                        case 3:
+                            eOpt = RECALC_SELECTIVE;
+                            break;
                         default:
                             SAL_WARN("sc", "unknown ooxml recalc option!");
                     }
@@ -416,6 +419,9 @@ void ScFormulaCfg::UpdateFromProperties( const Sequence<OUString>& aNames )
                         case 2:
                             eOpt = RECALC_ASK;
                             break;
+                        case 3:
+                            eOpt = RECALC_SELECTIVE;
+                            break;
                         default:
                             SAL_WARN("sc", "unknown odf recalc option!");
                     }
@@ -600,6 +606,9 @@ void ScFormulaCfg::ImplCommit()
                     case RECALC_ASK:
                         nVal = 2;
                         break;
+                    case RECALC_SELECTIVE:
+                        nVal = 3;
+                        break;
                 }
 
                 pValues[nProp] <<= nVal;
@@ -619,6 +628,9 @@ void ScFormulaCfg::ImplCommit()
                     case RECALC_ASK:
                         nVal = 2;
                         break;
+                    case RECALC_SELECTIVE:
+                        nVal = 3;
+                        break;
                 }
 
                 pValues[nProp] <<= nVal;
@@ -58,6 +58,8 @@
 #include <jumpmatrix.hxx>
 #include <cellkeytranslator.hxx>
 #include <lookupcache.hxx>
+#include <rangecache.hxx>
+#include <rangelst.hxx>
 #include <rangenam.hxx>
 #include <rangeutl.hxx>
 #include <compiler.hxx>
@@ -6690,7 +6692,15 @@ void ScInterpreter::IterateParametersIfs( double(*ResultFunc)( const sc::ParamIf
                         vConditions = vRefArrayConditions[nRefArrayMainPos];
 
                     SAL_WARN_IF(nDimensionCols && nDimensionRows && vConditions.empty(), "sc",  "ScInterpreter::IterateParametersIfs vConditions is empty");
-                    if (!vConditions.empty())
+                    if (!vConditions.empty() && !bCalcAsShown)
+                    {
+                        // Values need no rounding, so the cell blocks can be
+                        // walked directly.
+                        const ScRange aMainRange( nMainCol1, nMainRow1, nMainTab1,
+                                nMainCol1 + nDimensionCols - 1, nMainRow1 + nDimensionRows - 1, nMainTab1 );
+                        IterateParametersIfsMainRange( vConditions, nQueryCount, aMainRange, aRes );
+                    }
+                    else if (!vConditions.empty())
                     {
                         std::vector<sal_uInt8>::const_iterator itRes = vConditions.begin();
                         for (SCCOL nCol = 0; nCol < nDimensionCols; ++nCol)
@@ -11083,6 +11093,36 @@ void ScInterpreter::ScAddressFunc()
         PushString( aRefStr );
 }
 
+/** Whether the cells of a reference computed at run time can be used.
+
+    In a threaded group calculation only the static references of the group
+    were calculated beforehand, and a dirty cell can't be interpreted in a
+    thread. If the reference points into the cells of the run or to cells
+    that still need to be interpreted, the position of the cell is recorded
+    to calculate it again without threads and false is returned.
+ */
+bool ScInterpreter::IsDynamicRefCalculated( const ScRange& rRange )
+{
+    if (!mrDoc.IsThreadedGroupCalcInProgress())
+        return true;
+
+    bool bCalculated = !mrContext.mpThreadedCalcRanges
+        || !mrContext.mpThreadedCalcRanges->Intersects(rRange);
+    if (bCalculated && mrDoc.HasFormulaCell(rRange))
+    {
+        ScCellIterator aIter(mrDoc, rRange);
+        for (bool bHas = aIter.first(); bHas && bCalculated; bHas = aIter.next())
+        {
+            if (aIter.getType() == CELLTYPE_FORMULA && aIter.getFormulaCell()->NeedsInterpret())
+                bCalculated = false;
+        }
+    }
+
+    if (!bCalculated)
+        mrContext.maDynamicRefRecalcCells.push_back(aPos);
+    return bCalculated;
+}
+
 void ScInterpreter::ScOffset()
 {
     sal_uInt8 nParamCount = GetByte();
@@ -11141,6 +11181,8 @@ void ScInterpreter::ScOffset()
             nRow1 = static_cast<SCROW>(static_cast<tools::Long>(nRow1) + nRowPlus);
             if (!mrDoc.ValidCol(nCol1) || !mrDoc.ValidRow(nRow1))
                 PushIllegalArgument();
+            else if (!IsDynamicRefCalculated(ScRange(nCol1, nRow1, nTab1)))
+                PushNA();
             else
                 PushSingleRef(nCol1, nRow1, nTab1);
         }
@@ -11153,6 +11195,8 @@ void ScInterpreter::ScOffset()
             if (!mrDoc.ValidCol(nCol1) || !mrDoc.ValidRow(nRow1) ||
                 !mrDoc.ValidCol(nCol2) || !mrDoc.ValidRow(nRow2))
                 PushIllegalArgument();
+            else if (!IsDynamicRefCalculated(ScRange(nCol1, nRow1, nTab1, nCol2, nRow2, nTab1)))
+                PushNA();
             else
                 PushDoubleRef(nCol1, nRow1, nTab1, nCol2, nRow2, nTab1);
         }
@@ -11207,6 +11251,8 @@ void ScInterpreter::ScOffset()
         if (!mrDoc.ValidCol(nCol1) || !mrDoc.ValidRow(nRow1) ||
             !mrDoc.ValidCol(nCol2) || !mrDoc.ValidRow(nRow2) || nTab1 != nTab2)
             PushIllegalArgument();
+        else if (!IsDynamicRefCalculated(ScRange(nCol1, nRow1, nTab1, nCol2, nRow2, nTab1)))
+            PushNA();
         else
             PushDoubleRef(nCol1, nRow1, nTab1, nCol2, nRow2, nTab1);
         break;
@@ -13059,6 +13105,38 @@ bool ScInterpreter::SearchVectorForValue( VectorSearchArguments& vsa )
     return false;
 }
 
+static ScLookupHashIndex::Result lcl_LookupHashIndex( ScAddress & o_rResultPos, ScDocument& rDoc,
+        const ScQueryParam & rParam, const ScQueryEntry & rEntry,
+        const ScComplexRefData* refData, LookupSearchMode nSearchMode, sal_uInt16 nOpCode )
+{
+    if (nSearchMode != LookupSearchMode::Forward)
+        return ScLookupHashIndex::Result::UNKNOWN;
+    // Building the index costs about as much as one scan, don't bother for
+    // small ranges or for relative row references that would index a
+    // different range for each formula cell.
+    if (rParam.nRow2 - rParam.nRow1 < 100)
+        return ScLookupHashIndex::Result::UNKNOWN;
+    if (refData && (refData->Ref1.IsRowRel() || refData->Ref2.IsRowRel()))
+        return ScLookupHashIndex::Result::UNKNOWN;
+    const bool bNewSearchFunction = nOpCode == SC_OPCODE_X_LOOKUP || nOpCode == SC_OPCODE_X_MATCH;
+    if (!ScLookupHashIndex::canBeUsed(rDoc, rParam, bNewSearchFunction))
+        return ScLookupHashIndex::Result::UNKNOWN;
+
+    ScRange aRange( rParam.nCol1, rParam.nRow1, rParam.nTab, rParam.nCol1, rParam.nRow2, rParam.nTab);
+    const ScLookupHashIndex& rIndex = rDoc.GetLookupHashIndex( aRange, rParam );
+    const ScQueryEntry::Item& rItem = rEntry.GetQueryItem();
+    SCROW nRow = 0;
+    ScLookupHashIndex::Result eResult = rItem.meType == ScQueryEntry::ByValue
+        ? rIndex.lookupValue( rItem.mfVal, nRow )
+        : rIndex.lookupString( rItem.maString, nRow );
+    if (eResult == ScLookupHashIndex::Result::FOUND)
+    {
+        o_rResultPos.SetCol( rParam.nCol1 );
+        o_rResultPos.SetRow( nRow );
+    }
+    return eResult;
+}
+
 static bool lcl_LookupQuery( ScAddress & o_rResultPos, ScDocument& rDoc, ScInterpreterContext& rContext,
         const ScQueryParam & rParam, const ScQueryEntry & rEntry, const ScFormulaCell* cell,
         const ScComplexRefData* refData, LookupSearchMode nSearchMode, sal_uInt16 nOpCode )
@@ -13120,6 +13198,15 @@ static bool lcl_LookupQuery( ScAddress & o_rResultPos, ScDocument& rDoc, ScInter
         }
         else
         {
+            // An exact match in an unsorted range can be answered by the shared
+            // hash index of the range without scanning it.
+            ScLookupHashIndex::Result eResult = lcl_LookupHashIndex( o_rResultPos, rDoc, rParam,
+                rEntry, refData, nSearchMode, nOpCode );
+            if (eResult == ScLookupHashIndex::Result::FOUND)
+                return true;
+            if (eResult == ScLookupHashIndex::Result::NOT_AVAILABLE)
+                return false;
+
             ScQueryCellIteratorDirect aCellIter( rDoc, rContext, rParam.nTab, rParam, false,
                 nSearchMode == LookupSearchMode::Reverse);
             aCellIter.SetSortedBinarySearchMode(nSearchMode);
@@ -3630,10 +3630,14 @@ void ScInterpreter::ScTableOp()
     mrDoc.m_TableOpList.push_back(&aTableOp);
     mrDoc.IncInterpreterTableOpLevel();
 
-    bool bReuseLastParams = (mrDoc.aLastTableOpParams == aTableOp);
+    // A sheet may contain several TableOp blocks (or one block over several formulas) that
+    // are calculated interleaved, keep the collected positions of each of them.
+    auto itLastParams = std::find(mrDoc.maLastTableOpParams.begin(),
+                                  mrDoc.maLastTableOpParams.end(), aTableOp);
+    bool bReuseLastParams = (itLastParams != mrDoc.maLastTableOpParams.end());
     if ( bReuseLastParams )
     {
-        aTableOp.aNotifiedFormulaPos = mrDoc.aLastTableOpParams.aNotifiedFormulaPos;
+        aTableOp.aNotifiedFormulaPos = itLastParams->aNotifiedFormulaPos;
         aTableOp.bRefresh = true;
         for ( const auto& rPos : aTableOp.aNotifiedFormulaPos )
         {   // emulate broadcast and indirectly collect cell pointers
@@ -3679,7 +3683,12 @@ void ScInterpreter::ScTableOp()
 
     // save these params for next incarnation
     if ( !bReuseLastParams )
-        mrDoc.aLastTableOpParams = aTableOp;
+    {
+        const size_t nMaxLastParams = 16;
+        mrDoc.maLastTableOpParams.insert(mrDoc.maLastTableOpParams.begin(), aTableOp);
+        if (mrDoc.maLastTableOpParams.size() > nMaxLastParams)
+            mrDoc.maLastTableOpParams.pop_back();
+    }
 
     if (aCell.getType() == CELLTYPE_FORMULA)
     {
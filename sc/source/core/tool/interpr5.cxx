@@ -39,6 +39,7 @@
 #include <scresid.hxx>
 #include <cellkeytranslator.hxx>
 #include <formulagroup.hxx>
+#include <arraysumfunctor.hxx>
 #include <vcl/svapp.hxx> //Application::
 
 #include <vector>
@@ -1777,7 +1778,16 @@ void ScInterpreter::ScSumProduct()
         pMat->MergeDoubleArrayMultiply(aResArray);
     }
 
-    KahanSum fSum = 0.0;
+    // Without any error or "this is not a number" element the vectorised sum
+    // can be used, otherwise the products have to be filtered one by one.
+    KahanSum fSum = sc::op::sumArray(aResArray.data(), aResArray.size());
+    if (std::isfinite(fSum.get()))
+    {
+        PushDouble(fSum.get());
+        return;
+    }
+
+    fSum = 0.0;
     for( double fPosArray : aResArray )
     {
         FormulaError nErr = GetDoubleErrorValue(fPosArray);
@@ -1822,6 +1832,22 @@ void ScInterpreter::CalculateSumX2MY2SumX2DY2(bool _bSumX2DY2)
         PushNoValue();
         return;
     }
+    if (pMat1->IsNumeric() && pMat2->IsNumeric())
+    {
+        // No pair has to be skipped, sum the squares of both arrays with the
+        // vectorised sum.
+        std::vector<double> aArray1, aArray2;
+        pMat1->GetDoubleArray(aArray1);
+        pMat2->GetDoubleArray(aArray2);
+        KahanSum fSum = sc::op::sumSquareArray(aArray1.data(), aArray1.size());
+        KahanSum fSum2 = sc::op::sumSquareArray(aArray2.data(), aArray2.size());
+        if ( _bSumX2DY2 )
+            fSum += fSum2;
+        else
+            fSum -= fSum2;
+        PushDouble(fSum.get());
+        return;
+    }
     double fVal;
     KahanSum fSum = 0.0;
     for (i = 0; i < nC1; i++)
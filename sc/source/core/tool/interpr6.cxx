@@ -30,6 +30,8 @@
 
 #include <formula/token.hxx>
 
+#include <cstring>
+
 using namespace formula;
 
 double const fHalfMachEps = 0.5 * ::std::numeric_limits<double>::epsilon();
@@ -980,6 +982,97 @@ void ScInterpreter::ScCount2()
     IterateParameters( ifCOUNT2 );
 }
 
+/**
+ * Accumulate the numeric cells of the main range of SUMIFS, AVERAGEIFS,
+ * MINIFS and MAXIFS at positions where all criteria matched.
+ *
+ * rConditions holds one entry per cell of rMainRange in column-major order.
+ * Instead of looking up every matching cell position in the document this
+ * walks the cell blocks of each column once, and uses memchr() to skip the
+ * usually long runs of non-matching conditions.
+ */
+void ScInterpreter::IterateParametersIfsMainRange( const std::vector<sal_uInt8>& rConditions,
+        sal_uInt8 nQueryCount, const ScRange& rMainRange, sc::ParamIfsResult& rRes )
+{
+    class MainRangeAction : public sc::ColumnSpanSet::ColumnAction
+    {
+        ScInterpreter& mrInterpreter;
+        const std::vector<sal_uInt8>& mrConditions;
+        const sal_uInt8 mnQueryCount;
+        const ScRange& mrMainRange;
+        sc::ParamIfsResult& mrRes;
+        sc::ColumnBlockConstPosition maPos;
+        ScColumn* mpCol;
+        size_t mnColConditions;
+
+        void add( double fVal )
+        {
+            ++mrRes.mfCount;
+            mrRes.mfSum += fVal;
+            if ( mrRes.mfMin > fVal )
+                mrRes.mfMin = fVal;
+            if ( mrRes.mfMax < fVal )
+                mrRes.mfMax = fVal;
+        }
+
+    public:
+        MainRangeAction( ScInterpreter& rInterpreter, const std::vector<sal_uInt8>& rConditions,
+                sal_uInt8 nQueryCount, const ScRange& rMainRange, sc::ParamIfsResult& rRes ) :
+            mrInterpreter(rInterpreter), mrConditions(rConditions), mnQueryCount(nQueryCount),
+            mrMainRange(rMainRange), mrRes(rRes), mpCol(nullptr), mnColConditions(0) {}
+
+        virtual void startColumn( ScColumn* pCol ) override
+        {
+            mpCol = pCol;
+            mpCol->InitBlockPosition(maPos);
+            mnColConditions = static_cast<size_t>(pCol->GetCol() - mrMainRange.aStart.Col())
+                * (mrMainRange.aEnd.Row() - mrMainRange.aStart.Row() + 1);
+        }
+
+        virtual void execute( SCROW nRow1, SCROW nRow2, bool bVal ) override
+        {
+            if (!bVal)
+                return;
+
+            maPos.miCellPos = sc::ParseBlock(maPos.miCellPos, mpCol->GetCellStore(), *this, nRow1, nRow2);
+        }
+
+        void operator() ( const sc::CellStoreType::value_type& rNode, size_t nOffset, size_t nDataSize )
+        {
+            if (rNode.type != sc::element_type_numeric && rNode.type != sc::element_type_formula)
+                return;
+
+            const SCROW nTopRow = rNode.position + nOffset;
+            const sal_uInt8* const pCond = mrConditions.data() + mnColConditions
+                + (nTopRow - mrMainRange.aStart.Row());
+            const sal_uInt8* const pCondEnd = pCond + nDataSize;
+            for (const sal_uInt8* p = pCond; p < pCondEnd; ++p)
+            {
+                p = static_cast<const sal_uInt8*>(memchr(p, mnQueryCount, pCondEnd - p));
+                if (!p)
+                    break;
+
+                const size_t i = p - pCond;
+                if (rNode.type == sc::element_type_numeric)
+                    add(sc::numeric_block::at(*rNode.data, nOffset + i));
+                else
+                {
+                    ScRefCellValue aCell(sc::formula_block::at(*rNode.data, nOffset + i));
+                    if (aCell.hasNumeric())
+                    {
+                        const ScAddress aAdr(mpCol->GetCol(), nTopRow + i, mpCol->GetTab());
+                        add(mrInterpreter.GetCellValue(aAdr, aCell));
+                    }
+                }
+            }
+        }
+    };
+
+    MainRangeAction aAction(*this, rConditions, nQueryCount, rMainRange, rRes);
+    sc::RangeColumnSpanSet aSet(rMainRange);
+    aSet.executeColumnAction(mrDoc, aAction);
+}
+
 /**
  * The purpose of RAWSUBTRACT() is exactly to not apply any error correction, approximation etc.
  * But use the "raw" IEEE 754 double subtraction.
@@ -17,6 +17,7 @@
 #include <sfx2/bindings.hxx>
 #include <sfx2/linkmgr.hxx>
 #include <tools/urlobj.hxx>
+#include <vcl/svapp.hxx>
 
 #include <officecfg/Office/Common.hxx>
 #include <libxml/xpath.h>
@@ -257,21 +258,6 @@ static ScWebServiceLink* lcl_GetWebServiceLink(const sfx2::LinkManager* pLinkMgr
     return nullptr;
 }
 
-static bool lcl_FunctionAccessLoadWebServiceLink( OUString& rResult, ScDocument* pDoc, const OUString& rURI )
-{
-    // For FunctionAccess service always force a changed data update.
-    ScWebServiceLink aLink( pDoc, rURI);
-    if (aLink.DataChanged( OUString(), css::uno::Any()) != sfx2::SvBaseLink::UpdateResult::SUCCESS)
-        return false;
-
-    if (!aLink.HasResult())
-        return false;
-
-    rResult = aLink.GetResult();
-
-    return true;
-}
-
 void ScInterpreter::ScWebservice()
 {
     sal_uInt8 nParamCount = GetByte();
@@ -302,8 +288,10 @@ void ScInterpreter::ScWebservice()
         }
         else
         {
+            // For FunctionAccess service reuse a recently fetched document,
+            // else fetch synchronously.
             OUString aResult;
-            if (lcl_FunctionAccessLoadWebServiceLink( aResult, &mrDoc, aURI))
+            if (ScWebServiceLink::FetchCached( aURI, aResult))
                 PushString( aResult);
             else
                 PushError( FormulaError::NoValue);
@@ -339,7 +327,12 @@ void ScInterpreter::ScWebservice()
         //decision
         if (!mrDoc.HasLinkFormulaNeedingCheck())
         {
-            pLink->Update();
+            // In an interactive session don't block the UI on the network,
+            // the link broadcasts to its listeners once the data arrived.
+            if (pMyFormulaCell && !Application::IsHeadlessModeEnabled())
+                pLink->StartFetch();
+            else
+                pLink->Update();
         }
 
         if (pMyFormulaCell)
@@ -361,6 +354,14 @@ void ScInterpreter::ScWebservice()
     //  check the value
     if (pLink->HasResult())
         PushString(pLink->GetResult());
+    else if (pLink->IsPending())
+    {
+        // Keep a result loaded with the document while the fetch is running.
+        if (pMyFormulaCell && pMyFormulaCell->HasHybridStringResult())
+            PushString( pMyFormulaCell->GetResultString());
+        else
+            PushError( FormulaError::NotAvailable);
+    }
     else if (mrDoc.HasLinkFormulaNeedingCheck())
     {
         // If this formula cell is recalculated just after load and the
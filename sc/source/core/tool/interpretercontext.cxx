@@ -25,6 +25,7 @@
 #include <comphelper/random.hxx>
 #include <formula/token.hxx>
 #include <lookupcache.hxx>
+#include <mtvelements.hxx>
 #include <rangecache.hxx>
 #include <algorithm>
 
@@ -39,6 +40,7 @@ ScInterpreterContext::ScInterpreterContext(const ScDocument& rDoc, SvNumberForma
     // to lock a mutex to generate a random number
     , aRNG(comphelper::rng::uniform_uint_distribution(0, std::numeric_limits<sal_uInt32>::max()))
     , pInterpreter(nullptr)
+    , mpThreadedCalcRanges(nullptr)
     , mpFormatter(pFormatter)
 {
     if (!pFormatter)
@@ -108,6 +110,11 @@ void ScInterpreterContext::Cleanup()
     // Do not disturb mxScLookupCache.
     maConditions.clear();
     maDelayedSetNumberFormat.clear();
+    mpThreadedCalcRanges = nullptr;
+    maDynamicRefRecalcCells.clear();
+    // The cell storage may change once the threaded calculation is done.
+    if (mxColumnPositions)
+        mxColumnPositions->clear();
     ResetTokens();
 }
 
@@ -18,16 +18,24 @@
  */
 
 #include <rangecache.hxx>
+#include <bcaslot.hxx>
 #include <cellvalue.hxx>
 #include <document.hxx>
 #include <brdcst.hxx>
+#include <mtvelements.hxx>
 #include <queryevaluator.hxx>
 #include <queryparam.hxx>
 
+#include <rtl/math.hxx>
 #include <sal/log.hxx>
 #include <svl/numformat.hxx>
+#include <svl/sharedstring.hxx>
 #include <unotools/collatorwrapper.hxx>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
 static bool needsDescending(ScQueryOp op)
 {
     assert(op == SC_GREATER || op == SC_GREATER_EQUAL || op == SC_LESS || op == SC_LESS_EQUAL
@@ -270,4 +278,232 @@ ScSortedRangeCache::HashKey ScSortedRangeCache::makeHashKey(const ScRange& range
     return { range, toValueType(param), entry.eOp, item.meType };
 }
 
+namespace
+{
+// rtl::math::approxEqual() tolerates differences only in the last few bits of
+// the mantissa, so values that compare equal are always in the same or in
+// a neighbouring bucket of 256 consecutive doubles.
+constexpr int nValueBucketShift = 8;
+
+sal_uInt64 valueBucket(double fValue)
+{
+    if (fValue == 0.0)
+        return 0; // both 0.0 and -0.0
+    sal_uInt64 nBits;
+    std::memcpy(&nBits, &fValue, sizeof(nBits));
+    return nBits >> nValueBucketShift;
+}
+
+sal_uInt64 stringKey(const svl::SharedString& rString, ScLookupHashIndex::KeyType eKeyType)
+{
+    const rtl_uString* pData = eKeyType == ScLookupHashIndex::KeyType::StringsCaseSensitive
+                                   ? rString.getData()
+                                   : rString.getDataIgnoreCase();
+    return reinterpret_cast<sal_uIntPtr>(pData);
+}
+}
+
+ScLookupHashIndex::ScLookupHashIndex(ScDocument& rDoc, const ScRange& rRange, KeyType eKeyType)
+    : maRange(rRange)
+    , mrDoc(rDoc)
+    , meKeyType(eKeyType)
+{
+    assert(maRange.aStart.Col() == maRange.aEnd.Col());
+    assert(maRange.aStart.Tab() == maRange.aEnd.Tab());
+    SCTAB nTab = maRange.aStart.Tab();
+    SCCOL nCol = maRange.aStart.Col();
+    SCCOL nStartCol = nCol;
+    SCCOL nEndCol = nCol;
+    SCROW nStartRow = maRange.aStart.Row();
+    SCROW nEndRow = maRange.aEnd.Row();
+    if (!rDoc.ShrinkToDataArea(nTab, nStartCol, nStartRow, nEndCol, nEndRow))
+        return; // no data cells, nothing to index
+
+    sc::ColumnBlockPosition aBlockPos;
+    if (!rDoc.InitColumnBlockPosition(aBlockPos, nTab, nCol))
+        return;
+    for (SCROW nRow = nStartRow; nRow <= nEndRow; ++nRow)
+        updateRow(nRow, rDoc.GetRefCellValue(ScAddress(nCol, nRow, nTab), aBlockPos));
+}
+
+void ScLookupHashIndex::removeRow(SCROW nRow)
+{
+    maOpaqueRows.erase(nRow);
+    auto itKey = maRowKeys.find(nRow);
+    if (itKey == maRowKeys.end())
+        return;
+    auto itBucket = maBuckets.find(itKey->second);
+    assert(itBucket != maBuckets.end());
+    std::vector<Entry>& rEntries = itBucket->second;
+    auto it = std::lower_bound(rEntries.begin(), rEntries.end(), nRow,
+                               [](const Entry& rEntry, SCROW n) { return rEntry.mnRow < n; });
+    assert(it != rEntries.end() && it->mnRow == nRow);
+    rEntries.erase(it);
+    if (rEntries.empty())
+        maBuckets.erase(itBucket);
+    maRowKeys.erase(itKey);
+}
+
+void ScLookupHashIndex::updateRow(SCROW nRow, const ScRefCellValue& rCell)
+{
+    removeRow(nRow);
+
+    sal_uInt64 nKey = 0;
+    double fValue = 0.0;
+    switch (rCell.getType())
+    {
+        case CELLTYPE_NONE:
+            return;
+        case CELLTYPE_VALUE:
+            if (meKeyType != KeyType::Values)
+            {
+                // Matched against the input string of the number, which
+                // depends on the number format.
+                maOpaqueRows.insert(nRow);
+                return;
+            }
+            fValue = rCell.getDouble();
+            nKey = valueBucket(fValue);
+            break;
+        case CELLTYPE_STRING:
+            // Strings never match a numeric query with an empty query string.
+            if (meKeyType == KeyType::Values)
+                return;
+            nKey = stringKey(*rCell.getSharedString(), meKeyType);
+            break;
+        case CELLTYPE_EDIT:
+            if (meKeyType == KeyType::Values)
+                return;
+            maOpaqueRows.insert(nRow);
+            return;
+        case CELLTYPE_FORMULA:
+        default:
+            // Do not interpret here, the result may not even be calculated yet.
+            maOpaqueRows.insert(nRow);
+            return;
+    }
+
+    std::vector<Entry>& rEntries = maBuckets[nKey];
+    auto it = std::lower_bound(rEntries.begin(), rEntries.end(), nRow,
+                               [](const Entry& rEntry, SCROW n) { return rEntry.mnRow < n; });
+    rEntries.insert(it, Entry{ nRow, fValue });
+    maRowKeys.emplace(nRow, nKey);
+}
+
+SCROW ScLookupHashIndex::findFirstInBucket(sal_uInt64 nKey, double fValue) const
+{
+    auto itBucket = maBuckets.find(nKey);
+    if (itBucket == maBuckets.end())
+        return -1;
+    if (meKeyType != KeyType::Values)
+        return itBucket->second.front().mnRow;
+    for (const Entry& rEntry : itBucket->second)
+        if (rtl::math::approxEqual(rEntry.mfValue, fValue))
+            return rEntry.mnRow;
+    return -1;
+}
+
+ScLookupHashIndex::Result ScLookupHashIndex::makeResult(SCROW nFound, SCROW& rRow) const
+{
+    if (!maOpaqueRows.empty() && (nFound < 0 || *maOpaqueRows.begin() < nFound))
+        return Result::UNKNOWN;
+    if (nFound < 0)
+        return Result::NOT_AVAILABLE;
+    rRow = nFound;
+    return Result::FOUND;
+}
+
+ScLookupHashIndex::Result ScLookupHashIndex::lookupValue(double fValue, SCROW& rRow) const
+{
+    assert(meKeyType == KeyType::Values);
+    if (!std::isfinite(fValue))
+        return makeResult(-1, rRow);
+    const sal_uInt64 nKey = valueBucket(fValue);
+    SCROW nFound = -1;
+    for (sal_uInt64 nNeighbour : { nKey - 1, nKey, nKey + 1 })
+    {
+        SCROW nRow = findFirstInBucket(nNeighbour, fValue);
+        if (nRow >= 0 && (nFound < 0 || nRow < nFound))
+            nFound = nRow;
+    }
+    return makeResult(nFound, rRow);
+}
+
+ScLookupHashIndex::Result ScLookupHashIndex::lookupString(const svl::SharedString& rString,
+                                                          SCROW& rRow) const
+{
+    assert(meKeyType != KeyType::Values);
+    return makeResult(findFirstInBucket(stringKey(rString, meKeyType), 0.0), rRow);
+}
+
+void ScLookupHashIndex::Notify(const SfxHint& rHint)
+{
+    if (mrDoc.IsInDtorClear())
+        return;
+
+    if (rHint.GetId() == SfxHintId::ScDataChanged)
+    {
+        const ScHint* pScHint = dynamic_cast<const ScHint*>(&rHint);
+        const ScBroadcastAreaSlotMachine* pBASM = mrDoc.GetBASM();
+        if (pScHint && !(pBASM && pBASM->IsInBulkBroadcast()))
+        {
+            const ScRange aChanged = maRange.Intersection(pScHint->GetRange());
+            if (!aChanged.IsValid())
+                return;
+            sc::ColumnBlockPosition aBlockPos;
+            const SCCOL nCol = maRange.aStart.Col();
+            const SCTAB nTab = maRange.aStart.Tab();
+            if (mrDoc.InitColumnBlockPosition(aBlockPos, nTab, nCol))
+            {
+                for (SCROW nRow = aChanged.aStart.Row(); nRow <= aChanged.aEnd.Row(); ++nRow)
+                    updateRow(nRow,
+                              mrDoc.GetRefCellValue(ScAddress(nCol, nRow, nTab), aBlockPos));
+                return;
+            }
+        }
+        // Further changes within a bulk broadcast are not notified to this
+        // area listener anymore, rebuild the index when it's needed again.
+        mrDoc.RemoveLookupHashIndex(*this);
+        // this ScLookupHashIndex is deleted by RemoveLookupHashIndex
+    }
+    else if (rHint.GetId() == SfxHintId::ScAreaChanged
+             || rHint.GetId() == SfxHintId::ScTableOpDirty)
+    {
+        mrDoc.RemoveLookupHashIndex(*this);
+        // this ScLookupHashIndex is deleted by RemoveLookupHashIndex
+    }
+}
+
+bool ScLookupHashIndex::canBeUsed(const ScDocument& rDoc, const ScQueryParam& param,
+                                  bool bNewSearchFunction)
+{
+    const ScQueryEntry& entry = param.GetEntry(0);
+    if (!entry.bDoQuery || param.GetEntry(1).bDoQuery || entry.GetQueryItems().size() != 1)
+        return false;
+    if (entry.eOp != SC_EQUAL || param.eSearchType != utl::SearchParam::SearchType::Normal)
+        return false;
+    if (!param.bByRow || param.bHasHeader || param.mbRangeLookup)
+        return false;
+    if (param.nCol1 != param.nCol2 || entry.nField != param.nCol1)
+        return false;
+    if (!bNewSearchFunction && !ScQueryEvaluator::isMatchWholeCell(rDoc, entry.eOp))
+        return false;
+    const ScQueryEntry::Item& item = entry.GetQueryItem();
+    if (item.mbMatchEmpty || item.mbRoundForFilter)
+        return false;
+    if (item.meType == ScQueryEntry::ByValue)
+        return item.maString.isEmpty();
+    return item.meType == ScQueryEntry::ByString && !item.maString.isEmpty();
+}
+
+ScLookupHashIndex::HashKey ScLookupHashIndex::makeHashKey(const ScRange& range,
+                                                          const ScQueryParam& param)
+{
+    const ScQueryEntry::Item& item = param.GetEntry(0).GetQueryItem();
+    if (item.meType == ScQueryEntry::ByValue)
+        return { range, KeyType::Values };
+    return { range, param.bCaseSens ? KeyType::StringsCaseSensitive
+                                    : KeyType::StringsCaseInsensitive };
+}
+
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -23,6 +23,9 @@
 #include <osl/diagnose.h>
 #include <osl/thread.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <com/sun/star/uno/Any.hxx>
 #include <com/sun/star/uno/Sequence.hxx>
 #include <comphelper/string.hxx>
@@ -247,36 +250,36 @@ bool ScRangeToSequence::FillMixedArray( uno::Any& rAny, ScDocument& rDoc, const
 
     bool bHasErrors = false;
 
+    // empty cells are empty strings
+    const uno::Any aEmpty(OUString{});
     uno::Sequence< uno::Sequence<uno::Any> > aRowSeq( nRowCount );
     uno::Sequence<uno::Any>* pRowAry = aRowSeq.getArray();
+    std::vector<uno::Any*> aColArys(nRowCount);
     for (sal_Int32 nRow = 0; nRow < nRowCount; nRow++)
     {
-        uno::Sequence<uno::Any> aColSeq( nColCount );
-        uno::Any* pColAry = aColSeq.getArray();
-        for (sal_Int32 nCol = 0; nCol < nColCount; nCol++)
-        {
-            uno::Any& rElement = pColAry[nCol];
-
-            ScAddress aPos( static_cast<SCCOL>(nStartCol+nCol), static_cast<SCROW>(nStartRow+nRow), nTab );
-            ScRefCellValue aCell(rDoc, aPos);
+        pRowAry[nRow] = uno::Sequence<uno::Any>(nColCount);
+        aColArys[nRow] = pRowAry[nRow].getArray();
+        std::fill(aColArys[nRow], aColArys[nRow] + nColCount, aEmpty);
+    }
 
-            if (aCell.isEmpty())
-            {
-                rElement <<= OUString();
-                continue;
-            }
+    // only visit the non-empty cells, block by block
+    ScCellIterator aIter(rDoc, ScRange(nStartCol, nStartRow, nTab, rRange.aEnd.Col(), rRange.aEnd.Row(), nTab));
+    for (bool bHas = aIter.first(); bHas; bHas = aIter.next())
+    {
+        const ScAddress& rPos = aIter.GetPos();
+        uno::Any& rElement = aColArys[rPos.Row() - nStartRow][rPos.Col() - nStartCol];
+        ScRefCellValue aCell = aIter.getRefCellValue();
 
-            if (aCell.getType() == CELLTYPE_FORMULA && aCell.getFormula()->GetErrCode() != FormulaError::NONE)
-            {
-                // if NV is allowed, leave empty for errors
-                bHasErrors = true;
-            }
-            else if (aCell.hasNumeric())
-                rElement <<= aCell.getValue();
-            else
-                rElement <<= aCell.getString(rDoc);
+        if (aCell.getType() == CELLTYPE_FORMULA && aCell.getFormula()->GetErrCode() != FormulaError::NONE)
+        {
+            // if NV is allowed, leave empty for errors
+            rElement.clear();
+            bHasErrors = true;
         }
-        pRowAry[nRow] = std::move(aColSeq);
+        else if (aCell.hasNumeric())
+            rElement <<= aCell.getValue();
+        else
+            rElement <<= aCell.getString(rDoc);
     }
 
     rAny <<= aRowSeq;
@@ -25,6 +25,7 @@
 #include <mtvelements.hxx>
 #include <compare.hxx>
 #include <matrixoperators.hxx>
+#include <arraysumfunctor.hxx>
 #include <math.hxx>
 #include <jumpmatrix.hxx>
 
@@ -37,6 +38,7 @@
 
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <limits>
@@ -1204,6 +1206,17 @@ public:
             {
                 typedef MatrixImplType::numeric_block_type block_type;
 
+                if constexpr (std::is_same_v<Op, sc::op::SumSquare>)
+                {
+                    if (!mbIgnoreErrorValues)
+                    {
+                        const double* p = &block_type::at(*node.data, 0);
+                        maRes.maAccumulator += sc::op::sumSquareArray(p, node.size);
+                        maRes.mnCount += node.size;
+                        break;
+                    }
+                }
+
                 size_t nIgnored = 0;
                 block_type::const_iterator it = block_type::begin(*node.data);
                 block_type::const_iterator itEnd = block_type::end(*node.data);
@@ -3037,59 +3050,126 @@ void ScMatrixImpl::ExecuteBinaryOp(SCSIZE nMaxCol, SCSIZE nMaxRow, const ScMatri
         && "the caller code should have sized the output matrix to the passed dimensions");
     auto & rMatImpl1 = *rInputMat1.pImpl;
     auto & rMatImpl2 = *rInputMat2.pImpl;
-    // Check if we can do fast-path, where we have no replication or mis-matched matrix sizes.
-    if (rMatImpl1.maMat.size() == rMatImpl2.maMat.size()
-        && rMatImpl1.maMat.size() == maMat.size())
-    {
+    const MatrixImplType::size_pair_type aSize1 = rMatImpl1.maMat.size();
+    const MatrixImplType::size_pair_type aSize2 = rMatImpl2.maMat.size();
+    // A 1x1 operand is broadcast to all elements without replicating it.
+    const bool bScalar1 = aSize1.row == 1 && aSize1.column == 1;
+    const bool bScalar2 = aSize2.row == 1 && aSize2.column == 1;
+    // Check if we can do fast-path, where we have no other replication or mis-matched matrix sizes.
+    if ((bScalar1 || aSize1 == maMat.size()) && (bScalar2 || aSize2 == maMat.size()))
+    {
+        // The same error interpreter check that GetDouble() does.
+        auto checkDouble = [](const ScMatrixImpl& rImpl, double fVal)
+        {
+            if (rImpl.pErrorInterpreter)
+            {
+                FormulaError nError = GetDoubleErrorValue(fVal);
+                if (nError != FormulaError::NONE)
+                    rImpl.SetErrorAtInterpreter(nError);
+            }
+            return fVal;
+        };
+
+        // All matrices are walked in their column-major storage order.
+        const size_t nCount = nMaxCol * nMaxRow;
         MatrixImplType::position_type aOutPos = maMat.position(0, 0);
         MatrixImplType::const_position_type aPos1 = rMatImpl1.maMat.position(0, 0);
         MatrixImplType::const_position_type aPos2 = rMatImpl2.maMat.position(0, 0);
-        for (SCSIZE i = 0; i < nMaxCol; i++)
+        std::vector<double> aRun;
+        size_t nIndex = 0;
+        while (nIndex < nCount)
         {
-            for (SCSIZE j = 0; j < nMaxRow; j++)
+            // Calculate runs where both operands are in numeric blocks in one
+            // pass over the blocks, and set the results at once.
+            size_t nRun = 0;
+            if (rMatImpl1.maMat.get_type(aPos1) == mdds::mtm::element_numeric
+                && rMatImpl2.maMat.get_type(aPos2) == mdds::mtm::element_numeric)
             {
-                bool bVal1 = rMatImpl1.IsValueOrEmpty(aPos1);
-                bool bVal2 = rMatImpl2.IsValueOrEmpty(aPos2);
-                FormulaError nErr;
-                if (bVal1 && bVal2)
+                nRun = nCount - nIndex;
+                if (!bScalar1)
+                    nRun = std::min(nRun, aPos1.first->size - aPos1.second);
+                if (!bScalar2)
+                    nRun = std::min(nRun, aPos2.first->size - aPos2.second);
+            }
+            if (nRun > 1)
+            {
+                typedef MatrixImplType::numeric_block_type block_type;
+                block_type::const_iterator it1
+                    = std::next(block_type::begin(*aPos1.first->data), aPos1.second);
+                block_type::const_iterator it2
+                    = std::next(block_type::begin(*aPos2.first->data), aPos2.second);
+                const double fScalar1 = bScalar1 ? checkDouble(rMatImpl1, *it1) : 0.0;
+                const double fScalar2 = bScalar2 ? checkDouble(rMatImpl2, *it2) : 0.0;
+                aRun.resize(nRun);
+                for (double& rVal : aRun)
                 {
-                    double d = Op(rMatImpl1.GetDouble(aPos1), rMatImpl2.GetDouble(aPos2));
-                    aOutPos = maMat.set(aOutPos, d);
+                    double fVal1 = fScalar1;
+                    if (!bScalar1)
+                        fVal1 = checkDouble(rMatImpl1, *it1++);
+                    double fVal2 = fScalar2;
+                    if (!bScalar2)
+                        fVal2 = checkDouble(rMatImpl2, *it2++);
+                    rVal = Op(fVal1, fVal2);
                 }
-                else if (((nErr = rMatImpl1.GetErrorIfNotString(aPos1)) != FormulaError::NONE) ||
-                         ((nErr = rMatImpl2.GetErrorIfNotString(aPos2)) != FormulaError::NONE))
+                maMat.set(nIndex % nMaxRow, nIndex / nMaxRow, aRun.begin(), aRun.end());
+                nIndex += nRun;
+                if (nIndex < nCount)
                 {
-                    aOutPos = maMat.set(aOutPos, CreateDoubleError(nErr));
+                    const SCSIZE nR = nIndex % nMaxRow;
+                    const SCSIZE nC = nIndex / nMaxRow;
+                    aOutPos = maMat.position(nR, nC);
+                    if (!bScalar1)
+                        aPos1 = rMatImpl1.maMat.position(nR, nC);
+                    if (!bScalar2)
+                        aPos2 = rMatImpl2.maMat.position(nR, nC);
                 }
-                else if ((!bVal1 && rMatImpl1.IsStringOrEmpty(aPos1)) ||
-                         (!bVal2 && rMatImpl2.IsStringOrEmpty(aPos2)))
-                {
-                    FormulaError nError1 = FormulaError::NONE;
-                    SvNumFormatType nFmt1 = SvNumFormatType::ALL;
-                    double fVal1 = (bVal1 ? rMatImpl1.GetDouble(aPos1) :
-                            pInterpreter->ConvertStringToValue( rMatImpl1.GetString(aPos1).getString(), nError1, nFmt1));
-
-                    FormulaError nError2 = FormulaError::NONE;
-                    SvNumFormatType nFmt2 = SvNumFormatType::ALL;
-                    double fVal2 = (bVal2 ? rMatImpl2.GetDouble(aPos2) :
-                            pInterpreter->ConvertStringToValue( rMatImpl2.GetString(aPos2).getString(), nError2, nFmt2));
+                continue;
+            }
 
-                    if (nError1 != FormulaError::NONE)
-                        aOutPos = maMat.set(aOutPos, CreateDoubleError(nError1));
-                    else if (nError2 != FormulaError::NONE)
-                        aOutPos = maMat.set(aOutPos, CreateDoubleError(nError2));
-                    else
-                    {
-                        double d = Op( fVal1, fVal2);
-                        aOutPos = maMat.set(aOutPos, d);
-                    }
-                }
+            bool bVal1 = rMatImpl1.IsValueOrEmpty(aPos1);
+            bool bVal2 = rMatImpl2.IsValueOrEmpty(aPos2);
+            FormulaError nErr;
+            if (bVal1 && bVal2)
+            {
+                double d = Op(rMatImpl1.GetDouble(aPos1), rMatImpl2.GetDouble(aPos2));
+                aOutPos = maMat.set(aOutPos, d);
+            }
+            else if (((nErr = rMatImpl1.GetErrorIfNotString(aPos1)) != FormulaError::NONE) ||
+                     ((nErr = rMatImpl2.GetErrorIfNotString(aPos2)) != FormulaError::NONE))
+            {
+                aOutPos = maMat.set(aOutPos, CreateDoubleError(nErr));
+            }
+            else if ((!bVal1 && rMatImpl1.IsStringOrEmpty(aPos1)) ||
+                     (!bVal2 && rMatImpl2.IsStringOrEmpty(aPos2)))
+            {
+                FormulaError nError1 = FormulaError::NONE;
+                SvNumFormatType nFmt1 = SvNumFormatType::ALL;
+                double fVal1 = (bVal1 ? rMatImpl1.GetDouble(aPos1) :
+                        pInterpreter->ConvertStringToValue( rMatImpl1.GetString(aPos1).getString(), nError1, nFmt1));
+
+                FormulaError nError2 = FormulaError::NONE;
+                SvNumFormatType nFmt2 = SvNumFormatType::ALL;
+                double fVal2 = (bVal2 ? rMatImpl2.GetDouble(aPos2) :
+                        pInterpreter->ConvertStringToValue( rMatImpl2.GetString(aPos2).getString(), nError2, nFmt2));
+
+                if (nError1 != FormulaError::NONE)
+                    aOutPos = maMat.set(aOutPos, CreateDoubleError(nError1));
+                else if (nError2 != FormulaError::NONE)
+                    aOutPos = maMat.set(aOutPos, CreateDoubleError(nError2));
                 else
-                    aOutPos = maMat.set(aOutPos, CreateDoubleError(FormulaError::NoValue));
+                {
+                    double d = Op( fVal1, fVal2);
+                    aOutPos = maMat.set(aOutPos, d);
+                }
+            }
+            else
+                aOutPos = maMat.set(aOutPos, CreateDoubleError(FormulaError::NoValue));
+            if (!bScalar1)
                 aPos1 = MatrixImplType::next_position(aPos1);
+            if (!bScalar2)
                 aPos2 = MatrixImplType::next_position(aPos2);
-                aOutPos = MatrixImplType::next_position(aOutPos);
-            }
+            aOutPos = MatrixImplType::next_position(aOutPos);
+            ++nIndex;
         }
     }
     else
@@ -1321,18 +1321,19 @@ bool ScTokenArray::AddFormulaToken(
     return bError;
 }
 
-void ScTokenArray::CheckForThreading( const FormulaToken& r )
+bool ScTokenArray::IsThreadingDisabledBy( const FormulaToken& r )
 {
 #if HAVE_CPP_CONSTINIT_SORTED_VECTOR
     constinit
 #endif
+    // OFFSET is fine as long as its result was calculated already, see
+    // ScInterpreter::IsDynamicRefCalculated(). INDIRECT is not, resolving its
+    // argument may validate named ranges and register external references.
     static const o3tl::sorted_vector<OpCode> aThreadedCalcDenyList({
         ocIndirect,
         ocMacro,
-        ocOffset,
         ocTableOp,
         ocCell,
-        ocMatch,
         ocInfo,
         ocStyle,
         ocDBAverage,
@@ -1347,7 +1348,6 @@ void ScTokenArray::CheckForThreading( const FormulaToken& r )
         ocDBSum,
         ocDBVar,
         ocDBVarP,
-        ocText,
         ocSheet,
         ocExternal,
         ocDde,
@@ -1355,6 +1355,28 @@ void ScTokenArray::CheckForThreading( const FormulaToken& r )
         ocGetPivotData
     });
 
+    OpCode eOp = r.GetOpCode();
+
+    if (aThreadedCalcDenyList.find(eOp) != aThreadedCalcDenyList.end())
+        return true;
+
+    if (eOp != ocPush)
+        return false;
+
+    switch (r.GetType())
+    {
+        case svExternalDoubleRef:
+        case svExternalSingleRef:
+        case svExternalName:
+        case svMatrix:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void ScTokenArray::CheckForThreading( const FormulaToken& r )
+{
     // Don't enable threading once we decided to disable it.
     if (!mbThreadingEnabled)
         return;
@@ -1367,32 +1389,28 @@ void ScTokenArray::CheckForThreading( const FormulaToken& r )
         return;
     }
 
-    OpCode eOp = r.GetOpCode();
+    if (!IsThreadingDisabledBy(r))
+        return;
 
-    if (aThreadedCalcDenyList.find(eOp) != aThreadedCalcDenyList.end())
-    {
+    OpCode eOp = r.GetOpCode();
+    if (eOp == ocPush)
+        SAL_INFO("sc.core.formulagroup", "opcode ocPush: variable type " << StackVarEnumToString(r.GetType())
+            << " disables threaded calculation of formula group");
+    else
         SAL_INFO("sc.core.formulagroup", "opcode " << formula::FormulaCompiler().GetOpCodeMap(sheet::FormulaLanguage::ENGLISH)->getSymbol(eOp)
             << "(" << int(eOp) << ") disables threaded calculation of formula group");
-        mbThreadingEnabled = false;
-        return;
-    }
-
-    if (eOp != ocPush)
-        return;
+    mbThreadingEnabled = false;
+}
 
-    switch (r.GetType())
-    {
-        case svExternalDoubleRef:
-        case svExternalSingleRef:
-        case svExternalName:
-        case svMatrix:
-            SAL_INFO("sc.core.formulagroup", "opcode ocPush: variable type " << StackVarEnumToString(r.GetType())
-                << " disables threaded calculation of formula group");
-            mbThreadingEnabled = false;
-            return;
-        default:
-            break;
-    }
+const FormulaToken* ScTokenArray::GetThreadingBlocker() const
+{
+    for (const FormulaToken* p : RPNTokens())
+        if (IsThreadingDisabledBy(*p))
+            return p;
+    for (const FormulaToken* p : Tokens())
+        if (IsThreadingDisabledBy(*p))
+            return p;
+    return nullptr;
 }
 
 void ScTokenArray::CheckToken( const FormulaToken& r )
@@ -15,56 +15,100 @@
 #include <com/sun/star/ucb/SimpleFileAccess.hpp>
 #include <com/sun/star/io/XInputStream.hpp>
 
+#include <salhelper/thread.hxx>
 #include <tools/hostfilter.hxx>
 #include <tools/urlobj.hxx>
+#include <vcl/svapp.hxx>
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <webservicelink.hxx>
 #include <brdcst.hxx>
 #include <document.hxx>
 #include <sc.hrc>
 
-ScWebServiceLink::ScWebServiceLink(ScDocument* pD, OUString _aURL)
-    : ::sfx2::SvBaseLink(SfxLinkUpdateMode::ALWAYS, SotClipboardFormatId::STRING)
-    , pDoc(pD)
-    , aURL(std::move(_aURL))
-    , bHasResult(false)
+namespace
 {
+/// How long a fetched document is reused for new links and FunctionAccess.
+constexpr std::chrono::seconds CACHE_TIME_TO_LIVE(60);
+
+struct CacheEntry
+{
+    OUString maData;
+    std::chrono::steady_clock::time_point maTime;
+};
+
+std::mutex& getCacheMutex()
+{
+    static std::mutex aMutex;
+    return aMutex;
 }
 
-ScWebServiceLink::~ScWebServiceLink() {}
+std::unordered_map<OUString, CacheEntry>& getCache()
+{
+    static std::unordered_map<OUString, CacheEntry> aCache;
+    return aCache;
+}
 
-sfx2::SvBaseLink::UpdateResult ScWebServiceLink::DataChanged(const OUString&, const css::uno::Any&)
+bool lookupCache(const OUString& rURL, OUString& rData)
 {
-    aResult.clear();
-    bHasResult = false;
+    std::scoped_lock aGuard(getCacheMutex());
+    std::unordered_map<OUString, CacheEntry>& rCache = getCache();
+    auto it = rCache.find(rURL);
+    if (it == rCache.end())
+        return false;
+
+    if (std::chrono::steady_clock::now() - it->second.maTime > CACHE_TIME_TO_LIVE)
+    {
+        rCache.erase(it);
+        return false;
+    }
+
+    rData = it->second.maData;
+    return true;
+}
 
-    INetURLObject aURLObject(aURL);
+void storeInCache(const OUString& rURL, const OUString& rData)
+{
+    std::scoped_lock aGuard(getCacheMutex());
+    std::unordered_map<OUString, CacheEntry>& rCache = getCache();
+    const auto aNow = std::chrono::steady_clock::now();
+    std::erase_if(rCache,
+                  [&aNow](const auto& rPair) { return aNow - rPair.second.maTime > CACHE_TIME_TO_LIVE; });
+    rCache[rURL] = CacheEntry{ rData, aNow };
+}
+
+/// Can be called from any thread.
+bool fetch(const OUString& rURL, OUString& rData)
+{
+    INetURLObject aURLObject(rURL);
     const OUString sHost = aURLObject.GetHost();
     if (HostFilter::isForbidden(sHost))
     {
-        SAL_WARN("sc.ui", "ScWebServiceLink::DataChanged: blocked access to external file: \""
-                              << aURL << "\"");
-        return ERROR_GENERAL;
+        SAL_WARN("sc.ui", "ScWebServiceLink::DataChanged: blocked access to external file: ""
+                              << rURL << """);
+        return false;
     }
 
     css::uno::Reference<css::ucb::XSimpleFileAccess3> xFileAccess
         = css::ucb::SimpleFileAccess::create(comphelper::getProcessComponentContext());
     if (!xFileAccess.is())
-        return ERROR_GENERAL;
+        return false;
 
     css::uno::Reference<css::io::XInputStream> xStream;
     try
     {
-        xStream = xFileAccess->openFileRead(aURL);
+        xStream = xFileAccess->openFileRead(rURL);
     }
     catch (...)
     {
         // don't let any exceptions pass
-        return ERROR_GENERAL;
+        return false;
     }
     if (!xStream.is())
-        return ERROR_GENERAL;
+        return false;
 
     const sal_Int32 BUF_LEN = 8000;
     css::uno::Sequence<sal_Int8> buffer(BUF_LEN);
@@ -79,8 +123,79 @@ sfx2::SvBaseLink::UpdateResult ScWebServiceLink::DataChanged(const OUString&, co
 
     xStream->closeInput();
 
-    aResult = OStringToOUString(aBuffer, RTL_TEXTENCODING_UTF8);
-    bHasResult = true;
+    rData = OStringToOUString(aBuffer, RTL_TEXTENCODING_UTF8);
+    storeInCache(rURL, rData);
+    return true;
+}
+}
+
+namespace sc
+{
+class WebServiceFetchThread : public salhelper::Thread
+{
+    ScWebServiceLink& mrLink;
+    OUString maURL;
+
+public:
+    WebServiceFetchThread(ScWebServiceLink& rLink, OUString aURL)
+        : salhelper::Thread("WebService Fetch Thread")
+        , mrLink(rLink)
+        , maURL(std::move(aURL))
+    {
+    }
+
+    virtual void execute() override
+    {
+        OUString aData;
+        bool bSuccess = fetch(maURL, aData);
+
+        SolarMutexGuard aGuard;
+        if (mrLink.bDisposing)
+            return;
+
+        // The running thread holds its own reference.
+        mrLink.mxFetchThread.clear();
+        mrLink.SetResult(bSuccess, aData);
+    }
+};
+}
+
+ScWebServiceLink::ScWebServiceLink(ScDocument* pD, OUString _aURL)
+    : ::sfx2::SvBaseLink(SfxLinkUpdateMode::ALWAYS, SotClipboardFormatId::STRING)
+    , pDoc(pD)
+    , aURL(std::move(_aURL))
+    , bHasResult(false)
+    , bDisposing(false)
+{
+}
+
+ScWebServiceLink::~ScWebServiceLink()
+{
+    bDisposing = true;
+    if (mxFetchThread.is())
+    {
+        SolarMutexReleaser aReleaser;
+        mxFetchThread->join();
+    }
+}
+
+sfx2::SvBaseLink::UpdateResult ScWebServiceLink::DataChanged(const OUString&, const css::uno::Any&)
+{
+    aResult.clear();
+    bHasResult = false;
+
+    OUString aData;
+    if (!fetch(aURL, aData))
+        return ERROR_GENERAL;
+
+    SetResult(true, aData);
+    return SUCCESS;
+}
+
+void ScWebServiceLink::SetResult(bool bSuccess, const OUString& rResult)
+{
+    aResult = bSuccess ? rResult : OUString();
+    bHasResult = bSuccess;
 
     //  Something happened...
     if (HasListeners())
@@ -89,8 +204,29 @@ sfx2::SvBaseLink::UpdateResult ScWebServiceLink::DataChanged(const OUString&, co
         pDoc->TrackFormulas(); // must happen immediately
         pDoc->StartTrackTimer();
     }
+}
+
+void ScWebServiceLink::StartFetch()
+{
+    if (mxFetchThread.is())
+        return;
+
+    OUString aData;
+    if (lookupCache(aURL, aData))
+    {
+        // The caller reads the result right away, nobody to notify yet.
+        aResult = aData;
+        bHasResult = true;
+        return;
+    }
 
-    return SUCCESS;
+    mxFetchThread = new sc::WebServiceFetchThread(*this, aURL);
+    mxFetchThread->launch();
+}
+
+bool ScWebServiceLink::FetchCached(const OUString& rURL, OUString& rResult)
+{
+    return lookupCache(rURL, rResult) || fetch(rURL, rResult);
 }
 
 void ScWebServiceLink::ListenersGone()
@@ -628,13 +628,12 @@ XclExpNumberCell::XclExpNumberCell(
 {
 }
 
-static OString lcl_GetStyleId( const XclExpXmlStream& rStrm, sal_uInt32 nXFIndex )
+static sal_Int32 lcl_GetStyleId( const XclExpXmlStream& rStrm, sal_uInt32 nXFIndex )
 {
-    return OString::number( rStrm.GetRoot().GetXFBuffer()
-            .GetXmlCellIndex( nXFIndex ) );
+    return rStrm.GetRoot().GetXFBuffer().GetXmlCellIndex( nXFIndex );
 }
 
-static OString lcl_GetStyleId( const XclExpXmlStream& rStrm, const XclExpCellBase& rCell )
+static sal_Int32 lcl_GetStyleId( const XclExpXmlStream& rStrm, const XclExpCellBase& rCell )
 {
     sal_uInt32 nXFId    = rCell.GetFirstXFId();
     sal_uInt16 nXFIndex = rStrm.GetRoot().GetXFBuffer().GetXFIndex( nXFId );
@@ -1434,6 +1433,49 @@ void XclExpRkCell::WriteContents( XclExpStream& rStrm, sal_uInt16 nRelCol )
     rStrm << maRkValues[ nRelCol ];
 }
 
+XclExpMultiNumberCell::XclExpMultiNumberCell(
+        const XclExpRoot& rRoot, const XclAddress& rXclPos,
+        const ScPatternAttr* pPattern, sal_uInt32 nForcedXFId, double fValue ) :
+    XclExpMultiCellBase( EXC_ID3_NUMBER, EXC_ID3_NUMBER, 8, rXclPos )
+{
+    OSL_ENSURE( rRoot.GetOutput() == EXC_OUTPUT_XML_2007, "XclExpMultiNumberCell::XclExpMultiNumberCell - OOXML only" );
+    // #i41210# always use latin script for number cells - may look wrong for special number formats...
+    AppendXFId( rRoot, pPattern, ApiScriptType::LATIN, nForcedXFId );
+    maValues.push_back( fValue );
+}
+
+bool XclExpMultiNumberCell::TryMerge( const XclExpCellBase& rCell )
+{
+    const XclExpMultiNumberCell* pNumberCell = dynamic_cast< const XclExpMultiNumberCell* >( &rCell );
+    if( pNumberCell && TryMergeXFIds( *pNumberCell ) )
+    {
+        maValues.insert( maValues.end(), pNumberCell->maValues.begin(), pNumberCell->maValues.end() );
+        return true;
+    }
+    return false;
+}
+
+void XclExpMultiNumberCell::WriteXmlContents( XclExpXmlStream& rStrm, const XclAddress& rAddress, sal_uInt32 nXFId, sal_uInt16 nRelCol )
+{
+    OSL_ENSURE( nRelCol < maValues.size(), "XclExpMultiNumberCell::WriteXmlContents - overflow error" );
+    sax_fastparser::FSHelperPtr& rWorksheet = rStrm.GetCurrentStream();
+    rWorksheet->startElement( XML_c,
+            XML_r, XclXmlUtils::ToOString(rStrm.GetRoot().GetStringBuf(), rAddress).getStr(),
+            XML_s, lcl_GetStyleId(rStrm, nXFId),
+            XML_t, "n"
+            // OOXTODO: XML_cm, XML_vm, XML_ph
+    );
+    rWorksheet->startElement( XML_v );
+    rWorksheet->write( maValues[ nRelCol ] );
+    rWorksheet->endElement( XML_v );
+    rWorksheet->endElement( XML_c );
+}
+
+void XclExpMultiNumberCell::WriteContents( XclExpStream& /*rStrm*/, sal_uInt16 /*nRelCol*/ )
+{
+    OSL_FAIL( "XclExpMultiNumberCell::WriteContents - not a BIFF record" );
+}
+
 // Rows and Columns
 
 XclExpOutlineBuffer::XclExpOutlineBuffer( const XclExpRoot& rRoot, bool bRows ) :
@@ -2212,14 +2254,14 @@ void XclExpRow::SaveXml( XclExpXmlStream& rStrm )
     for ( sal_uInt32 i=0; i<mnXclRowRpt; ++i )
     {
         rWorksheet->startElement( XML_row,
-                XML_r,              OString::number(mnCurrentRow++),
+                XML_r,              mnCurrentRow++,
                 // OOXTODO: XML_spans,          optional
-                XML_s,              haveFormat ? lcl_GetStyleId( rStrm, mnXFIndex ).getStr() : nullptr,
+                XML_s,              sax_fastparser::UseIf( lcl_GetStyleId( rStrm, mnXFIndex ), haveFormat ),
                 XML_customFormat,   ToPsz( haveFormat ),
                 XML_ht,             OString::number(static_cast<double>(mnHeight) / 20.0),
                 XML_hidden,         ToPsz( ::get_flag( mnFlags, EXC_ROW_HIDDEN ) ),
                 XML_customHeight,   ToPsz( ::get_flag( mnFlags, EXC_ROW_UNSYNCED ) ),
-                XML_outlineLevel,   OString::number(mnOutlineLevel),
+                XML_outlineLevel,   mnOutlineLevel,
                 XML_collapsed,      ToPsz( ::get_flag( mnFlags, EXC_ROW_COLLAPSED ) )
                 // OOXTODO: XML_thickTop,       bool
                 // OOXTODO: XML_thickBot,       bool
@@ -2679,6 +2721,11 @@ XclExpCellTable::XclExpCellTable( const XclExpRoot& rRoot ) :
                             GetRoot(), aXclPos, pPattern, nMergeBaseXFId, fValue != 0.0 );
                 }
 
+                // OOXML: collect adjacent number cells in one record
+                if( !xCell && (GetOutput() == EXC_OUTPUT_XML_2007) )
+                    xCell = new XclExpMultiNumberCell(
+                        GetRoot(), aXclPos, pPattern, nMergeBaseXFId, fValue );
+
                 // try to create an RK value (compressed floating-point number)
                 sal_Int32 nRkValue;
                 if( !xCell && XclTools::GetRKFromDouble( nRkValue, fValue ) )
@@ -976,7 +976,8 @@ void XclImpStream::RestorePosition( const XclImpStreamPos& rPos )
 
 bool XclImpStream::ReadNextRawRecHeader()
 {
-    bool bRet = checkSeek(mrStrm, mnNextRecPos) && (mnNextRecPos + 4 <= mnStreamSize);
+    // mnStreamSize is known, don't let checkSeek() query the end of the stream for every record
+    bool bRet = (mnNextRecPos + 4 <= mnStreamSize) && (mrStrm.Seek(mnNextRecPos) == mnNextRecPos);
     if (bRet)
     {
         mrStrm.ReadUInt16( mnRawRecId ).ReadUInt16( mnRawRecSize );
@@ -2634,7 +2634,7 @@ void ScHTMLTable::InsertNewCell( const ScHTMLSize& rSpanSize )
             maHMergedCells.push_back( aNewRange );
         /*  Insert horizontally merged ranges and single cells into
             maUsedCells, they will not be changed anymore. */
-        maUsedCells.Join( aNewRange );
+        maUsedCells.push_back( aNewRange );
     }
 
     // adjust table size
@@ -2779,18 +2779,34 @@ void ScHTMLTable::FillEmptyCells()
     for( ScHTMLTableIterator aIter( mxNestedTables.get() ); aIter.is(); ++aIter )
         aIter->FillEmptyCells();
 
-    // insert the final vertically merged ranges into maUsedCells
-    for ( size_t i = 0, nRanges = maVMergedCells.size(); i < nRanges; ++i )
-    {
-        ScRange & rRange = maVMergedCells[ i ];
-        maUsedCells.Join( rRange );
-    }
+    /*  Mark the used cells, including the final vertically merged ranges,
+        in a grid once, instead of searching the range lists for every cell
+        of the table. */
+    const size_t nCols = static_cast< size_t >( maSize.mnCols );
+    std::vector< bool > aUsedGrid( nCols * static_cast< size_t >( maSize.mnRows ), false );
+    auto lclMarkUsed = [&aUsedGrid, nCols, this]( const ScRange& rRange )
+    {
+        SCROW nEndRow = std::min< SCROW >( rRange.aEnd.Row(), maSize.mnRows - 1 );
+        SCCOL nEndCol = std::min< SCCOL >( rRange.aEnd.Col(), maSize.mnCols - 1 );
+        for( SCROW nRow = rRange.aStart.Row(); nRow <= nEndRow; ++nRow )
+            for( SCCOL nCol = rRange.aStart.Col(); nCol <= nEndCol; ++nCol )
+                aUsedGrid[ nRow * nCols + nCol ] = true;
+    };
+    for( size_t i = 0, nRanges = maUsedCells.size(); i < nRanges; ++i )
+        lclMarkUsed( maUsedCells[ i ] );
+    for( size_t i = 0, nRanges = maVMergedCells.size(); i < nRanges; ++i )
+    {
+        maUsedCells.push_back( maVMergedCells[ i ] );
+        lclMarkUsed( maVMergedCells[ i ] );
+    }
+    auto lclIsUsed = [&aUsedGrid, nCols]( const ScAddress& rAddr )
+    { return aUsedGrid[ rAddr.Row() * nCols + rAddr.Col() ]; };
 
     for( ScAddress aAddr; aAddr.Row() < maSize.mnRows; aAddr.IncRow() )
     {
         for( aAddr.SetCol( 0 ); aAddr.Col() < maSize.mnCols; aAddr.IncCol() )
         {
-            if( !maUsedCells.Find( aAddr ) )
+            if( !lclIsUsed( aAddr ) )
             {
                 // create a range for the lock list (used to calc. cell span)
                 ScRange aRange( aAddr );
@@ -2798,9 +2814,10 @@ void ScHTMLTable::FillEmptyCells()
                 {
                     aRange.aEnd.IncCol();
                 }
-                while( (aRange.aEnd.Col() < maSize.mnCols) && !maUsedCells.Find( aRange.aEnd ) );
+                while( (aRange.aEnd.Col() < maSize.mnCols) && !lclIsUsed( aRange.aEnd ) );
                 aRange.aEnd.IncCol( -1 );
-                maUsedCells.Join( aRange );
+                maUsedCells.push_back( aRange );
+                lclMarkUsed( aRange );
 
                 // insert a dummy entry
                 ScHTMLEntryPtr xEntry = CreateEntry();
@@ -21,26 +21,26 @@
 
 #include <sal/types.h>
 
+#include <unordered_map>
+
 class ScPatternAttr;
 
-constexpr sal_Int32 nPatternCacheSize = 16;
+/**
+ * Maps (xf id, number format id) pairs to the pattern already set up for
+ * them, so that every combination used on a sheet is only prepared once
+ * no matter how many distinct cell formats the sheet uses.
+ */
 class ScPatternCache
 {
-    struct Entry
-    {
-        sal_Int32 nXfId;
-        sal_Int32 nNumFmtId;
-        ScPatternAttr* pPattern;
+    std::unordered_map<sal_uInt64, ScPatternAttr*> maPatterns;
 
-        Entry();
-    };
-
-    Entry maEntries[nPatternCacheSize];
-    sal_Int32 nNextPos;
+    static sal_uInt64 makeKey(sal_Int32 nXfId, sal_Int32 nNumFmtId)
+    {
+        return (static_cast<sal_uInt64>(static_cast<sal_uInt32>(nXfId)) << 32)
+               | static_cast<sal_uInt32>(nNumFmtId);
+    }
 
 public:
-    ScPatternCache();
-
     ScPatternAttr* query(sal_Int32 nXfId, sal_Int32 nNumFmtId) const;
     void add(sal_Int32 nXfId, sal_Int32 nNumFmtId, ScPatternAttr* pPattern);
 };
@@ -206,6 +206,7 @@ private:
 class RichString
 {
 public:
+    ~RichString();
 
     /** Appends and returns an index of a portion object for a plain string (t element). */
     sal_Int32 importText(const AttributeList& rAttribs);
@@ -261,6 +262,12 @@ private:
     std::unique_ptr<PhoneticSettings> mxPhonSettings; /// Phonetic settings for this string.
     PhoneticVector      maPhonPortions; /// Phonetic text portions.
     bool mbPreserveSpace = false;
+
+    /// Result of the last conversion into an edit engine, cloned for further cells using this string.
+    std::unique_ptr<EditTextObject> mxConvertedText;
+    const ScEditEngineDefaulter* mpConvertedEngine = nullptr;
+    const oox::xls::Font* mpConvertedFont = nullptr;
+    bool mbConvertedSingleLine = false;
 };
 
 typedef std::shared_ptr< RichString > RichStringRef;
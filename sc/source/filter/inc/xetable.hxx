@@ -565,6 +565,31 @@ private:
     ScfInt32Vec         maRkValues;     /// The cell values.
 };
 
+/** Represents a run of cells with double values in OOXML export.
+
+    OOXML does not distinguish between RK and NUMBER records, so adjacent
+    number cells of a row are collected in one record instead of creating a
+    cell record per value. This class is never saved to a BIFF stream.
+ */
+class XclExpMultiNumberCell : public XclExpMultiCellBase
+{
+public:
+    explicit            XclExpMultiNumberCell( const XclExpRoot& rRoot, const XclAddress& rXclPos,
+                            const ScPatternAttr* pPattern, sal_uInt32 nForcedXFId,
+                            double fValue );
+
+    /** Tries to merge the contents of the passed cell to own data. */
+    virtual bool        TryMerge( const XclExpCellBase& rCell ) override;
+
+private:
+    /** Writes the remaining contents of the specified cell (without XF index). */
+    virtual void        WriteContents( XclExpStream& rStrm, sal_uInt16 nRelCol ) override;
+    virtual void        WriteXmlContents( XclExpXmlStream& rStrm, const XclAddress& rAddress, sal_uInt32 nXFId, sal_uInt16 nRelCol ) override;
+
+private:
+    std::vector< double > maValues;     /// The cell values.
+};
+
 // Rows and Columns
 
 class ScOutlineArray;
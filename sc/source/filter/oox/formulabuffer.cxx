@@ -63,14 +63,17 @@ public:
     {
         // Check if a token array is cached for this column.
         ColCacheType::iterator it = maCache.find(rPos.Col());
-        if (it == maCache.end())
-            return nullptr;
+        if (it != maCache.end() && isSameFormula(*it->second, rPos, rFormula))
+            return it->second.get();
 
-        Item& rCached = *it->second;
-        const ScTokenArray& rCode = *rCached.mpCell->GetCode();
-        OUString aPredicted = rCode.CreateString(maCxt, rPos);
-        if (rFormula == aPredicted)
-            return &rCached;
+        // Formulas are often filled to the right as well, so try the cell on the left.
+        if (rPos.Col() > 0)
+        {
+            ColCacheType::iterator itLeft = maCache.find(rPos.Col() - 1);
+            if (itLeft != maCache.end() && itLeft->second->mnRow == rPos.Row()
+                && isSameFormula(*itLeft->second, rPos, rFormula))
+                return itLeft->second.get();
+        }
 
         return nullptr;
     }
@@ -96,6 +99,13 @@ public:
     }
 
 private:
+    bool isSameFormula( const Item& rCached, const ScAddress& rPos, std::u16string_view rFormula )
+    {
+        const ScTokenArray& rCode = *rCached.mpCell->GetCode();
+        OUString aPredicted = rCode.CreateString(maCxt, rPos);
+        return rFormula == aPredicted;
+    }
+
     typedef std::unordered_map<SCCOL, std::unique_ptr<Item>> ColCacheType;
     ColCacheType maCache;
     sc::TokenStringContext maCxt;
@@ -268,8 +278,7 @@ void applyCellFormulas(
                 pCell->SetNeedNumberFormat(true);
 
             // Update the cache.
-            p->mnRow = aPos.Row();
-            p->mpCell = pCell;
+            rCache.store(aPos, pCell);
             continue;
         }
 
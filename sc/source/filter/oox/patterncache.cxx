@@ -19,34 +19,13 @@
 
 #include <patterncache.hxx>
 
-ScPatternCache::Entry::Entry()
-    : nXfId(-1)
-    , nNumFmtId(-1)
-    , pPattern(nullptr)
-{
-}
-
-ScPatternCache::ScPatternCache()
-    : nNextPos(0)
-{
-}
-
 ScPatternAttr* ScPatternCache::query(sal_Int32 nXfId, sal_Int32 nNumFmtId) const
 {
-    for (const auto& entry : maEntries)
-    {
-        if (entry.nXfId == nXfId && entry.nNumFmtId == nNumFmtId)
-            return entry.pPattern;
-    }
-
-    return nullptr;
+    auto it = maPatterns.find(makeKey(nXfId, nNumFmtId));
+    return it != maPatterns.end() ? it->second : nullptr;
 }
 
 void ScPatternCache::add(sal_Int32 nXfId, sal_Int32 nNumFmtId, ScPatternAttr* pPattern)
 {
-    Entry& rEntry = maEntries[nNextPos];
-    nNextPos = ((nNextPos + 1) % nPatternCacheSize);
-    rEntry.nXfId = nXfId;
-    rEntry.nNumFmtId = nNumFmtId;
-    rEntry.pPattern = pPattern;
+    maPatterns[makeKey(nXfId, nNumFmtId)] = pPattern;
 }
@@ -24,6 +24,7 @@
 #include <com/sun/star/text/XText.hpp>
 #include <rtl/ustrbuf.hxx>
 #include <editeng/editobj.hxx>
+#include <editeng/editstat.hxx>
 #include <osl/diagnose.h>
 #include <oox/helper/binaryinputstream.hxx>
 #include <oox/helper/attributelist.hxx>
@@ -293,6 +294,8 @@ void PhoneticPortionModelList::importPortions( SequenceInputStream& rStrm )
     }
 }
 
+RichString::~RichString() = default;
+
 sal_Int32 RichString::importText(const AttributeList& rAttribs)
 {
     setAttributes(rAttribs);
@@ -407,22 +410,34 @@ OUString RichString::getStringContent() const
 
 std::unique_ptr<EditTextObject> RichString::convert( ScEditEngineDefaulter& rEE, const oox::xls::Font* pFirstPortionFont )
 {
+    // fdo#84370 - diving into editeng is not thread safe.
+    SolarMutexGuard aGuard;
+
+    // A shared string is typically used by many cells with the same cell font, so the
+    // text object created for the previous cell can simply be cloned.
+    const bool bSingleLine(rEE.GetControlWord() & EEControlBits::SINGLELINE);
+    if (mxConvertedText && mpConvertedEngine == &rEE && mpConvertedFont == pFirstPortionFont
+        && mbConvertedSingleLine == bSingleLine)
+        return mxConvertedText->Clone();
+
     ESelection aSelection;
 
     OUString sString(getStringContent());
 
-    // fdo#84370 - diving into editeng is not thread safe.
-    SolarMutexGuard aGuard;
-
     rEE.SetTextCurrentDefaults(sString);
 
+    mpConvertedEngine = &rEE;
+    mpConvertedFont = pFirstPortionFont;
+    mbConvertedSingleLine = bSingleLine;
+
     for( auto& rTextPortion : maTextPortions )
     {
         rTextPortion.convert( rEE, aSelection, pFirstPortionFont );
         pFirstPortionFont = nullptr;
     }
 
-    return rEE.CreateTextObject();
+    mxConvertedText = rEE.CreateTextObject();
+    return mxConvertedText->Clone();
 }
 
 // private --------------------------------------------------------------------
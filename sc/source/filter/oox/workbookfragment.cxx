@@ -667,6 +667,12 @@ void WorkbookFragment::recalcFormulaCells()
 
     if (bHardRecalc)
         rDocSh.DoHardRecalc();
+    else if (nRecalcMode == RECALC_SELECTIVE)
+    {
+        // Trust the cached results, except of volatile and external ones
+        // and anything depending on them.
+        rDoc.SetDirtySelectiveAfterLoad();
+    }
     else
     {
         getDocImport().broadcastRecalcAfterImport();
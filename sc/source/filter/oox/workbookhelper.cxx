@@ -40,6 +40,7 @@
 #include <oox/ole/vbaproject.hxx>
 #include <oox/token/properties.hxx>
 #include <tools/mapunit.hxx>
+#include <vcl/svapp.hxx>
 #include <addressconverter.hxx>
 #include <connectionsbuffer.hxx>
 #include <defnamesbuffer.hxx>
@@ -661,7 +662,21 @@ void WorkbookGlobals::finalize()
     mpDoc->UnlockAdjustHeight();
     // check settings (potentially asking the user if optimal row height should be run now)
     if (mpDocShell->GetRecalcRowHeightsMode()) // default is to always update
-        mpDocShell->UpdateAllRowHeights(/*bOnlyUsedRows=*/true);
+    {
+        // Interactively only the visible sheet is needed for the first paint, the
+        // other sheets are updated when they are shown, printed or saved, see
+        // ScDocShell::UpdatePendingRowHeights().
+        const SCTAB nTabCount = mpDoc->GetTableCount();
+        const SCTAB nVisibleTab = getViewSettings().getActiveCalcSheet();
+        if (!Application::IsHeadlessModeEnabled() && nTabCount > 1 && nVisibleTab < nTabCount)
+        {
+            for (SCTAB nTab = 0; nTab < nTabCount; ++nTab)
+                mpDoc->SetPendingRowHeights(nTab, true);
+            mpDocShell->UpdatePendingRowHeights(nVisibleTab);
+        }
+        else
+            mpDocShell->UpdateAllRowHeights(/*bOnlyUsedRows=*/true);
+    }
 
     // #i76026# enable Undo after loading the document
     mpDoc->EnableUndo(true);
@@ -785,6 +785,9 @@ sal_Int32 ScFormatRangeStyles::GetStyleNameIndex(const sal_Int32 nTable, const s
     {
         if (aItr->aRangeAddress.Sheet > nTable)
             break;
+        // sorted by start row, none of the remaining ranges can contain the cell (or be removed)
+        if (aItr->aRangeAddress.StartRow > nRow)
+            break;
         if ((aItr->aRangeAddress.StartColumn <= nColumn) &&
             (aItr->aRangeAddress.EndColumn >= nColumn) &&
             (aItr->aRangeAddress.StartRow <= nRow) &&
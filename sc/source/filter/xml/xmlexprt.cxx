@@ -1740,7 +1740,9 @@ static bool lcl_CopyStreamElement( const uno::Reference< io::XInputStream >& xIn
                             const uno::Reference< io::XOutputStream >& xOutput,
                             sal_Int64 nCount )
 {
-    const sal_Int32 nBufSize = 16*1024;
+    // unchanged sheets of big documents are megabytes of XML, each block
+    // is a round trip through the inflater and the package output stream
+    const sal_Int32 nBufSize = 256*1024;
     uno::Sequence<sal_Int8> aSequence(nBufSize);
 
     sal_Int64 nRemaining = nCount;
@@ -1776,8 +1778,8 @@ static bool lcl_CopyStreamElement( const uno::Reference< io::XInputStream >& xIn
         {
             if ( nRead > 0 )
             {
-                uno::Sequence<sal_Int8> aTempBuf( aSequence.getConstArray(), nRead );
-                xOutput->writeBytes( aTempBuf );
+                aSequence.realloc( nRead );
+                xOutput->writeBytes( aSequence );
             }
             nRemaining = 0;
         }
@@ -1791,7 +1793,7 @@ static void lcl_SkipBytesInBlocks( const uno::Reference< io::XInputStream >& xIn
     // For now, split into several calls to avoid allocating a large buffer.
     // Later, skipBytes should be changed.
 
-    const sal_Int64 nMaxSize = 32*1024;
+    const sal_Int64 nMaxSize = 256*1024;
 
     if ( nBytesToSkip > 0 )
     {
@@ -2286,7 +2288,12 @@ void ScXMLExport::collectAutoStyles()
                     if (pDoc->IsStreamValid(nTab))
                         pDoc->InterpretDirtyCells(ScRange(0, 0, nTab, pDoc->MaxCol(), pDoc->MaxRow(), nTab));
 
+                // The entries were collected in document order, and getByIndex creates a new
+                // sheet object each time, so keep the one of the previous entry.
+
                 // stored cell styles
+                sal_Int32 nPrevTable = -1;
+                uno::Reference <sheet::XSpreadsheet> xTable;
                 const std::vector<ScCellStyleEntry>& rCellEntries = pSheetData->GetCellStyles();
                 for (const auto& rCellEntry : rCellEntries)
                 {
@@ -2295,7 +2302,11 @@ void ScXMLExport::collectAutoStyles()
                     bool bCopySheet = pDoc->IsStreamValid( static_cast<SCTAB>(nTable) );
                     if (bCopySheet)
                     {
-                        uno::Reference <sheet::XSpreadsheet> xTable(xIndex->getByIndex(nTable), uno::UNO_QUERY);
+                        if (nTable != nPrevTable)
+                        {
+                            xTable.set(xIndex->getByIndex(nTable), uno::UNO_QUERY);
+                            nPrevTable = nTable;
+                        }
                         uno::Reference <beans::XPropertySet> xProperties(
                             xTable->getCellByPosition( aPos.Col(), aPos.Row() ), uno::UNO_QUERY );
 
@@ -2304,6 +2315,8 @@ void ScXMLExport::collectAutoStyles()
                 }
 
                 // stored column styles
+                nPrevTable = -1;
+                uno::Reference<table::XTableColumns> xTableColumns;
                 const std::vector<ScCellStyleEntry>& rColumnEntries = pSheetData->GetColumnStyles();
                 for (const auto& rColumnEntry : rColumnEntries)
                 {
@@ -2312,8 +2325,12 @@ void ScXMLExport::collectAutoStyles()
                     bool bCopySheet = pDoc->IsStreamValid( static_cast<SCTAB>(nTable) );
                     if (bCopySheet)
                     {
-                        uno::Reference<table::XColumnRowRange> xColumnRowRange(xIndex->getByIndex(nTable), uno::UNO_QUERY);
-                        uno::Reference<table::XTableColumns> xTableColumns(xColumnRowRange->getColumns());
+                        if (nTable != nPrevTable)
+                        {
+                            uno::Reference<table::XColumnRowRange> xColumnRowRange(xIndex->getByIndex(nTable), uno::UNO_QUERY);
+                            xTableColumns = xColumnRowRange->getColumns();
+                            nPrevTable = nTable;
+                        }
                         uno::Reference<beans::XPropertySet> xColumnProperties(xTableColumns->getByIndex( aPos.Col() ), uno::UNO_QUERY);
 
                         sal_Int32 nIndex(-1);
@@ -2323,6 +2340,8 @@ void ScXMLExport::collectAutoStyles()
                 }
 
                 // stored row styles
+                nPrevTable = -1;
+                uno::Reference<table::XTableRows> xTableRows;
                 const std::vector<ScCellStyleEntry>& rRowEntries = pSheetData->GetRowStyles();
                 for (const auto& rRowEntry : rRowEntries)
                 {
@@ -2331,8 +2350,12 @@ void ScXMLExport::collectAutoStyles()
                     bool bCopySheet = pDoc->IsStreamValid( static_cast<SCTAB>(nTable) );
                     if (bCopySheet)
                     {
-                        uno::Reference<table::XColumnRowRange> xColumnRowRange(xIndex->getByIndex(nTable), uno::UNO_QUERY);
-                        uno::Reference<table::XTableRows> xTableRows(xColumnRowRange->getRows());
+                        if (nTable != nPrevTable)
+                        {
+                            uno::Reference<table::XColumnRowRange> xColumnRowRange(xIndex->getByIndex(nTable), uno::UNO_QUERY);
+                            xTableRows = xColumnRowRange->getRows();
+                            nPrevTable = nTable;
+                        }
                         uno::Reference<beans::XPropertySet> xRowProperties(xTableRows->getByIndex( aPos.Row() ), uno::UNO_QUERY);
 
                         sal_Int32 nIndex(-1);
@@ -2474,6 +2497,8 @@ void ScXMLExport::collectAutoStyles()
                 // refer to the same cell, so cache it.
                 ScAddress aPrevPos;
                 uno::Reference<beans::XPropertySet> xPrevCursorProp;
+                nPrevTable = -1;
+                uno::Reference<table::XCellRange> xCellRange;
                 const std::vector<ScTextStyleEntry>& rTextEntries = pSheetData->GetTextStyles();
                 for (const auto& rTextEntry : rTextEntries)
                 {
@@ -2484,14 +2509,17 @@ void ScXMLExport::collectAutoStyles()
                         continue;
 
                     //! separate method AddStyleFromText needed?
-                    //! cache sheet object
 
                     uno::Reference<beans::XPropertySet> xCursorProp;
                     if (xPrevCursorProp && aPrevPos == aPos)
                         xCursorProp = xPrevCursorProp;
                     else
                     {
-                        uno::Reference<table::XCellRange> xCellRange(xIndex->getByIndex(nTable), uno::UNO_QUERY);
+                        if (nTable != nPrevTable)
+                        {
+                            xCellRange.set(xIndex->getByIndex(nTable), uno::UNO_QUERY);
+                            nPrevTable = nTable;
+                        }
                         uno::Reference<text::XSimpleText> xCellText(xCellRange->getCellByPosition(aPos.Col(), aPos.Row()), uno::UNO_QUERY);
                         xCursorProp.set(xCellText->createTextCursor(), uno::UNO_QUERY);
                     }
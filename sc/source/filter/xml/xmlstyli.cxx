@@ -433,6 +433,7 @@ XMLTableStyleContext::XMLTableStyleContext( ScXMLImport& rImport,
     nNumberFormat(-1),
     nLastSheet(-1),
     bParentSet(false),
+    bNumberFormatSet(false),
     mpCondFormat(nullptr),
     mbDeleteCondFormat(true)
 {
@@ -535,9 +536,17 @@ void XMLTableStyleContext::FillPropertySet(
                 AddProperty(CTF_SC_CELLSTYLE, uno::Any(GetImport().GetStyleDisplayName( XmlStyleFamily::TABLE_CELL, GetParentName() )));
                 bParentSet = true;
             }
-            sal_Int32 nNumFmt = GetNumberFormat();
-            if (nNumFmt >= 0)
-                AddProperty(CTF_SC_NUMBERFORMAT, uno::Any(nNumFmt));
+            // the style is applied once per run of cells using it, only add the
+            // resolved number format the first time instead of growing the list
+            if (!bNumberFormatSet)
+            {
+                sal_Int32 nNumFmt = GetNumberFormat();
+                if (nNumFmt >= 0)
+                {
+                    AddProperty(CTF_SC_NUMBERFORMAT, uno::Any(nNumFmt));
+                    bNumberFormatSet = true;
+                }
+            }
         }
         else if (GetFamily() == XmlStyleFamily::TABLE_TABLE)
         {
@@ -74,6 +74,7 @@ class XMLTableStyleContext : public XMLPropStyleContext
     sal_Int32                   nNumberFormat;
     SCTAB                       nLastSheet;
     bool                        bParentSet;
+    bool                        bNumberFormatSet;
     ScConditionalFormat*        mpCondFormat;
     bool                        mbDeleteCondFormat;
 
@@ -1941,8 +1941,9 @@ IMPL_LINK_NOARG(ScModule, IdleHandler, Timer *, void)
         sc::DocumentLinkManager& rLinkMgr = rDoc.GetDocLinkManager();
         bool bLinks = rLinkMgr.idleCheckLinks();
         bool bWidth = rDoc.IdleCalcTextWidth();
+        bool bRecalc = pDocSh->IdleHardRecalc();
 
-        bMore = bLinks || bWidth; // Still something at all?
+        bMore = bLinks || bWidth || bRecalc; // Still something at all?
 
         // While calculating a Basic formula, a paint event may have occurred,
         // so check the bNeedsRepaint flags for this document's views
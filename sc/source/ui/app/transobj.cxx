@@ -275,6 +275,14 @@ static ScRange lcl_reduceBlock(const ScDocument& rDoc, ScRange aReducedBlock, bo
     return aReducedBlock;
 }
 
+const ScRange& ScTransferObj::GetReducedBlock(bool bIncludeVisual)
+{
+    std::optional<ScRange>& rReduced = bIncludeVisual ? m_oReducedVisualBlock : m_oReducedBlock;
+    if (!rReduced)
+        rReduced = lcl_reduceBlock(*m_pDoc, m_aBlock, bIncludeVisual);
+    return *rReduced;
+}
+
 bool ScTransferObj::GetData( const datatransfer::DataFlavor& rFlavor, const OUString& /*rDestDoc*/ )
 {
     SotClipboardFormatId nFormat = SotExchange::GetFormat( rFlavor );
@@ -295,7 +303,7 @@ bool ScTransferObj::GetData( const datatransfer::DataFlavor& rFlavor, const OUSt
                                      nFormat == SotClipboardFormatId::PNG);
 
         if (bReduceBlockFormat)
-            aReducedBlock = lcl_reduceBlock(*m_pDoc, m_aBlock, bIncludeVisual);
+            aReducedBlock = GetReducedBlock(bIncludeVisual);
 
         if ( nFormat == SotClipboardFormatId::LINKSRCDESCRIPTOR || nFormat == SotClipboardFormatId::OBJECTDESCRIPTOR )
         {
@@ -579,7 +587,7 @@ bool ScTransferObj::WriteObject( SvStream& rOStm, void* pUserObject, sal_uInt32
 
 sal_Bool SAL_CALL ScTransferObj::isComplex()
 {
-    ScRange aReduced = lcl_reduceBlock(*m_pDoc, m_aBlock);
+    const ScRange& aReduced = GetReducedBlock(false);
     size_t nCells = (aReduced.aEnd.Col() - aReduced.aStart.Col() + 1) *
                     (aReduced.aEnd.Row() - aReduced.aStart.Row() + 1) *
                     (aReduced.aEnd.Tab() - aReduced.aStart.Tab() + 1);
@@ -17,7 +17,9 @@
 #include <sfx2/viewfrm.hxx>
 #include <tools/stream.hxx>
 #include <vcl/svapp.hxx>
+#include <dbdocfun.hxx>
 #include <docsh.hxx>
+#include <dpobject.hxx>
 #include <tabvwsh.hxx>
 #include <viewdata.hxx>
 #include <stringutil.hxx>
@@ -424,10 +426,37 @@ void DataStream::Refresh()
 
     fTimes[ DebugTime::Recalc ] = getNow() - fStart;
 
+    if (meMove == RANGE_DOWN)
+        RefreshPivotTables();
+
     mfLastRefreshTime = getNow();
     mnLinesSinceRefresh = 0;
 }
 
+void DataStream::RefreshPivotTables()
+{
+    // While the range is filled downwards rows are only appended, so the
+    // pivot caches of the source ranges need to read just the new rows.
+    ScDPCollection* pDPs = mpDocShell->GetDocument().GetDPCollection();
+    if (!pDPs)
+        return;
+
+    const ScRange aStreamRange(maStartRange.aStart, maEndRange.aEnd);
+    ScDPCollection::SheetCaches& rCaches = pDPs->GetSheetCaches();
+    const std::vector<ScRange> aRanges = rCaches.getAllRanges();
+    ScDBDocFunc aFunc(*mpDocShell);
+    for (const ScRange& rRange : aRanges)
+    {
+        if (!rRange.IsValid() || !rRange.Intersects(aStreamRange))
+            continue;
+
+        o3tl::sorted_vector<ScDPObject*> aRefs;
+        rCaches.updateCache(rRange, aRefs, true);
+        for (ScDPObject* pObj : aRefs)
+            aFunc.UpdatePivotTable(*pObj, false, true);
+    }
+}
+
 void DataStream::MoveData()
 {
     switch (meMove)
@@ -27,6 +27,7 @@
 #include <svx/dataaccessdescriptor.hxx>
 #include <sfx2/viewfrm.hxx>
 #include <sal/log.hxx>
+#include <svl/intitem.hxx>
 #include <osl/diagnose.h>
 #include <comphelper/diagnose_ex.hxx>
 
@@ -43,6 +44,7 @@
 #include <com/sun/star/frame/FrameSearchFlag.hpp>
 #include <com/sun/star/view/XSelectionSupplier.hpp>
 
+#include <scitems.hxx>
 #include <dbdocfun.hxx>
 #include <docsh.hxx>
 #include <globstr.hrc>
@@ -334,7 +336,7 @@ bool ScDBDocFunc::DoImport( SCTAB nTab, const ScImportParam& rParam,
                             for (tools::Long i=0; i<nColCount; i++)
                             {
                                 ScDatabaseDocUtil::PutData( *pImportDoc, nCol, nRow, nTab,
-                                                xRow, i+1, pTypeArr[i], pCurrArr[i] );
+                                                xRow, i+1, pTypeArr[i], pCurrArr[i], nullptr, false );
                                 ++nCol;
                             }
                             nEndRow = nRow;
@@ -356,6 +358,24 @@ bool ScDBDocFunc::DoImport( SCTAB nTab, const ScImportParam& rParam,
                     }
                 }
 
+                //  number formats per column instead of per imported cell
+                if ( nEndRow > rParam.nRow1 )
+                {
+                    for (tools::Long i=0; i<nColCount; i++)
+                    {
+                        sal_uInt32 nFormat = ScDatabaseDocUtil::GetNumberFormat(
+                                                *pImportDoc, pTypeArr[i], pCurrArr[i] );
+                        if ( nFormat )
+                        {
+                            ScPatternAttr aPattern(pImportDoc->getCellAttributeHelper());
+                            aPattern.ItemSetPut(SfxUInt32Item(ATTR_VALUE_FORMAT, nFormat));
+                            SCCOL nFormatCol = static_cast<SCCOL>( rParam.nCol1 + i );
+                            pImportDoc->ApplyPatternAreaTab( nFormatCol, rParam.nRow1 + 1,
+                                                nFormatCol, nEndRow, nTab, aPattern );
+                        }
+                    }
+                }
+
                 bSuccess = true;
             }
 
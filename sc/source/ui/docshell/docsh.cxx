@@ -149,6 +149,7 @@
 #include <DocumentModelAccessor.hxx>
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <comphelper/lok.hxx>
@@ -623,6 +624,12 @@ bool ScDocShell::LoadXML( SfxMedium* pLoadMedium, const css::uno::Reference< css
 
     if (bHardRecalc)
         DoHardRecalc();
+    else if (nRecalcMode == RECALC_SELECTIVE)
+    {
+        // Trust the cached results, except of volatile and external ones
+        // and anything depending on them.
+        m_pDocument->SetDirtySelectiveAfterLoad();
+    }
     else
     {
         // still need to recalc volatile formula cells.
@@ -1230,6 +1237,58 @@ static void lcl_parseHtmlFilterOption(const OUString& rOption, LanguageType& rLa
         rScientificConvert = static_cast<bool>(aTokens[2].toInt32());
 }
 
+namespace {
+
+/**
+ * A local file mapped into memory for reading, so that lines of text are
+ * converted directly from the mapped data instead of being copied through
+ * the buffers of a file stream first, see ReadCsvLine().
+ */
+class ScMappedFile
+{
+    oslFileHandle mpHandle = nullptr;
+    void* mpAddress = nullptr;
+    sal_uInt64 mnSize = 0;
+    std::optional<SvMemoryStream> moStream;
+
+public:
+    explicit ScMappedFile( const OUString& rSystemPath )
+    {
+        OUString aURL;
+        if (osl::FileBase::getFileURLFromSystemPath(rSystemPath, aURL) != osl::FileBase::E_None)
+            return;
+        if (osl_openFile(aURL.pData, &mpHandle, osl_File_OpenFlag_Read) != osl_File_E_None)
+        {
+            mpHandle = nullptr;
+            return;
+        }
+        if (osl_getFileSize(mpHandle, &mnSize) != osl_File_E_None || !mnSize
+            || osl_mapFile(mpHandle, &mpAddress, mnSize, 0, 0) != osl_File_E_None)
+        {
+            mpAddress = nullptr;
+            return;
+        }
+        moStream.emplace(mpAddress, mnSize, StreamMode::READ);
+    }
+
+    ~ScMappedFile()
+    {
+        moStream.reset();
+        if (mpAddress)
+            osl_unmapMappedFile(mpHandle, mpAddress, mnSize);
+        if (mpHandle)
+            osl_closeFile(mpHandle);
+    }
+
+    ScMappedFile( const ScMappedFile& ) = delete;
+    ScMappedFile& operator= ( const ScMappedFile& ) = delete;
+
+    /** The stream on the mapped data, or nullptr if the file could not be mapped. */
+    SvStream* GetStream() { return moStream ? &*moStream : nullptr; }
+};
+
+}
+
 void ScDocShell::AddDelayedInfobarEntry(const OUString& sId, const OUString& sPrimaryMessage,
                                         const OUString& sSecondaryMessage, InfobarType aInfobarType,
                                         bool bShowCloseButton)
@@ -1378,6 +1437,15 @@ bool ScDocShell::ConvertFrom( SfxMedium& rMedium )
                 aImpEx.SetExtOptions( aOptions );
 
                 SvStream* pInStream = rMedium.GetInStream();
+                // Read local files through a memory mapping, large CSV files
+                // are imported line by line straight from the mapped data.
+                std::optional<ScMappedFile> oMappedFile;
+                if (pInStream && !rMedium.GetPhysicalName().isEmpty())
+                {
+                    oMappedFile.emplace(rMedium.GetPhysicalName());
+                    if (SvStream* pMappedStream = oMappedFile->GetStream())
+                        pInStream = pMappedStream;
+                }
                 if (pInStream)
                 {
                     pInStream->SetStreamEncoding( aOptions.GetCharSet() );
@@ -1815,6 +1883,8 @@ ScDocShell::PrepareSaveGuard::PrepareSaveGuard( ScDocShell& rDocShell )
     }
     if (mrDocShell.GetCreateMode()== SfxObjectCreateMode::STANDARD)
         mrDocShell.SfxObjectShell::SetVisArea( tools::Rectangle() );   // "Normally" worked on => no VisArea.
+    // Sheets not shown since loading may still lack their optimal row heights.
+    mrDocShell.UpdatePendingRowHeights( mrDocShell.m_pDocument->GetTableCount() - 1, true );
 }
 
 ScDocShell::PrepareSaveGuard::~PrepareSaveGuard()
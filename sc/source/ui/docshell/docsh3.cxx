@@ -196,6 +196,28 @@ void ScDocShell::PostPaint( const ScRangeList& rRanges, PaintPartFlags nPart, sa
 
     Broadcast(ScPaintHint(aPaintRanges.Combine(), nPart, nMaxWidthAffectedHint));
 
+    // LOK: sheets that are not shown in any view don't send tile
+    // invalidations, drop all their painted tiles instead
+    if (comphelper::LibreOfficeKit::isActive())
+    {
+        if (ScModelObj* pModel = GetModel())
+        {
+            for (auto nTab : aTabsInvalidated)
+            {
+                bool bShown = false;
+                for (SfxViewShell* pViewShell = SfxViewShell::GetFirst(); pViewShell && !bShown;
+                        pViewShell = SfxViewShell::GetNext(*pViewShell))
+                {
+                    auto pTabViewShell = dynamic_cast<ScTabViewShell*>(pViewShell);
+                    bShown = pTabViewShell && pTabViewShell->GetViewData().GetDocShell() == this
+                             && pTabViewShell->GetViewData().CurrentTabForData() == nTab;
+                }
+                if (!bShown)
+                    pModel->invalidateTileCache(nTab, nullptr);
+            }
+        }
+    }
+
     // LOK: we are supposed to update the row / columns headers (and actually
     // the document size too - cell size affects that, obviously)
     if ((nPart & (PaintPartFlags::Top | PaintPartFlags::Left)) && comphelper::LibreOfficeKit::isActive())
@@ -488,7 +488,10 @@ void ScDocShell::Execute( SfxRequest& rReq )
             rReq.Done();
             break;
         case FID_HARD_RECALC:
-            DoHardRecalc();
+            if (rReq.IsAPI())
+                DoHardRecalc();
+            else
+                DoIdleHardRecalc();
             rReq.Done();
             break;
         case SID_UPDATETABLINKS:
@@ -1889,6 +1892,8 @@ void ScDocShell::DoHardRecalc()
         SAL_WARN("sc","ScDocShell::DoHardRecalc tries re-entering while in Recalc; probably Forms->BASIC->Dispatcher.");
         return;
     }
+    // A hard recalc in idle is superseded.
+    m_pDocument->CancelIdleHardRecalc();
     auto start = std::chrono::steady_clock::now();
     ScDocShellRecalcGuard aGuard(*m_pDocument);
     weld::WaitObject aWaitObj( GetActiveDialogParent() );
@@ -1899,7 +1904,80 @@ void ScDocShell::DoHardRecalc()
         pSh->UpdateInputHandler();
     }
     m_pDocument->CalcAll();
+    HardRecalcFinished();
+
+    PostPaintGridAll();
+    auto end = std::chrono::steady_clock::now();
+    SAL_INFO("sc.timing", "ScDocShell::DoHardRecalc(): took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms");
+}
+
+void ScDocShell::DoIdleHardRecalc()
+{
+    // Below this amount of formula code a hard recalc doesn't take long
+    // enough to be worth the chunking.
+    constexpr sal_uInt64 nMinIdleRecalcCodeCount = 500000;
+
+    if (m_pDocument->IsInDocShellRecalc())
+    {
+        SAL_WARN("sc","ScDocShell::DoIdleHardRecalc tries re-entering while in Recalc");
+        return;
+    }
+    if (!m_pDocument->GetAutoCalc() || m_pDocument->GetCodeCount() < nMinIdleRecalcCodeCount)
+    {
+        DoHardRecalc();
+        return;
+    }
+
+    ScDocShellRecalcGuard aGuard(*m_pDocument);
+    ScTabViewShell* pSh = GetBestViewShell();
+    if ( pSh )
+    {
+        ScTabView::UpdateInputLine();     // InputEnterHandler
+        pSh->UpdateInputHandler();
+    }
+    m_pDocument->StartIdleHardRecalc();
+
+    // Calculate the visible cells first, the rest follows in idle.
+    if ( pSh )
+        pSh->InterpretVisible();
+    PostPaintGridAll();
+
+    ScModule::get()->EnsureIdleUpdate();
+}
+
+bool ScDocShell::IdleHardRecalc()
+{
+    if (!m_pDocument->IsIdleHardRecalc())
+        return false;
+    if (m_pDocument->IsInDocShellRecalc())
+        return true;
+
+    ScRangeList aCalculated;
+    bool bMore;
+    {
+        ScDocShellRecalcGuard aGuard(*m_pDocument);
+        bMore = m_pDocument->IdleHardRecalc(aCalculated);
+    }
+    if (!aCalculated.empty())
+        PostPaint(aCalculated, PaintPartFlags::Grid);
+    if (!bMore)
+        HardRecalcFinished();
+    return bMore;
+}
+
+void ScDocShell::CancelIdleHardRecalc()
+{
+    if (!m_pDocument->IsIdleHardRecalc())
+        return;
+
+    m_pDocument->CancelIdleHardRecalc();
+    HardRecalcFinished();
+}
+
+void ScDocShell::HardRecalcFinished()
+{
     GetDocFunc().DetectiveRefresh();    // creates own Undo
+    ScTabViewShell* pSh = GetBestViewShell();
     if ( pSh )
         pSh->UpdateCharts(true);
 
@@ -1919,10 +1997,6 @@ void ScDocShell::DoHardRecalc()
     // (somewhat consistent with charts)
     for (SCTAB nTab=0; nTab<nTabCount; nTab++)
         m_pDocument->SetStreamValid(nTab, false);
-
-    PostPaintGridAll();
-    auto end = std::chrono::steady_clock::now();
-    SAL_INFO("sc.timing", "ScDocShell::DoHardRecalc(): took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms");
 }
 
 void ScDocShell::DoAutoStyle( const ScRange& rRange, const OUString& rStyle )
@@ -18,6 +18,7 @@
  */
 
 #include <comphelper/processfactory.hxx>
+#include <comphelper/threadpool.hxx>
 #include <i18nlangtag/languagetag.hxx>
 #include <i18nutil/unicode.hxx>
 #include <sot/formats.hxx>
@@ -70,7 +71,9 @@
 #include <sax/tools/converter.hxx>
 
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 #include <unicode/uchar.h>
 
@@ -1495,6 +1498,160 @@ static OUString lcl_GetFixed( const OUString& rLine, sal_Int32 nStart, sal_Int32
     }
 }
 
+namespace {
+
+/** One field of a CSV line as scanned by ScanNextFieldFromString(). */
+struct CsvField
+{
+    OUString maText;
+    bool mbQuoted = false;
+    bool mbOverflow = false;
+};
+
+struct CsvLine
+{
+    OUString maText;
+    sal_uInt64 mnEndPos = 0;        ///< stream position after the line
+    std::vector<CsvField> maFields;
+};
+
+/**
+ * Reads lines with separated fields ahead in batches and splits them into
+ * fields on the thread pool, while the caller converts the fields of one line
+ * after the other into cells. Only splitting the lines is independent of the
+ * document, the conversion uses the document's number formatter, edit engine
+ * and attributes and stays on the calling thread.
+ */
+class CsvLineReader
+{
+    SvStream& mrStrm;
+    OUString& mrSeps;
+    sal_Unicode mcStr;
+    sal_Unicode& mrcDetectSep;
+    bool mbMerge;
+    bool mbRemoveSpace;
+    bool mbNullTreatment;
+    bool mbEnd;
+    sal_uInt64 mnBatchStartPos;
+    size_t mnNext;
+    std::vector<CsvLine> maLines;
+
+    void readBatch();
+
+public:
+    CsvLineReader( SvStream& rStrm, OUString& rSeps, sal_Unicode cStr, sal_Unicode& rcDetectSep,
+                   bool bMerge, bool bRemoveSpace, bool bNullTreatment ) :
+        mrStrm(rStrm), mrSeps(rSeps), mcStr(cStr), mrcDetectSep(rcDetectSep), mbMerge(bMerge),
+        mbRemoveSpace(bRemoveSpace), mbNullTreatment(bNullTreatment), mbEnd(false),
+        mnBatchStartPos(rStrm.Tell()), mnNext(0) {}
+
+    /** The next line, or nullptr at the end of the stream. */
+    const CsvLine* next();
+
+    /** Set the stream position behind the last line returned by next(). */
+    void rewind();
+
+    /** Split the lines [nStart,nEnd) of the current batch, called from worker threads. */
+    void split( size_t nStart, size_t nEnd );
+};
+
+class SplitCsvLinesTask : public comphelper::ThreadTask
+{
+    CsvLineReader& mrReader;
+    size_t mnStart;
+    size_t mnEnd;
+
+public:
+    SplitCsvLinesTask( const std::shared_ptr<comphelper::ThreadTaskTag>& rTag, CsvLineReader& rReader,
+                       size_t nStart, size_t nEnd ) :
+        comphelper::ThreadTask(rTag), mrReader(rReader), mnStart(nStart), mnEnd(nEnd) {}
+
+    virtual void doWork() override
+    {
+        mrReader.split(mnStart, mnEnd);
+    }
+};
+
+const CsvLine* CsvLineReader::next()
+{
+    if (mnNext == maLines.size())
+    {
+        if (mbEnd)
+            return nullptr;
+        readBatch();
+        if (maLines.empty())
+            return nullptr;
+    }
+    return &maLines[mnNext++];
+}
+
+void CsvLineReader::rewind()
+{
+    if (mnNext < maLines.size())
+        mrStrm.Seek(mnNext ? maLines[mnNext - 1].mnEndPos : mnBatchStartPos);
+}
+
+void CsvLineReader::split( size_t nStart, size_t nEnd )
+{
+    for (size_t i = nStart; i < nEnd; ++i)
+    {
+        CsvLine& rLine = maLines[i];
+        if (mbNullTreatment)
+            ScImportExport::EmbeddedNullTreatment(rLine.maText);
+
+        const sal_Unicode* p = rLine.maText.getStr();
+        while (*p)
+        {
+            CsvField& rField = rLine.maFields.emplace_back();
+            p = ScImportExport::ScanNextFieldFromString( p, rField.maText, mcStr, mrSeps.getStr(),
+                    mbMerge, rField.mbQuoted, rField.mbOverflow, mbRemoveSpace );
+            // some dodgy CSVs have a trailing linefeed in each token, which will
+            // make the code think that we have a multi-line field, which will slow things down a lot.
+            if (rField.maText.endsWith("\n"))
+                rField.maText = rField.maText.copy(0, rField.maText.getLength() - 1);
+        }
+    }
+}
+
+void CsvLineReader::readBatch()
+{
+    constexpr size_t nBatchLines = 8192;
+    constexpr size_t nMinLinesForThreads = 1024;
+
+    mnBatchStartPos = mrStrm.Tell();
+    mnNext = 0;
+    maLines.clear();
+    while (maLines.size() < nBatchLines)
+    {
+        OUString aLine = ReadCsvLine(mrStrm, true, mrSeps, mcStr, mrcDetectSep);
+        if (mrStrm.eof() && aLine.isEmpty())
+        {
+            mbEnd = true;
+            break;
+        }
+        CsvLine& rLine = maLines.emplace_back();
+        rLine.maText = std::move(aLine);
+        rLine.mnEndPos = mrStrm.Tell();
+    }
+
+    comphelper::ThreadPool& rThreadPool = comphelper::ThreadPool::getSharedOptimalPool();
+    const size_t nThreadCount = rThreadPool.getWorkerCount();
+    if (nThreadCount < 2 || maLines.size() < nMinLinesForThreads)
+    {
+        split(0, maLines.size());
+        return;
+    }
+
+    std::shared_ptr<comphelper::ThreadTaskTag> pTag = comphelper::ThreadPool::createThreadTaskTag();
+    const size_t nChunk = (maLines.size() + nThreadCount - 1) / nThreadCount;
+    for (size_t nStart = 0; nStart < maLines.size(); nStart += nChunk)
+        rThreadPool.pushTask(std::make_unique<SplitCsvLinesTask>(
+            pTag, *this, nStart, std::min(nStart + nChunk, maLines.size())));
+    rThreadPool.waitUntilDone(pTag);
+}
+
+}
+
 bool ScImportExport::ExtText2Doc( SvStream& rStrm )
 {
     if (!pExtOptions)
@@ -1516,7 +1673,7 @@ bool ScImportExport::ExtText2Doc( SvStream& rStrm )
 
     bool    bFixed              = pExtOptions->IsFixedLen();
     OUString aSeps              = pExtOptions->GetFieldSeps();  // Need non-const for ReadCsvLine(),
-    const sal_Unicode* pSeps    = aSeps.getStr();               // but it will be const anyway (asserted below).
+                                                                // but it will be const anyway.
     bool    bMerge              = pExtOptions->IsMergeSeps();
     bool    bRemoveSpace        = pExtOptions->IsRemoveSpace();
     sal_uInt16  nInfoCount      = pExtOptions->GetInfoCount();
@@ -1584,13 +1741,26 @@ bool ScImportExport::ExtText2Doc( SvStream& rStrm )
     do
     {
         const SCCOL nLastCol = nEndCol; // tdf#129701 preserve value of nEndCol
+        // Separated fields are split ahead, see CsvLineReader.
+        std::optional<CsvLineReader> oReader;
+        if (!bFixed)
+            oReader.emplace(rStrm, aSeps, cStr, cDetectSep, bMerge, bRemoveSpace, !bDetermineRange);
         for( ;; )
         {
-            aLine = ReadCsvLine(rStrm, !bFixed, aSeps, cStr, cDetectSep);
-            if ( rStrm.eof() && aLine.isEmpty() )
-                break;
-
-            assert(pSeps == aSeps.getStr());
+            const CsvLine* pCsvLine = nullptr;
+            if (oReader)
+            {
+                pCsvLine = oReader->next();
+                if (!pCsvLine)
+                    break;
+                aLine = pCsvLine->maText;
+            }
+            else
+            {
+                aLine = ReadCsvLine(rStrm, !bFixed, aSeps, cStr, cDetectSep);
+                if ( rStrm.eof() && aLine.isEmpty() )
+                    break;
+            }
 
             if ( nRow > rDoc.MaxRow() )
             {
@@ -1598,7 +1768,7 @@ bool ScImportExport::ExtText2Doc( SvStream& rStrm )
                 break;  // for
             }
 
-            if (!bDetermineRange)
+            if (!bDetermineRange && !pCsvLine)
                 EmbeddedNullTreatment( aLine);
 
             sal_Int32 nLineLen = aLine.getLength();
@@ -1666,23 +1836,28 @@ bool ScImportExport::ExtText2Doc( SvStream& rStrm )
             {
                 SCCOL nSourceCol = 0;
                 sal_uInt16 nInfoStart = 0;
-                const sal_Unicode* p = aLine.getStr();
+                const std::vector<CsvField>& rFields = pCsvLine->maFields;
+                size_t nField = 0;
                 // tdf#129701 if there is only one column, and user wants to treat empty cells,
-                // we need to detect *p = null
-                bool bIsLastColEmpty = !(*p) && !bSkipEmptyCells && !bDetermineRange;
+                // we need to detect an empty line
+                bool bIsLastColEmpty = rFields.empty() && !bSkipEmptyCells && !bDetermineRange;
                 // Yes, the check is nCol<=rDoc.MaxCol()+1, +1 because it is only an
                 // overflow if there is really data following to be put behind
                 // the last column, which doesn't happen if info is
                 // SC_COL_SKIP.
-                while ( (*p || bIsLastColEmpty) && nCol <= rDoc.MaxCol()+1)
+                while ( (nField < rFields.size() || bIsLastColEmpty) && nCol <= rDoc.MaxCol()+1)
                 {
                     bool bIsQuoted = false;
-                    p = ScImportExport::ScanNextFieldFromString( p, aCell,
-                            cStr, pSeps, bMerge, bIsQuoted, bOverflowCell, bRemoveSpace );
-                    // some dodgy CSVs have a trailing linefeed in each token, which will
-                    // make the code think that we have a multi-line field, which will slow things down a lot.
-                    if (aCell.endsWith("\n"))
-                        aCell = aCell.copy(0, aCell.getLength()-1);
+                    if (nField < rFields.size())
+                    {
+                        const CsvField& rField = rFields[nField++];
+                        aCell = rField.maText;
+                        bIsQuoted = rField.mbQuoted;
+                        if (rField.mbOverflow)
+                            bOverflowCell = true;
+                    }
+                    else
+                        aCell.clear();      // the empty last column
 
                     sal_uInt8 nFmt = SC_COL_STANDARD;
                     for ( i=nInfoStart; i<nInfoCount; i++ )
@@ -1717,7 +1892,7 @@ bool ScImportExport::ExtText2Doc( SvStream& rStrm )
                         else
                         {
                             // tdf#129701 detect if there is a last empty column when we need it
-                            bIsLastColEmpty = (nCol == nLastCol) && !(*p) && !bSkipEmptyCells && !bDetermineRange;
+                            bIsLastColEmpty = (nCol == nLastCol) && nField == rFields.size() && !bSkipEmptyCells && !bDetermineRange;
                         }
 
                     }
@@ -1734,10 +1909,12 @@ bool ScImportExport::ExtText2Doc( SvStream& rStrm )
                     nFirstUpdateRowHeight = std::min( nFirstUpdateRowHeight, nRow );
                     nLastUpdateRowHeight = std::max( nLastUpdateRowHeight, nRow );
                 }
-                xProgress->SetStateOnPercent( rStrm.Tell() - nOldPos );
+                xProgress->SetStateOnPercent( (pCsvLine ? pCsvLine->mnEndPos : rStrm.Tell()) - nOldPos );
             }
             ++nRow;
         }
+        if (oReader)
+            oReader->rewind();
         // so far nRow/nEndCol pointed to the next free
         if (nRow > nStartRow)
             --nRow;
@@ -2692,6 +2869,50 @@ ScImportStringStream::ScImportStringStream( const OUString& rStr )
     ResetEndianSwap();
 }
 
+/** Read a line like SvStream::ReadUniOrByteStringLine(), but directly from
+    the data of a memory stream, e.g. of a memory mapped file, converting it
+    into the result without copying it through a line buffer first.
+ */
+static void lcl_ReadLine( SvStream& rStream, OUString& rStr, sal_Int32 nMaxBytesToRead )
+{
+    SvMemoryStream* pMemStream = dynamic_cast<SvMemoryStream*>(&rStream);
+    const rtl_TextEncoding eEncoding = rStream.GetStreamEncoding();
+    if (pMemStream && eEncoding != RTL_TEXTENCODING_UNICODE && !rStream.GetError())
+    {
+        const sal_uInt64 nPos = pMemStream->Tell();
+        const sal_uInt64 nEnd = pMemStream->TellEnd();
+        if (nPos >= nEnd)
+        {
+            rStr.clear();
+            char c;
+            pMemStream->ReadBytes(&c, 1);  // sets eof
+            return;
+        }
+        const char* pData = static_cast<const char*>(pMemStream->GetData());
+        const sal_uInt64 nMaxEnd = std::min<sal_uInt64>(nEnd, nPos + nMaxBytesToRead);
+        const char* p = pData + nPos;
+        const char* const pStop = pData + nMaxEnd;
+        while (p < pStop && *p != '\n' && *p != '\r')
+            ++p;
+        // Longer lines are truncated by ReadUniOrByteStringLine().
+        if (p < pStop || nMaxEnd == nEnd)
+        {
+            rStr = OUString(pData + nPos, p - (pData + nPos), eEncoding);
+            sal_uInt64 nNext = p - pData;
+            if (nNext < nEnd)
+            {
+                // Skip the line end, which may be a CR LF or LF CR pair.
+                ++nNext;
+                if (nNext < nEnd && (pData[nNext] == '\n' || pData[nNext] == '\r') && pData[nNext] != *p)
+                    ++nNext;
+            }
+            pMemStream->Seek(nNext);
+            return;
+        }
+    }
+    rStream.ReadUniOrByteStringLine(rStr, nMaxBytesToRead);
+}
+
 OUString ReadCsvLine( SvStream &rStream, bool bEmbeddedLineBreak,
         OUString& rFieldSeparators, sal_Unicode cFieldQuote, sal_Unicode& rcDetectSep, sal_uInt32 nMaxSourceLines )
 {
@@ -2714,7 +2935,7 @@ Label_RetryWithNewSep:
     }
 
     OUString aStr;
-    rStream.ReadUniOrByteStringLine(aStr, nArbitraryLineLengthLimit);
+    lcl_ReadLine(rStream, aStr, nArbitraryLineLengthLimit);
 
     if (bEmbeddedLineBreak)
     {
@@ -2832,7 +3053,7 @@ Label_RetryWithNewSep:
             {
                 nLastOffset = aStr.getLength();
                 OUString aNext;
-                rStream.ReadUniOrByteStringLine(aNext, nArbitraryLineLengthLimit);
+                lcl_ReadLine(rStream, aNext, nArbitraryLineLengthLimit);
                 if (!rStream.eof())
                     aStr += "\n" + aNext;
             }
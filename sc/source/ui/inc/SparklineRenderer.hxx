@@ -13,6 +13,7 @@
 #include <document.hxx>
 
 #include <basegfx/polygon/b2dpolygon.hxx>
+#include <basegfx/polygon/b2dpolypolygon.hxx>
 #include <basegfx/polygon/b2dpolygontools.hxx>
 #include <basegfx/matrix/b2dhommatrix.hxx>
 #include <vcl/rendercontext/AntialiasingFlags.hxx>
@@ -365,40 +366,20 @@ private:
         }
     }
 
-    static void setFillAndLineColor(vcl::RenderContext& rRenderContext,
-                                    sc::SparklineAttributes const& rAttributes, double nValue,
-                                    size_t nValueIndex, SparklineValues const& rSparklineValues)
+    static Color getValueColor(sc::SparklineAttributes const& rAttributes, double nValue,
+                               size_t nValueIndex, SparklineValues const& rSparklineValues)
     {
         if (rAttributes.isFirst() && nValueIndex == rSparklineValues.mnFirstIndex)
-        {
-            rRenderContext.SetLineColor(rAttributes.getColorFirst().getFinalColor());
-            rRenderContext.SetFillColor(rAttributes.getColorFirst().getFinalColor());
-        }
+            return rAttributes.getColorFirst().getFinalColor();
         else if (rAttributes.isLast() && nValueIndex == rSparklineValues.mnLastIndex)
-        {
-            rRenderContext.SetLineColor(rAttributes.getColorLast().getFinalColor());
-            rRenderContext.SetFillColor(rAttributes.getColorLast().getFinalColor());
-        }
+            return rAttributes.getColorLast().getFinalColor();
         else if (rAttributes.isHigh() && nValue == rSparklineValues.mfMaximum)
-        {
-            rRenderContext.SetLineColor(rAttributes.getColorHigh().getFinalColor());
-            rRenderContext.SetFillColor(rAttributes.getColorHigh().getFinalColor());
-        }
+            return rAttributes.getColorHigh().getFinalColor();
         else if (rAttributes.isLow() && nValue == rSparklineValues.mfMinimum)
-        {
-            rRenderContext.SetLineColor(rAttributes.getColorLow().getFinalColor());
-            rRenderContext.SetFillColor(rAttributes.getColorLow().getFinalColor());
-        }
+            return rAttributes.getColorLow().getFinalColor();
         else if (rAttributes.isNegative() && nValue < 0.0)
-        {
-            rRenderContext.SetLineColor(rAttributes.getColorNegative().getFinalColor());
-            rRenderContext.SetFillColor(rAttributes.getColorNegative().getFinalColor());
-        }
-        else
-        {
-            rRenderContext.SetLineColor(rAttributes.getColorSeries().getFinalColor());
-            rRenderContext.SetFillColor(rAttributes.getColorSeries().getFinalColor());
-        }
+            return rAttributes.getColorNegative().getFinalColor();
+        return rAttributes.getColorSeries().getFinalColor();
     }
 
     void drawColumn(vcl::RenderContext& rRenderContext, tools::Rectangle const& rRectangle,
@@ -450,14 +431,17 @@ private:
 
         size_t nValueIndex = 0;
 
+        // The columns don't overlap, so collect them per colour and draw
+        // each colour with a single call.
+        std::vector<std::pair<Color, basegfx::B2DPolyPolygon>> aColumnsByColor;
+
         for (auto const& rSparklineValue : rValueList)
         {
             double nValue = rSparklineValue.maValue;
 
             if (nValue != 0.0)
             {
-                setFillAndLineColor(rRenderContext, rAttributes, nValue, nValueIndex,
-                                    rSparklineValues);
+                Color aColor = getValueColor(rAttributes, nValue, nValueIndex, rSparklineValues);
 
                 double nP = (nValue - nMin) / nDelta;
                 double x = rRectangle.GetWidth() * (xStep / numberOfSteps);
@@ -467,11 +451,24 @@ private:
                 aPolygon = basegfx::utils::createPolygonFromRect(aRectangle);
 
                 aPolygon.transform(aMatrix);
-                rRenderContext.DrawPolygon(aPolygon);
+
+                auto it = std::find_if(aColumnsByColor.begin(), aColumnsByColor.end(),
+                                       [aColor](auto const& rEntry) { return rEntry.first == aColor; });
+                if (it == aColumnsByColor.end())
+                    it = aColumnsByColor.emplace(aColumnsByColor.end(), aColor,
+                                                 basegfx::B2DPolyPolygon());
+                it->second.append(aPolygon);
             }
             xStep++;
             nValueIndex++;
         }
+
+        for (auto const& [rColor, rPolyPolygon] : aColumnsByColor)
+        {
+            rRenderContext.SetLineColor(rColor);
+            rRenderContext.SetFillColor(rColor);
+            rRenderContext.DrawPolyPolygon(rPolyPolygon);
+        }
     }
 
     bool isCellHidden(ScAddress const& rAddress)
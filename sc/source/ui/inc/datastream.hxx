@@ -93,6 +93,7 @@ private:
     void MoveData();
     void Text2Doc();
     void Refresh();
+    void RefreshPivotTables();
 
     DECL_LINK( ImportTimerHdl, Timer*, void );
 
@@ -270,10 +270,10 @@ public:
 
     /// check config if on file-open optimal row heights should run, or if the user should be asked
     SC_DLLPUBLIC bool GetRecalcRowHeightsMode();
-    bool            AdjustRowHeight( SCROW nStartRow, SCROW nEndRow, SCTAB nTab );
+    SC_DLLPUBLIC bool AdjustRowHeight( SCROW nStartRow, SCROW nEndRow, SCTAB nTab );
     SC_DLLPUBLIC void UpdateAllRowHeights( const ScMarkData* pTabMark = nullptr );
     SC_DLLPUBLIC void UpdateAllRowHeights(const bool bOnlyUsedRows);
-    void            UpdatePendingRowHeights( SCTAB nUpdateTab, bool bBefore = false );
+    SC_DLLPUBLIC void UpdatePendingRowHeights( SCTAB nUpdateTab, bool bBefore = false );
 
     void            RefreshPivotTables( const ScRange& rSource );
     void            DoConsolidate( const ScConsolidateParam& rParam, bool bRecord = true );
@@ -291,6 +291,16 @@ public:
 
     SC_DLLPUBLIC void DoRecalc( bool bApi );
     SC_DLLPUBLIC void DoHardRecalc();
+    /**
+     * Hard recalc of a large document in idle chunks, cells are painted as
+     * their chunk is calculated. Falls back to DoHardRecalc() for small
+     * documents or without AutoCalc.
+     */
+    SC_DLLPUBLIC void DoIdleHardRecalc();
+    /// Calculate the next chunk of DoIdleHardRecalc(), true if there is more.
+    bool            IdleHardRecalc();
+    /// Stop DoIdleHardRecalc(), remaining cells are calculated on demand.
+    SC_DLLPUBLIC void CancelIdleHardRecalc();
 
     void            UpdateOle(const ScViewData& rViewData, bool bSnapSize = false);
     bool            IsOle() const;
@@ -444,6 +454,9 @@ private:
         SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2, SCTAB nTab);
 
     void SetLanguage(LanguageType eLatin, LanguageType eCjk, LanguageType eCtl);
+
+    /// Notifications and updates after all cells were hard recalculated.
+    void HardRecalcFinished();
 };
 
 void UpdateAcceptChangesDialog();
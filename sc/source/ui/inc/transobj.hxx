@@ -25,6 +25,8 @@
 #include <rtl/ref.hxx>
 #include <sfx2/objsh.hxx>
 
+#include <optional>
+
 
 class ScDocShell;
 class ScMarkData;
@@ -51,10 +53,14 @@ private:
     bool                            m_bUsedForLink;
     bool                            m_bHasFiltered;       // if has filtered rows
     bool                            m_bUseInApi;          // to recognize clipboard content copied from API
+    // the clip doc doesn't change, so the shrunk export areas are computed once
+    std::optional<ScRange>          m_oReducedBlock;
+    std::optional<ScRange>          m_oReducedVisualBlock;
 
     // #i123405# added parameter to allow size calculation without limitation
     // to PageSize, e.g. used for Metafile creation for clipboard.
     void        InitDocShell(bool bLimitToPageSize);
+    const ScRange& GetReducedBlock(bool bIncludeVisual);
     static void StripRefs( ScDocument& rDoc, SCCOL nStartX, SCROW nStartY,
                             SCCOL nEndX, SCROW nEndY,
                             ScDocument& rDestDoc );
@@ -73,6 +73,9 @@ protected:
 
     static void     ShowTable( SCTAB nTab );
     static void     ShowTable( const ScRange& rRange );
+
+    /// Rough estimate of the memory held by an undo/redo document copy, for GetMemorySize().
+    static size_t   GetDocMemorySize( const ScDocument* pDoc );
 };
 
 enum ScBlockUndoMode { SC_UNDO_SIMPLE, SC_UNDO_MANUALHEIGHT, SC_UNDO_AUTOHEIGHT };
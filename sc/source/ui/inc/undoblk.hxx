@@ -194,6 +194,7 @@ public:
     virtual bool CanRepeat(SfxRepeatTarget& rTarget) const override;
 
     virtual OUString GetComment() const override;
+    virtual size_t GetMemorySize() const override;
 
 private:
     ScMarkData      aMarkData;
@@ -260,6 +261,7 @@ public:
     virtual bool    CanRepeat(SfxRepeatTarget& rTarget) const override;
 
     virtual OUString GetComment() const override;
+    virtual size_t GetMemorySize() const override;
 
     void SetDataSpans( const std::shared_ptr<DataSpansType>& pSpans );
 
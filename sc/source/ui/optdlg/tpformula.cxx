@@ -53,6 +53,10 @@ ScTpFormulaOptions::ScTpFormulaOptions(weld::Container* pPage, weld::DialogContr
     mxLbFormulaSyntax->append_text(ScResId(SCSTR_FORMULA_SYNTAX_XL_A1));
     mxLbFormulaSyntax->append_text(ScResId(SCSTR_FORMULA_SYNTAX_XL_R1C1));
 
+    // The recalc on load entries are in the order of ScRecalcOptions.
+    mxLbOOXMLRecalcOptions->append_text(ScResId(SCSTR_FORMULA_RECALC_SELECTIVE));
+    mxLbODFRecalcOptions->append_text(ScResId(SCSTR_FORMULA_RECALC_SELECTIVE));
+
     Link<weld::Button&,void> aLink2 = LINK( this, ScTpFormulaOptions, ButtonHdl );
     mxBtnSepReset->connect_clicked(aLink2);
     mxBtnCustomCalcDetails->connect_clicked(aLink2);
@@ -241,6 +241,16 @@ void ScSimpleUndo::ShowTable( const ScRange& rRange )
     }
 }
 
+size_t ScSimpleUndo::GetDocMemorySize( const ScDocument* pDoc )
+{
+    if (!pDoc)
+        return 0;
+    // Cell storage plus average string/formula overhead; counting is cheap (per cell block),
+    // as this is queried for every action on the stack whenever a new one is added.
+    constexpr size_t nBytesPerCell = 64;
+    return pDoc->GetCellCount() * nBytesPerCell;
+}
+
 ScBlockUndo::ScBlockUndo( ScDocShell& rDocSh, const ScRange& rRange,
                                             ScBlockUndoMode eBlockMode ) :
     ScSimpleUndo( rDocSh ),
@@ -947,6 +947,11 @@ OUString ScUndoPaste::GetComment() const
     return ScResId( STR_UNDO_PASTE ); // "paste"
 }
 
+size_t ScUndoPaste::GetMemorySize() const
+{
+    return GetDocMemorySize(pUndoDoc.get()) + GetDocMemorySize(pRedoDoc.get());
+}
+
 void ScUndoPaste::SetChangeTrack()
 {
     ScChangeTrack* pChangeTrack = rDocShell.GetDocument().GetChangeTrack();
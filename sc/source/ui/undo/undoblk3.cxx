@@ -88,6 +88,11 @@ OUString ScUndoDeleteContents::GetComment() const
     return ScResId( STR_UNDO_DELETECONTENTS );    // "Delete"
 }
 
+size_t ScUndoDeleteContents::GetMemorySize() const
+{
+    return GetDocMemorySize(pUndoDoc.get());
+}
+
 void ScUndoDeleteContents::SetDataSpans( const std::shared_ptr<DataSpansType>& pSpans )
 {
     mpDataSpans = pSpans;
@@ -1076,6 +1076,19 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
 
     rDoc.DeleteAreaTab( nStartCol, nStartRow, nEndCol, nEndRow, nTab, InsertDeleteFlags::CONTENTS );
 
+    // Consecutive numbers in a column are collected and set as one block,
+    // instead of looking up the cell position and broadcasting for each one.
+    std::vector<std::vector<double>> aValueRuns(nCols);
+    std::vector<SCROW> aValueRunStarts(nCols);
+    auto flushValueRun = [&](sal_Int32 nCol)
+    {
+        std::vector<double>& rRun = aValueRuns[nCol];
+        if (rRun.empty())
+            return;
+        rDoc.SetValues(ScAddress(nStartCol + nCol, aValueRunStarts[nCol], nTab), rRun);
+        rRun.clear();
+    };
+
     bool bError = false;
     SCROW nDocRow = nStartRow;
     for (const uno::Sequence<uno::Any>& rColSeq : aData)
@@ -1086,8 +1099,24 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
             for (const uno::Any& rElement : rColSeq)
             {
                 ScAddress aPos(nDocCol, nDocRow, nTab);
+                const sal_Int32 nCol = nDocCol - nStartCol;
+
+                uno::TypeClass eClass = rElement.getValueTypeClass();
+                switch (eClass)
+                {
+                    case uno::TypeClass_BYTE:
+                    case uno::TypeClass_SHORT:
+                    case uno::TypeClass_UNSIGNED_SHORT:
+                    case uno::TypeClass_LONG:
+                    case uno::TypeClass_UNSIGNED_LONG:
+                    case uno::TypeClass_FLOAT:
+                    case uno::TypeClass_DOUBLE:
+                        break;
+                    default:
+                        flushValueRun(nCol);
+                }
 
-                switch( rElement.getValueTypeClass() )
+                switch (eClass)
                 {
                     case uno::TypeClass_VOID:
                     {
@@ -1108,7 +1137,9 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
                     {
                         double fVal(0.0);
                         rElement >>= fVal;
-                        rDoc.SetValue(aPos, fVal);
+                        if (aValueRuns[nCol].empty())
+                            aValueRunStarts[nCol] = nDocRow;
+                        aValueRuns[nCol].push_back(fVal);
                     }
                     break;
 
@@ -1157,11 +1188,18 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
             }
         }
         else
+        {
             bError = true;                          // wrong size
+            for (sal_Int32 nCol = 0; nCol < nCols; ++nCol)
+                flushValueRun(nCol);
+        }
 
         ++nDocRow;
     }
 
+    for (sal_Int32 nCol = 0; nCol < nCols; ++nCol)
+        flushValueRun(nCol);
+
     bool bHeight = rDocShell.AdjustRowHeight( nStartRow, nEndRow, nTab );
 
     if ( pUndoDoc )
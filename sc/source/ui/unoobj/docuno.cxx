@@ -146,6 +146,9 @@
 
 #include <prnsave.hxx>
 
+#include <algorithm>
+#include <deque>
+
 using namespace com::sun::star;
 
 // #i111553# provides the name of the VBA constant for this document type (e.g. 'ThisExcelDoc' for Calc)
@@ -200,6 +203,8 @@ static std::span<const SfxItemPropertyMapEntry> lcl_GetDocOptPropertyMap()
         { SC_UNO_ISADJUSTHEIGHTENABLED,   0, cppu::UnoType<bool>::get(),                                             0, 0},
         { SC_UNO_ISEXECUTELINKENABLED,    0, cppu::UnoType<bool>::get(),                                             0, 0},
         { SC_UNO_ISCHANGEREADONLYENABLED, 0, cppu::UnoType<bool>::get(),                                             0, 0},
+        { SC_UNO_ISFORMULAGROUPPROFILE,   0, cppu::UnoType<bool>::get(),                                             0, 0},
+        { SC_UNO_FORMULAGROUPPROFILE,     0, cppu::UnoType<OUString>::get(),                  beans::PropertyAttribute::READONLY, 0},
         { SC_UNO_REFERENCEDEVICE,         0, cppu::UnoType<awt::XDevice>::get(),                    beans::PropertyAttribute::READONLY, 0},
         {u"BuildId"_ustr,                      0, ::cppu::UnoType<OUString>::get(),                0, 0},
         { SC_UNO_CODENAME,                0, cppu::UnoType<OUString>::get(),                  0, 0},
@@ -399,6 +404,31 @@ SdrModel& ScModelObj::getSdrModelFromUnoModel() const
     return *rDoc.GetDrawLayer(); // TTTT should be reference
 }
 
+/**
+ * Tiles painted by ScModelObj::paintTile(), most recently used first. They
+ * are dropped by the same invalidations that are sent to the LOK clients,
+ * see ScModelObj::invalidateTileCache().
+ */
+struct ScTileCache
+{
+    struct Entry
+    {
+        SCTAB mnTab;
+        Fraction maZoomX;
+        Fraction maZoomY;
+        tools::Rectangle maTileRect;
+        Size maOutputSize;
+        SCCOL mnEndCol;
+        SCROW mnEndRow;
+        OString maRenderState;
+        Bitmap maBitmap;
+    };
+
+    static constexpr size_t nMaxEntries = 64;
+
+    std::deque<Entry> maEntries;
+};
+
 ScModelObj::ScModelObj( ScDocShell* pDocSh ) :
     SfxBaseModel( pDocSh ),
     aPropSet( lcl_GetDocOptPropertyMap() ),
@@ -565,6 +595,17 @@ static ScViewData* lcl_getViewMatchingDocZoomTab(const Fraction& rZoomX,
     return nullptr;
 }
 
+static bool lcl_hasInPlaceActiveObject(const ScDocShell* pDocShell)
+{
+    for (SfxViewShell* pViewShell = SfxViewShell::GetFirst(); pViewShell;
+            pViewShell = SfxViewShell::GetNext(*pViewShell))
+    {
+        if (pViewShell->GetObjectShell() == pDocShell && pViewShell->GetIPClient())
+            return true;
+    }
+    return false;
+}
+
 void ScModelObj::paintTile( VirtualDevice& rDevice,
                             int nOutputWidth, int nOutputHeight,
                             int nTilePosX, int nTilePosY,
@@ -609,17 +650,75 @@ void ScModelObj::paintTile( VirtualDevice& rDevice,
 
     pGridWindow->SetOutputSizePixel(Size(aDocSize.Width() * pViewData->GetPPTX(), aDocSize.Height() * pViewData->GetPPTY()));
 
+    tools::Rectangle aTileRect(Point(nTilePosX, nTilePosY), Size(nTileWidth, nTileHeight));
+    Size aOutputSize(nOutputWidth, nOutputHeight);
+    const SCTAB nTab = pViewData->CurrentTabForData();
+    const OString aRenderState = getTabViewRenderState(*pViewData->GetViewShell());
+
+    // Charts in edit mode are painted from their own view and don't
+    // invalidate through ours, don't reuse tiles while there are any.
+    const bool bUseTileCache = !lcl_hasInPlaceActiveObject(pDocShell);
+    if (bUseTileCache)
+    {
+        if (!mpTileCache)
+            mpTileCache = std::make_unique<ScTileCache>();
+
+        std::deque<ScTileCache::Entry>& rEntries = mpTileCache->maEntries;
+        auto it = std::find_if(rEntries.begin(), rEntries.end(),
+            [&](const ScTileCache::Entry& rEntry)
+            {
+                return rEntry.mnTab == nTab && rEntry.maTileRect == aTileRect
+                    && rEntry.maOutputSize == aOutputSize && rEntry.maZoomX == aFracX
+                    && rEntry.maZoomY == aFracY && rEntry.mnEndCol == nTiledRenderingAreaEndCol
+                    && rEntry.mnEndRow == nTiledRenderingAreaEndRow
+                    && rEntry.maRenderState == aRenderState;
+            });
+        if (it != rEntries.end())
+        {
+            const bool bMapModeEnabled = rDevice.IsMapModeEnabled();
+            rDevice.EnableMapMode(false);
+            rDevice.DrawBitmap(Point(0, 0), aOutputSize, it->maBitmap);
+            rDevice.EnableMapMode(bMapModeEnabled);
+            std::rotate(rEntries.begin(), it, it + 1);
+            return;
+        }
+    }
+
     pGridWindow->PaintTile( rDevice, nOutputWidth, nOutputHeight,
                             nTilePosX, nTilePosY, nTileWidth, nTileHeight,
                             nTiledRenderingAreaEndCol, nTiledRenderingAreaEndRow );
 
     // Draw Form controls
     ScDrawLayer* pDrawLayer = pDocShell->GetDocument().GetDrawLayer();
-    SdrPage* pPage = pDrawLayer->GetPage(sal_uInt16(pViewData->CurrentTabForData()));
+    SdrPage* pPage = pDrawLayer->GetPage(sal_uInt16(nTab));
     SdrView* pDrawView = pViewData->GetViewShell()->GetScDrawView();
-    tools::Rectangle aTileRect(Point(nTilePosX, nTilePosY), Size(nTileWidth, nTileHeight));
-    Size aOutputSize(nOutputWidth, nOutputHeight);
     LokControlHandler::paintControlTile(pPage, pDrawView, *pGridWindow, rDevice, aOutputSize, aTileRect);
+
+    if (bUseTileCache)
+    {
+        const bool bMapModeEnabled = rDevice.IsMapModeEnabled();
+        rDevice.EnableMapMode(false);
+        std::deque<ScTileCache::Entry>& rEntries = mpTileCache->maEntries;
+        rEntries.push_front({ nTab, aFracX, aFracY, aTileRect, aOutputSize,
+                              nTiledRenderingAreaEndCol, nTiledRenderingAreaEndRow, aRenderState,
+                              rDevice.GetBitmap(Point(0, 0), aOutputSize) });
+        rDevice.EnableMapMode(bMapModeEnabled);
+        if (rEntries.size() > ScTileCache::nMaxEntries)
+            rEntries.pop_back();
+    }
+}
+
+void ScModelObj::invalidateTileCache(int nPart, const tools::Rectangle* pRect)
+{
+    if (!mpTileCache)
+        return;
+
+    std::erase_if(mpTileCache->maEntries,
+        [nPart, pRect](const ScTileCache::Entry& rEntry)
+        {
+            return (nPart < 0 || rEntry.mnTab == nPart)
+                && (!pRect || rEntry.maTileRect.Overlaps(*pRect));
+        });
 }
 
 void ScModelObj::setPart( int nPart, bool /*bAllowChangeFocus*/ )
@@ -3288,6 +3387,10 @@ void SAL_CALL ScModelObj::setPropertyValue(
     {
         rDoc.EnableChangeReadOnly( ScUnoHelpFunctions::GetBoolFromAny( aValue ) );
     }
+    else if ( aPropertyName == SC_UNO_ISFORMULAGROUPPROFILE )
+    {
+        rDoc.EnableFormulaGroupProfile( ScUnoHelpFunctions::GetBoolFromAny( aValue ) );
+    }
     else if ( aPropertyName == "BuildId" )
     {
         aValue >>= maBuildId;
@@ -3491,6 +3594,14 @@ uno::Any SAL_CALL ScModelObj::getPropertyValue( const OUString& aPropertyName )
         {
             aRet <<= rDoc.IsChangeReadOnlyEnabled();
         }
+        else if ( aPropertyName == SC_UNO_ISFORMULAGROUPPROFILE )
+        {
+            aRet <<= rDoc.IsFormulaGroupProfileEnabled();
+        }
+        else if ( aPropertyName == SC_UNO_FORMULAGROUPPROFILE )
+        {
+            aRet <<= rDoc.GetFormulaGroupProfileAsJson();
+        }
         else if ( aPropertyName == SC_UNO_REFERENCEDEVICE )
         {
             rtl::Reference<VCLXDevice> pXDev = new VCLXDevice();
@@ -19,6 +19,7 @@
 
 #include "vbarange.hxx"
 
+#include <comphelper/scopeguard.hxx>
 #include <comphelper/types.hxx>
 #include <cppuhelper/exc_hlp.hxx>
 #include <o3tl/any.hxx>
@@ -1546,6 +1547,24 @@ ScVbaRange::getValue2()
 void
 ScVbaRange::setValue( const uno::Any& aValue, ValueSetter& valueSetter )
 {
+    // Adjust the row heights once for the whole range afterwards instead of after each
+    // cell; with ScreenUpdating = False they are deferred until that is reset anyway
+    ScDocShell* pDocSh = isSingleCellRange() ? nullptr : getDocShellFromRange( mxRange );
+    if ( pDocSh )
+        pDocSh->GetDocument().LockAdjustHeight();
+    comphelper::ScopeGuard aAdjustHeightGuard( [pDocSh, this]()
+        {
+            if ( !pDocSh )
+                return;
+            ScDocument& rDoc = pDocSh->GetDocument();
+            rDoc.UnlockAdjustHeight();
+            if ( !rDoc.IsAdjustHeightLocked() )
+            {
+                table::CellRangeAddress aAddr = lclGetRangeAddress( mxRange );
+                pDocSh->AdjustRowHeight( aAddr.StartRow, aAddr.EndRow, aAddr.Sheet );
+            }
+        } );
+
     uno::TypeClass aClass = aValue.getValueTypeClass();
     if ( aClass == uno::TypeClass_SEQUENCE )
     {
@@ -1088,6 +1088,8 @@ void ScCellShell::Execute( SfxRequest& rReq )
                     pTabViewShell->ResetBrushDocument();            // abort format paint brush
                 else if (pTabViewShell->HasHintWindow())
                     pTabViewShell->RemoveHintWindow();
+                else if (GetViewData().GetDocument().IsIdleHardRecalc())
+                    GetViewData().GetDocShell()->CancelIdleHardRecalc();    // abort hard recalc in idle
                 else if( ScViewUtil::IsFullScreen( *pTabViewShell ) )
                     ScViewUtil::SetFullScreen( *pTabViewShell, false );
                 else
@@ -58,6 +58,8 @@
 #include <sal/log.hxx>
 #include <unotools/charclass.hxx>
 #include <osl/diagnose.h>
+#include <o3tl/hash_combine.hxx>
+#include <o3tl/lru_map.hxx>
 
 #include <output.hxx>
 #include <document.hxx>
@@ -81,6 +83,7 @@
 #include <memory>
 #include <vector>
 
+#include <cmath>
 #include <math.h>
 
 using namespace com::sun::star;
@@ -122,6 +125,27 @@ class ScDrawStringsVars
 
     ScRefCellValue      maLastCell;
     sal_uLong           nValueFormat;
+
+    // Formatted strings of value cells already seen during this paint, so repeated
+    // values don't go through the number formatter again. See FormatCell().
+    struct FormattedValue
+    {
+        OUString            aString;
+        const Color*        pColor;
+    };
+    typedef std::pair<double, sal_uLong> FormattedValueKey;
+    struct FormattedValueKeyHash
+    {
+        size_t operator()(const FormattedValueKey& rKey) const
+        {
+            std::size_t seed = 0;
+            o3tl::hash_combine(seed, rKey.first);
+            o3tl::hash_combine(seed, rKey.second);
+            return seed;
+        }
+    };
+    o3tl::lru_map<FormattedValueKey, FormattedValue, FormattedValueKeyHash> maFormattedValues;
+
     bool                bLineBreak;
     bool                bRepeat;
     bool                bShrink;
@@ -192,6 +216,7 @@ public:
     }
 
 private:
+    OUString    FormatCell( const ScRefCellValue& rCell, const Color** ppColor );
     tools::Long        GetMaxDigitWidth();     // in logic units
     tools::Long        GetSignWidth();
     tools::Long        GetDotWidth();
@@ -218,6 +243,7 @@ ScDrawStringsVars::ScDrawStringsVars(ScOutputData* pData, bool bPTL) :
     nDotWidth( 0 ),
     nExpWidth( 0 ),
     nValueFormat( 0 ),
+    maFormattedValues( 256 ),
     bLineBreak  ( false ),
     bRepeat     ( false ),
     bShrink     ( false ),
@@ -489,6 +515,28 @@ void ScDrawStringsVars::SetPatternSimple( const ScPatternAttr* pNew, const SfxIt
     bShrink = pPattern->GetItem( ATTR_SHRINKTOFIT, pCondSet ).GetValue();
 }
 
+OUString ScDrawStringsVars::FormatCell( const ScRefCellValue& rCell, const Color** ppColor )
+{
+    // The display options and the number formatter don't change during one paint,
+    // so the result only depends on the value and the number format.
+    if (rCell.getType() != CELLTYPE_VALUE || std::isnan(rCell.getDouble()))
+        return ScCellFormat::GetString( rCell, nValueFormat, ppColor, nullptr, *pOutput->mpDoc,
+                                        pOutput->mbShowNullValues, pOutput->mbShowFormulas, true );
+
+    const FormattedValueKey aKey( rCell.getDouble(), nValueFormat );
+    auto aHit = maFormattedValues.find( aKey );
+    if (aHit != maFormattedValues.end())
+    {
+        *ppColor = aHit->second.pColor;
+        return aHit->second.aString;
+    }
+
+    OUString aFormatted = ScCellFormat::GetString( rCell, nValueFormat, ppColor, nullptr, *pOutput->mpDoc,
+                                                   pOutput->mbShowNullValues, pOutput->mbShowFormulas, true );
+    maFormattedValues.insert( { aKey, { aFormatted, *ppColor } } );
+    return aFormatted;
+}
+
 static bool SameValue( const ScRefCellValue& rCell, const ScRefCellValue& rOldCell )
 {
     return rOldCell.getType() == CELLTYPE_VALUE && rCell.getType() == CELLTYPE_VALUE &&
@@ -507,13 +555,7 @@ bool ScDrawStringsVars::SetText( const ScRefCellValue& rCell )
 
             const Color* pColor;
             sal_uLong nFormat = nValueFormat;
-            aString = ScCellFormat::GetString( rCell,
-                                     nFormat, &pColor,
-                                     nullptr,
-                                     *pOutput->mpDoc,
-                                     pOutput->mbShowNullValues,
-                                     pOutput->mbShowFormulas,
-                                     true );
+            aString = FormatCell( rCell, &pColor );
             if ( nFormat )
             {
                 nRepeatPos = aString.indexOf( 0x1B );
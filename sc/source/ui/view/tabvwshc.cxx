@@ -30,6 +30,7 @@
 #include <global.hxx>
 #include <scmod.hxx>
 #include <document.hxx>
+#include <docuno.hxx>
 #include <uiitems.hxx>
 #include <namedlg.hxx>
 #include <namedefdlg.hxx>
@@ -491,6 +492,15 @@ void ScTabViewShell::afterCallbackRegistered()
     }
 }
 
+void ScTabViewShell::libreOfficeKitViewInvalidateTilesCallback(const tools::Rectangle* pRect, int nPart, int nMode) const
+{
+    // Drop the painted tiles of the document before the client asks for them again.
+    if (ScModelObj* pModel = GetViewData().GetDocShell()->GetModel())
+        pModel->invalidateTileCache(nPart == INT_MIN ? -1 : nPart, pRect);
+
+    SfxViewShell::libreOfficeKitViewInvalidateTilesCallback(pRect, nPart, nMode);
+}
+
 void ScTabViewShell::NotifyCursor(SfxViewShell* pOtherShell) const
 {
     ScDrawView* pDrView = const_cast<ScTabViewShell*>(this)->GetScDrawView();
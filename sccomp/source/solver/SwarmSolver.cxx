@@ -30,6 +30,8 @@
 #include <comphelper/proparrhlp.hxx>
 
 #include <cmath>
+#include <map>
+#include <tuple>
 #include <vector>
 #include <limits>
 #include <chrono>
@@ -128,6 +130,10 @@ private:
     std::vector<Bound> maBounds;
     std::vector<sheet::SolverConstraint> maNonBoundedConstraints;
 
+    // cells are accessed for every evaluated candidate, resolve them through UNO only once per
+    // solve() - key is sheet, column and row
+    std::map<std::tuple<sal_Int16, sal_Int32, sal_Int32>, uno::Reference<table::XCell>> maCells;
+
 private:
     static OUString getResourceString(TranslateId aId);
 
@@ -288,10 +294,16 @@ OUString SwarmSolver::getResourceString(TranslateId aId)
 
 uno::Reference<table::XCell> SwarmSolver::getCell(const table::CellAddress& rPosition)
 {
-    uno::Reference<container::XIndexAccess> xSheets(mxDocument->getSheets(), uno::UNO_QUERY);
-    uno::Reference<sheet::XSpreadsheet> xSheet(xSheets->getByIndex(rPosition.Sheet),
-                                               uno::UNO_QUERY);
-    return xSheet->getCellByPosition(rPosition.Column, rPosition.Row);
+    uno::Reference<table::XCell>& rxCell
+        = maCells[std::make_tuple(rPosition.Sheet, rPosition.Column, rPosition.Row)];
+    if (!rxCell.is())
+    {
+        uno::Reference<container::XIndexAccess> xSheets(mxDocument->getSheets(), uno::UNO_QUERY);
+        uno::Reference<sheet::XSpreadsheet> xSheet(xSheets->getByIndex(rPosition.Sheet),
+                                                   uno::UNO_QUERY);
+        rxCell = xSheet->getCellByPosition(rPosition.Column, rPosition.Row);
+    }
+    return rxCell;
 }
 
 void SwarmSolver::setValue(const table::CellAddress& rPosition, double fValue)
@@ -503,6 +515,7 @@ void SAL_CALL SwarmSolver::solve()
 
     maStatus.clear();
     mbSuccess = false;
+    maCells.clear();
     if (!maVariables.getLength())
         return;
 
@@ -574,6 +587,7 @@ void SAL_CALL SwarmSolver::solve()
 
     xModel->unlockControllers();
 
+    maCells.clear();
     mbSuccess = true;
 
     maSolution.realloc(aSolution.size());
@@ -24,6 +24,7 @@
 #include <svx/svdpage.hxx>
 
 #include <set>
+#include <unordered_map>
 #include <utility>
 
 namespace sd::slidesorter::cache {
@@ -57,25 +58,6 @@ public:
             return rRequest1.meClass < rRequest2.meClass;
         }
     };
-    /** Request data is compared arbitrarily by their addresses in memory.
-        This just establishes an order so that the STL containers are happy.
-        The order is not semantically interpreted.
-    */
-    class DataComparator
-    {
-    public:
-        explicit DataComparator (const CacheKey aKey)
-            : maKey(aKey)
-        {
-        }
-        bool operator() (const Request& rRequest) const
-        {
-            return maKey == rRequest.maKey;
-        }
-    private:
-        const CacheKey maKey;
-    };
-
     CacheKey maKey;
     sal_Int32 mnPriorityInClass;
     RequestPriorityClass meClass;
@@ -88,6 +70,12 @@ class RequestQueue::Container
         Request,
         Request::Comparator>
 {
+public:
+    /** There is at most one request per page.  Keep track of it so that
+        finding the request of a page does not need a linear search, which
+        made filling the queue for large documents quadratic.
+    */
+    std::unordered_map<CacheKey, const_iterator> maRequestByKey;
 };
 
 //=====  GenericRequestQueue  =================================================
@@ -131,6 +119,7 @@ void RequestQueue::AddRequest (
 
     if (bInserted)
     {
+        mpRequestQueue->maRequestByKey[aKey] = ret.first;
         SdrPage *pPage = const_cast<SdrPage*>(aRequest.maKey);
         pPage->AddPageUser(*this);
     }
@@ -160,28 +149,22 @@ RequestQueue::RemoveRequest(
 #if OSL_DEBUG_LEVEL >=2
     bool bIsRemoved = false;
 #endif
-    while(true)
+    auto iKey (mpRequestQueue->maRequestByKey.find(aKey));
+    if (iKey != mpRequestQueue->maRequestByKey.end())
     {
-        Container::const_iterator aRequestIterator = ::std::find_if (
-            mpRequestQueue->begin(),
-            mpRequestQueue->end(),
-            Request::DataComparator(aKey));
-        if (aRequestIterator != mpRequestQueue->end())
-        {
-            if (aRequestIterator->mnPriorityInClass == mnMinimumPriority+1)
-                mnMinimumPriority++;
-            else if (aRequestIterator->mnPriorityInClass == mnMaximumPriority-1)
-                mnMaximumPriority--;
-
-            SdrPage *pPage = const_cast<SdrPage*>(aRequestIterator->maKey);
-            pPage->RemovePageUser(*this);
-            mpRequestQueue->erase(aRequestIterator);
+        Container::const_iterator aRequestIterator (iKey->second);
+        if (aRequestIterator->mnPriorityInClass == mnMinimumPriority+1)
+            mnMinimumPriority++;
+        else if (aRequestIterator->mnPriorityInClass == mnMaximumPriority-1)
+            mnMaximumPriority--;
+
+        SdrPage *pPage = const_cast<SdrPage*>(aRequestIterator->maKey);
+        pPage->RemovePageUser(*this);
+        mpRequestQueue->erase(aRequestIterator);
+        mpRequestQueue->maRequestByKey.erase(iKey);
 #if OSL_DEBUG_LEVEL >=2
-            bIsRemoved = true;
+        bIsRemoved = true;
 #endif
-        }
-        else
-            break;
     }
 #if OSL_DEBUG_LEVEL >=2
     return bIsRemoved;
@@ -197,12 +180,8 @@ void RequestQueue::ChangeClass (
 
     assert(eNewRequestClass>=MIN_CLASS && eNewRequestClass<=MAX_CLASS);
 
-    Container::const_iterator iRequest (
-        ::std::find_if (
-            mpRequestQueue->begin(),
-            mpRequestQueue->end(),
-            Request::DataComparator(aKey)));
-    if (iRequest!=mpRequestQueue->end() && iRequest->meClass!=eNewRequestClass)
+    auto iKey (mpRequestQueue->maRequestByKey.find(aKey));
+    if (iKey!=mpRequestQueue->maRequestByKey.end() && iKey->second->meClass!=eNewRequestClass)
     {
         AddRequest(aKey, eNewRequestClass);
     }
@@ -240,6 +219,7 @@ void RequestQueue::PopFront()
     Container::const_iterator aIter(mpRequestQueue->begin());
     SdrPage *pPage = const_cast<SdrPage*>(aIter->maKey);
     pPage->RemovePageUser(*this);
+    mpRequestQueue->maRequestByKey.erase(aIter->maKey);
     mpRequestQueue->erase(aIter);
 
     // Reset the priority counter if possible.
@@ -267,6 +247,7 @@ void RequestQueue::Clear()
     }
 
     mpRequestQueue->clear();
+    mpRequestQueue->maRequestByKey.clear();
     mnMinimumPriority = 0;
     mnMaximumPriority = 1;
 }
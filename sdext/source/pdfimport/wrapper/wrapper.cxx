@@ -56,6 +56,7 @@
 #include <vcl/pdf/pwdinteract.hxx>
 #include <vcl/virdev.hxx>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string_view>
@@ -1025,13 +1026,36 @@ public:
 
         if (aChar != '\n' && aChar != '\r')
             line.append(aChar);
+        else
+            return nRes;
 
+        // append whole runs of the buffer up to the line end, the
+        // protocol is mostly long lines and this is called per line
         for (;;)
         {
-            nRes = read(&aChar, 1, &nBytesRead);
-            if (osl_File_E_None != nRes || nBytesRead != 1 || aChar == '\n' || aChar == '\r')
+            if (left == 0)
+            {
+                nRes = osl_readFile(pOut, aBuffer.get(), SIZE, &left);
+                if (nRes != osl_File_E_None || left == 0)
+                    break;
+                pos = 0;
+            }
+
+            const char* pStart = aBuffer.get() + pos;
+            const char* pEnd = pStart + left;
+            const char* pEol = std::find_if(pStart, pEnd,
+                                            [](char c) { return c == '\n' || c == '\r'; });
+            const size_t nRun = pEol - pStart;
+            line.append(pStart, nRun);
+            pos += nRun;
+            left -= nRun;
+            if (pEol != pEnd)
+            {
+                // consume the line end
+                ++pos;
+                --left;
                 break;
-            line.append(aChar);
+            }
         }
 
         return nRes;
@@ -730,7 +730,9 @@ IMPL_LINK_NOARG(FileDialogHelper_Impl, TimeOutHdl_Impl, Timer *, void)
     {
         const OUString&    aURL = aPathSeq[0];
 
-        if ( ERRCODE_NONE == getGraphic( aURL, maGraphic ) )
+        // the bitmap is scaled down to the preview area anyway, no need to decode it in full
+        const Size aPreviewSize(xFilePicker->getAvailableWidth(), xFilePicker->getAvailableHeight());
+        if ( ERRCODE_NONE == getGraphic( aURL, maGraphic, &aPreviewSize ) )
         {
             // changed the code slightly;
             // before: the bitmap was scaled and
@@ -786,7 +788,8 @@ IMPL_LINK_NOARG(FileDialogHelper_Impl, TimeOutHdl_Impl, Timer *, void)
 }
 
 ErrCode FileDialogHelper_Impl::getGraphic( const OUString& rURL,
-                                           Graphic& rGraphic )
+                                           Graphic& rGraphic,
+                                           const Size* pPreviewSizeHint )
 {
     if ( utl::UCBContentHelper::IsFolder( rURL ) )
         return ERRCODE_IO_NOTAFILE;
@@ -821,13 +824,13 @@ ErrCode FileDialogHelper_Impl::getGraphic( const OUString& rURL,
         std::unique_ptr<SvStream> pStream = ::utl::UcbStreamHelper::CreateStream( rURL, StreamMode::READ );
 
         if( pStream )
-            nRet = mpGraphicFilter->ImportGraphic(rGraphic, rURL, *pStream, nFilter, nullptr, nFilterImportFlags, -1, xInteractionHandler);
+            nRet = mpGraphicFilter->ImportGraphic(rGraphic, rURL, *pStream, nFilter, nullptr, nFilterImportFlags, -1, xInteractionHandler, pPreviewSizeHint);
         else
-            nRet = mpGraphicFilter->ImportGraphic(rGraphic, aURLObj, nFilter, nullptr, nFilterImportFlags, xInteractionHandler);
+            nRet = mpGraphicFilter->ImportGraphic(rGraphic, aURLObj, nFilter, nullptr, nFilterImportFlags, xInteractionHandler, pPreviewSizeHint);
     }
     else
     {
-        nRet = mpGraphicFilter->ImportGraphic(rGraphic, aURLObj, nFilter, nullptr, nFilterImportFlags, xInteractionHandler);
+        nRet = mpGraphicFilter->ImportGraphic(rGraphic, aURLObj, nFilter, nullptr, nFilterImportFlags, xInteractionHandler, pPreviewSizeHint);
     }
 
     return nRet;
@@ -120,7 +120,8 @@ namespace sfx2
         std::shared_ptr<const SfxFilter>        getCurrentSfxFilter();
         bool                updateExtendedControl( sal_Int16 _nExtendedControlId, bool _bEnable );
 
-        ErrCode                 getGraphic( const OUString& rURL, Graphic& rGraphic );
+        ErrCode                 getGraphic( const OUString& rURL, Graphic& rGraphic,
+                                            const Size* pPreviewSizeHint = nullptr );
         void                    setDefaultValues();
 
         void                    preExecute();
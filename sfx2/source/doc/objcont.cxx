@@ -111,24 +111,27 @@ SfxObjectShell::GetPreviewMetaFile( bool bFullContent, bool bOutputForScreen ) c
     return xFile;
 }
 
-Bitmap SfxObjectShell::GetPreviewBitmap() const
+Bitmap SfxObjectShell::GetPreviewBitmap(bool bLowCost) const
 {
     SfxCloseVetoLock lock(this);
     ScopedVclPtrInstance< VirtualDevice > pDevice(DeviceFormat::WITH_ALPHA);
     pDevice->SetAntialiasing(AntialiasingFlags::Enable | pDevice->GetAntialiasing());
-    if(!CreatePreview_Impl(/*bFullContent*/false, false, pDevice, nullptr))
+    if(!CreatePreview_Impl(/*bFullContent*/false, false, pDevice, nullptr, !bLowCost))
         return Bitmap();
     Size size = pDevice->GetOutputSizePixel();
     Bitmap aBitmap( pDevice->GetBitmap( Point(), size) );
-    // Scale down the image to the desired size from the 4*size from CreatePreview_Impl().
-    size = Size( size.Width() / 4, size.Height() / 4 );
-    aBitmap.Scale(size, BmpScaleFlag::BestQuality);
+    if (!bLowCost)
+    {
+        // Scale down the image to the desired size from the 4*size from CreatePreview_Impl().
+        size = Size( size.Width() / 4, size.Height() / 4 );
+        aBitmap.Scale(size, BmpScaleFlag::BestQuality);
+    }
     if (!aBitmap.IsEmpty())
         aBitmap.Convert(BmpConversion::N24Bit);
     return aBitmap;
 }
 
-bool SfxObjectShell::CreatePreview_Impl( bool bFullContent, bool bOutputForScreen, VirtualDevice* pDevice, GDIMetaFile* pFile) const
+bool SfxObjectShell::CreatePreview_Impl( bool bFullContent, bool bOutputForScreen, VirtualDevice* pDevice, GDIMetaFile* pFile, bool bSupersample) const
 {
     // DoDraw can only be called when no printing is done, otherwise
     // the printer may be turned off
@@ -189,8 +192,12 @@ bool SfxObjectShell::CreatePreview_Impl( bool bFullContent, bool bOutputForScree
                 aSizePix.setHeight(basegfx::fround<tools::Long>(nMaximumExtent / fWH));
             }
         }
-        // do it 4x larger to be able to scale it down & get beautiful antialias
-        aTmpSize = Size( aSizePix.Width() * 4, aSizePix.Height() * 4 );
+        // do it 4x larger to be able to scale it down & get beautiful antialias,
+        // that is 16 times the pixels to render and a costly scaling afterwards
+        if (bSupersample)
+            aTmpSize = Size( aSizePix.Width() * 4, aSizePix.Height() * 4 );
+        else
+            aTmpSize = aSizePix;
         pDevice->SetOutputSizePixel( aTmpSize );
     }
 
@@ -3998,7 +3998,8 @@ bool SfxObjectShell::WriteThumbnail(bool bEncrypted, const uno::Reference<io::XS
         }
         else
         {
-            Bitmap bitmap = GetPreviewBitmap();
+            // LOK saves documents all the time, prefer a cheap thumbnail there
+            Bitmap bitmap = GetPreviewBitmap(comphelper::LibreOfficeKit::isActive());
             if (!bitmap.IsEmpty())
             {
                 bResult = GraphicHelper::getThumbnailFormatFromBitmap_Impl(bitmap, xStream);
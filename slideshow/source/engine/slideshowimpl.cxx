@@ -2510,8 +2510,10 @@ void SlideShowImpl::notifySlideAnimationsEnded()
             // ignore return value, this is just to populate
             // Slide's internal bitmap buffer, such that the time
             // needed to generate the slide bitmap is not spent
-            // when the slide change is requested.
-            mpPrefetchSlide->getCurrentSlideBitmap( *maViewContainer.begin() );
+            // when the slide change is requested. Do that for
+            // every view, the transition needs all of them.
+            for( const auto& pView : maViewContainer )
+                mpPrefetchSlide->getCurrentSlideBitmap( pView );
         }
     } // finally
 
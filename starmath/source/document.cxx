@@ -152,6 +152,7 @@ void SmDocShell::SetText(const OUString& rBuffer)
 
     Parse();
 
+    bool bRepainted = false;
     SmViewShell *pViewSh = SmGetActiveView();
     if (pViewSh)
     {
@@ -164,6 +165,7 @@ void SmDocShell::SetText(const OUString& rBuffer)
             SfxGetpApp()->NotifyEvent(SfxEventHint( SfxEventHintId::VisAreaChanged, GlobalEventConfig::GetEventName(GlobalEventId::VISAREACHANGED), this));
 
             Repaint();
+            bRepainted = true;
         }
         else
             pViewSh->GetGraphicWidget().Invalidate();
@@ -185,7 +187,9 @@ void SmDocShell::SetText(const OUString& rBuffer)
         }
     }
 
-    if ( GetCreateMode() == SfxObjectCreateMode::EMBEDDED )
+    // OnDocumentPrinterChanged(nullptr) only re-arranges and repaints for the
+    // document's own printer, which was just done above
+    if ( GetCreateMode() == SfxObjectCreateMode::EMBEDDED && !bRepainted )
         OnDocumentPrinterChanged(nullptr);
 }
 
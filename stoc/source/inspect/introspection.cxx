@@ -1411,10 +1411,12 @@ struct TypeKey {
                 + "*"); // arbitrary delimiter not used by type grammar
         }
         types = b.makeStringAndClear();
+        typesHash = types.hashCode();
     }
 
     css::uno::Reference<css::beans::XPropertySetInfo> properties;
     OUString types;
+    sal_Int32 typesHash;
 };
 
 struct TypeKeyLess {
@@ -1425,6 +1427,11 @@ struct TypeKeyLess {
         if (key1.properties.get() > key2.properties.get()) {
             return false;
         }
+        // the types strings are long and mostly share their prefix, so only
+        // compare them for equal hashes
+        if (key1.typesHash != key2.typesHash) {
+            return key1.typesHash < key2.typesHash;
+        }
         return key1.types < key2.types;
     }
 };
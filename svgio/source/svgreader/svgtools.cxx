@@ -308,7 +308,7 @@ namespace svgio::svgreader
             }
         }
 
-        void copySign(std::u16string_view rCandidate, sal_Int32& nPos, OUStringBuffer& rTarget, const sal_Int32 nLen)
+        void skip_sign(std::u16string_view rCandidate, sal_Int32& nPos, const sal_Int32 nLen)
         {
             if(nPos < nLen)
             {
@@ -316,27 +316,23 @@ namespace svgio::svgreader
 
                 if('+' == aChar || '-' == aChar)
                 {
-                    rTarget.append(aChar);
                     nPos++;
                 }
             }
         }
 
-        void copyNumber(std::u16string_view rCandidate, sal_Int32& nPos, OUStringBuffer& rTarget, const sal_Int32 nLen)
+        void skip_number(std::u16string_view rCandidate, sal_Int32& nPos, const sal_Int32 nLen)
         {
-            bool bOnNumber(true);
-
-            while(bOnNumber && nPos < nLen)
+            while(nPos < nLen)
             {
                 const sal_Unicode aChar(rCandidate[nPos]);
 
-                bOnNumber = ('0' <= aChar && '9' >= aChar) || '.' == aChar;
-
-                if(bOnNumber)
+                if(!(('0' <= aChar && '9' >= aChar) || '.' == aChar))
                 {
-                    rTarget.append(aChar);
-                    nPos++;
+                    break;
                 }
+
+                nPos++;
             }
         }
 
@@ -381,10 +377,13 @@ namespace svgio::svgreader
         {
             if(nPos < nLen)
             {
-                OUStringBuffer aNum;
+                // only find the extent of the number here and convert it in
+                // place; path data consists of little else, so building a
+                // temporary string per number is measurable on large files
+                const sal_Int32 nStart(nPos);
 
-                copySign(rCandidate, nPos, aNum, nLen);
-                copyNumber(rCandidate, nPos, aNum, nLen);
+                skip_sign(rCandidate, nPos, nLen);
+                skip_number(rCandidate, nPos, nLen);
 
                 if(nPos < nLen)
                 {
@@ -397,29 +396,26 @@ namespace svgio::svgreader
                         // by error. First try if there are numbers after the 'e',
                         // safe current state
                         nPos++;
-                        const OUString aNum2(aNum);
                         const sal_Int32 nPosAfterE(nPos);
 
-                        aNum.append(aChar);
-                        copySign(rCandidate, nPos, aNum, nLen);
-                        copyNumber(rCandidate, nPos, aNum, nLen);
+                        skip_sign(rCandidate, nPos, nLen);
+                        skip_number(rCandidate, nPos, nLen);
 
                         if(nPosAfterE == nPos)
                         {
                             // no number after 'e', go back. Do not
                             // return false, it's still a valid integer number
-                            aNum = aNum2;
                             nPos--;
                         }
                     }
                 }
 
-                if(!aNum.isEmpty())
+                if(nStart != nPos)
                 {
                     rtl_math_ConversionStatus eStatus;
 
                     fNum = rtl::math::stringToDouble(
-                        aNum, '.', ',',
+                        rCandidate.substr(nStart, nPos - nStart), '.', ',',
                         &eStatus);
 
                     return eStatus == rtl_math_ConversionStatus_Ok;
@@ -38,6 +38,8 @@
 
 #include <memory>
 #include <optional>
+#include <thread>
+#include <vector>
 #include <unicode/timezone.h>
 
 using namespace ::com::sun::star;
@@ -67,6 +69,7 @@ public:
     void testSharedStringPoolPurge();
     void testSharedStringPoolPurgeBug1();
     void testSharedStringPoolEmptyString();
+    void testSharedStringPoolThreaded();
     void testFdo60915();
     void testI116701();
     void testTdf103060();
@@ -86,6 +89,7 @@ public:
     CPPUNIT_TEST(testSharedStringPoolPurge);
     CPPUNIT_TEST(testSharedStringPoolPurgeBug1);
     CPPUNIT_TEST(testSharedStringPoolEmptyString);
+    CPPUNIT_TEST(testSharedStringPoolThreaded);
     CPPUNIT_TEST(testFdo60915);
     CPPUNIT_TEST(testI116701);
     CPPUNIT_TEST(testTdf103060);
@@ -451,6 +455,46 @@ void Test::testSharedStringPoolEmptyString()
     CPPUNIT_ASSERT_EQUAL(SharedString::getEmptyString(), aPool.intern(SharedString::EMPTY_STRING));
 }
 
+void Test::testSharedStringPoolThreaded()
+{
+    // Intern the same strings from several threads at once, all of them must
+    // end up with the same shared string objects.
+    SvtSysLocale aSysLocale;
+    svl::SharedStringPool aPool(aSysLocale.GetCharClass());
+    size_t extraCount = aPool.getCount(); // internal items such as SharedString::getEmptyString()
+
+    constexpr int nThreads = 4;
+    constexpr int nStrings = 500;
+    std::vector<std::vector<svl::SharedString>> aResults(nThreads);
+    std::vector<std::thread> aThreads;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        aThreads.emplace_back([&aPool, &aResults, i]() {
+            for (int j = 0; j < nStrings; ++j)
+                aResults[i].push_back(aPool.intern("Str" + OUString::number(j)));
+        });
+    }
+    for (std::thread& rThread : aThreads)
+        rThread.join();
+
+    for (int i = 1; i < nThreads; ++i)
+    {
+        for (int j = 0; j < nStrings; ++j)
+        {
+            CPPUNIT_ASSERT_EQUAL(aResults[0][j].getData(), aResults[i][j].getData());
+            CPPUNIT_ASSERT_EQUAL(aResults[0][j].getDataIgnoreCase(), aResults[i][j].getDataIgnoreCase());
+        }
+    }
+
+    // One mixed-case and one upper-case entry per string.
+    CPPUNIT_ASSERT_EQUAL(2 * nStrings + extraCount, aPool.getCount());
+    CPPUNIT_ASSERT_EQUAL(aResults[0][0].getDataIgnoreCase(), aPool.intern(u"STR0"_ustr).getData());
+
+    aResults.clear();
+    aPool.purge();
+    CPPUNIT_ASSERT_EQUAL(extraCount, aPool.getCount());
+}
+
 void Test::checkPreviewString(SvNumberFormatter& aFormatter,
                               const OUString& sCode,
                               double fPreviewNumber,
@@ -264,10 +264,13 @@ SfxItemSet::SfxItemSet( const SfxItemSet& rASet )
     if (rASet.GetRanges().empty())
         return;
 
+    // size the map once instead of rehashing while copying
+    m_aPoolItemMap.reserve(rASet.m_aPoolItemMap.size());
+
     for (const auto& rSource : rASet.m_aPoolItemMap)
     {
         const SfxPoolItem* pNew(implCreateItemEntry(*GetPool(), rSource.second, false));
-        m_aPoolItemMap[rSource.first] = pNew;
+        m_aPoolItemMap.emplace(rSource.first, pNew);
         if (m_nRegister != rASet.m_nRegister)
             checkAddPoolRegistration(pNew);
     }
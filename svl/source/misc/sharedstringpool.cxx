@@ -11,6 +11,7 @@
 #include <svl/sharedstring.hxx>
 #include <unotools/charclass.hxx>
 
+#include <array>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
@@ -27,21 +28,36 @@ struct StringWithHash
         , hashCode(str.hashCode())
     {
     }
-
-    bool operator==(StringWithHash const& rhs) const
+    StringWithHash(OUString s, sal_Int32 nHashCode)
+        : str(std::move(s))
+        , hashCode(nHashCode)
     {
-        if (hashCode != rhs.hashCode)
-            return false;
-        return str == rhs.str;
     }
 };
-}
 
-namespace std
+/** lookup key, so that looking up an existing string does not need to acquire it */
+struct StringRefWithHash
 {
-template <> struct hash<StringWithHash>
+    const OUString& str;
+    sal_Int32 hashCode;
+};
+
+struct StringWithHashHash
 {
+    using is_transparent = void;
     std::size_t operator()(const StringWithHash& k) const { return k.hashCode; }
+    std::size_t operator()(const StringRefWithHash& k) const { return k.hashCode; }
+};
+
+struct StringWithHashEqual
+{
+    using is_transparent = void;
+    template <typename A, typename B> bool operator()(const A& lhs, const B& rhs) const
+    {
+        if (lhs.hashCode != rhs.hashCode)
+            return false;
+        return lhs.str == rhs.str;
+    }
 };
 }
 
@@ -54,17 +70,42 @@ sal_Int32 getRefCount(const rtl_uString* p) { return (p->refCount & 0x3FFFFFFF);
 
 struct SharedStringPool::Impl
 {
-    mutable std::mutex maMutex;
-    // We use this map for two purposes - to store lower->upper case mappings
-    // and to retrieve a shared uppercase object, so the management logic
-    // is quite complex.
-    std::unordered_map<StringWithHash, OUString> maStrMap;
+    /**
+     * The pool is split into shards by string hash, each with its own mutex,
+     * so that threads interning different strings rarely wait for each
+     * other. A lower-case entry and its upper-case entry may live in
+     * different shards; intern() never holds more than one shard lock, and
+     * purge() locks all shards in index order.
+     */
+    static constexpr size_t SHARD_COUNT = 16;
+
+    struct Shard
+    {
+        mutable std::mutex maMutex;
+        // We use this map for two purposes - to store lower->upper case mappings
+        // and to retrieve a shared uppercase object, so the management logic
+        // is quite complex.
+        std::unordered_map<StringWithHash, OUString, StringWithHashHash, StringWithHashEqual>
+            maStrMap;
+    };
+
+    std::array<Shard, SHARD_COUNT> maShards;
+    // CharClass isn't thread-safe, serialize case conversion of new strings.
+    std::mutex maCharClassMutex;
     const CharClass& mrCharClass;
 
     explicit Impl(const CharClass& rCharClass)
         : mrCharClass(rCharClass)
     {
     }
+
+    Shard& getShard(sal_Int32 nHashCode)
+    {
+        // Use the high bits of a multiplicative hash, the low bits of the
+        // hash code select the buckets inside the shard's map.
+        sal_uInt32 nHash = static_cast<sal_uInt32>(nHashCode) * 0x9E3779B1u;
+        return maShards[nHash >> 28];
+    }
 };
 
 SharedStringPool::SharedStringPool(const CharClass& rCharClass)
@@ -79,43 +120,50 @@ SharedStringPool::~SharedStringPool() {}
 
 SharedString SharedStringPool::intern(const OUString& rStr)
 {
-    StringWithHash aStrWithHash(rStr);
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
-
-    auto[mapIt, bInserted] = mpImpl->maStrMap.emplace(aStrWithHash, rStr);
-    if (!bInserted)
-        // there is already a mapping
-        return SharedString(mapIt->first.str.pData, mapIt->second.pData);
+    const sal_Int32 nHashCode = rStr.hashCode();
+    Impl::Shard& rShard = mpImpl->getShard(nHashCode);
+    {
+        std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+        auto mapIt = rShard.maStrMap.find(StringRefWithHash{ rStr, nHashCode });
+        if (mapIt != rShard.maStrMap.end())
+            // there is already a mapping
+            return SharedString(mapIt->first.str.pData, mapIt->second.pData);
+    }
 
     // This is a new string insertion. Establish mapping to upper-case variant.
-    OUString aUpper = mpImpl->mrCharClass.uppercase(rStr);
-    if (aUpper == rStr)
-        // no need to do anything more, because we inserted an upper->upper mapping
-        return SharedString(mapIt->first.str.pData, mapIt->second.pData);
-
-    // We need to insert a lower->upper mapping, so also insert
-    // an upper->upper mapping, which we can use both for when an upper string
-    // is interned, and to look up a shared upper string.
-    StringWithHash aUpperWithHash(aUpper);
-    auto mapIt2 = mpImpl->maStrMap.find(aUpperWithHash);
-    if (mapIt2 != mpImpl->maStrMap.end())
+    OUString aUpper;
     {
-        // there is an already existing upper string
-        mapIt->second = mapIt2->first.str;
-        return SharedString(mapIt->first.str.pData, mapIt->second.pData);
+        std::scoped_lock<std::mutex> aGuard(mpImpl->maCharClassMutex);
+        aUpper = mpImpl->mrCharClass.uppercase(rStr);
     }
 
-    // There is no already existing upper string.
-    // First, update using the iterator, can't do this later because
-    // the iterator will be invalid.
-    mapIt->second = aUpper;
-    mpImpl->maStrMap.emplace_hint(mapIt2, aUpperWithHash, aUpper);
-    return SharedString(rStr.pData, aUpper.pData);
+    if (aUpper != rStr)
+    {
+        // We need to insert a lower->upper mapping, so also insert
+        // an upper->upper mapping, which we can use both for when an upper string
+        // is interned, and to look up a shared upper string.
+        StringWithHash aUpperWithHash(aUpper);
+        Impl::Shard& rUpperShard = mpImpl->getShard(aUpperWithHash.hashCode);
+        std::scoped_lock<std::mutex> aGuard(rUpperShard.maMutex);
+        auto mapIt2 = rUpperShard.maStrMap.emplace(aUpperWithHash, aUpper).first;
+        // use the already existing upper string if there is one
+        aUpper = mapIt2->first.str;
+    }
+
+    // Another thread may have inserted the string in the meantime, in which
+    // case its mapping is used.
+    std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+    auto mapIt = rShard.maStrMap
+                     .emplace(StringWithHash(rStr, nHashCode), aUpper == rStr ? rStr : aUpper)
+                     .first;
+    return SharedString(mapIt->first.str.pData, mapIt->second.pData);
 }
 
 void SharedStringPool::purge()
 {
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
+    std::array<std::unique_lock<std::mutex>, Impl::SHARD_COUNT> aGuards;
+    for (size_t i = 0; i < Impl::SHARD_COUNT; ++i)
+        aGuards[i] = std::unique_lock<std::mutex>(mpImpl->maShards[i].maMutex);
 
     // Because we can have an uppercase entry mapped to itself,
     // and then a bunch of lowercase entries mapped to that same
@@ -123,60 +171,74 @@ void SharedStringPool::purge()
     // time to remove lowercase entries, and then only can we
     // check for unused uppercase entries.
 
-    auto it = mpImpl->maStrMap.begin();
-    auto itEnd = mpImpl->maStrMap.end();
-    while (it != itEnd)
+    for (Impl::Shard& rShard : mpImpl->maShards)
     {
-        rtl_uString* p1 = it->first.str.pData;
-        rtl_uString* p2 = it->second.pData;
-        if (p1 != p2)
+        auto it = rShard.maStrMap.begin();
+        auto itEnd = rShard.maStrMap.end();
+        while (it != itEnd)
         {
-            // normal case - lowercase mapped to uppercase, which
-            // means that the lowercase entry has one ref-counted
-            // entry as the key in the map
-            if (getRefCount(p1) == 1)
+            rtl_uString* p1 = it->first.str.pData;
+            rtl_uString* p2 = it->second.pData;
+            if (p1 != p2)
             {
-                it = mpImpl->maStrMap.erase(it);
-                continue;
+                // normal case - lowercase mapped to uppercase, which
+                // means that the lowercase entry has one ref-counted
+                // entry as the key in the map
+                if (getRefCount(p1) == 1)
+                {
+                    it = rShard.maStrMap.erase(it);
+                    continue;
+                }
             }
+            ++it;
         }
-        ++it;
     }
 
-    it = mpImpl->maStrMap.begin();
-    itEnd = mpImpl->maStrMap.end();
-    while (it != itEnd)
+    for (Impl::Shard& rShard : mpImpl->maShards)
     {
-        rtl_uString* p1 = it->first.str.pData;
-        rtl_uString* p2 = it->second.pData;
-        if (p1 == p2)
+        auto it = rShard.maStrMap.begin();
+        auto itEnd = rShard.maStrMap.end();
+        while (it != itEnd)
         {
-            // uppercase which is mapped to itself, which means
-            // one ref-counted entry as the key in the map, and
-            // one ref-counted entry in the value in the map
-            if (getRefCount(p1) == 2)
+            rtl_uString* p1 = it->first.str.pData;
+            rtl_uString* p2 = it->second.pData;
+            if (p1 == p2)
             {
-                it = mpImpl->maStrMap.erase(it);
-                continue;
+                // uppercase which is mapped to itself, which means
+                // one ref-counted entry as the key in the map, and
+                // one ref-counted entry in the value in the map
+                if (getRefCount(p1) == 2)
+                {
+                    it = rShard.maStrMap.erase(it);
+                    continue;
+                }
             }
+            ++it;
         }
-        ++it;
     }
 }
 
 size_t SharedStringPool::getCount() const
 {
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
-    return mpImpl->maStrMap.size();
+    size_t nCount = 0;
+    for (const Impl::Shard& rShard : mpImpl->maShards)
+    {
+        std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+        nCount += rShard.maStrMap.size();
+    }
+    return nCount;
 }
 
 size_t SharedStringPool::getCountIgnoreCase() const
 {
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
     // this is only called from unit tests, so no need to be efficient
     std::unordered_set<OUString> aUpperSet;
-    for (auto const& pair : mpImpl->maStrMap)
-        aUpperSet.insert(pair.second);
+    for (const Impl::Shard& rShard : mpImpl->maShards)
+    {
+        std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+        for (auto const& pair : rShard.maStrMap)
+            aUpperSet.insert(pair.second);
+    }
     return aUpperSet.size();
 }
 }
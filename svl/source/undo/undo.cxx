@@ -107,6 +107,12 @@ OUString SfxUndoAction::GetRepeatComment(SfxRepeatTarget&) const
 }
 
 
+size_t SfxUndoAction::GetMemorySize() const
+{
+    return 0;
+}
+
+
 void SfxUndoAction::Undo()
 {
     // These are only conceptually pure virtual
@@ -189,6 +195,7 @@ struct SfxUndoManager_Data
     bool            mbClearUntilTopLevel;
     bool            mbEmptyActions;
     std::optional<bool> moNeedsClearRedo; // holds a requested ClearRedo until safe to clear stack
+    size_t          mnMaxUndoMemorySize;
 
     UndoListeners   aListeners;
 
@@ -201,6 +208,7 @@ struct SfxUndoManager_Data
         ,mbDoing( false )
         ,mbClearUntilTopLevel( false )
         ,mbEmptyActions( true )
+        ,mnMaxUndoMemorySize( 0 )
     {
         pActUndoArray = &maUndoArray;
     }
@@ -430,6 +438,18 @@ size_t SfxUndoManager::GetMaxUndoActionCount() const
     return m_xData->pActUndoArray->nMaxUndoActions;
 }
 
+void SfxUndoManager::SetMaxUndoMemorySize( size_t nMaxUndoMemorySize )
+{
+    UndoManagerGuard aGuard( *m_xData );
+    m_xData->mnMaxUndoMemorySize = nMaxUndoMemorySize;
+}
+
+size_t SfxUndoManager::GetMaxUndoMemorySize() const
+{
+    UndoManagerGuard aGuard( *m_xData );
+    return m_xData->mnMaxUndoMemorySize;
+}
+
 void SfxUndoManager::ImplClearCurrentLevel_NoNotify( UndoManagerGuard& i_guard )
 {
     // clear array
@@ -590,6 +610,26 @@ bool SfxUndoManager::ImplAddUndoAction_NoNotify( std::unique_ptr<SfxUndoAction>
                 --m_xData->mnEmptyMark;
             }
         }
+
+        // respect max memory, but always keep the new action
+        if (m_xData->mnMaxUndoMemorySize)
+        {
+            size_t nMemorySize = pAction->GetMemorySize();
+            for (const MarkedUndoAction& rAction : m_xData->pActUndoArray->maUndoActions)
+                nMemorySize += rAction.pAction->GetMemorySize();
+            while (nMemorySize > m_xData->mnMaxUndoMemorySize
+                   && !m_xData->pActUndoArray->maUndoActions.empty())
+            {
+                std::unique_ptr<SfxUndoAction> pRemoved = m_xData->pActUndoArray->Remove(0);
+                nMemorySize -= pRemoved->GetMemorySize();
+                i_guard.markForDeletion( std::move(pRemoved) );
+                if (m_xData->pActUndoArray->nCurUndoAction > 0)
+                {
+                    --m_xData->pActUndoArray->nCurUndoAction;
+                    --m_xData->mnEmptyMark;
+                }
+            }
+        }
     }
 
     // append new action
@@ -1336,6 +1376,14 @@ ViewShellId SfxListUndoAction::GetViewShellId() const
     return mpImpl->mnViewShellId;
 }
 
+size_t SfxListUndoAction::GetMemorySize() const
+{
+    size_t nMemorySize = 0;
+    for (const MarkedUndoAction& rAction : maUndoActions)
+        nMemorySize += rAction.pAction->GetMemorySize();
+    return nMemorySize;
+}
+
 void SfxListUndoAction::SetComment(const OUString& rComment)
 {
     mpImpl->maComment = rComment;
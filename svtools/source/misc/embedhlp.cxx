@@ -246,6 +246,9 @@ struct EmbeddedObjectRef_Impl
     OUString                                    aMediaType;
     comphelper::EmbeddedObjectContainer*        pContainer;
     std::optional<Graphic>                      oGraphic;
+    // the graphic GetGraphicStream(true) already imported to validate the
+    // updated stream, so that GetReplacement does not import it once more
+    std::optional<Graphic>                      oUpdatedGraphic;
     sal_Int64                                   nViewAspect;
     bool                                        bIsLocked:1;
     bool                                        bNeedUpdate:1;
@@ -470,6 +473,15 @@ void EmbeddedObjectRef::GetReplacement( bool bUpdate )
     }
 
     std::unique_ptr<SvStream> pGraphicStream(GetGraphicStream( bUpdate ));
+    std::optional<Graphic> oUpdatedGraphic(std::move(mpImpl->oUpdatedGraphic));
+    mpImpl->oUpdatedGraphic.reset();
+    if (pGraphicStream && oUpdatedGraphic)
+    {
+        mpImpl->oGraphic = std::move(oUpdatedGraphic);
+        mpImpl->mnGraphicVersion++;
+        return;
+    }
+
     if (!pGraphicStream && bUpdate && (!mpImpl->oGraphic || mpImpl->oGraphic->IsNone()))
     {
         // We have no old graphic, tried to get an updated one, but that failed. Try to get an old
@@ -612,6 +624,7 @@ void EmbeddedObjectRef::SetGraphic( const Graphic& rGraphic, const OUString& rMe
 std::unique_ptr<SvStream> EmbeddedObjectRef::GetGraphicStream( bool bUpdate ) const
 {
     DBG_ASSERT( bUpdate || mpImpl->pContainer, "Can't retrieve current graphic!" );
+    mpImpl->oUpdatedGraphic.reset();
     uno::Reference < io::XInputStream > xStream;
     if ( mpImpl->pContainer && !bUpdate )
     {
@@ -692,6 +705,8 @@ std::unique_ptr<SvStream> EmbeddedObjectRef::GetGraphicStream( bool bUpdate ) co
                                 SAL_WARN("svtools.misc", "EmbeddedObjectRef::GetGraphicStream: failed to parse xStream");
                                 bInsertGraphicStream = false;
                             }
+                            else
+                                mpImpl->oUpdatedGraphic = std::move(aGraphic);
                         }
                     }
                     if (xSeekable.is() && oPosition.has_value())
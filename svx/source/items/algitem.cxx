@@ -205,6 +205,16 @@ bool SvxMarginItem::operator==( const SfxPoolItem& rItem ) const
              ( nBottomMargin == static_cast<const SvxMarginItem&>(rItem).nBottomMargin ) );
 }
 
+size_t SvxMarginItem::hashCode() const
+{
+    std::size_t seed(0);
+    o3tl::hash_combine(seed, nLeftMargin);
+    o3tl::hash_combine(seed, nTopMargin);
+    o3tl::hash_combine(seed, nRightMargin);
+    o3tl::hash_combine(seed, nBottomMargin);
+    return seed;
+}
+
 SvxMarginItem* SvxMarginItem::Clone( SfxItemPool* ) const
 {
     return new SvxMarginItem(*this);
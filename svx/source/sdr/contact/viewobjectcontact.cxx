@@ -24,6 +24,8 @@
 #include <svx/sdr/animation/animationstate.hxx>
 #include <svx/sdr/contact/viewobjectcontactredirector.hxx>
 #include <basegfx/color/bcolor.hxx>
+#include <basegfx/polygon/b2dpolygontools.hxx>
+#include <drawinglayer/primitive2d/PolygonHairlinePrimitive2D.hxx>
 #include <drawinglayer/primitive2d/modifiedcolorprimitive2d.hxx>
 #include <drawinglayer/primitive2d/animatedprimitive2d.hxx>
 #include <drawinglayer/processor2d/baseprocessor2d.hxx>
@@ -574,6 +576,24 @@ void ViewObjectContact::getPrimitive2DSequenceHierarchy(DisplayInfo& rDisplayInf
     if(!bVisible)
         return;
 
+    // level of detail: on screen, don't process the full (maybe expensive, e.g. text or hatch)
+    // content of an object that covers less than a pixel; show its range as a hairline instead
+    if(!aObjectRange.isEmpty() && !GetObjectContact().isOutputToPrinter()
+        && !GetObjectContact().isOutputToRecordingMetaFile() && !GetObjectContact().isOutputToPDFFile())
+    {
+        basegfx::B2DRange aDiscreteRange(aObjectRange);
+        aDiscreteRange.transform(rViewInformation2D.getObjectToViewTransformation());
+
+        if(aDiscreteRange.getWidth() < 1.0 && aDiscreteRange.getHeight() < 1.0)
+        {
+            const basegfx::BColor aGray(0.5, 0.5, 0.5);
+            rVisitor.visit(drawinglayer::primitive2d::Primitive2DReference(
+                new drawinglayer::primitive2d::PolygonHairlinePrimitive2D(
+                    basegfx::utils::createPolygonFromRect(aObjectRange), aGray)));
+            return;
+        }
+    }
+
     // temporarily take over the mxPrimitive2DSequence, in case it gets invalidated while we want to iterate over it
     auto tmp = std::move(const_cast<ViewObjectContact*>(this)->mxPrimitive2DSequence);
     int nPrevCount = mnActionChangedCount;
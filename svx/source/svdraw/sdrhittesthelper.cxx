@@ -29,6 +29,7 @@
 #include <drawinglayer/processor2d/hittestprocessor2d.hxx>
 #include <svx/svdpagv.hxx>
 #include <svx/sdr/contact/viewcontact.hxx>
+#include <vcl/canvastools.hxx>
 
 
 // #i101872# new Object HitTest as View-tooling
@@ -47,8 +48,14 @@ SdrObject* SdrObjectPrimitiveHit(
     if(rObject.GetSubList() && rObject.GetSubList()->GetObjCount())
     {
         // group or scene with content. Single 3D objects also have a
-        // true == rObject.GetSubList(), but no content
-        pResult = SdrObjListPrimitiveHit(*rObject.GetSubList(), rPnt, rHitTolerance, rSdrPageView, pVisiLayer, bTextOnly);
+        // true == rObject.GetSubList(), but no content. The bound rect
+        // covers all the content, so skip the whole sub list when the
+        // point is not even inside of it (big nested drawings)
+        basegfx::B2DRange aGroupRange(vcl::unotools::b2DRectangleFromRectangle(rObject.GetCurrentBoundRect()));
+        aGroupRange.grow(rHitTolerance);
+
+        if(aGroupRange.isEmpty() || aGroupRange.isInside(basegfx::B2DPoint(rPnt.X(), rPnt.Y())))
+            pResult = SdrObjListPrimitiveHit(*rObject.GetSubList(), rPnt, rHitTolerance, rSdrPageView, pVisiLayer, bTextOnly);
     }
     else
     {
@@ -133,6 +133,10 @@ class SW_DLLPUBLIC SwTextNode final
     mutable std::unique_ptr<SwNodeNum> mpNodeNumRLHidden; ///< Numbering for this paragraph (hidden redlines)
     mutable std::unique_ptr<SwNodeNum> mpNodeNumOrig; ///< Numbering for this paragraph (before changes)
 
+    /// The whole paragraph text. GetText() hands out a reference to it to
+    /// hundreds of callers (layout, filters, UNO), which is why this is not
+    /// a chunked buffer: inserting copies it, which is cheap next to the
+    /// reformatting of the paragraph that follows every edit.
     OUString m_Text;
 
     mutable sw::ParagraphIdleData m_aParagraphIdleData;
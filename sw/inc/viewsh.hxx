@@ -314,6 +314,16 @@ public:
 
     virtual void CalcLayout();  // Force complete formatting of layout.
 
+    /** Format the complete layout like CalcLayout(), but give up after about
+        nMilliSeconds, so that the caller can keep the UI responsive, report
+        progress or cancel between the slices.
+
+        @param pValidPages receives the number of leading pages that are
+               completely formatted, if not null.
+        @return true if the layout is complete.
+    */
+    SW_DLLPUBLIC bool CalcLayoutSlice( sal_uInt32 nMilliSeconds, sal_uInt16* pValidPages = nullptr );
+
     SW_DLLPUBLIC sal_uInt16 GetPageCount() const;
 
     SW_DLLPUBLIC Size GetPageSize( sal_uInt16 nPageNum, bool bSkipEmptyPages ) const;
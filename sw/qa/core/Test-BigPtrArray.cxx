@@ -160,6 +160,43 @@ public:
         releaseBigPtrArrayContent(bparr);
     }
 
+    void test_insert_many_entries_in_the_middle()
+    {
+        BigPtrArray bparr;
+
+        // more than one block, so that full blocks have to be split
+        const sal_Int32 nCount = 3 * MAXENTRY;
+        fillBigPtrArray(bparr, nCount);
+
+        for (sal_Int32 i = 0; i < nCount; i++)
+            bparr.Insert(new BigPtrEntryMock(nCount + i), nCount / 2 + i);
+
+        CPPUNIT_ASSERT_EQUAL_MESSAGE
+        (
+            "test_insert_many_entries_in_the_middle failed",
+            2 * nCount, bparr.Count()
+        );
+
+        for (sal_Int32 i = 0; i < bparr.Count(); i++)
+        {
+            sal_Int32 nExpected = i < nCount / 2 ? i
+                                  : (i < nCount / 2 + nCount ? nCount + i - nCount / 2 : i - nCount);
+            CPPUNIT_ASSERT_EQUAL_MESSAGE
+            (
+                "test_insert_many_entries_in_the_middle failed",
+                nExpected, static_cast<BigPtrEntryMock*>(bparr[i])->getCount()
+            );
+        }
+
+        CPPUNIT_ASSERT_MESSAGE
+        (
+            "test_insert_many_entries_in_the_middle failed",
+            checkElementPositions(bparr)
+        );
+
+        releaseBigPtrArrayContent(bparr);
+    }
+
     void test_insert_at_already_used_index()
     {
         BigPtrArray bparr;
@@ -528,6 +565,7 @@ public:
     CPPUNIT_TEST(test_ctor);
     CPPUNIT_TEST(test_insert_entries_at_front);
     CPPUNIT_TEST(test_insert_entries_in_the_middle);
+    CPPUNIT_TEST(test_insert_many_entries_in_the_middle);
     CPPUNIT_TEST(test_insert_at_already_used_index);
     CPPUNIT_TEST(test_insert_at_end);
     CPPUNIT_TEST(test_remove_at_front);
@@ -600,6 +638,9 @@ public:
     void test_insert_at_front_1000000()
     { test_insert_at_front("1000000"); }
 
+    void test_insert_in_the_middle_100000()
+    { test_insert_in_the_middle("100000"); }
+
     CPPUNIT_TEST_SUITE(BigPtrArrayPerformanceTest);
     CPPUNIT_TEST(test_insert_at_end_1000);
     CPPUNIT_TEST(test_insert_at_end_10000);
@@ -609,6 +650,7 @@ public:
     CPPUNIT_TEST(test_insert_at_front_10000);
     CPPUNIT_TEST(test_insert_at_front_100000);
     CPPUNIT_TEST(test_insert_at_front_1000000);
+    CPPUNIT_TEST(test_insert_in_the_middle_100000);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -637,6 +679,21 @@ private:
 
         releaseBigPtrArrayContent(bparr);
     }
+
+    // like pasting many paragraphs into the middle of a big document
+    void test_insert_in_the_middle(const char* numElements)
+    {
+        OStringBuffer buff("test_insert_in_the_middle ");
+        buff.append(numElements);
+        int n = atoi(numElements);
+        PerformanceTracer tracer(buff.getStr());
+        BigPtrArray bparr;
+        fillBigPtrArray(bparr, n);
+        for (int i = 0; i < n; i++)
+            bparr.Insert(new BigPtrEntryMock(i), n / 2 + i);
+
+        releaseBigPtrArrayContent(bparr);
+    }
 };
 
 #endif
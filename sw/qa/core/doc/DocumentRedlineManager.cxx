@@ -437,6 +437,28 @@ CPPUNIT_TEST_FIXTURE(Test, testFormatThenDel)
         CPPUNIT_ASSERT(!rRedlineData.Next());
     }
 }
+
+CPPUNIT_TEST_FIXTURE(Test, testRedlinesInOneParagraphSorted)
+{
+    // Given a paragraph with two separate insertions:
+    createSwDoc();
+    SwWrtShell* pWrtShell = getSwDocShell()->GetWrtShell();
+    pWrtShell->Insert(u"aaa bbb"_ustr);
+    RedlineFlags nMode = pWrtShell->GetRedlineFlags();
+    pWrtShell->SetRedlineFlags(nMode | RedlineFlags::On);
+    pWrtShell->Insert(u"x"_ustr);
+    pWrtShell->SttEndDoc(/*bStt=*/true);
+    pWrtShell->Insert(u"y"_ustr);
+    pWrtShell->SetRedlineFlags(nMode);
+
+    // Then make sure the redline table still allows a binary search:
+    SwDoc* pDoc = getSwDocShell()->GetDoc();
+    const SwRedlineTable& rRedlines = pDoc->getIDocumentRedlineAccess().GetRedlineTable();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), rRedlines.size());
+    // Without the accompanying fix in place, this test would have failed, redlines in the same
+    // paragraph were considered to be overlapping, making all redline lookups linear.
+    CPPUNIT_ASSERT(!rRedlines.HasOverlappingElements());
+}
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
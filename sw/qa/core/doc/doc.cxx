@@ -49,6 +49,7 @@
 #include <unotxdoc.hxx>
 #include <UndoManager.hxx>
 #include <IDocumentRedlineAccess.hxx>
+#include <IDocumentFieldsAccess.hxx>
 #include <frmmgr.hxx>
 #include <formatflysplit.hxx>
 #include <IDocumentLayoutAccess.hxx>
@@ -1181,6 +1182,38 @@ CPPUNIT_TEST_FIXTURE(SwCoreDocTest, testTableAutoFormats)
         getProperty<awt::FontSlant>(getParagraphOfText(1, xCell->getText()), u"CharPosture"_ustr));
 }
 
+CPPUNIT_TEST_FIXTURE(SwCoreDocTest, testFieldsDirtyPageNumber)
+{
+    // Given a document with a page number field in its only paragraph:
+    createSwDoc();
+    SwDoc* pDoc = getSwDoc();
+    uno::Reference<lang::XMultiServiceFactory> xFactory(mxComponent, uno::UNO_QUERY);
+    uno::Reference<text::XTextDocument> xTextDocument(mxComponent, uno::UNO_QUERY);
+    uno::Reference<text::XText> xText = xTextDocument->getText();
+    uno::Reference<text::XTextContent> xField(
+        xFactory->createInstance(u"com.sun.star.text.TextField.PageNumber"_ustr), uno::UNO_QUERY);
+    xText->insertTextContent(xText->getEnd(), xField, /*bAbsorb=*/false);
+    SwWrtShell* pWrtShell = getSwDocShell()->GetWrtShell();
+    const SwNode& rNode = pWrtShell->GetCursor()->GetPointNode();
+
+    // When editing that paragraph:
+    IDocumentFieldsAccess& rIDFA = pDoc->getIDocumentFieldsAccess();
+    rIDFA.SetFieldsDirty(false, nullptr, SwNodeOffset(0));
+    bool bFieldsFound = rIDFA.SetFieldsDirty(true, &rNode, SwNodeOffset(1));
+
+    // Then the idle field update is not requested, page numbers are expanded by the layout:
+    // Without the accompanying fix in place, this test would have failed, any field in the
+    // paragraph made every edit recalculate all expression fields.
+    CPPUNIT_ASSERT(!bFieldsFound);
+
+    // But a chapter field still needs the update:
+    xField.set(xFactory->createInstance(u"com.sun.star.text.TextField.Chapter"_ustr),
+               uno::UNO_QUERY);
+    xText->insertTextContent(xText->getEnd(), xField, /*bAbsorb=*/false);
+    rIDFA.SetFieldsDirty(false, nullptr, SwNodeOffset(0));
+    CPPUNIT_ASSERT(rIDFA.SetFieldsDirty(true, &rNode, SwNodeOffset(1)));
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -204,6 +204,37 @@ CPPUNIT_TEST_FIXTURE(Test, testIdleLayoutingAnyInput)
     Scheduler::ProcessEventsToIdle();
 #endif
 }
+
+CPPUNIT_TEST_FIXTURE(Test, testCalcLayoutSlice)
+{
+    // Given a document with 10 pages:
+    createSwDoc();
+    SwWrtShell* pWrtShell = getSwDocShell()->GetWrtShell();
+    for (int i = 0; i < 9; ++i)
+    {
+        pWrtShell->Insert(u"test"_ustr);
+        pWrtShell->InsertPageBreak();
+    }
+    pWrtShell->CalcLayout();
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(10), pWrtShell->GetPageCount());
+
+    // When formatting the invalidated layout in slices that end at once:
+    pWrtShell->StartAction();
+    pWrtShell->Reformat();
+    sal_uInt16 nValidPages = 0;
+    int nSlices = 1;
+    while (!pWrtShell->CalcLayoutSlice(0, &nValidPages))
+    {
+        CPPUNIT_ASSERT(nValidPages < 10);
+        CPPUNIT_ASSERT_LESS(1000, ++nSlices);
+    }
+    pWrtShell->EndAction();
+
+    // Then the layout was calculated in several slices, up to the last page:
+    CPPUNIT_ASSERT_GREATER(1, nSlices);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(10), nValidPages);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(10), pWrtShell->GetPageCount());
+}
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -521,6 +521,11 @@ public:
     {
         return maEvents.erase( aPos );
     }
+    // iterators to the moved event stay valid
+    void move_to_end( const std::list<SwAccessibleEvent_Impl>::iterator& aPos )
+    {
+        maEvents.splice( maEvents.end(), maEvents, aPos );
+    }
 };
 
 // see comment in SwAccessibleMap::InvalidatePosOrSize()
@@ -532,19 +537,16 @@ void SwAccessibleEventList_Impl::MoveMissingXAccToEnd()
     {
         return;
     }
-    SwAccessibleEventList_Impl lstEvent;
+    std::list<SwAccessibleEvent_Impl> lstEvent;
     for (auto li = begin(); li != end(); )
     {
         if (li->IsNoXaccParentFrame())
-        {
-            lstEvent.insert(lstEvent.end(), *li);
-            li = erase(li);
-        }
+            lstEvent.splice(lstEvent.end(), maEvents, li++);
         else
             ++li;
     }
     assert(size() + lstEvent.size() == nSize);
-    maEvents.insert(end(),lstEvent.begin(),lstEvent.end());
+    maEvents.splice(end(), lstEvent);
     assert(size() == nSize);
 }
 
@@ -952,7 +954,8 @@ void SwAccessibleMap::AppendEvent( const SwAccessibleEvent_Impl& rEvent )
                                         mpEventMap->find( rEvent.GetFrameOrObj() );
         if( aIter != mpEventMap->end() )
         {
-            SwAccessibleEvent_Impl aEvent( *(*aIter).second );
+            // the stored event is merged in place and then moved to the back
+            SwAccessibleEvent_Impl& aEvent = *(*aIter).second;
             assert( aEvent.GetType() != SwAccessibleEvent_Impl::DISPOSE &&
                     "dispose events should not be stored" );
             bool bAppendEvent = true;
@@ -1030,8 +1033,7 @@ void SwAccessibleMap::AppendEvent( const SwAccessibleEvent_Impl& rEvent )
             }
             if( bAppendEvent )
             {
-                mpEvents->erase( (*aIter).second );
-                (*aIter).second = mpEvents->insert( mpEvents->end(), aEvent );
+                mpEvents->move_to_end( (*aIter).second );
             }
             else
             {
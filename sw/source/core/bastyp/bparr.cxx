@@ -229,11 +229,12 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
 
     if( p->nElem == MAXENTRY )
     {
-        // does the last entry fit into the next block?
-        BlockInfo* q;
-        if( cur < ( m_nBlock - 1 ) && m_ppInf[ cur+1 ]->nElem < MAXENTRY )
+        // does the last entry fit into the next block? Only push it there if
+        // that's cheap, otherwise every following insertion at about the same
+        // position would have to move all entries of the next block again.
+        if( cur < ( m_nBlock - 1 ) && m_ppInf[ cur+1 ]->nElem < MAXENTRY / 2 )
         {
-            q = m_ppInf[ cur+1 ];
+            BlockInfo* q = m_ppInf[ cur+1 ];
             if( q->nElem )
             {
                 int nCount = q->nElem;
@@ -247,6 +248,18 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
             }
             q->nStart--;
             q->nEnd--;
+
+            // entry does not fit anymore - clear space
+            BigPtrEntry* pLast = p->mvData[ MAXENTRY-1 ];
+            pLast->m_nOffset = 0;
+            pLast->m_pBlock = q;
+
+            q->mvData[ 0 ] = pLast;
+            q->nElem++;
+            q->nEnd++;
+
+            p->nEnd--;
+            p->nElem--;
         }
         else
         {
@@ -262,20 +275,30 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
                 return ;
             }
 
-            q = InsBlock( cur+1 );
+            // split the full block: its upper half goes into the new one
+            BlockInfo* q = InsBlock( cur+1 );
+            const sal_uInt16 nMove = MAXENTRY / 2;
+            auto pFrom = p->mvData.begin() + ( MAXENTRY - nMove );
+            auto pTo = q->mvData.begin();
+            for( sal_uInt16 nOff = 0; nOff < nMove; ++nOff, ++pTo )
+            {
+                *pTo = *pFrom++;
+                (*pTo)->m_pBlock = q;
+                (*pTo)->m_nOffset = nOff;
+            }
+            q->nElem = nMove;
+            q->nEnd = p->nEnd;
+            q->nStart = p->nEnd - nMove + 1;
+            p->nElem = p->nElem - nMove;
+            p->nEnd -= nMove;
+
+            // insert into the new block if pos is behind the remaining half
+            if( pos > p->nEnd + 1 )
+            {
+                p = q;
+                ++cur;
+            }
         }
-
-        // entry does not fit anymore - clear space
-        BigPtrEntry* pLast = p->mvData[ MAXENTRY-1 ];
-        pLast->m_nOffset = 0;
-        pLast->m_pBlock = q;
-
-        q->mvData[ 0 ] = pLast;
-        q->nElem++;
-        q->nEnd++;
-
-        p->nEnd--;
-        p->nElem--;
     }
     // now we have free space - insert
     pos -= p->nStart;
@@ -184,6 +184,33 @@ namespace
     #endif
         }
     }
+
+    /// Does the idle field update (expression, chapter, table and reference
+    /// fields) recalculate fields of this type? Fields of other types, like
+    /// page numbers, dates or document information, are expanded by the
+    /// layout and editing their paragraph doesn't require a full update.
+    bool lcl_IsFieldUpdatedWhenDirty( SwFieldIds nWhich )
+    {
+        switch( nWhich )
+        {
+        case SwFieldIds::SetExp:
+        case SwFieldIds::GetExp:
+        case SwFieldIds::User:
+        case SwFieldIds::HiddenText:
+        case SwFieldIds::HiddenPara:
+        case SwFieldIds::Database:
+        case SwFieldIds::DatabaseName:
+        case SwFieldIds::DbSetNumber:
+        case SwFieldIds::DbNextSet:
+        case SwFieldIds::DbNumSet:
+        case SwFieldIds::Chapter:
+        case SwFieldIds::Table:
+        case SwFieldIds::GetRef:
+            return true;
+        default:
+            return false;
+        }
+    }
 }
 
 namespace sw
@@ -1299,8 +1326,12 @@ bool DocumentFieldsManager::SetFieldsDirty( bool b, const SwNode* pChk, SwNodeOf
                     for( size_t n = 0 ; n < nEnd; ++n )
                     {
                         const SwTextAttr* pAttr = pTNd->GetSwpHints().Get(n);
-                        if (   pAttr->Which() == RES_TXTATR_FIELD
-                            || pAttr->Which() == RES_TXTATR_INPUTFIELD)
+                        // input fields may feed variables, other fields only
+                        // matter if the idle update recalculates them
+                        if (   pAttr->Which() == RES_TXTATR_INPUTFIELD
+                            || (   pAttr->Which() == RES_TXTATR_FIELD
+                                && lcl_IsFieldUpdatedWhenDirty(
+                                    pAttr->GetFormatField().GetField()->GetTyp()->Which())))
                         {
                             b = true;
                             break;
@@ -281,9 +281,12 @@ class WordArrayComparator : public ArrayComparator
 private:
     const SwTextNode *m_pTextNode1, *m_pTextNode2;
     std::unique_ptr<int[]> m_pPos1, m_pPos2;
+    std::unique_ptr<sal_uInt32[]> m_pHash1, m_pHash2; // per-word hashes to reject quickly
     int m_nCount1, m_nCount2;       // number of words
 
     static void CalcPositions( int *pPos, const SwTextNode *pTextNd, int &nCnt );
+    static void CalcHashes( sal_uInt32 *pHash, const int *pPos, const SwTextNode *pTextNd,
+                            int nCnt );
 
 public:
     WordArrayComparator( const SwTextNode *pNode1, const SwTextNode *pNode2 );
@@ -2257,10 +2260,22 @@ WordArrayComparator::WordArrayComparator( const SwTextNode *pNode1,
 
     CalcPositions( m_pPos1.get(), m_pTextNode1, m_nCount1 );
     CalcPositions( m_pPos2.get(), m_pTextNode2, m_nCount2 );
+
+    m_pHash1.reset( new sal_uInt32[ m_nCount1 ] );
+    m_pHash2.reset( new sal_uInt32[ m_nCount2 ] );
+
+    CalcHashes( m_pHash1.get(), m_pPos1.get(), m_pTextNode1, m_nCount1 );
+    CalcHashes( m_pHash2.get(), m_pPos2.get(), m_pTextNode2, m_nCount2 );
 }
 
 bool WordArrayComparator::Compare( int nIdx1, int nIdx2 ) const
 {
+    // Called O(n*m) times by the LCS search, so reject differing words
+    // without looking at their characters
+    if( m_pHash1[ nIdx1 ] != m_pHash2[ nIdx2 ] )
+    {
+        return false;
+    }
     int nLen = m_pPos1[ nIdx1 + 1 ] - m_pPos1[ nIdx1 ];
     if( nLen != m_pPos2[ nIdx2 + 1 ] - m_pPos2[ nIdx2 ] )
     {
@@ -2309,6 +2324,21 @@ int WordArrayComparator::GetCharSequence( const int *pWordLcs1,
     return nLen;
 }
 
+void WordArrayComparator::CalcHashes( sal_uInt32 *pHash, const int *pPos,
+                                      const SwTextNode *pTextNd, int nCnt )
+{
+    const OUString& rText = pTextNd->GetText();
+    for( int i = 0; i < nCnt; i++ )
+    {
+        sal_uInt32 nHash = 0;
+        for( int j = pPos[ i ]; j < pPos[ i + 1 ]; j++ )
+        {
+            nHash = nHash * 31 + rText[ j ];
+        }
+        pHash[ i ] = nHash;
+    }
+}
+
 void WordArrayComparator::CalcPositions( int *pPos, const SwTextNode *pTextNd,
                                          int &nCnt )
 {
@@ -460,12 +460,15 @@ void SwRedlineTable::CheckOverlapping(vector_type::const_iterator it)
         return;
     if (maVector.size() <= 1) // a single element cannot be overlapping
         return;
+    // Compare positions, not just nodes: redlines that follow each other in
+    // the same paragraph are common and still allow a binary search, their
+    // ends are sorted as well.
     auto pCurr = *it;
     auto itNext = it + 1;
     if (itNext != maVector.end())
     {
         auto pNext = *itNext;
-        if (pCurr->End()->GetNodeIndex() >= pNext->Start()->GetNodeIndex())
+        if (*pCurr->End() > *pNext->Start())
         {
             m_bHasOverlappingElements = true;
             return;
@@ -474,7 +477,7 @@ void SwRedlineTable::CheckOverlapping(vector_type::const_iterator it)
     if (it != maVector.begin())
     {
         auto pPrev = *(it - 1);
-        if (pPrev->End()->GetNodeIndex() >= pCurr->Start()->GetNodeIndex())
+        if (*pPrev->End() > *pCurr->Start())
             m_bHasOverlappingElements = true;
     }
 }
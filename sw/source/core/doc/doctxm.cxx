@@ -70,6 +70,7 @@
 #include <o3tl/safeint.hxx>
 #include <osl/diagnose.h>
 
+#include <algorithm>
 #include <memory>
 
 using namespace ::com::sun::star;
@@ -2141,9 +2142,21 @@ void SwTOXBaseSection::InsertSorted(std::unique_ptr<SwTOXSortTabBase> pNew)
     }
 
     // find position and insert
-    tools::Long i;
+    tools::Long i = aRange.Min();
+
+    // Apart from keyword indexes and bibliographies the entries are ordered by
+    // node position first, and an entry at an earlier node is neither equivalent
+    // to nor sorted after the new one: skip all of those by bisection.
+    if (TOX_INDEX != SwTOXBase::GetType() && TOX_AUTHORITIES != SwTOXBase::GetType())
+    {
+        i = std::lower_bound(m_aSortArr.begin() + aRange.Min(), m_aSortArr.begin() + aRange.Max(),
+                             pNew->nPos,
+                             [](const std::unique_ptr<SwTOXSortTabBase>& rOld, SwNodeOffset nPos)
+                             { return rOld->nPos < nPos; })
+            - m_aSortArr.begin();
+    }
 
-    for( i = aRange.Min(); i < aRange.Max(); ++i)
+    for( ; i < aRange.Max(); ++i)
     {   // Only check for same level
         SwTOXSortTabBase* pOld = m_aSortArr[i].get();
         if (pOld->equivalent(*pNew))
@@ -82,6 +82,7 @@ class SwLayAction
                                 // WaitCursor can be enabled via CheckWaitCursor()
 
     VclInputFlags m_nInputType;   // Which input should terminate processing
+    sal_uInt64 m_nSliceEndTicks;  // If != 0, the system ticks at which processing is terminated
     sal_uInt16 m_nEndPage;        // StatBar control
     sal_uInt16 m_nCheckPageNum;   // CheckPageDesc() was delayed if != USHRT_MAX
                                 // check from this page onwards
@@ -155,6 +156,8 @@ public:
     void SetComplete    ( bool bNew )   { m_bComplete = bNew; }
     void SetStatBar     ( bool bNew );
     void SetInputType   ( VclInputFlags nNew ) { m_nInputType = nNew; }
+    // Terminate processing like on input after nMilliSeconds
+    void SetTimeSlice   ( sal_uInt32 nMilliSeconds );
     void SetCalcLayout  ( bool bNew )   { m_bCalcLayout = bNew; }
     void SetReschedule  ( bool bNew )   { m_bReschedule = bNew; }
     void SetWaitAllowed ( bool bNew )   { m_bWaitAllowed = bNew; }
@@ -1665,6 +1665,8 @@ void InsertCnt_( SwLayoutFrame *pLay, SwDoc& rDoc,
                 }
             }
 #endif
+            if (pPageMaker)
+                pPageMaker->CheckParaHeight( *pFrame, nIndex );
             // OD 12.08.2003 #i17969# - consider horizontal/vertical layout
             // for setting position at newly inserted frame
             lcl_SetPos( *pFrame, *pLay );
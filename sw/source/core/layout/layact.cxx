@@ -68,6 +68,7 @@
 #include <fntcache.hxx>
 #include <fmtanchr.hxx>
 #include <comphelper/scopeguard.hxx>
+#include <tools/time.hxx>
 #include <vector>
 #include <comphelper/diagnose_ex.hxx>
 #include <comphelper/lok.hxx>
@@ -92,6 +93,9 @@ inline void SwLayAction::CheckIdleEnd()
     if (!IsInterrupt())
         m_bInterrupt = bool(GetInputType()) && Application::AnyInput(GetInputType());
 
+    if (!IsInterrupt() && m_nSliceEndTicks)
+        m_bInterrupt = tools::Time::GetSystemTicks() >= m_nSliceEndTicks;
+
     if (comphelper::LibreOfficeKit::isActive() && !IsInterrupt() && bool(GetInputType()))
     {
         // Also check if the LOK client has any pending input events.
@@ -99,6 +103,11 @@ inline void SwLayAction::CheckIdleEnd()
     }
 }
 
+void SwLayAction::SetTimeSlice( sal_uInt32 nMilliSeconds )
+{
+    m_nSliceEndTicks = tools::Time::GetSystemTicks() + nMilliSeconds;
+}
+
 void SwLayAction::SetStatBar( bool bNew )
 {
     if ( bNew )
@@ -263,6 +272,7 @@ SwLayAction::SwLayAction( SwRootFrame *pRt, SwViewShellImp *pI ) :
     m_nPreInvaPage( USHRT_MAX ),
     m_nStartTicks( std::clock() ),
     m_nInputType( VclInputFlags::NONE ),
+    m_nSliceEndTicks( 0 ),
     m_nEndPage( USHRT_MAX ),
     m_nCheckPageNum( USHRT_MAX )
 {
@@ -289,6 +299,7 @@ void SwLayAction::Reset()
     m_pOptTab = nullptr;
     m_nStartTicks = std::clock();
     m_nInputType = VclInputFlags::NONE;
+    m_nSliceEndTicks = 0;
     m_nEndPage = m_nPreInvaPage = m_nCheckPageNum = USHRT_MAX;
     m_bPaint = m_bComplete = m_bWaitAllowed = m_bCheckPages = true;
     m_bInterrupt = m_bNextCycle = m_bCalcLayout = m_bIdle = m_bReschedule =
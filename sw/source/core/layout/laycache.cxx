@@ -47,13 +47,43 @@
 #include <node.hxx>
 #include <ndtxt.hxx>
 #include <frameformats.hxx>
+#include <ndhints.hxx>
 
+#include <o3tl/hash_combine.hxx>
+
+#include <algorithm>
 #include <limits>
 
 using namespace ::com::sun::star;
 
 SwLayoutCache::SwLayoutCache() : m_nLockCount( 0 ) {}
 
+namespace {
+
+/// The hash which validates a cached paragraph height: the text, the count
+/// of the paragraph attributes and hints, and the width of the page.
+sal_uInt32 lcl_GetParaHash( const SwTextNode& rNode, const SwPageFrame& rPage )
+{
+    sal_uInt32 nHash = static_cast<sal_uInt32>( rNode.GetText().hashCode() );
+    o3tl::hash_combine( nHash, rNode.HasSwAttrSet() ? rNode.GetSwAttrSet().Count() : 0 );
+    o3tl::hash_combine( nHash, rNode.HasHints() ? rNode.GetSwpHints().Count() : 0 );
+    o3tl::hash_combine( nHash, rPage.getFramePrintArea().Width() );
+    return nHash;
+}
+
+/// Only paragraphs directly in the body, which aren't split, have a height
+/// which can be reused.
+bool lcl_IsParaHeightCacheable( const SwFrame& rFrame )
+{
+    if( !rFrame.IsTextFrame() || rFrame.IsVertical() )
+        return false;
+    const SwTextFrame& rTextFrame = static_cast<const SwTextFrame&>(rFrame);
+    return !rTextFrame.IsFollow() && !rTextFrame.HasFollow() &&
+           !rTextFrame.GetMergedPara();
+}
+
+}
+
 /*
  *  Reading and writing of the layout cache.
  *  The layout cache is not necessary, but it improves
@@ -141,6 +171,19 @@ bool SwLayCacheImpl::Read( SvStream& rStream )
             aIo.CloseRec();
             break;
         }
+        case SW_LAYCACHE_IO_REC_HEIGHT:
+        {
+            aIo.OpenRec( SW_LAYCACHE_IO_REC_HEIGHT );
+            aIo.OpenFlagRec();
+            sal_uInt32 nHash(0);
+            sal_Int32 nHeight(0);
+            aIo.GetStream().ReadUInt32( nIndex ).ReadUInt32( nHash ).ReadInt32( nHeight );
+            aIo.CloseFlagRec();
+            if( nHeight > 0 )
+                m_aParaHeights.push_back( { SwNodeOffset(nIndex), nHash, nHeight } );
+            aIo.CloseRec();
+            break;
+        }
         default:
             aIo.SkipRec();
             break;
@@ -148,9 +191,24 @@ bool SwLayCacheImpl::Read( SvStream& rStream )
     }
     aIo.CloseRec();
 
+    // the records are written page by page, but a table spanning pages may
+    // change the order
+    std::stable_sort( m_aParaHeights.begin(), m_aParaHeights.end(),
+        []( const SwParaHeight& rA, const SwParaHeight& rB ) { return rA.nIndex < rB.nIndex; } );
+
     return !aIo.HasError();
 }
 
+bool SwLayCacheImpl::GetParaHeight( SwNodeOffset nIndex, sal_uInt32 nHash, sal_Int32& rHeight ) const
+{
+    auto it = std::lower_bound( m_aParaHeights.begin(), m_aParaHeights.end(), nIndex,
+        []( const SwParaHeight& rEntry, SwNodeOffset nIdx ) { return rEntry.nIndex < nIdx; } );
+    if( it == m_aParaHeights.end() || it->nIndex != nIndex || it->nHash != nHash )
+        return false;
+    rHeight = it->nHeight;
+    return true;
+}
+
 /** writes the index (more precise: the difference between
  * the index and the first index of the document content)
  * of the first paragraph/table at the top of every page.
@@ -158,7 +216,8 @@ bool SwLayCacheImpl::Read( SvStream& rStream )
  * from the bottom of the previous page, the character/row
  * number is stored, too.
  * The position, size and page number of the text frames
- * are stored, too
+ * are stored, too, and the heights of the paragraphs which
+ * are completely at one page.
  */
 void SwLayoutCache::Write( SvStream &rStream, const SwDoc& rDoc )
 {
@@ -319,6 +378,30 @@ void SwLayoutCache::Write( SvStream &rStream, const SwDoc& rDoc )
         }
         pPage = static_cast<SwPageFrame*>(pPage->GetNext());
     }
+
+    pPage = static_cast<SwPageFrame*>(rDoc.getIDocumentLayoutAccess().GetCurrentLayout()->Lower());
+    while( pPage )
+    {
+        const SwLayoutFrame* pBody = pPage->FindBodyCont();
+        for( const SwFrame* pTmp = pBody ? pBody->Lower() : nullptr; pTmp; pTmp = pTmp->GetNext() )
+        {
+            if( !lcl_IsParaHeightCacheable( *pTmp ) || !pTmp->isFrameAreaDefinitionValid() )
+                continue;
+            const SwTextNode& rNode = *static_cast<const SwTextFrame*>(pTmp)->GetTextNodeFirst();
+            if( rNode.GetIndex() <= nStartOfContent )
+                continue;
+            /* Open Height Record */
+            aIo.OpenRec( SW_LAYCACHE_IO_REC_HEIGHT );
+            aIo.OpenFlagRec( 0, 12 );
+            aIo.GetStream().WriteUInt32( sal_Int32(rNode.GetIndex() - nStartOfContent) )
+                           .WriteUInt32( lcl_GetParaHash( rNode, *pPage ) )
+                           .WriteInt32( pTmp->getFrameArea().Height() );
+            aIo.CloseFlagRec();
+            /* Close Height Record */
+            aIo.CloseRec();
+        }
+        pPage = static_cast<SwPageFrame*>(pPage->GetNext());
+    }
     aIo.CloseRec();
 }
 
@@ -904,6 +987,20 @@ struct FlyCacheCompare
  * If there are text frames with default position, the fly cache
  * is checked, if these frames are stored in the cache.
  */
+void SwLayHelper::CheckParaHeight_( SwFrame& rFrame, SwNodeOffset nNodeIndex )
+{
+    if( !mrpLay->IsBodyFrame() || !lcl_IsParaHeightCacheable( rFrame ) )
+        return;
+    const SwTextNode& rNode = *static_cast<SwTextFrame&>(rFrame).GetTextNodeFirst();
+    sal_Int32 nHeight;
+    if( mpImpl->GetParaHeight( nNodeIndex - mnStartOfContent,
+                               lcl_GetParaHash( rNode, *mrpPage ), nHeight ) )
+    {
+        SwFrameAreaDefinition::FrameAreaWriteAccess aFrm( rFrame );
+        aFrm.Height( nHeight );
+    }
+}
+
 void SwLayHelper::CheckFlyCache_( SwPageFrame* pPage )
 {
     if( !mpImpl || !pPage )
@@ -48,11 +48,23 @@ class SvStream;
  * and if it's not the first part of the table/paragraph,
  * the row/character-offset inside the table/paragraph.
  * The text frame positions are stored in the SwPageFlyCache array.
+ * The heights of the paragraphs which fit completely into the body of a
+ * page are stored in the SwParaHeightCache array, together with a hash of
+ * the paragraph content and the page width to validate them.
  */
 
 class SwFlyCache;
 typedef std::vector<SwFlyCache> SwPageFlyCache;
 
+struct SwParaHeight
+{
+    SwNodeOffset nIndex; ///< relative to the start of the content
+    sal_uInt32 nHash;
+    sal_Int32 nHeight;
+};
+/// sorted by node index
+typedef std::vector<SwParaHeight> SwParaHeightCache;
+
 class SwLayCacheImpl
 {
     std::vector<SwNodeOffset> mIndices;
@@ -60,6 +72,7 @@ class SwLayCacheImpl
     std::deque<sal_Int32> m_aOffset;
     std::vector<sal_uInt16> m_aType;
     SwPageFlyCache m_FlyCache;
+    SwParaHeightCache m_aParaHeights;
     bool m_bUseFlyCache;
     void Insert( sal_uInt16 nType, SwNodeOffset nIndex, sal_Int32 nOffset );
 
@@ -78,6 +91,11 @@ public:
     inline SwFlyCache& GetFlyCache( size_t nIdx );
 
     bool IsUseFlyCache() const { return m_bUseFlyCache; }
+
+    bool HasParaHeights() const { return !m_aParaHeights.empty(); }
+    /// Returns the cached height of the paragraph at the relative index
+    /// nIndex, if it was written for the same hash.
+    bool GetParaHeight( SwNodeOffset nIndex, sal_uInt32 nHash, sal_Int32& rHeight ) const;
 };
 
 // Helps to create the sectionframes during the InsertCnt_-function
@@ -119,6 +137,7 @@ class SwLayHelper
     size_t mnFlyIdx;                         ///< the index in the fly cache array
     bool mbFirst : 1;
     void CheckFlyCache_( SwPageFrame* pPage );
+    void CheckParaHeight_( SwFrame& rFrame, SwNodeOffset nNodeIndex );
 public:
     SwLayHelper( SwDoc& rDoc, SwFrame* &rpF, SwFrame* &rpP, SwPageFrame* &rpPg,
             SwLayoutFrame* &rpL, std::unique_ptr<SwActualSection> &rpA,
@@ -134,6 +153,12 @@ public:
     /// position, if they are in the fly cache.
     void CheckFlyCache( SwPageFrame* pPage )
     { if( mpImpl && mnFlyIdx < mpImpl->GetFlyCount() ) CheckFlyCache_( pPage ); }
+
+    /// Give a fresh text frame the height it had when the document was saved,
+    /// if the paragraph and the page width are unchanged. The frame stays
+    /// invalid, but its formatting doesn't move the following frames then.
+    void CheckParaHeight( SwFrame& rFrame, SwNodeOffset nNodeIndex )
+    { if( mpImpl && mpImpl->HasParaHeights() ) CheckParaHeight_( rFrame, nNodeIndex ); }
 };
 
 // Contains the data structures that are required to read and write a layout cache.
@@ -141,9 +166,10 @@ public:
 #define SW_LAYCACHE_IO_REC_PARA     'P'
 #define SW_LAYCACHE_IO_REC_TABLE    'T'
 #define SW_LAYCACHE_IO_REC_FLY      'F'
+#define SW_LAYCACHE_IO_REC_HEIGHT   'H'
 
 #define SW_LAYCACHE_IO_VERSION_MAJOR    1
-#define SW_LAYCACHE_IO_VERSION_MINOR    1
+#define SW_LAYCACHE_IO_VERSION_MINOR    2
 
 class SwLayCacheIoImpl
 {
@@ -5264,6 +5264,14 @@ static SwTwips lcl_calcHeightOfRowBeforeThisFrame(const SwRowFrame& rRow)
     const SwTabFrame* pTab = rRow.FindTabFrame();
     if (!pLine || !pTab || !pTab->IsFollow())
         return 0;
+    // Only the first non-headline row of a follow can be the continuation of a split row. Check
+    // that before iterating over the row frames of the line's format: that format may be shared
+    // by all rows of the table, which would make formatting big tables quadratic.
+    const SwFrame* pTabRow = &rRow;
+    while (pTabRow->GetUpper() && !pTabRow->GetUpper()->IsTabFrame())
+        pTabRow = pTabRow->GetUpper();
+    if (pTabRow != pTab->GetFirstNonHeadlineRow())
+        return 0;
     SwTwips nResult = 0;
     SwIterator<SwRowFrame, SwFormat> aIter(*pLine->GetFrameFormat());
     for (const SwRowFrame* pCurRow = aIter.First(); pCurRow; pCurRow = aIter.Next())
@@ -2108,6 +2108,12 @@ public:
 
 // We calculate the text frame's size and send a notification.
 // Shrink() or Grow() to adjust the frame's size to the changed required space.
+// Formatting has to run on the main thread, one frame after the other: the
+// portions are built with the shared SwFntCache and the reference device,
+// which are not thread safe, and the paragraph cache (SwTextFrame::GetPara())
+// lives in the global SwCache. The layout cache gives unchanged paragraphs
+// their saved height on load (SwLayHelper::CheckParaHeight()), which keeps
+// the text flow small instead.
 void SwTextFrame::Format( vcl::RenderContext* pRenderContext, const SwBorderAttrs * )
 {
     // tdf#92091: SwTextFrame::Format is re-entrant, but may change VCL global state.
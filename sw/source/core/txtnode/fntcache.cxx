@@ -862,12 +862,20 @@ static void DrawTextArray(OutputDevice& rOutputDevice, const Point& rStartPt, co
         auto nContextEnd = std::clamp(nLayoutContext->m_nEnd, nStrEnd, rStr.getLength());
         auto nContextLen = nContextEnd - nContextBegin;
 
+        // Reuse the glyphs of the last paint of the same text, or of its formatting if that was
+        // done with the same device, instead of laying out the text again on every repaint.
+        const SalLayoutGlyphs* pLayoutCache = SalLayoutGlyphsCache::self()->GetLayoutGlyphs(
+            &rOutputDevice, rStr, nContextBegin, nContextLen, nIndex, nIndex + nLen);
         rOutputDevice.DrawPartialTextArray(rStartPt, rStr, aKernArray, pKashidaAry, nContextBegin,
-                                           nContextLen, nIndex, nLen);
+                                           nContextLen, nIndex, nLen, SalLayoutFlags::NONE,
+                                           pLayoutCache);
     }
     else
     {
-        rOutputDevice.DrawTextArray(rStartPt, rStr, aKernArray, pKashidaAry, nIndex, nLen);
+        const SalLayoutGlyphs* pLayoutCache
+            = SalLayoutGlyphsCache::self()->GetLayoutGlyphs(&rOutputDevice, rStr, nIndex, nLen);
+        rOutputDevice.DrawTextArray(rStartPt, rStr, aKernArray, pKashidaAry, nIndex, nLen,
+                                    SalLayoutFlags::NONE, pLayoutCache);
     }
 }
 
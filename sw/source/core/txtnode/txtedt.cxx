@@ -1409,6 +1409,11 @@ SwRect SwTextFrame::AutoSpell_(SwTextNode & rNode, sal_Int32 nActPos)
         SwScanner aScanner( *pNode, pNode->GetText(), nullptr, ModelToViewHelper(),
                             WordType::DICTIONARY_WORD, nBegin, nEnd);
 
+        // the language rarely changes between words, ask the spell checker
+        // about it only once per run of words in the same language
+        LanguageType eLastLang = LANGUAGE_DONTKNOW;
+        bool bHasLanguage = false;
+
         bool bNextWord = aScanner.NextWord();
         while( bNextWord )
         {
@@ -1420,9 +1425,14 @@ SwRect SwTextFrame::AutoSpell_(SwTextNode & rNode, sal_Int32 nActPos)
             // get next language for next word, consider language attributes
             // within the word
             LanguageType eActLang = aScanner.GetCurrentLanguage();
-            DetectAndMarkMissingDictionaries( rDoc, xSpell, eActLang );
+            if( eActLang != eLastLang )
+            {
+                eLastLang = eActLang;
+                bHasLanguage = xSpell.is() && xSpell->hasLanguage( static_cast<sal_uInt16>(eActLang) );
+                rDoc.SetMissingDictionaries( xSpell.is() && !bHasLanguage );
+            }
 
-            bool bSpell = xSpell.is() && xSpell->hasLanguage( static_cast<sal_uInt16>(eActLang) );
+            bool bSpell = bHasLanguage;
             if( bSpell && !rWord.isEmpty() && !lcl_IsURL(rWord, *pNode, nBegin, nLen) )
             {
                 // check for: bAlter => xHyphWord.is()
@@ -2170,6 +2180,22 @@ bool SwTextNode::CountWords( SwDocStat& rStat,
     {   // not counting hidden paras
         return false;
     }
+    // Shortcut when counting whole non-empty paragraph and current count is
+    // clean: the numbering only matters for empty paragraphs here, and
+    // getting the numbering string is not cheap
+    if ( bCountAll && nStt != nEnd && !IsWordCountDirty() )
+    {
+        // count of non-empty paras
+        ++rStat.nPara;
+
+        // accumulate into DocStat record to return the values
+        rStat.nWord += m_aParagraphIdleData.nNumberOfWords;
+        rStat.nAsianWord += m_aParagraphIdleData.nNumberOfAsianWords;
+        rStat.nChar += m_aParagraphIdleData.nNumberOfChars;
+        rStat.nCharExcludingSpaces += m_aParagraphIdleData.nNumberOfCharsExcludingSpaces;
+        return false;
+    }
+
     // count words in numbering string if started at beginning of para:
     bool bCountNumbering = nStt == 0;
     bool bHasBullet = false, bHasNumbering = false;
@@ -70,6 +70,7 @@
 #include <com/sun/star/beans/PropertyAttribute.hpp>
 #include <com/sun/star/beans/NamedValue.hpp>
 #include <com/sun/star/i18n/WordType.hpp>
+#include <algorithm>
 #include <memory>
 #include <unoparaframeenum.hxx>
 #include <unoparagraph.hxx>
@@ -1909,6 +1910,29 @@ static bool propertyCausesSideEffectsInNodes(sal_uInt16 nWID)
            nWID == FN_UNO_NUM_RULES;
 }
 
+namespace
+{
+// Build the ranges for all which ids at once: merging them one by one into a
+// WhichRangesContainer allocates for every property, which adds up for import
+// filters setting dozens of properties on every text portion.
+WhichRangesContainer MakeWhichRanges(std::vector<sal_uInt16>& rWhichIds)
+{
+    if (rWhichIds.empty())
+        return WhichRangesContainer();
+    std::sort(rWhichIds.begin(), rWhichIds.end());
+    std::unique_ptr<WhichPair[]> pPairs(new WhichPair[rWhichIds.size()]);
+    sal_Int32 nPairs = 0;
+    for (sal_uInt16 nWhich : rWhichIds)
+    {
+        if (nPairs && nWhich <= pPairs[nPairs - 1].second + 1)
+            pPairs[nPairs - 1].second = std::max(pPairs[nPairs - 1].second, nWhich);
+        else
+            pPairs[nPairs++] = { nWhich, nWhich };
+    }
+    return WhichRangesContainer(std::move(pPairs), nPairs);
+}
+}
+
 void SwUnoCursorHelper::SetPropertyValues(
     SwPaM& rPaM, const SfxItemPropertySet& rPropSet,
     const uno::Sequence< beans::PropertyValue > &rPropertyValues,
@@ -1931,7 +1955,8 @@ void SwUnoCursorHelper::SetPropertyValues(
     OUString aUnknownExMsg, aPropertyVetoExMsg;
 
     // Build set of attributes we want to fetch
-    WhichRangesContainer aRanges;
+    std::vector<sal_uInt16> aWhichIds;
+    aWhichIds.reserve(aPropertyValues.size());
     std::vector<std::pair<const SfxItemPropertyMapEntry*, const uno::Any&>> aSideEffectsEntries;
     std::vector<std::pair<const SfxItemPropertyMapEntry*, const uno::Any&>> aEntries;
     aEntries.reserve(aPropertyValues.size());
@@ -1959,7 +1984,7 @@ void SwUnoCursorHelper::SetPropertyValues(
         }
         else
         {
-            aRanges = aRanges.MergeRange(pEntry->nWID, pEntry->nWID);
+            aWhichIds.push_back(pEntry->nWID);
             aEntries.emplace_back(pEntry, rPropVal.Value);
         }
     }
@@ -1979,7 +2004,7 @@ void SwUnoCursorHelper::SetPropertyValues(
     if (!aEntries.empty())
     {
         // Fetch, overwrite, and re-set the attributes from the core
-        SfxItemSet aItemSet(rDoc.GetAttrPool(), std::move(aRanges));
+        SfxItemSet aItemSet(rDoc.GetAttrPool(), MakeWhichRanges(aWhichIds));
         // we need to get up-to-date item set from nodes
         SwUnoCursorHelper::GetCursorAttr(rPaM, aItemSet);
 
@@ -2289,7 +2314,8 @@ SwXTextCursor::setPropertyValue(
         auto pPropSet = aSwMapProvider.GetPropertySet(PROPERTY_MAP_PARA_AUTO_STYLE);
 
         // Build set of attributes we want to fetch
-        WhichRangesContainer aRanges;
+        std::vector<sal_uInt16> aWhichIds;
+        aWhichIds.reserve(def.getLength());
         for (auto& rPropVal : def)
         {
             SfxItemPropertyMapEntry const* pEntry =
@@ -2297,8 +2323,9 @@ SwXTextCursor::setPropertyValue(
             if (!pEntry)
                 continue; // PropValuesToAutoStyleItemSet ignores invalid names
 
-            aRanges = aRanges.MergeRange(pEntry->nWID, pEntry->nWID);
+            aWhichIds.push_back(pEntry->nWID);
         }
+        WhichRangesContainer aRanges(MakeWhichRanges(aWhichIds));
 
         if (!aRanges.empty())
         {
@@ -1217,13 +1217,13 @@ SwXText::finishOrAppendParagraph(
             });
             if ( itCharStyle != rProperties.end() )
             {
+                std::vector<beans::PropertyValue> aCharProperties;
                 for (const auto& rValue : rProperties)
                 {
                     if ( rValue != *itCharStyle && rValue.Name.startsWith("Char") )
-                    {
-                        SwUnoCursorHelper::SetPropertyValue(aPam, *pParaPropSet, rValue.Name, rValue.Value);
-                    }
+                        aCharProperties.push_back(rValue);
                 }
+                SwUnoCursorHelper::SetPropertyValues(aPam, *pParaPropSet, aCharProperties);
             }
         }
     }
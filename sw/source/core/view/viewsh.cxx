@@ -1282,6 +1282,45 @@ void SwViewShell::CalcLayout()
         ::EndProgress( GetDoc()->GetDocShell() );
 }
 
+bool SwViewShell::CalcLayoutSlice( sal_uInt32 nMilliSeconds, sal_uInt16* pValidPages )
+{
+    // same as CalcLayout()
+    assert((typeid(*this) == typeid(SwViewShell)) || mnStartAction);
+
+    CurrShell aCurr( this );
+
+    bool bInterrupt;
+    {
+        // Like the idle layout, which doesn't lock the expression fields
+        // either, so no second round is needed for them.
+        SwLayAction aAction( GetLayout(), Imp() );
+        aAction.SetPaint( false );
+        aAction.SetCalcLayout( true );
+        aAction.SetWaitAllowed( false );
+        // only an idle action checks for the end while formatting content
+        aAction.SetIdle( true );
+        aAction.SetTimeSlice( nMilliSeconds );
+        aAction.Action(GetOut());
+        bInterrupt = aAction.IsInterrupt();
+    }
+
+    if ( pValidPages )
+    {
+        sal_uInt16 nValid = 0;
+        const SwPageFrame* pPage = static_cast<const SwPageFrame*>(GetLayout()->Lower());
+        while ( pPage && !pPage->IsInvalid() && !pPage->IsInvalidFly() )
+        {
+            ++nValid;
+            pPage = static_cast<const SwPageFrame*>(pPage->GetNext());
+        }
+        *pValidPages = nValid;
+    }
+
+    if ( !bInterrupt && VisArea().HasArea() )
+        InvalidateWindows( VisArea() );
+    return !bInterrupt;
+}
+
 void SwViewShell::SetFirstVisPageInvalid()
 {
     for(SwViewShell& rSh : GetRingContainer())
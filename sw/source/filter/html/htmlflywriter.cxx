@@ -45,6 +45,7 @@
 #include <osl/diagnose.h>
 #include <svx/svdograf.hxx>
 #include <comphelper/xmlencode.hxx>
+#include <o3tl/underlyingenumvalue.hxx>
 #include <poolfmt.hxx>
 
 #include <fmtanchr.hxx>
@@ -2031,16 +2032,32 @@ static SwHTMLWriter& OutHTML_FrameFormatGrfNode( SwHTMLWriter& rWrt, const SwFra
                 }
             }
 
-            ErrCode nErr = XOutBitmap::WriteGraphic( rGraphic, aGraphicURL,
-                    aFilterName, nFlags, &aMM100Size, nullptr, &aMimeType );
-            if( nErr )
+            // The same image with the same output options gives the same
+            // file, so only encode and write it for its first occurrence.
+            const OUString aWrittenKey = OUString::number(rGraphic.GetChecksum(), 16) + "|"
+                + OUString::number(o3tl::to_underlying(nFlags)) + "|" + aFilterName + "|"
+                + OUString::number(aMM100Size.Width()) + "x"
+                + OUString::number(aMM100Size.Height());
+            auto it = rWrt.m_aWrittenGraphics.find(aWrittenKey);
+            if (it != rWrt.m_aWrittenGraphics.end())
             {
-                rWrt.m_nWarn = WARN_SWG_POOR_LOAD;
-                return rWrt;
+                aGraphicURL = it->second.first;
+                aMimeType = it->second.second;
+            }
+            else
+            {
+                ErrCode nErr = XOutBitmap::WriteGraphic( rGraphic, aGraphicURL,
+                        aFilterName, nFlags, &aMM100Size, nullptr, &aMimeType );
+                if( nErr )
+                {
+                    rWrt.m_nWarn = WARN_SWG_POOR_LOAD;
+                    return rWrt;
+                }
+                aGraphicURL = URIHelper::SmartRel2Abs(
+                    INetURLObject(rWrt.GetBaseURL()), aGraphicURL,
+                    URIHelper::GetMaybeFileHdl() );
+                rWrt.m_aWrittenGraphics.emplace(aWrittenKey, std::make_pair(aGraphicURL, aMimeType));
             }
-            aGraphicURL = URIHelper::SmartRel2Abs(
-                INetURLObject(rWrt.GetBaseURL()), aGraphicURL,
-                URIHelper::GetMaybeFileHdl() );
             bOwn = true;
         }
         else
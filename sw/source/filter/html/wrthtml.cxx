@@ -653,6 +653,7 @@ ErrCode SwHTMLWriter::WriteStream()
     m_CharFormatInfos.clear();
     m_TextCollInfos.clear();
     m_aImgMapNames.clear();
+    m_aWrittenGraphics.clear();
     m_aImplicitMarks.clear();
     m_aOutlineMarks.clear();
     m_aOutlineMarkPoss.clear();
@@ -301,6 +301,7 @@ protected:
 
 public:
     std::vector<OUString> m_aImgMapNames;   // written image maps
+    std::map<OUString, std::pair<OUString, OUString>> m_aWrittenGraphics; // written image files and their mime types
     std::set<OUString> m_aImplicitMarks;    // implicit jump marks
     std::set<UIName> m_aNumRuleNames;     // names of exported num rules
     std::set<OUString> m_aScriptParaStyles; // script dependent para styles
@@ -1372,7 +1372,12 @@ bool SwDBManager::MergeMailFiles(SwWrtShell* pSourceShell,
                     //TODO xProgressDlg->queue_draw();
                 }
 
-                Scheduler::ProcessEventsToIdle();
+                // Without a progress dialog there is nothing to repaint or cancel, so don't
+                // run every idle job of the open documents again for each single record.
+                if( bIsMergeSilent )
+                    Application::Reschedule( true );
+                else
+                    Scheduler::ProcessEventsToIdle();
 
                 // Create a copy of the source document and work with that one instead of the source.
                 // If we're not in the single file mode (which requires modifying the document for the merging),
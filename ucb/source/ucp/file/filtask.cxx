@@ -1078,7 +1078,8 @@ TaskManager::getv( sal_Int32 CommandId,
                      TaskHandlerErr::OPEN_FILE_FOR_PAGING, // BEAWARE, REUSED
                      nError1);
 
-    osl::FileBase::RC nError2 = aDirItem.getFileStatus( aFileStatus );
+    // Only stat the file if one of the requested properties actually comes from the file system
+    osl::FileBase::RC nError2 = n_Mask ? aDirItem.getFileStatus( aFileStatus ) : osl::FileBase::E_None;
     if( nError1 == osl::FileBase::E_None &&
         nError2 != osl::FileBase::E_None )
         installError(CommandId,
@@ -2512,9 +2513,15 @@ TaskManager::getv(
     {
         std::unique_lock aGuard( m_aMutex );
 
-        insertDefaultProperties( aGuard, aUnqPath );
-
+        // Repeated listings of the same folder must not query the property registry again;
+        // Title is one of the default properties, so its presence means they are in place
         TaskManager::ContentMap::iterator it = m_aContent.find( aUnqPath );
+        if( it == m_aContent.end() ||
+            it->second.properties.find( MyProperty( Title ) ) == it->second.properties.end() )
+        {
+            insertDefaultProperties( aGuard, aUnqPath );
+            it = m_aContent.find( aUnqPath );
+        }
         commit( aGuard, it, aFileStatus );
 
         PropertySet& propset = it->second.properties;
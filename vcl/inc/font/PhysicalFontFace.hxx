@@ -193,6 +193,9 @@ public:
 protected:
     mutable hb_face_t* mpHbFace;
     mutable hb_font_t* mpHbUnscaledFont;
+    /// GetHbFace() preprocessed for subsetting, kept as long as the face to
+    /// speed up subsetting the same font again, e.g. in the next PDF export
+    mutable hb_face_t* mpHbSubsetFace;
     mutable FontCharMapRef mxCharMap;
     mutable std::optional<vcl::FontCapabilities> mxFontCapabilities;
     mutable std::optional<std::vector<ColorPalette>> mxColorPalettes;
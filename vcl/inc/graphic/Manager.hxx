@@ -37,6 +37,8 @@ private:
     Timer maSwapOutTimer;
     sal_Int32 mnTimeout = 1'000;
     sal_Int64 mnSmallFrySize = 100'000;
+    sal_Int64 mnSwapInCount = 0;
+    sal_Int64 mnSwapOutCount = 0;
 
     DECL_LINK(ReduceMemoryTimerHandler, Timer*, void);
 
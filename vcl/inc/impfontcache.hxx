@@ -23,6 +23,7 @@
 
 #include <basegfx/range/b2drectangle.hxx>
 #include <rtl/ref.hxx>
+#include <rtl/strbuf.hxx>
 #include <o3tl/lru_map.hxx>
 #include <o3tl/hash_combine.hxx>
 
@@ -65,6 +66,15 @@ typedef o3tl::lru_map<GlyphBoundRectCacheKey, basegfx::B2DRectangle,
 
 class ImplFontCache
 {
+public:
+    struct Statistics
+    {
+        sal_uInt64 nHits = 0; ///< font instance found in the cache
+        sal_uInt64 nMisses = 0; ///< font instance had to be created
+        sal_uInt64 nBoundRectHits = 0; ///< glyph bound rect found in the cache
+        sal_uInt64 nBoundRectMisses = 0; ///< glyph bound rect not cached
+    };
+
 private:
     // cache of recently used font instances
     struct IFSD_Equal { bool operator()( const vcl::font::FontSelectPattern&, const vcl::font::FontSelectPattern& ) const; };
@@ -74,6 +84,7 @@ private:
     LogicalFontInstance* mpLastHitCacheEntry; ///< keeps the last hit cache entry
     FontInstanceList maFontInstanceList;
     GlyphBoundRectCache m_aBoundRectCache;
+    Statistics maStatistics;
 
     rtl::Reference<LogicalFontInstance> GetFontInstance(vcl::font::PhysicalFontCollection const*, vcl::font::FontSelectPattern&);
 
@@ -91,6 +102,9 @@ public:
     void CacheGlyphBoundRect(const LogicalFontInstance*, sal_GlyphId, const basegfx::B2DRectangle&);
 
     void                Invalidate();
+
+    const Statistics&   GetStatistics() const { return maStatistics; }
+    void                dumpState(rtl::OStringBuffer& rState) const;
 };
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
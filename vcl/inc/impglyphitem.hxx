@@ -109,6 +109,12 @@ public:
     void setLinearPos(const basegfx::B2DPoint& point) { m_aLinearPos = point; }
     void setLinearPosX(double x) { m_aLinearPos.setX(x); }
     void adjustLinearPosX(double diff) { m_aLinearPos.adjustX(diff); }
+    void adjustCharPos(int diff)
+    {
+        if (!IsDropped())
+            m_nCharPos += diff;
+        m_nOrigCharPos += diff;
+    }
     bool isLayoutEquivalent(const GlyphItem& other) const
     {
         return rtl::math::approxEqual(m_aLinearPos.getX(), other.m_aLinearPos.getX(), 8)
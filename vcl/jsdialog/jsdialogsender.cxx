@@ -12,6 +12,9 @@
 #include <tools/json_writer.hxx>
 #include <vcl/dockwin.hxx>
 
+#include <algorithm>
+#include <iterator>
+
 JSDialogNotifyIdle::JSDialogNotifyIdle(VclPtr<vcl::Window> aNotifierWindow,
                                        VclPtr<vcl::Window> aContentWindow,
                                        const OUString& sTypeOfJSON)
@@ -52,8 +55,25 @@ void JSDialogNotifyIdle::sendMessage(const jsdialog::MessageType eType,
 {
     std::scoped_lock aGuard(m_aQueueMutex);
 
+    // full update dumps the whole dialog when the queue is processed, so widget updates next
+    // to it (without other messages in between which could depend on their order) are redundant
+    if (eType == jsdialog::MessageType::FullUpdate || eType == jsdialog::MessageType::WidgetUpdate)
+    {
+        auto itUpdates = m_aMessageQueue.end();
+        while (itUpdates != m_aMessageQueue.begin()
+               && (std::prev(itUpdates)->m_eType == jsdialog::MessageType::FullUpdate
+                   || std::prev(itUpdates)->m_eType == jsdialog::MessageType::WidgetUpdate))
+            --itUpdates;
+
+        if (eType == jsdialog::MessageType::FullUpdate)
+            m_aMessageQueue.erase(itUpdates, m_aMessageQueue.end());
+        else if (std::any_of(itUpdates, m_aMessageQueue.end(), [](const JSDialogMessageInfo& rInfo) {
+                     return rInfo.m_eType == jsdialog::MessageType::FullUpdate;
+                 }))
+            return;
+    }
+
     // we want only the latest update of same type
-    // TODO: also if we met full update - previous updates are not valid
     auto it = m_aMessageQueue.begin();
     const VclReferenceBase* pRawTarget = static_cast<VclReferenceBase*>(pTarget);
 
@@ -249,6 +249,33 @@ CPPUNIT_TEST_FIXTURE(VclComplexTextTest, testCachingSubstring)
     testCachedGlyphsSubstring( text, u"Dejavu Sans"_ustr, false );
 }
 
+// Check that a run of plain text is reused from the cache in another string
+// with the same surrounding characters.
+CPPUNIT_TEST_FIXTURE(VclComplexTextTest, testCachingRun)
+{
+    ScopedVclPtrInstance<VirtualDevice> pOutputDevice;
+    pOutputDevice->SetLayoutMode(vcl::text::ComplexTextLayoutFlags::BiDiStrong);
+    vcl::Font aFont(u"Dejavu Sans"_ustr, Size(0, 12));
+    pOutputDevice->SetFont(aFont);
+    SalLayoutGlyphsCache::self()->clear();
+
+    const OUString aText1(u"one two three four five six seven"_ustr);
+    const OUString aText2(u"eight nine two three four five six seven"_ustr);
+    const SalLayoutGlyphs* pGlyphs1
+        = SalLayoutGlyphsCache::self()->GetLayoutGlyphs(pOutputDevice, aText1, 14, 4);
+    CPPUNIT_ASSERT(pGlyphs1 != nullptr);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt64(0), SalLayoutGlyphsCache::self()->GetStatistics().nRunHits);
+
+    const SalLayoutGlyphs* pGlyphs2
+        = SalLayoutGlyphsCache::self()->GetLayoutGlyphs(pOutputDevice, aText2, 20, 4);
+    CPPUNIT_ASSERT(pGlyphs2 != nullptr);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt64(1), SalLayoutGlyphsCache::self()->GetStatistics().nRunHits);
+
+    std::unique_ptr<SalLayout> pLayout = pOutputDevice->ImplLayout(
+        aText2, 20, 4, Point(0, 0), 0, {}, {}, SalLayoutFlags::GlyphItemsOnly);
+    checkCompareGlyphs(pLayout->GetGlyphs(), *pGlyphs2, "run in another string");
+}
+
 CPPUNIT_TEST_FIXTURE(VclComplexTextTest, testCaret)
 {
 #if HAVE_MORE_FONTS
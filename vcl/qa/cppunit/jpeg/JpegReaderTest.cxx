@@ -35,12 +35,14 @@ public:
     void testReadGray();
     void testReadCMYK();
     void testTdf138950();
+    void testPreviewSizeHint();
 
     CPPUNIT_TEST_SUITE(JpegReaderTest);
     CPPUNIT_TEST(testReadRGB);
     CPPUNIT_TEST(testReadGray);
     CPPUNIT_TEST(testReadCMYK);
     CPPUNIT_TEST(testTdf138950);
+    CPPUNIT_TEST(testPreviewSizeHint);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -197,6 +199,28 @@ void JpegReaderTest::testTdf138950()
     CPPUNIT_ASSERT_EQUAL(0, nBlackCount);
 }
 
+void JpegReaderTest::testPreviewSizeHint()
+{
+    OUString aURL = getFullUrl(u"tdf138950.jpeg");
+    GraphicFilter& rFilter = GraphicFilter::GetGraphicFilter();
+    Graphic aGraphic;
+    SvFileStream aFileStream(aURL, StreamMode::READ);
+    const Size aPreviewSize(100, 100);
+    ErrCode bResult = rFilter.ImportGraphic(aGraphic, aURL, aFileStream, GRFILTER_FORMAT_DONTKNOW,
+                                            nullptr, GraphicFilterImportFlags::NONE, -1, nullptr,
+                                            &aPreviewSize);
+    CPPUNIT_ASSERT_EQUAL(ERRCODE_NONE, bResult);
+
+    // The 720x1280 image is decoded at 1/4 scale, the smallest one still covering 100x100.
+    Size aSize = aGraphic.GetBitmap().GetSizePixel();
+    CPPUNIT_ASSERT_EQUAL(tools::Long(180), aSize.Width());
+    CPPUNIT_ASSERT_EQUAL(tools::Long(320), aSize.Height());
+
+    // The complete image data is still available.
+    CPPUNIT_ASSERT(aGraphic.IsGfxLink());
+    CPPUNIT_ASSERT_EQUAL(GfxLinkType::NativeJpg, aGraphic.GetSharedGfxLink()->GetType());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(JpegReaderTest);
 
 CPPUNIT_PLUGIN_IMPLEMENT();
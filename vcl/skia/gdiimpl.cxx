@@ -1420,13 +1420,22 @@ Color SkiaSalGraphicsImpl::getPixel(tools::Long nX, tools::Long nY)
     checkSurface();
     SAL_INFO("vcl.skia.trace", "getpixel(" << this << "): " << Point(nX, nY));
     flushDrawing();
-    // This is presumably slow, but getPixel() should be generally used only by unit tests.
+    // Read back only the one pixel, not the whole surface, this is called repeatedly
+    // e.g. when checking rendered output of headless rendering.
+    const int nSurfaceX = nX * mScaling;
+    const int nSurfaceY = nY * mScaling;
+    if (nSurfaceX < 0 || nSurfaceY < 0 || nSurfaceX >= mSurface->width()
+        || nSurfaceY >= mSurface->height())
+    {
+        SAL_WARN("vcl.skia", "getPixel() outside of surface: " << Point(nX, nY));
+        return Color();
+    }
     SkBitmap bitmap;
-    if (!bitmap.tryAllocN32Pixels(mSurface->width(), mSurface->height()))
+    if (!bitmap.tryAllocN32Pixels(1, 1))
         abort();
-    if (!mSurface->readPixels(bitmap, 0, 0))
+    if (!mSurface->readPixels(bitmap, nSurfaceX, nSurfaceY))
         abort();
-    return fromSkColor(bitmap.getColor(nX * mScaling, nY * mScaling));
+    return fromSkColor(bitmap.getColor(0, 0));
 }
 
 void SkiaSalGraphicsImpl::invert(basegfx::B2DPolygon const& rPoly, SalInvert eFlags)
@@ -2134,8 +2143,13 @@ void SkiaSalGraphicsImpl::drawGenericLayout(const GenericSalLayout& layout, Colo
     {
         bool verticalRun = *pos;
         std::vector<bool>::const_iterator rangeEnd = std::find(pos + 1, end, !verticalRun);
+        // Build the blob only from the glyphs of this run.
+        const size_t nRunStart = pos - verticals.cbegin();
+        const size_t nRunLength = rangeEnd - pos;
         sk_sp<SkTextBlob> textBlob = SkTextBlob::MakeFromRSXformGlyphs(
-            glyphIds, glyphForms, verticalRun ? verticalFont : font);
+            SkSpan<const SkGlyphID>(glyphIds.data() + nRunStart, nRunLength),
+            SkSpan<const SkRSXform>(glyphForms.data() + nRunStart, nRunLength),
+            verticalRun ? verticalFont : font);
         addUpdateRegion(textBlob->bounds());
         SkPaint paint = makeTextPaint(textColor);
         getDrawCanvas()->drawTextBlob(textBlob, 0, 0, paint);
@@ -429,6 +429,10 @@ void Scheduler::CallbackTaskScheduling()
         return;
     }
 
+    // How late this tick is compared to the system timer deadline.
+    const sal_uInt64 nDeadline = rSchedCtx.mnTimerStart + rSchedCtx.mnTimerPeriod;
+    const sal_uInt64 nLateness = nTime > nDeadline ? nTime - nDeadline : 0;
+
     ImplSchedulerData* pSchedulerData = nullptr;
     ImplSchedulerData* pPrevSchedulerData = nullptr;
     ImplSchedulerData *pMostUrgent = nullptr;
@@ -453,6 +457,8 @@ void Scheduler::CallbackTaskScheduling()
         while (pSchedulerData)
         {
             ++nTasks;
+#ifdef SAL_LOG_INFO
+            // Only pay for the RTTI lookup of every task on every tick when logging is built in.
             const Timer *timer = dynamic_cast<Timer*>( pSchedulerData->mpTask );
             if ( timer )
                 SAL_INFO( "vcl.schedule", tools::Time::GetSystemTicks() << " "
@@ -464,6 +470,7 @@ void Scheduler::CallbackTaskScheduling()
             else
                 SAL_INFO( "vcl.schedule", tools::Time::GetSystemTicks() << " "
                         << pSchedulerData << " " << *pSchedulerData << " (to be deleted)" );
+#endif
 
             // Should the Task be released from scheduling?
             assert(!pSchedulerData->mbInScheduler);
@@ -517,7 +524,8 @@ void Scheduler::CallbackTaskScheduling()
         return;
 
     SAL_INFO( "vcl.schedule", tools::Time::GetSystemTicks() << " "
-              << pMostUrgent << "  invoke-in  " << *pMostUrgent->mpTask );
+              << pMostUrgent << "  invoke-in  " << *pMostUrgent->mpTask
+              << " late " << nLateness << "ms" );
 
     Task *pTask = pMostUrgent->mpTask;
 
@@ -638,7 +646,8 @@ void Scheduler::CallbackTaskScheduling()
     pMostUrgent->mbInScheduler = false;
 
     SAL_INFO( "vcl.schedule", tools::Time::GetSystemTicks() << " "
-              << pMostUrgent << "  invoke-out" );
+              << pMostUrgent << "  invoke-out after "
+              << tools::Time::GetSystemTicks() - nTime << "ms" );
 
     // pop the scheduler stack
     pSchedulerData = rSchedCtx.mpSchedulerStack;
@@ -42,6 +42,7 @@
 #include <salframe.hxx>
 #include <scrwnd.hxx>
 #include <helpwin.hxx>
+#include <impfontcache.hxx>
 #include <vcl/toolkit/dialog.hxx>
 #include <salinst.hxx>
 #include <salgdi.hxx>
@@ -484,6 +485,9 @@ void ImplSVData::dumpState(rtl::OStringBuffer &rState)
         rState.append(static_cast<sal_Int32>(mpBlendFrameCache->m_aLastSize.Height()));
     }
 
+    if (maGDIData.mxScreenFontCache)
+        maGDIData.mxScreenFontCache->dumpState(rState);
+
     for (CacheOwner* pCacheOwner : maCacheOwners)
         pCacheOwner->dumpState(rState);
 }
@@ -174,6 +174,52 @@ template <size_t nSize> struct ScaleFunc
     }
 };
 
+// Horizontal source span and weights of one destination column; they only depend on the
+// column, so scaleDown() computes them once instead of for every source row it sums up.
+struct ScaleDownColumn
+{
+    sal_Int32 mnRowStart;
+    sal_Int32 mnRowRange;
+    BilinearWeightType mnWeightFirst;
+    BilinearWeightType mnWeightLast;
+    BilinearWeightType mnTotalWeight;
+};
+
+std::vector<ScaleDownColumn> generateScaleDownColumns(const ScaleContext &rCtx)
+{
+    const sal_Int32 nEndX = rCtx.mnDestW - 1;
+    std::vector<ScaleDownColumn> aColumns(rCtx.mnDestW);
+
+    for (sal_Int32 nX = 0; nX <= nEndX; nX++)
+    {
+        ScaleDownColumn& rColumn = aColumns[nX];
+        if (nX == nEndX)
+        {
+            rColumn.mnRowStart = rCtx.maMapIX[nX];
+            rColumn.mnRowRange = 0;
+            rColumn.mnWeightFirst = lclMaxWeight();
+            rColumn.mnWeightLast = 0;
+        }
+        else
+        {
+            sal_Int32 nLeft = rCtx.mbHMirr ? (nX + 1) : nX;
+            sal_Int32 nRight = rCtx.mbHMirr ? nX : (nX + 1);
+
+            rColumn.mnRowStart = rCtx.maMapIX[nLeft];
+            rColumn.mnRowRange = (rCtx.maMapIX[nRight] == rCtx.maMapIX[nLeft]) ?
+                                    1 : (rCtx.maMapIX[nRight] - rCtx.maMapIX[nLeft]);
+            rColumn.mnWeightFirst = lclMaxWeight() - rCtx.maMapFX[nLeft];
+            rColumn.mnWeightLast = rCtx.maMapFX[nRight];
+        }
+
+        rColumn.mnTotalWeight = rColumn.mnWeightFirst;
+        if (rColumn.mnRowRange > 0)
+            rColumn.mnTotalWeight += (rColumn.mnRowRange - 1) * lclMaxWeight() + rColumn.mnWeightLast;
+    }
+
+    return aColumns;
+}
+
 template <int nColorBits>
 void scaleDown (const ScaleContext &rCtx, sal_Int32 nStartY, sal_Int32 nEndY)
 {
@@ -181,8 +227,8 @@ void scaleDown (const ScaleContext &rCtx, sal_Int32 nStartY, sal_Int32 nEndY)
     constexpr int nColorComponents = nColorBits / 8;
     static_assert(nColorComponents * 8 == nColorBits, "nColorBits must be divisible by 8");
     using ScaleFunction = ScaleFunc<nColorComponents>;
-    const sal_Int32 nStartX = 0;
-    const sal_Int32 nEndX = rCtx.mnDestW - 1;
+
+    const std::vector<ScaleDownColumn> aColumns = generateScaleDownColumns(rCtx);
 
     for (sal_Int32 nY = nStartY; nY <= nEndY; nY++)
     {
@@ -204,60 +250,25 @@ void scaleDown (const ScaleContext &rCtx, sal_Int32 nStartY, sal_Int32 nEndY)
         }
 
         Scanline pScanDest = rCtx.mpDest->GetScanline(nY);
-        for (sal_Int32 nX = nStartX; nX <= nEndX; nX++)
+        for (const ScaleDownColumn& rColumn : aColumns)
         {
-            sal_Int32 nLeft = rCtx.mbHMirr ? (nX + 1) : nX;
-            sal_Int32 nRight = rCtx.mbHMirr ? nX : (nX + 1);
-
-            sal_Int32 nRowStart;
-            sal_Int32 nRowRange;
-            if (nX == nEndX)
-            {
-                nRowStart = rCtx.maMapIX[nX];
-                nRowRange = 0;
-            }
-            else
-            {
-                nRowStart = rCtx.maMapIX[nLeft];
-                nRowRange = (rCtx.maMapIX[nRight] == rCtx.maMapIX[nLeft]) ?
-                                1 : (rCtx.maMapIX[nRight] - rCtx.maMapIX[nLeft]);
-            }
-
             std::array<int, nColorComponents> sumNumbers{}; // zero-initialize
             BilinearWeightType nTotalWeightY = 0;
 
             for (sal_Int32 i = 0; i<= nLineRange; i++)
             {
                 Scanline pTmpY = rCtx.mpSrc->GetScanline(nLineStart + i);
-                Scanline pTmpX = pTmpY + nColorComponents * nRowStart;
+                Scanline pTmpX = pTmpY + nColorComponents * rColumn.mnRowStart;
 
                 std::array<int, nColorComponents> sumRows{}; // zero-initialize
-                BilinearWeightType nTotalWeightX = 0;
 
-                for (sal_Int32 j = 0; j <= nRowRange; j++)
+                // weighted first pixel, full weight pixels in between, weighted last pixel
+                ScaleFunction::generateSumRows(rColumn.mnWeightFirst, pTmpX, sumRows);
+                if (rColumn.mnRowRange > 0)
                 {
-                    if (nX == nEndX)
-                    {
+                    for (sal_Int32 j = 1; j < rColumn.mnRowRange; j++)
                         ScaleFunction::generateSumRows(pTmpX, sumRows);
-                        nTotalWeightX += lclMaxWeight();
-                    }
-                    else if(j == 0)
-                    {
-                        BilinearWeightType nWeightX = lclMaxWeight() - rCtx.maMapFX[nLeft];
-                        ScaleFunction::generateSumRows(nWeightX, pTmpX, sumRows);
-                        nTotalWeightX += nWeightX;
-                    }
-                    else if ( nRowRange == j )
-                    {
-                        BilinearWeightType nWeightX = rCtx.maMapFX[ nRight ] ;
-                        ScaleFunction::generateSumRows(nWeightX, pTmpX, sumRows);
-                        nTotalWeightX += nWeightX;
-                    }
-                    else
-                    {
-                       ScaleFunction::generateSumRows(pTmpX, sumRows);
-                       nTotalWeightX += lclMaxWeight();
-                    }
+                    ScaleFunction::generateSumRows(rColumn.mnWeightLast, pTmpX, sumRows);
                 }
 
                 BilinearWeightType nWeightY = lclMaxWeight();
@@ -270,9 +281,9 @@ void scaleDown (const ScaleContext &rCtx, sal_Int32 nStartY, sal_Int32 nEndY)
                 else if (nLineRange == i)
                     nWeightY = rCtx.maMapFY[nBottom];
 
-                if (nTotalWeightX)
+                if (rColumn.mnTotalWeight)
                 {
-                  ScaleFunction::generateSumRows(nTotalWeightX, sumRows);
+                  ScaleFunction::generateSumRows(rColumn.mnTotalWeight, sumRows);
                 }
                 ScaleFunction::generateSumNumbers(nWeightY, sumRows, sumNumbers);
                 nTotalWeightY += nWeightY;
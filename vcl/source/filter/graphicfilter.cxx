@@ -447,7 +447,8 @@ ErrCode GraphicFilter::CanImportGraphic( std::u16string_view rMainUrl, SvStream&
 ErrCode GraphicFilter::ImportGraphic(
     Graphic& rGraphic, const INetURLObject& rPath, sal_uInt16 nFormat,
     sal_uInt16 * pDeterminedFormat, GraphicFilterImportFlags nImportFlags,
-    const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler)
+    const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler,
+    const Size* pPreviewSizeHint)
 {
     SAL_WARN_IF( rPath.GetProtocol() == INetProtocol::NotValid, "vcl.filter", "GraphicFilter::ImportGraphic() : ProtType == INetProtocol::NotValid" );
 
@@ -462,7 +463,7 @@ ErrCode GraphicFilter::ImportGraphic(
     std::unique_ptr<SvStream> xStream(::utl::UcbStreamHelper::CreateStream( aMainUrl, StreamMode::READ | StreamMode::SHARE_DENYNONE ));
     if (xStream)
     {
-        nRetValue = ImportGraphic(rGraphic, aMainUrl, *xStream, nFormat, pDeterminedFormat, nImportFlags, -1, xInteractionHandler);
+        nRetValue = ImportGraphic(rGraphic, aMainUrl, *xStream, nFormat, pDeterminedFormat, nImportFlags, -1, xInteractionHandler, pPreviewSizeHint);
     }
     return nRetValue;
 }
@@ -533,7 +534,8 @@ void GraphicImportTask::doImport(GraphicImportContext& rContext)
     }
 }
 
-std::vector<Graphic> GraphicFilter::ImportGraphics(std::vector<std::unique_ptr<SvStream>> vStreams)
+std::vector<Graphic> GraphicFilter::ImportGraphics(std::vector<std::unique_ptr<SvStream>> vStreams,
+                                                   bool bCreateGfxLink)
 {
     static bool bThreads = !getenv("VCL_NO_THREAD_IMPORT");
     std::vector<GraphicImportContext> aContexts;
@@ -618,7 +620,7 @@ std::vector<Graphic> GraphicFilter::ImportGraphics(std::vector<std::unique_ptr<S
         else
             aGraphics.emplace_back();
 
-        if (rContext.m_nStatus == ERRCODE_NONE && rContext.m_eLinkType != GfxLinkType::NONE)
+        if (bCreateGfxLink && rContext.m_nStatus == ERRCODE_NONE && rContext.m_eLinkType != GfxLinkType::NONE)
         {
             BinaryDataContainer aGraphicContent;
 
@@ -673,10 +675,14 @@ void GraphicFilter::MakeGraphicsAvailableThreaded(std::vector<Graphic*>& graphic
     {
         streams.push_back(graphic->GetSharedGfxLink()->getDataContainer().getAsStream());
     }
-    std::vector<Graphic> loadedGraphics = ImportGraphics(std::move(streams));
+    // The graphics already have their encoded data, share their GfxLink with the loaded graphics
+    // instead of copying the data again.
+    std::vector<Graphic> loadedGraphics = ImportGraphics(std::move(streams), /*bCreateGfxLink=*/false);
     assert(loadedGraphics.size() == toLoad.size());
     for( size_t i = 0; i < toLoad.size(); ++i )
     {
+        if (!loadedGraphics[ i ].IsNone())
+            loadedGraphics[ i ].SetGfxLink(toLoad[ i ]->GetSharedGfxLink());
         toLoad[ i ]->ImplGetImpGraphic()->updateFromLoadedGraphic(loadedGraphics[ i ].ImplGetImpGraphic());
     }
 }
@@ -933,7 +939,8 @@ ErrCode GraphicFilter::readPNG(SvStream & rStream, Graphic& rGraphic, GfxLinkTyp
     return aReturnCode;
 }
 
-ErrCode GraphicFilter::readJPEG(SvStream & rStream, Graphic & rGraphic, GfxLinkType & rLinkType, GraphicFilterImportFlags nImportFlags)
+ErrCode GraphicFilter::readJPEG(SvStream & rStream, Graphic & rGraphic, GfxLinkType & rLinkType, GraphicFilterImportFlags nImportFlags,
+                                const Size* pPreviewSizeHint)
 {
     // set LOGSIZE flag always, if not explicitly disabled
     // (see #90508 and #106763)
@@ -943,7 +950,7 @@ ErrCode GraphicFilter::readJPEG(SvStream & rStream, Graphic & rGraphic, GfxLinkT
     }
 
     ImportOutput aImportOutput;
-    if (!ImportJPEG(rStream, aImportOutput, nImportFlags, nullptr))
+    if (!ImportJPEG(rStream, aImportOutput, nImportFlags, nullptr, pPreviewSizeHint ? *pPreviewSizeHint : Size()))
     {
         return ERRCODE_GRFILTER_FILTERERROR;
     }
@@ -1289,7 +1296,8 @@ ErrCode GraphicFilter::ImportGraphic(Graphic& rGraphic, std::u16string_view rPat
                                      SvStream& rIStream, sal_uInt16 nFormat,
                                      sal_uInt16* pDeterminedFormat,
                                      GraphicFilterImportFlags nImportFlags, sal_Int32 nPageIndex,
-                                     const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler)
+                                     const css::uno::Reference<css::task::XInteractionHandler>& xInteractionHandler,
+                                     const Size* pPreviewSizeHint)
 {
     OUString aFilterName;
     sal_uInt64 nStreamBegin;
@@ -1343,7 +1351,7 @@ ErrCode GraphicFilter::ImportGraphic(Graphic& rGraphic, std::u16string_view rPat
     }
     else if (aFilterName.equalsIgnoreAsciiCase(IMP_JPEG))
     {
-        nStatus = readJPEG(rIStream, rGraphic, eLinkType, nImportFlags);
+        nStatus = readJPEG(rIStream, rGraphic, eLinkType, nImportFlags, pPreviewSizeHint);
     }
     else if (aFilterName.equalsIgnoreAsciiCase(IMP_SVG) || aFilterName.equalsIgnoreAsciiCase(IMP_SVGZ))
     {
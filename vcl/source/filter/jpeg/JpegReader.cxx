@@ -170,10 +170,12 @@ void jpeg_svstream_src (j_decompress_ptr cinfo, void* input)
     source->pub.next_input_byte = nullptr; /* until buffer loaded */
 }
 
-JPEGReader::JPEGReader( SvStream& rStream, GraphicFilterImportFlags nImportFlags ) :
+JPEGReader::JPEGReader( SvStream& rStream, GraphicFilterImportFlags nImportFlags,
+                        const Size& rPreviewSize ) :
     mrStream         ( rStream ),
     mnLastPos        ( rStream.Tell() ),
-    mbSetLogSize     ( nImportFlags & GraphicFilterImportFlags::SetLogsizeForJpeg )
+    mbSetLogSize     ( nImportFlags & GraphicFilterImportFlags::SetLogsizeForJpeg ),
+    maPreviewSize    ( rPreviewSize )
 {
     if (!(nImportFlags & GraphicFilterImportFlags::UseExistingBitmap))
     {
@@ -225,7 +227,7 @@ bool JPEGReader::CreateBitmap(JPEGCreateBitmapParam const & rParam)
             Fraction    aFractX( 1, rParam.X_density );
             Fraction    aFractY( 1, rParam.Y_density );
             MapMode     aMapMode( nUnit == 1 ? MapUnit::MapInch : MapUnit::MapCM, Point(), aFractX, aFractY );
-            Size        aPrefSize = OutputDevice::LogicToLogic(aSize, aMapMode, MapMode(MapUnit::Map100thMM));
+            Size        aPrefSize = OutputDevice::LogicToLogic(Size(rParam.nImageWidth, rParam.nImageHeight), aMapMode, MapMode(MapUnit::Map100thMM));
 
             mpBitmap->SetPrefSize(aPrefSize);
             mpBitmap->SetPrefMapMode(MapMode(MapUnit::Map100thMM));
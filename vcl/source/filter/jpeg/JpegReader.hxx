@@ -39,6 +39,9 @@ struct JPEGCreateBitmapParam
     tools::ULong density_unit;
     tools::ULong X_density;
     tools::ULong Y_density;
+    // size of the image before DCT scaling, for the logic size
+    tools::ULong nImageWidth;
+    tools::ULong nImageHeight;
 
     bool bGray;
 };
@@ -49,15 +52,20 @@ class JPEGReader
     std::optional<Bitmap> mpBitmap;
     tools::Long mnLastPos;
     bool mbSetLogSize;
+    Size maPreviewSize;
 
 public:
-    JPEGReader( SvStream& rStream, GraphicFilterImportFlags nImportFlags );
+    JPEGReader( SvStream& rStream, GraphicFilterImportFlags nImportFlags,
+                const Size& rPreviewSize = Size() );
 
     ReadState Read(ImportOutput& rImportOutput, GraphicFilterImportFlags nImportFlags, BitmapScopedWriteAccess* ppAccess);
 
     bool CreateBitmap(JPEGCreateBitmapParam const & param);
 
     Bitmap& GetBitmap() { return *mpBitmap; }
+
+    /// Size the image will be shown at, the decoder may scale down to it; empty for full size.
+    const Size& GetPreviewSize() const { return maPreviewSize; }
 };
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -23,9 +23,10 @@
 
 #include <vcl/graphicfilter.hxx>
 
-VCL_DLLPUBLIC bool ImportJPEG( SvStream& rInputStream, ImportOutput& rImportOutput, GraphicFilterImportFlags nImportFlags, BitmapScopedWriteAccess* ppAccess )
+VCL_DLLPUBLIC bool ImportJPEG( SvStream& rInputStream, ImportOutput& rImportOutput, GraphicFilterImportFlags nImportFlags, BitmapScopedWriteAccess* ppAccess,
+                               const Size& rPreviewSizeHint )
 {
-    JPEGReader aJPEGReader(rInputStream, nImportFlags);
+    JPEGReader aJPEGReader(rInputStream, nImportFlags, rPreviewSizeHint);
 
     ReadState eReadState = aJPEGReader.Read(rImportOutput, nImportFlags, ppAccess);
 
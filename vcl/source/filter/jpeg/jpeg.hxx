@@ -25,7 +25,8 @@
 
 #include <com/sun/star/uno/Sequence.h>
 
-VCL_DLLPUBLIC bool ImportJPEG( SvStream& rInputStream, ImportOutput& rImportOutput, GraphicFilterImportFlags nImportFlags, BitmapScopedWriteAccess* ppAccess );
+VCL_DLLPUBLIC bool ImportJPEG( SvStream& rInputStream, ImportOutput& rImportOutput, GraphicFilterImportFlags nImportFlags, BitmapScopedWriteAccess* ppAccess,
+                               const Size& rPreviewSizeHint = Size() );
 
 bool ExportJPEG(SvStream& rOutputStream,
                     const Graphic& rGraphic,
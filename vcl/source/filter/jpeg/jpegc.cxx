@@ -36,6 +36,7 @@ extern "C" {
 #include "jpeg.h"
 #include "JpegReader.hxx"
 #include "JpegWriter.hxx"
+#include <algorithm>
 #include <memory>
 #include <comphelper/configuration.hxx>
 #include <vcl/graphicfilter.hxx>
@@ -212,6 +213,29 @@ static void ReadJPEG(JpegStuff& rContext, JPEGReader* pJPEGReader, void* pInputS
     rContext.cinfo.raw_data_out = FALSE;
     rContext.cinfo.quantize_colors = FALSE;
 
+    // change scale for preview import: let the DCT produce the largest 1/2, 1/4 or 1/8 scaled
+    // image that still covers the preview size
+    const Size& rPreviewSize = pJPEGReader->GetPreviewSize();
+    tools::Long nPreviewWidth = rPreviewSize.Width();
+    tools::Long nPreviewHeight = rPreviewSize.Height();
+    if (nPreviewWidth > 0 || nPreviewHeight > 0)
+    {
+        const tools::Long nImageWidth = rContext.cinfo.image_width;
+        const tools::Long nImageHeight = rContext.cinfo.image_height;
+        if (nPreviewWidth <= 0)
+            nPreviewWidth = std::max<tools::Long>(1, nImageWidth * nPreviewHeight / std::max<tools::Long>(1, nImageHeight));
+        else if (nPreviewHeight <= 0)
+            nPreviewHeight = std::max<tools::Long>(1, nImageHeight * nPreviewWidth / std::max<tools::Long>(1, nImageWidth));
+
+        tools::Long nScaleDenom = 1;
+        while (nScaleDenom < 8 && nImageWidth >= nPreviewWidth * nScaleDenom * 2
+               && nImageHeight >= nPreviewHeight * nScaleDenom * 2)
+        {
+            nScaleDenom *= 2;
+        }
+        rContext.cinfo.scale_denom = nScaleDenom;
+    }
+
     jpeg_calc_output_dimensions(&rContext.cinfo);
 
     tools::Long nWidth = rContext.cinfo.output_width;
@@ -236,6 +260,8 @@ static void ReadJPEG(JpegStuff& rContext, JPEGReader* pJPEGReader, void* pInputS
     aCreateBitmapParam.density_unit = rContext.cinfo.density_unit;
     aCreateBitmapParam.X_density = rContext.cinfo.X_density;
     aCreateBitmapParam.Y_density = rContext.cinfo.Y_density;
+    aCreateBitmapParam.nImageWidth = rContext.cinfo.image_width;
+    aCreateBitmapParam.nImageHeight = rContext.cinfo.image_height;
     aCreateBitmapParam.bGray = bGray;
 
     const auto bOnlyCreateBitmap = static_cast<bool>(nImportFlags & GraphicFilterImportFlags::OnlyCreateBitmap);
@@ -48,6 +48,7 @@ PhysicalFontFace::PhysicalFontFace(const FontAttributes& rDFA)
     : FontAttributes(rDFA)
     , mpHbFace(nullptr)
     , mpHbUnscaledFont(nullptr)
+    , mpHbSubsetFace(nullptr)
 {
 }
 
@@ -57,6 +58,8 @@ PhysicalFontFace::~PhysicalFontFace()
         hb_face_destroy(mpHbFace);
     if (mpHbUnscaledFont)
         hb_font_destroy(mpHbUnscaledFont);
+    if (mpHbSubsetFace)
+        hb_face_destroy(mpHbSubsetFace);
 }
 
 sal_Int32 PhysicalFontFace::CompareIgnoreSize(const PhysicalFontFace& rOther) const
@@ -492,8 +495,11 @@ bool PhysicalFontFace::CreateFontSubset(std::vector<sal_uInt8>& rOutBuffer,
             hb_subset_input_pin_axis_location(pInput, pHbFace, rVariation.tag, rVariation.value);
     }
 
-    // Perform the subsetting
-    hb_face_t* pSubsetFace = hb_subset_or_fail(pHbFace, pInput);
+    // Perform the subsetting. The preprocessed face caches the parsed tables,
+    // which are needed again for every subset of the font.
+    if (!mpHbSubsetFace)
+        mpHbSubsetFace = hb_subset_preprocess(pHbFace);
+    hb_face_t* pSubsetFace = hb_subset_or_fail(mpHbSubsetFace, pInput);
     comphelper::ScopeGuard aSubsetFaceGuard([&]() { hb_face_destroy(pSubsetFace); });
     if (!pSubsetFace)
         return false;
@@ -147,8 +147,13 @@ rtl::Reference<LogicalFontInstance> ImplFontCache::GetFontInstance( PhysicalFont
         }
     }
 
+    if (pFontInstance)
+        ++maStatistics.nHits;
+
     if( !pFontInstance && pFontFamily) // still no cache hit => create a new font instance
     {
+        ++maStatistics.nMisses;
+
         vcl::font::PhysicalFontFace* pFontData = pFontFamily->FindBestFontFace(aFontSelData);
 
         // create a new logical font instance from this physical font face
@@ -265,9 +270,11 @@ bool ImplFontCache::GetCachedGlyphBoundRect(const LogicalFontInstance *pFont, sa
     auto it = m_aBoundRectCache.find({pFont, nID});
     if (it != m_aBoundRectCache.end())
     {
+        ++maStatistics.nBoundRectHits;
         rRect = it->second;
         return true;
     }
+    ++maStatistics.nBoundRectMisses;
     return false;
 }
 
@@ -282,4 +289,16 @@ void ImplFontCache::CacheGlyphBoundRect(const LogicalFontInstance *pFont, sal_Gl
     m_aBoundRectCache.insert({{pFont, nID}, rRect});
 }
 
+void ImplFontCache::dumpState(rtl::OStringBuffer& rState) const
+{
+    rState.append("\nImplFontCache:\t");
+    rState.append(static_cast<sal_Int32>(maFontInstanceList.size()));
+    rState.append("\n\tHits:\t" + OString::number(maStatistics.nHits));
+    rState.append("\n\tMisses:\t" + OString::number(maStatistics.nMisses));
+    rState.append("\n\tGlyph bound rects:\t");
+    rState.append(static_cast<sal_Int32>(m_aBoundRectCache.size()));
+    rState.append("\n\tBound rect hits:\t" + OString::number(maStatistics.nBoundRectHits));
+    rState.append("\n\tBound rect misses:\t" + OString::number(maStatistics.nBoundRectMisses));
+}
+
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -29,6 +29,7 @@
 #include <TextLayoutCache.hxx>
 #include <officecfg/Office/Common.hxx>
 #include <o3tl/string_view.hxx>
+#include <rtl/character.hxx>
 
 #include <unicode/ubidi.h>
 #include <unicode/uchar.h>
@@ -230,7 +231,11 @@ bool SalLayoutGlyphsImpl::IsValid() const
     return true;
 }
 
-void SalLayoutGlyphsCache::clear() { mCachedGlyphs.clear(); }
+void SalLayoutGlyphsCache::clear()
+{
+    mCachedGlyphs.clear();
+    maStatistics = Statistics();
+}
 
 SalLayoutGlyphsCache* SalLayoutGlyphsCache::self()
 {
@@ -304,6 +309,59 @@ static SalLayoutGlyphs makeGlyphsSubset(const SalLayoutGlyphs& source,
     return ret;
 }
 
+// HarfBuzz looks at no more than 5 code points before and after the shaped text
+// as context (HB_BUFFER_CONTEXT_LENGTH), 10 UTF-16 units always contain them.
+constexpr sal_Int32 nRunContextLength = 10;
+
+// Whether the range is laid out the same way in any string that has the same characters
+// around it as HarfBuzz context. This is the case for plain ASCII starting with a letter:
+// it's a single Latin script run, which doesn't depend on the text before it, and it can't
+// contain parts of grapheme clusters. Brackets are excluded, they take the script of their
+// pair, which may be anywhere in the string.
+static bool isContextIndependentRun(std::u16string_view text, sal_Int32 index, sal_Int32 len)
+{
+    if (!rtl::isAsciiAlpha(text[index]))
+        return false;
+    for (sal_Int32 i = index; i < index + len; ++i)
+    {
+        const sal_Unicode c = text[i];
+        if (c < 0x20 || c > 0x7e)
+            return false;
+        switch (c)
+        {
+            case '(':
+            case ')':
+            case '[':
+            case ']':
+            case '{':
+            case '}':
+            case '<':
+            case '>':
+                return false;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+// Copy of glyphs with the character positions moved by the given offset.
+static SalLayoutGlyphs makeGlyphsShifted(const SalLayoutGlyphs& source, sal_Int32 offset)
+{
+    SalLayoutGlyphs ret;
+    for (int level = 0;; ++level)
+    {
+        const SalLayoutGlyphsImpl* sourceLevel = source.Impl(level);
+        if (sourceLevel == nullptr)
+            break;
+        SalLayoutGlyphsImpl* shifted = sourceLevel->clone();
+        for (GlyphItem& rGlyph : *shifted)
+            rGlyph.adjustCharPos(offset);
+        ret.AppendImpl(shifted);
+    }
+    return ret;
+}
+
 #ifdef DBG_UTIL
 static void checkGlyphsEqual(const SalLayoutGlyphs& g1, const SalLayoutGlyphs& g2)
 {
@@ -332,7 +390,10 @@ const SalLayoutGlyphs* SalLayoutGlyphsCache::GetLayoutGlyphs(
     if (it != mCachedGlyphs.end())
     {
         if (it->second.IsValid())
+        {
+            ++maStatistics.nHits;
             return &it->second;
+        }
         // Do not try to create the layout here. If a cache item exists, it's already
         // been attempted and the layout was invalid (this happens with MultiSalLayout).
         // So in that case this is a cached failure.
@@ -350,7 +411,10 @@ const SalLayoutGlyphs* SalLayoutGlyphsCache::GetLayoutGlyphs(
         // Which means it's possible to get the glyphs faster by just copying
         // a subset of the full glyphs and adjusting as necessary.
         if (mLastTemporaryKey.has_value() && mLastTemporaryKey == key)
+        {
+            ++maStatistics.nSubsetHits;
             return &mLastTemporaryGlyphs;
+        }
         const CachedGlyphsKey keyWhole(outputDevice, text, 0, text.getLength(), nLogicWidth);
         GlyphsCache::const_iterator itWhole = mCachedGlyphs.find(keyWhole);
         if (itWhole == mCachedGlyphs.end())
@@ -411,6 +475,7 @@ const SalLayoutGlyphs* SalLayoutGlyphsCache::GetLayoutGlyphs(
                 = makeGlyphsSubset(itWhole->second, outputDevice, text, nIndex, nLen);
             if (mLastTemporaryGlyphs.IsValid())
             {
+                ++maStatistics.nSubsetHits;
                 mLastTemporaryKey = key;
 #ifdef DBG_UTIL
                 std::shared_ptr<const vcl::text::TextLayoutCache> tmpLayoutCache;
@@ -440,6 +505,65 @@ const SalLayoutGlyphs* SalLayoutGlyphsCache::GetLayoutGlyphs(
             mLastSubstringKey.reset();
     }
 
+    // Short runs like words or numbers repeat a lot in different strings. Lay them out
+    // only with the characters HarfBuzz uses as context and cache them keyed by those,
+    // so that they can be reused in any string. The glyphs just need their character
+    // positions moved to where the run is.
+    if ((nIndex != 0 || nLen != text.getLength()) && !skipGlyphSubsets && nLogicWidth == 0
+        && !(outputDevice->GetLayoutMode() & vcl::text::ComplexTextLayoutFlags::BiDiRtl)
+        && isContextIndependentRun(text, nIndex, nLen))
+    {
+        const sal_Int32 nRunStart = std::max<sal_Int32>(0, nIndex - nRunContextLength);
+        const sal_Int32 nRunEnd
+            = std::min<sal_Int32>(text.getLength(), nIndex + nLen + nRunContextLength);
+        const CachedGlyphsKey keyRun(outputDevice, text.copy(nRunStart, nRunEnd - nRunStart),
+                                     nIndex - nRunStart, nLen, 0);
+        GlyphsCache::const_iterator itRun = mCachedGlyphs.find(keyRun);
+        if (itRun == mCachedGlyphs.end())
+        {
+            ++maStatistics.nMisses;
+            std::shared_ptr<const vcl::text::TextLayoutCache> runLayoutCache
+                = vcl::text::TextLayoutCache::Create(keyRun.text);
+            std::unique_ptr<SalLayout> layout = outputDevice->ImplLayout(
+                keyRun.text, keyRun.index, nLen, Point(0, 0), 0, {}, {},
+                SalLayoutFlags::GlyphItemsOnly, runLayoutCache.get());
+            SalLayoutGlyphs glyphs;
+            if (layout)
+                glyphs = layout->GetGlyphs();
+            if (glyphs.IsValid() && !mbCacheGlyphsWhenDoingFallbackFonts
+                && glyphs.Impl(1) != nullptr)
+            {
+                mLastTemporaryGlyphs = makeGlyphsShifted(glyphs, nRunStart);
+                mLastTemporaryKey.reset();
+                return &mLastTemporaryGlyphs;
+            }
+            mCachedGlyphs.insert(std::make_pair(keyRun, std::move(glyphs)));
+            itRun = mCachedGlyphs.begin();
+        }
+        else
+            ++maStatistics.nRunHits;
+        if (!itRun->second.IsValid())
+            return nullptr;
+        mLastTemporaryGlyphs = makeGlyphsShifted(itRun->second, nRunStart);
+        mLastTemporaryKey = key;
+#ifdef DBG_UTIL
+        std::shared_ptr<const vcl::text::TextLayoutCache> tmpLayoutCache;
+        if (layoutCache == nullptr)
+        {
+            tmpLayoutCache = vcl::text::TextLayoutCache::Create(text);
+            layoutCache = tmpLayoutCache.get();
+        }
+        // Check that the run really is laid out the same way in the entire string.
+        std::unique_ptr<SalLayout> layout
+            = outputDevice->ImplLayout(text, nIndex, nLen, Point(0, 0), nLogicWidth, {}, {},
+                                       SalLayoutFlags::GlyphItemsOnly, layoutCache);
+        assert(layout);
+        checkGlyphsEqual(mLastTemporaryGlyphs, layout->GetGlyphs());
+#endif
+        return &mLastTemporaryGlyphs;
+    }
+
+    ++maStatistics.nMisses;
     std::shared_ptr<const vcl::text::TextLayoutCache> tmpLayoutCache;
     if (layoutCache == nullptr)
     {
@@ -602,6 +726,10 @@ void SalLayoutGlyphsCache::dumpState(rtl::OStringBuffer& rState)
 {
     rState.append("\nSalLayoutGlyphsCache:\t");
     rState.append(static_cast<sal_Int32>(mCachedGlyphs.size()));
+    rState.append("\n\tHits:\t" + OString::number(maStatistics.nHits));
+    rState.append("\n\tSubset hits:\t" + OString::number(maStatistics.nSubsetHits));
+    rState.append("\n\tRun hits:\t" + OString::number(maStatistics.nRunHits));
+    rState.append("\n\tMisses:\t" + OString::number(maStatistics.nMisses));
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
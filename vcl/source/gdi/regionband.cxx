@@ -27,6 +27,27 @@
 #include <osl/diagnose.h>
 #include <sal/log.hxx>
 
+namespace
+{
+// Apply rOperation to all bands lying completely inside of nTop and nBottom,
+// the same range as processed by the rectangle based Union/Exclude/XOr. This
+// allows to process all separations of a source band with one walk over the
+// band list instead of one walk for each separation
+template <typename Operation>
+void processBandRange(ImplRegionBand* pBand, tools::Long nTop, tools::Long nBottom,
+                      const Operation& rOperation)
+{
+    while (pBand && pBand->mnYTop < nTop)
+        pBand = pBand->mpNextBand;
+
+    while (pBand && pBand->mnYBottom <= nBottom)
+    {
+        rOperation(*pBand);
+        pBand = pBand->mpNextBand;
+    }
+}
+}
+
 RegionBand::RegionBand()
 :   mpFirstBand(nullptr),
     mpLastCheckedBand(nullptr)
@@ -962,13 +983,12 @@ void RegionBand::Union(const RegionBand& rSource)
         InsertBands(pBand->mnYTop, pBand->mnYBottom);
 
         // process all elements of the list
-        ImplRegionBandSep* pSep = pBand->mpFirstSep;
-
-        while(pSep)
-        {
-            Union(pSep->mnXLeft, pBand->mnYTop, pSep->mnXRight, pBand->mnYBottom);
-            pSep = pSep->mpNextSep;
-        }
+        processBandRange(mpFirstBand, pBand->mnYTop, pBand->mnYBottom,
+                         [pBand](ImplRegionBand& rTarget) {
+                             for (ImplRegionBandSep* pSep = pBand->mpFirstSep; pSep;
+                                  pSep = pSep->mpNextSep)
+                                 rTarget.Union(pSep->mnXLeft, pSep->mnXRight);
+                         });
 
         pBand = pBand->mpNextBand;
     }
@@ -1076,31 +1096,31 @@ void RegionBand::Intersect(const RegionBand& rSource)
         InsertBands( pBand->mnYTop, pBand->mnYBottom );
 
         // process all elements of the list
-        ImplRegionBandSep* pSep = pBand->mpFirstSep;
-
-        while ( pSep )
-        {
-            // left boundary?
-            if ( pSep == pBand->mpFirstSep )
-            {
-                // process intersection and do not remove untouched bands
-                Exclude( LONG_MIN+1, pBand->mnYTop, pSep->mnXLeft-1, pBand->mnYBottom );
-            }
-
-            // right boundary?
-            if ( pSep->mpNextSep == nullptr )
-            {
-                // process intersection and do not remove untouched bands
-                Exclude( pSep->mnXRight+1, pBand->mnYTop, LONG_MAX-1, pBand->mnYBottom );
-            }
-            else
-            {
-                // process intersection and do not remove untouched bands
-                Exclude( pSep->mnXRight+1, pBand->mnYTop, pSep->mpNextSep->mnXLeft-1, pBand->mnYBottom );
-            }
-
-            pSep = pSep->mpNextSep;
-        }
+        processBandRange(mpFirstBand, pBand->mnYTop, pBand->mnYBottom,
+                         [pBand](ImplRegionBand& rTarget) {
+                             for (ImplRegionBandSep* pSep = pBand->mpFirstSep; pSep;
+                                  pSep = pSep->mpNextSep)
+                             {
+                                 // left boundary?
+                                 if (pSep == pBand->mpFirstSep)
+                                 {
+                                     // process intersection and do not remove untouched bands
+                                     rTarget.Exclude(LONG_MIN + 1, pSep->mnXLeft - 1);
+                                 }
+
+                                 // right boundary?
+                                 if (pSep->mpNextSep == nullptr)
+                                 {
+                                     // process intersection and do not remove untouched bands
+                                     rTarget.Exclude(pSep->mnXRight + 1, LONG_MAX - 1);
+                                 }
+                                 else
+                                 {
+                                     // process intersection and do not remove untouched bands
+                                     rTarget.Exclude(pSep->mnXRight + 1, pSep->mpNextSep->mnXLeft - 1);
+                                 }
+                             }
+                         });
 
         pBand = pBand->mpNextBand;
     }
@@ -1149,13 +1169,12 @@ bool RegionBand::Exclude(const RegionBand& rSource)
         InsertBands( pBand->mnYTop, pBand->mnYBottom );
 
         // process all elements of the list
-        ImplRegionBandSep* pSep = pBand->mpFirstSep;
-
-        while ( pSep )
-        {
-            Exclude( pSep->mnXLeft, pBand->mnYTop, pSep->mnXRight, pBand->mnYBottom );
-            pSep = pSep->mpNextSep;
-        }
+        processBandRange(mpFirstBand, pBand->mnYTop, pBand->mnYBottom,
+                         [pBand](ImplRegionBand& rTarget) {
+                             for (ImplRegionBandSep* pSep = pBand->mpFirstSep; pSep;
+                                  pSep = pSep->mpNextSep)
+                                 rTarget.Exclude(pSep->mnXLeft, pSep->mnXRight);
+                         });
 
         // to test less bands, already check in the loop
         if ( !OptimizeBandList() )
@@ -1220,13 +1239,12 @@ void RegionBand::XOr(const RegionBand& rSource)
         InsertBands( pBand->mnYTop, pBand->mnYBottom );
 
         // process all elements of the list
-        ImplRegionBandSep* pSep = pBand->mpFirstSep;
-
-        while ( pSep )
-        {
-            XOr( pSep->mnXLeft, pBand->mnYTop, pSep->mnXRight, pBand->mnYBottom );
-            pSep = pSep->mpNextSep;
-        }
+        processBandRange(mpFirstBand, pBand->mnYTop, pBand->mnYBottom,
+                         [pBand](ImplRegionBand& rTarget) {
+                             for (ImplRegionBandSep* pSep = pBand->mpFirstSep; pSep;
+                                  pSep = pSep->mpNextSep)
+                                 rTarget.XOr(pSep->mnXLeft, pSep->mnXRight);
+                         });
 
         pBand = pBand->mpNextBand;
     }
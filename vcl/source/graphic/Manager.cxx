@@ -24,6 +24,9 @@
 #include <officecfg/Office/Common.hxx>
 #include <unotools/configmgr.hxx>
 
+#include <algorithm>
+#include <vector>
+
 using namespace css;
 
 namespace
@@ -121,11 +124,15 @@ void MemoryManager::changeExisting(MemoryManaged* pMemoryManaged, sal_Int64 nNew
 void MemoryManager::swappedIn(MemoryManaged* pMemoryManaged, sal_Int64 nNewSize)
 {
     changeExisting(pMemoryManaged, nNewSize);
+    std::scoped_lock aGuard(maMutex);
+    ++mnSwapInCount;
 }
 
 void MemoryManager::swappedOut(MemoryManaged* pMemoryManaged, sal_Int64 nNewSize)
 {
     changeExisting(pMemoryManaged, nNewSize);
+    std::scoped_lock aGuard(maMutex);
+    ++mnSwapOutCount;
 }
 
 OUString MemoryManager::getCacheName() const { return "MemoryManager"; }
@@ -145,7 +152,10 @@ void MemoryManager::dumpState(rtl::OStringBuffer& rState)
     rState.append(static_cast<sal_Int32>(maObjectList.size()));
     rState.append("\tsize:\t");
     rState.append(static_cast<sal_Int64>(mnTotalSize / 1024));
-    rState.append("\tkb");
+    rState.append("\tkb\tswapped out:\t");
+    rState.append(mnSwapOutCount);
+    rState.append("\tswapped in:\t");
+    rState.append(mnSwapInCount);
 
     for (MemoryManaged* pMemoryManaged : maObjectList)
     {
@@ -188,14 +198,15 @@ void MemoryManager::reduceMemory(std::unique_lock<std::mutex>& rGuard, bool bDro
 
 void MemoryManager::loopAndReduceMemory(std::unique_lock<std::mutex>& rGuard, bool bDropAll)
 {
-    // make a copy of m_pImpGraphicList because if we swap out a svg, the svg
+    // collect the candidates first because if we swap out a svg, the svg
     // filter may create more temp Graphics which are auto-added to
     // m_pImpGraphicList invalidating a loop over m_pImpGraphicList, e.g.
     // reexport of tdf118346-1.odg
 
-    o3tl::sorted_vector<MemoryManaged*> aObjectListCopy = maObjectList;
+    const auto aCurrent = std::chrono::high_resolution_clock::now();
 
-    for (MemoryManaged* pMemoryManaged : aObjectListCopy)
+    std::vector<std::pair<std::chrono::high_resolution_clock::time_point, MemoryManaged*>> aCandidates;
+    for (MemoryManaged* pMemoryManaged : maObjectList)
     {
         if (!pMemoryManaged->canReduceMemory())
             continue;
@@ -203,19 +214,34 @@ void MemoryManager::loopAndReduceMemory(std::unique_lock<std::mutex>& rGuard, bo
         sal_Int64 nCurrentSizeInBytes = pMemoryManaged->getCurrentSizeInBytes();
         if (nCurrentSizeInBytes > mnSmallFrySize || bDropAll) // ignore small-fry
         {
-            auto aCurrent = std::chrono::high_resolution_clock::now();
-            auto aDeltaTime = aCurrent - pMemoryManaged->getLastUsed();
-            auto aSeconds = std::chrono::duration_cast<std::chrono::seconds>(aDeltaTime);
+            auto aLastUsed = pMemoryManaged->getLastUsed();
+            auto aSeconds = std::chrono::duration_cast<std::chrono::seconds>(aCurrent - aLastUsed);
 
             if (aSeconds > mnAllowedIdleTime)
-            {
-                // unlock because svgio can call back into us
-                rGuard.unlock();
-                pMemoryManaged->reduceMemory();
-                rGuard.lock();
-            }
+                aCandidates.emplace_back(aLastUsed, pMemoryManaged);
         }
     }
+
+    // Least recently used first, and only as much as needed to get below the limit, so the
+    // graphics just painted stay loaded instead of being swapped out and in again.
+    std::stable_sort(aCandidates.begin(), aCandidates.end(),
+                     [](const auto& rA, const auto& rB) { return rA.first < rB.first; });
+
+    for (const auto& rCandidate : aCandidates)
+    {
+        if (!bDropAll && mnTotalSize < mnMemoryLimit)
+            break;
+
+        MemoryManaged* pMemoryManaged = rCandidate.second;
+        // may have been destroyed while the lock was released
+        if (maObjectList.find(pMemoryManaged) == maObjectList.end())
+            continue;
+
+        // unlock because svgio can call back into us
+        rGuard.unlock();
+        pMemoryManaged->reduceMemory();
+        rGuard.lock();
+    }
 }
 
 } // end vcl::graphic
@@ -8847,14 +8847,51 @@ bool PDFWriterImpl::writeBitmapObject( const BitmapEmit& rObject )
         {
             const int nScanLineBytes = pAccess->Width()*3;
             std::unique_ptr<sal_uInt8[]> xCol(new sal_uInt8[nScanLineBytes]);
+            // Offsets of red, green and blue for the formats that can be copied
+            // directly; premultiplied ones have to go through GetColorFromData().
+            int nPixelBytes = 0, nRed = 0, nGreen = 0, nBlue = 0;
+            switch (pAccess->GetScanlineFormat())
+            {
+                case ScanlineFormat::N24BitTcBgr:
+                    nPixelBytes = 3; nRed = 2; nGreen = 1; nBlue = 0;
+                    break;
+                case ScanlineFormat::N32BitTcXbgr:
+                    nPixelBytes = 4; nRed = 3; nGreen = 2; nBlue = 1;
+                    break;
+                case ScanlineFormat::N32BitTcXrgb:
+                    nPixelBytes = 4; nRed = 1; nGreen = 2; nBlue = 3;
+                    break;
+                case ScanlineFormat::N32BitTcBgrx:
+                    nPixelBytes = 4; nRed = 2; nGreen = 1; nBlue = 0;
+                    break;
+                case ScanlineFormat::N32BitTcRgbx:
+                    nPixelBytes = 4; nRed = 0; nGreen = 1; nBlue = 2;
+                    break;
+                default:
+                    break;
+            }
             for( tools::Long y = 0, nHeight = pAccess->Height(); y < nHeight; y++ )
             {
-                for( tools::Long x = 0, nWidth = pAccess->Width(); x < nWidth; x++ )
+                const sal_uInt8* pScanline = pAccess->GetScanline( y );
+                if (nPixelBytes)
                 {
-                    BitmapColor aColor = pAccess->GetColor( y, x );
-                    xCol[3*x+0] = aColor.GetRed();
-                    xCol[3*x+1] = aColor.GetGreen();
-                    xCol[3*x+2] = aColor.GetBlue();
+                    const sal_uInt8* pPixel = pScanline;
+                    for( tools::Long x = 0, nWidth = pAccess->Width(); x < nWidth; x++, pPixel += nPixelBytes )
+                    {
+                        xCol[3*x+0] = pPixel[nRed];
+                        xCol[3*x+1] = pPixel[nGreen];
+                        xCol[3*x+2] = pPixel[nBlue];
+                    }
+                }
+                else
+                {
+                    for( tools::Long x = 0, nWidth = pAccess->Width(); x < nWidth; x++ )
+                    {
+                        BitmapColor aColor = pAccess->GetColorFromData( pScanline, x );
+                        xCol[3*x+0] = aColor.GetRed();
+                        xCol[3*x+1] = aColor.GetGreen();
+                        xCol[3*x+2] = aColor.GetBlue();
+                    }
                 }
                 if (!writeBufferBytes(xCol.get(), nScanLineBytes))
                     return false;
@@ -9133,10 +9170,11 @@ const BitmapEmit& PDFWriterImpl::createBitmapEmit(const Bitmap& i_rBitmap, const
     BitmapID aID;
     aID.m_aPixelSize        = aBitmap.GetSizePixel();
     aID.m_nSize             = vcl::pixelFormatBitCount(ePixelFormat);
-    aID.m_nChecksum         = aBitmap.CreateColorBitmap().GetChecksum();
+    // The checksum of the bitmap itself covers the alpha channel too, and unlike
+    // the ones of separately created color and alpha bitmaps it is cached in the
+    // SalBitmap, so placing the same image again is cheap.
+    aID.m_nChecksum         = aBitmap.GetChecksum();
     aID.m_nMaskChecksum     = 0;
-    if( aBitmap.HasAlpha() )
-        aID.m_nMaskChecksum = aBitmap.CreateAlphaMask().GetChecksum();
     std::list<BitmapEmit>::const_iterator it = std::find_if(rBitmaps.begin(), rBitmaps.end(),
                                              [&](const BitmapEmit& arg) { return aID == arg.m_aID; });
     if (it == rBitmaps.end())
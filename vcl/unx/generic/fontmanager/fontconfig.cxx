@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 #include <o3tl/lru_map.hxx>
@@ -81,6 +82,53 @@ struct FontOptionsKey
     }
 };
 
+// everything PrintFontManager::Substitute looks at when searching a glyph
+// fallback font, the font size is deliberately not part of it
+struct GlyphFallbackKey
+{
+    OUString m_sTargetName;
+    OUString m_sSearchName;
+    OUString m_sMissingCodes;
+    LanguageType m_eLanguage;
+    FontFamily m_eFamilyType;
+    FontItalic m_eItalic;
+    FontWeight m_eWeight;
+    FontWidth m_eWidth;
+    FontPitch m_ePitch;
+    bool m_bEmbolden;
+    ItalicMatrix m_aItalicMatrix;
+
+    explicit GlyphFallbackKey(const vcl::font::FontSelectPattern& rPattern, const OUString& rMissingCodes)
+        : m_sTargetName(rPattern.maTargetName)
+        , m_sSearchName(rPattern.maSearchName)
+        , m_sMissingCodes(rMissingCodes)
+        , m_eLanguage(rPattern.meLanguage)
+        , m_eFamilyType(rPattern.GetFamilyType())
+        , m_eItalic(rPattern.GetItalic())
+        , m_eWeight(rPattern.GetWeight())
+        , m_eWidth(rPattern.GetWidthType())
+        , m_ePitch(rPattern.GetPitch())
+        , m_bEmbolden(rPattern.mbEmbolden)
+        , m_aItalicMatrix(rPattern.maItalicMatrix)
+    {
+    }
+
+    bool operator==(const GlyphFallbackKey& rOther) const
+    {
+        return m_sTargetName == rOther.m_sTargetName &&
+               m_sSearchName == rOther.m_sSearchName &&
+               m_sMissingCodes == rOther.m_sMissingCodes &&
+               m_eLanguage == rOther.m_eLanguage &&
+               m_eFamilyType == rOther.m_eFamilyType &&
+               m_eItalic == rOther.m_eItalic &&
+               m_eWeight == rOther.m_eWeight &&
+               m_eWidth == rOther.m_eWidth &&
+               m_ePitch == rOther.m_ePitch &&
+               m_bEmbolden == rOther.m_bEmbolden &&
+               m_aItalicMatrix == rOther.m_aItalicMatrix;
+    }
+};
+
 }
 
 namespace std
@@ -100,6 +148,20 @@ template <> struct hash<FontOptionsKey>
     }
 };
 
+template <> struct hash<GlyphFallbackKey>
+{
+    std::size_t operator()(const GlyphFallbackKey& k) const noexcept
+    {
+        std::size_t seed = k.m_sTargetName.hashCode();
+        o3tl::hash_combine(seed, k.m_sSearchName.hashCode());
+        o3tl::hash_combine(seed, k.m_sMissingCodes.hashCode());
+        o3tl::hash_combine(seed, static_cast<sal_uInt16>(k.m_eLanguage));
+        o3tl::hash_combine(seed, k.m_eItalic);
+        o3tl::hash_combine(seed, k.m_eWeight);
+        return seed;
+    }
+};
+
 } // end std namespace
 
 namespace
@@ -163,6 +225,102 @@ private:
     }
 };
 
+// result of a glyph fallback search, the attributes of the substituted
+// pattern together with the codes the substitute still lacks
+struct GlyphFallbackResult
+{
+    OUString m_sSearchName;
+    FontItalic m_eItalic;
+    FontWeight m_eWeight;
+    FontWidth m_eWidth;
+    FontPitch m_ePitch;
+    bool m_bEmbolden;
+    ItalicMatrix m_aItalicMatrix;
+    OUString m_sStillMissing;
+};
+
+// Process-wide cache of fontconfig glyph fallback searches. The per
+// LogicalFontInstance fallback cache is lost with each new font size, zoom
+// level or device, so without this each of those repeated the full
+// FcFontSetMatch for the same script runs
+class CachedFontConfigGlyphFallback : public CacheOwner
+{
+private:
+    o3tl::lru_map<GlyphFallbackKey, GlyphFallbackResult> lru_fallback_cache;
+    sal_uInt32 m_nHits;
+    sal_uInt32 m_nMisses;
+
+public:
+    CachedFontConfigGlyphFallback()
+        // the same fairly arbitrary limit as FcPreMatchSubstitution uses
+#if defined __cpp_lib_memory_resource
+        : lru_fallback_cache(256, &CacheOwner::GetMemoryResource())
+#else
+        : lru_fallback_cache(256)
+#endif
+        , m_nHits(0)
+        , m_nMisses(0)
+    {
+    }
+
+    bool lookup(const GlyphFallbackKey& rKey, vcl::font::FontSelectPattern& rPattern, OUString& rMissingCodes)
+    {
+        auto it = lru_fallback_cache.find(rKey);
+        if (it == lru_fallback_cache.end())
+        {
+            ++m_nMisses;
+            return false;
+        }
+        ++m_nHits;
+        const GlyphFallbackResult& rResult = it->second;
+        rPattern.maSearchName = rResult.m_sSearchName;
+        rPattern.SetItalic(rResult.m_eItalic);
+        rPattern.SetWeight(rResult.m_eWeight);
+        rPattern.SetWidthType(rResult.m_eWidth);
+        rPattern.SetPitch(rResult.m_ePitch);
+        rPattern.mbEmbolden = rResult.m_bEmbolden;
+        rPattern.maItalicMatrix = rResult.m_aItalicMatrix;
+        rMissingCodes = rResult.m_sStillMissing;
+        return true;
+    }
+
+    void cache(const GlyphFallbackKey& rKey, const vcl::font::FontSelectPattern& rPattern, const OUString& rStillMissing)
+    {
+        lru_fallback_cache.insert(std::make_pair(rKey,
+            GlyphFallbackResult{ rPattern.maSearchName, rPattern.GetItalic(), rPattern.GetWeight(),
+                                 rPattern.GetWidthType(), rPattern.GetPitch(), rPattern.mbEmbolden,
+                                 rPattern.maItalicMatrix, rStillMissing }));
+    }
+
+    // the results depend on the available fonts
+    void clear()
+    {
+        lru_fallback_cache.clear();
+    }
+
+private:
+    virtual OUString getCacheName() const override
+    {
+        return "CachedFontConfigGlyphFallback";
+    }
+
+    virtual bool dropCaches() override
+    {
+        lru_fallback_cache.clear();
+        return true;
+    }
+
+    virtual void dumpState(rtl::OStringBuffer& rState) override
+    {
+        rState.append("\nCachedFontConfigGlyphFallback:\t");
+        rState.append(static_cast<sal_Int32>(lru_fallback_cache.size()));
+        rState.append("\t hits: ");
+        rState.append(static_cast<sal_Int64>(m_nHits));
+        rState.append("\t misses: ");
+        rState.append(static_cast<sal_Int64>(m_nMisses));
+    }
+};
+
 typedef std::pair<FcChar8*, FcChar8*> lang_and_element;
 
 class FontCfgWrapper
@@ -196,6 +354,7 @@ public:
     std::unordered_map< OString, OString > m_aFontNameToLocalized;
     std::unordered_map< OString, OString > m_aLocalizedToCanonical;
     CachedFontConfigFontOptions m_aCachedFontOptions;
+    CachedFontConfigGlyphFallback m_aCachedGlyphFallbacks;
 private:
     void cacheLocalizedFontNames(const FcChar8 *origfontname, const FcChar8 *bestfontname, const std::vector< lang_and_element > &lang_and_elements);
 
@@ -222,6 +381,8 @@ void FontCfgWrapper::addFontSet( FcSetName eSetName )
     if( !pOrig )
         return;
 
+    m_aCachedGlyphFallbacks.clear();
+
     // filter the font sets to remove obsolete faces
     for( int i = 0; i < pOrig->nfont; ++i )
     {
@@ -371,6 +532,7 @@ void FontCfgWrapper::replaceFontSet(FcFontSet* pFilteredFontSet)
     if (m_pFontSet)
         FcFontSetDestroy(m_pFontSet);
     m_pFontSet = pFilteredFontSet;
+    m_aCachedGlyphFallbacks.clear();
 }
 
 FontCfgWrapper::~FontCfgWrapper()
@@ -516,6 +678,7 @@ void FontCfgWrapper::clear()
 {
     m_aFontNameToLocalized.clear();
     m_aLocalizedToCanonical.clear();
+    m_aCachedGlyphFallbacks.clear();
     if( m_pFontSet )
     {
         FcFontSetDestroy( m_pFontSet );
@@ -1037,6 +1200,21 @@ void PrintFontManager::Substitute(vcl::font::FontSelectPattern &rPattern, OUStri
 {
     FontCfgWrapper& rWrapper = FontCfgWrapper::get();
 
+    // glyph fallback for the same codes is searched again for every new size
+    // and device, so reuse earlier answers
+    std::optional<GlyphFallbackKey> oFallbackKey;
+    if (!rMissingCodes.isEmpty())
+    {
+        oFallbackKey.emplace(rPattern, rMissingCodes);
+        if (rWrapper.m_aCachedGlyphFallbacks.lookup(*oFallbackKey, rPattern, rMissingCodes))
+        {
+            SAL_INFO("vcl.fonts", "PrintFontManager::Substitute: cached glyph fallback for: '"
+                                      << rPattern.maTargetName << "' is '" << rPattern.maSearchName
+                                      << "'");
+            return;
+        }
+    }
+
     // build pattern argument for fontconfig query
     FcPattern* pPattern = FcPatternCreate();
 
@@ -1257,6 +1435,9 @@ void PrintFontManager::Substitute(vcl::font::FontSelectPattern &rPattern, OUStri
         FcFontSetDestroy( pSet );
     }
 
+    if (oFallbackKey)
+        rWrapper.m_aCachedGlyphFallbacks.cache(*oFallbackKey, rPattern, rMissingCodes);
+
     SAL_INFO("vcl.fonts", "PrintFontManager::Substitute: replacing missing font: '"
                               << rPattern.maTargetName << "' with '" << rPattern.maSearchName
                               << "'");
@@ -43,7 +43,7 @@ private:
 class FcGlyphFallbackSubstitution
 :    public vcl::font::GlyphFallbackFontSubstitution
 {
-    // TODO: add a cache
+    // the fontconfig results are cached process-wide in PrintFontManager::Substitute
 public:
     bool FindFontSubstitute(vcl::font::FontSelectPattern&, LogicalFontInstance* pLogicalFont, OUString& rMissingCodes) const override;
 };
@@ -183,10 +183,6 @@ bool FcGlyphFallbackSubstitution::FindFontSubstitute(vcl::font::FontSelectPatter
         return false;
 
     const vcl::font::FontSelectPattern aOut = GetFcSubstitute( rFontSelData, rMissingCodes );
-    // TODO: cache the unicode + srcfont specific result
-    // FC doing it would be preferable because it knows the invariables
-    // e.g. FC knows the FC rule that all Arial gets replaced by LiberationSans
-    // whereas we would have to check for every size or attribute
     if( aOut.maSearchName.isEmpty() )
         return false;
 
@@ -30,6 +30,7 @@
 #include <xmloff/xmlnamespace.hxx>
 #include <xmloff/xmlprmap.hxx>
 #include <xmloff/xmltoken.hxx>
+#include <xmloff/xmltypes.hxx>
 
 #include "impastpl.hxx"
 
@@ -240,44 +241,94 @@ XMLAutoStylePoolParent::~XMLAutoStylePoolParent()
 
 namespace {
 
-struct ComparePartial
+// Must be consistent with uno::Any equality for the BUILDIN_CMP types, which compares numbers of
+// different type classes by value.
+size_t lcl_HashValue( const uno::Any& rValue )
 {
-    const XMLAutoStyleFamily& rFamilyData;
-
-    bool operator()(const std::vector< XMLPropertyState >& lhs,
-                    const XMLAutoStylePoolProperties& rhs) const
+    switch (rValue.getValueTypeClass())
     {
-        return rFamilyData.mxMapper->LessPartial(lhs, rhs.GetProperties());
+        case uno::TypeClass_BOOLEAN:
+            return std::hash<bool>()(*o3tl::doAccess<bool>(rValue));
+        case uno::TypeClass_ENUM:
+            return std::hash<sal_Int32>()(*static_cast<const sal_Int32*>(rValue.getValue()));
+        case uno::TypeClass_STRING:
+            return o3tl::doAccess<OUString>(rValue)->hashCode();
+        case uno::TypeClass_HYPER:
+            return std::hash<double>()(static_cast<double>(*o3tl::doAccess<sal_Int64>(rValue)));
+        case uno::TypeClass_UNSIGNED_HYPER:
+            return std::hash<double>()(static_cast<double>(*o3tl::doAccess<sal_uInt64>(rValue)));
+        case uno::TypeClass_BYTE:
+        case uno::TypeClass_SHORT:
+        case uno::TypeClass_UNSIGNED_SHORT:
+        case uno::TypeClass_LONG:
+        case uno::TypeClass_UNSIGNED_LONG:
+        case uno::TypeClass_FLOAT:
+        case uno::TypeClass_DOUBLE:
+        {
+            double fValue = 0;
+            rValue >>= fValue;
+            return std::hash<double>()(fValue);
+        }
+        default:
+            return 0;
     }
-    bool operator()(const XMLAutoStylePoolProperties& lhs,
-                    const std::vector< XMLPropertyState >& rhs ) const
+}
+
+// Hashes what SvXMLExportPropertyMapper::LessPartial() compares: the property indexes and the
+// values of the simple types.  Values of complex types are compared by their handlers, so they
+// can't be part of the hash.
+size_t lcl_HashProperties( const XMLAutoStyleFamily& rFamilyData, const std::vector< XMLPropertyState >& rProperties )
+{
+    const rtl::Reference<XMLPropertySetMapper>& rMapper = rFamilyData.mxMapper->getPropertySetMapper();
+    size_t nHash = rProperties.size();
+    for (XMLPropertyState const & rState : rProperties)
     {
-        return rFamilyData.mxMapper->LessPartial(lhs.GetProperties(), rhs);
+        o3tl::hash_combine(nHash, rState.mnIndex);
+        if (rState.mnIndex != -1 && (rMapper->GetEntryType(rState.mnIndex) & XML_TYPE_BUILDIN_CMP) != 0)
+            o3tl::hash_combine(nHash, lcl_HashValue(rState.maValue));
     }
-};
+    return nHash;
+}
 
 }
 
+// Returns the index of the first added entry equal to rProperties, or m_PropertiesList.size()
+
+size_t XMLAutoStylePoolParent::FindIndex( const XMLAutoStyleFamily& rFamilyData, const std::vector< XMLPropertyState >& rProperties, size_t nHash ) const
+{
+    const SvXMLExportPropertyMapper& rMapper = *rFamilyData.mxMapper;
+    size_t nFound = m_PropertiesList.size();
+    auto [itBegin, itEnd] = m_PropertiesIndex.equal_range(nHash);
+    for (auto it = itBegin; it != itEnd; ++it)
+    {
+        if (it->second >= nFound)
+            continue;
+        const std::vector< XMLPropertyState >& rCandidate = m_PropertiesList[it->second].GetProperties();
+        // Equals() is only meaningful for lists that LessPartial() considers equivalent
+        if (!rMapper.LessPartial(rCandidate, rProperties) && !rMapper.LessPartial(rProperties, rCandidate)
+            && rMapper.Equals(rCandidate, rProperties))
+            nFound = it->second;
+    }
+    return nFound;
+}
+
 // Adds an array of XMLPropertyState ( std::vector< XMLPropertyState > ) to list
 // if not added, yet.
 
 bool XMLAutoStylePoolParent::Add( XMLAutoStyleFamily& rFamilyData, std::vector< XMLPropertyState >&& rProperties, OUString& rName, bool bDontSeek )
 {
-    PropertiesListType::iterator pProperties = m_PropertiesList.end();;
-    auto [itBegin, itEnd] = std::equal_range(m_PropertiesList.begin(), m_PropertiesList.end(), rProperties, ComparePartial{rFamilyData});
-    if (!bDontSeek)
-        for (auto it = itBegin; it != itEnd; ++it)
-            if (rFamilyData.mxMapper->Equals(it->GetProperties(), rProperties))
-                pProperties = it;
+    size_t nHash = lcl_HashProperties(rFamilyData, rProperties);
+    size_t nIndex = bDontSeek ? m_PropertiesList.size() : FindIndex(rFamilyData, rProperties, nHash);
 
     bool bAdded = false;
-    if( bDontSeek || pProperties == m_PropertiesList.end() )
+    if( nIndex == m_PropertiesList.size() )
     {
-        pProperties = m_PropertiesList.emplace(itBegin, rFamilyData, std::move(rProperties), msParent);
+        m_PropertiesList.emplace_back(rFamilyData, std::move(rProperties), msParent);
+        m_PropertiesIndex.emplace(nHash, nIndex);
         bAdded = true;
     }
 
-    rName = pProperties->GetName();
+    rName = m_PropertiesList[nIndex].GetName();
 
     return bAdded;
 }
@@ -292,12 +343,11 @@ bool XMLAutoStylePoolParent::AddNamed( XMLAutoStyleFamily& rFamilyData, std::vec
 {
     if (rFamilyData.maNameSet.find(rName) != rFamilyData.maNameSet.end())
         return false;
-    
-    auto it = std::lower_bound(m_PropertiesList.begin(), m_PropertiesList.end(), rProperties, ComparePartial{rFamilyData});
 
-    it = m_PropertiesList.emplace(it, rFamilyData, std::move(rProperties), msParent);
+    m_PropertiesIndex.emplace(lcl_HashProperties(rFamilyData, rProperties), m_PropertiesList.size());
+    XMLAutoStylePoolProperties& rNew = m_PropertiesList.emplace_back(rFamilyData, std::move(rProperties), msParent);
     // ignore the generated name
-    it->SetName( rName );
+    rNew.SetName( rName );
     return true;
 }
 
@@ -307,13 +357,10 @@ bool XMLAutoStylePoolParent::AddNamed( XMLAutoStyleFamily& rFamilyData, std::vec
 
 OUString XMLAutoStylePoolParent::Find( const XMLAutoStyleFamily& rFamilyData, const std::vector< XMLPropertyState >& rProperties ) const
 {
-    OUString sName;
-    auto [itBegin,itEnd] = std::equal_range(m_PropertiesList.begin(), m_PropertiesList.end(), rProperties, ComparePartial{rFamilyData});
-    for (auto it = itBegin; it != itEnd; ++it)
-        if (rFamilyData.mxMapper->Equals(it->GetProperties(), rProperties))
-            sName = it->GetName();
-
-    return sName;
+    size_t nIndex = FindIndex(rFamilyData, rProperties, lcl_HashProperties(rFamilyData, rProperties));
+    if (nIndex == m_PropertiesList.size())
+        return OUString();
+    return m_PropertiesList[nIndex].GetName();
 }
 
 bool XMLAutoStylePoolParent::operator< (const XMLAutoStylePoolParent& rOther) const
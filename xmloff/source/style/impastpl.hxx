@@ -23,6 +23,7 @@
 #include <rtl/ustring.hxx>
 #include <rtl/ref.hxx>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -61,7 +62,12 @@ public:
 
 private:
     OUString msParent;
+    /// in the order the styles were added
     PropertiesListType m_PropertiesList;
+    /// hash of the properties -> index into m_PropertiesList
+    std::unordered_multimap<size_t, size_t> m_PropertiesIndex;
+
+    size_t FindIndex( const XMLAutoStyleFamily& rFamilyData, const ::std::vector< XMLPropertyState >& rProperties, size_t nHash ) const;
 
 public:
 
@@ -157,13 +157,13 @@ uno::Sequence< ::sal_Int8 > SAL_CALL OCipherContext::convertWithCipherContext( c
 
     if (m_AESGCMIV.getLength())
     {
-        if (SAL_MAX_INT32 - nAESGCMIVSize - nAESGCMTagSize <= static_cast<size_t>(m_aLastBlock.getLength()) + static_cast<size_t>(aData.getLength()))
+        if (SAL_MAX_INT32 - nAESGCMIVSize - nAESGCMTagSize <= m_aAESGCMData.size() + static_cast<size_t>(aData.getLength()))
         {
             m_bBroken = true;
             throw uno::RuntimeException(u"overflow"_ustr);
         }
-        m_aLastBlock.realloc(m_aLastBlock.getLength() + aData.getLength());
-        memcpy(m_aLastBlock.getArray() + m_aLastBlock.getLength() - aData.getLength(), aData.getConstArray(), aData.getLength());
+        // grow geometrically, the stream arrives in many small chunks
+        m_aAESGCMData.insert(m_aAESGCMData.end(), aData.begin(), aData.end());
         return {};
     }
 
@@ -254,17 +254,17 @@ uno::Sequence< ::sal_Int8 > SAL_CALL OCipherContext::finalizeCipherContextAndDis
         unsigned outLen;
         if (m_bEncryption)
         {
-            assert(sal::static_int_cast<size_t>(m_aLastBlock.getLength()) <= SAL_MAX_INT32 - nAESGCMIVSize - nAESGCMTagSize);
+            assert(m_aAESGCMData.size() <= SAL_MAX_INT32 - nAESGCMIVSize - nAESGCMTagSize);
             // add space for IV and tag
-            aResult.realloc(m_aLastBlock.getLength() + nAESGCMIVSize + nAESGCMTagSize);
+            aResult.realloc(m_aAESGCMData.size() + nAESGCMIVSize + nAESGCMTagSize);
             // W3C xmlenc-core1 requires the IV preceding the ciphertext,
             // but NSS doesn't do it, so copy it manually
             memcpy(aResult.getArray(), m_AESGCMIV.getConstArray(), nAESGCMIVSize);
             if (PK11_Encrypt(m_pSymKey, CKM_AES_GCM, m_pSecParam,
                     reinterpret_cast<unsigned char*>(aResult.getArray() + nAESGCMIVSize),
                     &outLen, aResult.getLength() - nAESGCMIVSize,
-                    reinterpret_cast<unsigned char const*>(m_aLastBlock.getConstArray()),
-                    m_aLastBlock.getLength()) != SECSuccess)
+                    reinterpret_cast<unsigned char const*>(m_aAESGCMData.data()),
+                    m_aAESGCMData.size()) != SECSuccess)
             {
                 m_bBroken = true;
                 Dispose();
@@ -272,20 +272,20 @@ uno::Sequence< ::sal_Int8 > SAL_CALL OCipherContext::finalizeCipherContextAndDis
             }
             assert(outLen == sal::static_int_cast<unsigned>(aResult.getLength() - nAESGCMIVSize));
         }
-        else if (nAESGCMIVSize + nAESGCMTagSize < sal::static_int_cast<size_t>(m_aLastBlock.getLength()))
+        else if (nAESGCMIVSize + nAESGCMTagSize < m_aAESGCMData.size())
         {
-            if (0 != memcmp(m_AESGCMIV.getConstArray(), m_aLastBlock.getConstArray(), nAESGCMIVSize))
+            if (0 != memcmp(m_AESGCMIV.getConstArray(), m_aAESGCMData.data(), nAESGCMIVSize))
             {
                 m_bBroken = true;
                 Dispose();
                 throw uno::RuntimeException(u"inconsistent IV"_ustr);
             }
-            aResult.realloc(m_aLastBlock.getLength() - nAESGCMIVSize - nAESGCMTagSize);
+            aResult.realloc(m_aAESGCMData.size() - nAESGCMIVSize - nAESGCMTagSize);
             if (PK11_Decrypt(m_pSymKey, CKM_AES_GCM, m_pSecParam,
                     reinterpret_cast<unsigned char*>(aResult.getArray()),
                     &outLen, aResult.getLength(),
-                    reinterpret_cast<unsigned char const*>(m_aLastBlock.getConstArray() + nAESGCMIVSize),
-                    m_aLastBlock.getLength() - nAESGCMIVSize) != SECSuccess)
+                    reinterpret_cast<unsigned char const*>(m_aAESGCMData.data() + nAESGCMIVSize),
+                    m_aAESGCMData.size() - nAESGCMIVSize) != SECSuccess)
             {
                 m_bBroken = true;
                 Dispose();
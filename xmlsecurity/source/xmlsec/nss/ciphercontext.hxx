@@ -23,6 +23,7 @@
 
 #include <cppuhelper/implbase.hxx>
 #include <mutex>
+#include <vector>
 #include <seccomon.h>
 #include <secmodt.h>
 
@@ -39,6 +40,8 @@ private:
     sal_Int32 m_nBlockSize;
     css::uno::Sequence< sal_Int8 > m_aLastBlock;
     css::uno::Sequence<sal_Int8> m_AESGCMIV;
+    /// AES-GCM works on the whole stream at once, this collects it
+    std::vector<sal_Int8> m_aAESGCMData;
 
     bool m_bEncryption;
     bool m_bPadding;
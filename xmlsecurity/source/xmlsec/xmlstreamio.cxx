@@ -19,6 +19,8 @@
 
 #include <sal/config.h>
 
+#include <cstring>
+
 #include <xmlsec/io.h>
 
 /*
@@ -112,7 +114,7 @@ static int xmlStreamRead( void* context, char* buffer, int len )
 {
     int numbers ;
     css::uno::Reference< css::io::XInputStream > xInputStream ;
-    css::uno::Sequence< sal_Int8 > outSeqs( len ) ;
+    css::uno::Sequence< sal_Int8 > outSeqs ;
 
     numbers = 0 ;
     if (g_bInputCallbacksEnabled && g_bInputCallbacksRegistered)
@@ -122,10 +124,11 @@ static int xmlStreamRead( void* context, char* buffer, int len )
             if( !xInputStream.is() )
                 return 0 ;
 
+            // this is called for every chunk of every signed stream while
+            // digesting, so copy the chunk in one go
             numbers = xInputStream->readBytes( outSeqs, len ) ;
-            const sal_Int8* readBytes = outSeqs.getArray() ;
-            for( int i = 0 ; i < numbers ; i ++ )
-                *( buffer + i ) = *( readBytes + i ) ;
+            if( numbers > 0 )
+                memcpy( buffer, outSeqs.getConstArray(), numbers ) ;
         }
     }
 